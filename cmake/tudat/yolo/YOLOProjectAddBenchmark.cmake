@@ -0,0 +1,63 @@
+include(CMakeParseArguments)
+
+function("TUDAT_ADD_BENCHMARK" arg1)
+    # arg1 : Benchmark name. Will add source file ${CMAKE_CURRENT_SOURCE_DIR}/benchmark${arg1}.cpp
+    # PRIVATE_LINKS : Libraries to link to the benchmark.
+    # Benchmarks are built in ${PROJECT_BINARY_DIR}/benchmarks, and are not added as (c)tests or installed.
+    cmake_parse_arguments(
+            PARSED_ARGS
+            ""
+            ""
+            "SOURCES;PRIVATE_LINKS"
+            ${ARGN})
+
+    # Create target name.
+    get_filename_component(dirname ${CMAKE_CURRENT_SOURCE_DIR} NAME)
+    set(target_name "benchmark_${dirname}_${arg1}")
+
+    # Add executable.
+    add_executable(${target_name} ${CMAKE_CURRENT_SOURCE_DIR}/benchmark${arg1}.cpp ${PARSED_ARGS_SOURCES})
+
+    #==========================================================================
+    # TARGET-CONFIGURATION.
+    #==========================================================================
+    target_include_directories("${target_name}" PUBLIC
+            $<BUILD_INTERFACE:${PROJECT_BINARY_DIR}/include>
+            $<BUILD_INTERFACE:${PROJECT_SOURCE_DIR}/tests/include>
+            $<BUILD_INTERFACE:${PROJECT_SOURCE_DIR}/include>
+            )
+
+    target_include_directories("${target_name}"
+            SYSTEM PRIVATE
+            "${EIGEN3_INCLUDE_DIRS}"
+            "${Boost_INCLUDE_DIRS}"
+            "${CSpice_INCLUDE_DIRS}"
+            "${Sofa_INCLUDE_DIRS}"
+            "${TudatResources_INCLUDE_DIRS}"
+            )
+
+    target_link_libraries("${target_name}"
+            PUBLIC ${PARSED_ARGS_PRIVATE_LINKS}
+            PRIVATE "${Boost_LIBRARIES}"
+            )
+
+    #==========================================================================
+    # BUILD-TREE.
+    #==========================================================================
+    set_target_properties(${target_name}
+            PROPERTIES
+            LINKER_LANGUAGE CXX
+            RUNTIME_OUTPUT_DIRECTORY "${PROJECT_BINARY_DIR}/benchmarks"
+            )
+
+    # Let's setup the target C++ standard, but only if the user did not provide it manually.
+    if (NOT CMAKE_CXX_STANDARD)
+        set_property(TARGET ${target_name} PROPERTY CXX_STANDARD 17)
+    endif ()
+    set_property(TARGET ${target_name} PROPERTY CXX_STANDARD_REQUIRED YES)
+    set_property(TARGET ${target_name} PROPERTY CXX_EXTENSIONS NO)
+
+    # Clean up set variables.
+    unset(target_name)
+    unset(dirname)
+endfunction()
@@ -19,6 +19,7 @@
 #define TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -98,6 +99,8 @@ public:
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
      *  \param savePressureCoefficients Boolean denoting whether to save the pressure coefficients that are computed to files
+     *  \param numberOfThreads Number of threads over which the (independent) combinations of angle of attack and sideslip
+     *  are distributed when generating the coefficients.
      */
     HypersonicLocalInclinationAnalysis( const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
                                         const std::shared_ptr< SurfaceGeometry > inputVehicleSurface,
@@ -108,7 +111,8 @@ public:
                                         const double referenceArea,
                                         const double referenceLength,
                                         const Eigen::Vector3d& momentReferencePoint,
-                                        const bool savePressureCoefficients = false );
+                                        const bool savePressureCoefficients = false,
+                                        const int numberOfThreads = 1 );
 
     //! Default destructor.
     /*!
@@ -127,15 +131,6 @@ public:
      */
     Eigen::Vector6d getAerodynamicCoefficientsDataPoint( const boost::array< int, 3 > independentVariables );
 
-    //! Determine inclination angles of panels on a given part.
-    /*!
-     * Determines panel inclinations for all panels on all parts for given attitude.
-     * Outward pointing surface-normals are assumed!
-     * \param angleOfAttack Angle of attack at which to determine inclination angles.
-     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
-     */
-    void determineInclinations( const double angleOfAttack, const double angleOfSideslip );
-
     //! Get the number of vehicle parts.
     /*!
      *  Returns the number of vehicle parts.
@@ -217,18 +212,9 @@ public:
 
         isCoefficientGenerated_.resize( numberOfPointsPerIndependentVariables );
 
-        for( unsigned int i = 0; i < inclination_.size( ); i++ )
-        {
-            for( unsigned int j = 0; j < inclination_.at( i ).size( ); j++ )
-            {
-                inclination_.at( i ).at( j ).clear( );
-                pressureCoefficient_.at( i ).at( j ).clear( );
-            }
-            inclination_.at( i ).clear( );
-            pressureCoefficient_.at( i ).clear( );
-        }
-        inclination_.clear( );
-        pressureCoefficient_.clear( );
+        panelSurfaceNormals_.clear( );
+        panelCoefficientContributions_.clear( );
+        pressureCoefficientList_.clear( );
 
         for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
         {
@@ -236,7 +222,6 @@ public:
         }
         selectedMethods_.clear( );
 
-        previouslyComputedInclinations_.clear( );
         clearBaseData( );
     }
 
@@ -245,10 +230,21 @@ private:
     /*!
      * Generates aerodynamic database. Settings of geometry,
      * reference quantities, database point settings and analysis methods
-     * should have been set previously.
+     * should have been set previously. The combinations of angle of attack and sideslip are distributed over
+     * numberOfThreads_ threads.
      */
     void generateCoefficients( );
 
+    //! Generate aerodynamic coefficients for a list of attitudes, at all Mach numbers.
+    /*!
+     * Generates aerodynamic coefficients for a list of attitudes, at all Mach numbers, and sets the corresponding entries
+     * in the aerodynamicCoefficients_ array. The panel inclinations are computed once per attitude. This function only
+     * modifies the entries of the coefficient arrays for the given attitudes, and may be called concurrently for
+     * disjoint lists of attitudes.
+     * \param attitudeIndices List of indices of angle of attack (first) and angle of sideslip (second) points.
+     */
+    void generateCoefficientsForAttitudes( const std::vector< std::pair< int, int > >& attitudeIndices );
+
     //! Generate aerodynamic coefficients at a single set of independent variables.
     /*!
      * Generates aerodynamic coefficients at a single set of independent variables.
@@ -258,61 +254,74 @@ private:
      */
     void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
 
-    //! Determine aerodynamic coefficients for a single LaWGS part.
+    //! Set the panel properties of all parts in contiguous arrays.
     /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     * \return Force and moment coefficients for requested vehicle part.
+     * Sets the surface normals of all panels, and the contribution of each panel's pressure coefficient to the force and
+     * moment coefficients, in contiguous arrays (one per vehicle part). Panels are ordered by line, then by point.
      */
-    Eigen::Vector6d determinePartCoefficients( const int partNumber, const boost::array< int, 3 > independentVariableIndices );
+    void setFlattenedPanelProperties( );
 
-    //! Determine pressure coefficients on a given part.
+    //! Determine inclination angles of panels on all parts, stored in contiguous arrays.
     /*!
-     * Determines pressure coefficients on a single vehicle part.
-     * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     */
-    void determinePressureCoefficients( const int partNumber, const boost::array< int, 3 > independentVariableIndices );
-
-    //! Determine force coefficients of a part.
-    /*!
-     * Sums the pressure coefficients of given part and determines force coefficients from it by
-     * non-dimensionalization with reference area.
-     * \param partNumber Index from vehicleParts_ array for which determine coefficients.
-     * \return Force coefficients for requested vehicle part.
+     * Determine inclination angles of panels on all parts, stored in contiguous arrays.
+     * \param angleOfAttack Angle of attack at which to determine inclination angles.
+     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \param panelInclinations Panel inclination angles, one array per vehicle part (returned by reference).
      */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
+    void determinePanelInclinations( const double angleOfAttack,
+                                     const double angleOfSideslip,
+                                     std::vector< Eigen::ArrayXd >& panelInclinations ) const;
 
-    //! Determine moment coefficients of a part.
+    //! Determine pressure coefficients of panels on all parts, stored in contiguous arrays.
     /*!
-     * Determines the moment coefficients of a given part by summing the contributions of all
-     * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
-     * dimensionalization is performed by product of referenceLength and referenceArea.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \return Moment coefficients for requested vehicle part.
+     * Determine pressure coefficients of panels on all parts, using the compression method (for positive inclination) and
+     * expansion method (for non-positive inclination) selected for each part.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param panelInclinations Panel inclination angles, one array per vehicle part.
+     * \param panelPressureCoefficients Panel pressure coefficients, one array per vehicle part (returned by reference).
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    void determinePanelPressureCoefficients( const double machNumber,
+                                             const std::vector< Eigen::ArrayXd >& panelInclinations,
+                                             std::vector< Eigen::ArrayXd >& panelPressureCoefficients ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
-     * inclination > 0.
+     * Sets the values of panelPressureCoefficients for which inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param panelInclinations Panel inclination angles of part.
+     * \param panelPressureCoefficients Panel pressure coefficients of part (modified by reference).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures( const double machNumber,
+                                     const int partNumber,
+                                     const Eigen::ArrayXd& panelInclinations,
+                                     Eigen::ArrayXd& panelPressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
-     * which inclination <= 0.
+     * Sets the values of panelPressureCoefficients for which inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param panelInclinations Panel inclination angles of part.
+     * \param panelPressureCoefficients Panel pressure coefficients of part (modified by reference).
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    void updateExpansionPressures( const double machNumber,
+                                   const int partNumber,
+                                   const Eigen::ArrayXd& panelInclinations,
+                                   Eigen::ArrayXd& panelPressureCoefficients ) const;
+
+    //! Determine force and moment coefficients from panel pressure coefficients of all parts.
+    /*!
+     * Determine force and moment coefficients from panel pressure coefficients of all parts. Moment arms are taken
+     * from panel centroid to momentReferencePoint.
+     * \param panelPressureCoefficients Panel pressure coefficients, one array per vehicle part.
+     * \return Force and moment coefficients of vehicle.
+     */
+    Eigen::Vector6d calculateCoefficientsFromPressures( const std::vector< Eigen::ArrayXd >& panelPressureCoefficients ) const;
+
+    //! Save panel pressure coefficients for given independent variables (in part-line-point format) to pressureCoefficientList_.
+    void savePanelPressureCoefficients( const boost::array< int, 3 > independentVariableIndices,
+                                        const std::vector< Eigen::ArrayXd >& panelPressureCoefficients );
 
     //! Array of vehicle parts.
     /*!
@@ -327,34 +336,20 @@ private:
      */
     boost::multi_array< bool, 3 > isCoefficientGenerated_;
 
-    //! Three-dimensional array of panel inclination angles.
-    /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
-     */
-    std::vector< std::vector< std::vector< double > > > inclination_;
-
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
-    /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
-     */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > > previouslyComputedInclinations_;
+    //! Surface normals of panels, one matrix (with one column per panel) per vehicle part.
+    std::vector< Eigen::Matrix< double, 3, Eigen::Dynamic > > panelSurfaceNormals_;
 
-    //! Three-dimensional array of panel pressure coefficients.
+    //! Contribution of each panel's pressure coefficient to force and moment coefficients, one matrix per vehicle part.
     /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
+     * Contribution of each panel's pressure coefficient to force and moment coefficients, one matrix (with one column
+     * per panel) per vehicle part, already normalized by reference area (and length).
      */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > panelCoefficientContributions_;
 
     std::map< boost::array< int, 3 >, std::vector< std::vector< std::vector< double > > > > pressureCoefficientList_;
 
-    //! Stagnation pressure coefficient.
-    /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
-     */
-    double stagnationPressureCoefficient;
+    //! Mutex for saving pressure coefficients from multiple threads.
+    std::mutex pressureCoefficientListMutex_;
 
     //! Ratio of specific heats.
     /*!
@@ -369,6 +364,9 @@ private:
      */
     std::vector< std::vector< int > > selectedMethods_;
 
+    //! Number of threads used to generate the coefficients.
+    int numberOfThreads_;
+
     bool savePressureCoefficients_;
 };
 
@@ -20,6 +20,7 @@
 #include "tudat/astro/gravitation/ringGravityModel.h"
 #include "tudat/astro/gravitation/polyhedronGravityModel.h"
 #include "tudat/astro/gravitation/directTidalDissipationAcceleration.h"
+#include "tudat/astro/gravitation/mutualPointMassGravityModel.h"
 #include "tudat/astro/aerodynamics/aerodynamicAcceleration.h"
 #include "tudat/astro/basic_astro/massRateModel.h"
 #include "tudat/astro/propulsion/thrustAccelerationModel.h"
@@ -69,7 +70,8 @@ enum AvailableAcceleration {
     custom_acceleration = 20,
     einstein_infeld_hoffmann_acceleration,
     yarkovsky_acceleration,
-    rtg_acceleration
+    rtg_acceleration,
+    mutual_point_mass_gravity
 };
 
 // Function to get a string representing a 'named identification' of an acceleration type
@@ -9,6 +9,7 @@
 
 #include "tudat/math/interpolators/multiDimensionalInterpolator.h"
 #include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/io/timeIndexedGridFile.h"
 
 namespace tudat
 {
@@ -91,6 +92,57 @@ private:
     double referenceIonosphereHeight_;
 };
 
+//! Class defining a VTEC model using TEC maps from a (memory-mapped) binary time-indexed grid file.
+/*!
+ *  Class defining a VTEC model using TEC maps from a binary time-indexed grid file (e.g. as created from IONEX files by
+ *  input_output::convertIonexFilesToTimeIndexedGridFile). The TEC is interpolated bilinearly in latitude and longitude, and
+ *  linearly in time, using only the two TEC maps that bracket the requested time. Values outside the tabulated range are
+ *  taken at the boundary of the range.
+ */
+class TimeIndexedGridIonosphereModel : public IonosphereModel
+{
+public:
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param gridFile Grid file containing TEC maps (in TECU), on a grid of epochs [s since J2000], latitudes [deg] and
+     *  longitudes [deg]
+     *  \param tecFieldIndex Index of the field in the grid file containing the TEC
+     */
+    TimeIndexedGridIonosphereModel( const std::shared_ptr< input_output::TimeIndexedGridFile >& gridFile, const int tecFieldIndex = 0 ):
+        gridFile_( gridFile ), tecFieldIndex_( tecFieldIndex )
+    {
+        if( tecFieldIndex_ < 0 || tecFieldIndex_ >= gridFile_->getNumberOfFields( ) )
+        {
+            throw std::runtime_error( "Error when creating grid-file ionosphere model, TEC field index is invalid." );
+        }
+    }
+
+    //! Get vertical TEC at given lat [deg], lon [deg], and time [s since J2000]
+    double getVerticalTotalElectronContent( const double latitude, const double longitude, const double time ) override
+    {
+        return gridFile_->interpolateField( tecFieldIndex_, time, latitude, longitude );
+    }
+
+    double getReferenceIonosphereHeight( ) const override
+    {
+        return gridFile_->getReferenceHeight( );
+    }
+
+    //! Function to retrieve the grid file from which the TEC is interpolated
+    std::shared_ptr< input_output::TimeIndexedGridFile > getGridFile( ) const
+    {
+        return gridFile_;
+    }
+
+private:
+    //! Grid file from which the TEC is interpolated
+    std::shared_ptr< input_output::TimeIndexedGridFile > gridFile_;
+
+    //! Index of the field in the grid file containing the TEC
+    int tecFieldIndex_;
+};
+
 }  // namespace environment
 }  // namespace tudat
 
@@ -21,6 +21,7 @@
 #include <Eigen/Eigenvalues>
 
 #include <iostream>
+#include <utility>
 
 namespace tudat
 {
@@ -112,6 +113,37 @@ Eigen::Matrix3d computePolyhedronInertiaTensor( const Eigen::MatrixXd& verticesC
                                                 const double gravitationalParameter,
                                                 const double gravitationalConstant );
 
+/*! Computes the radius of the Brillouin sphere of a polyhedron.
+ *
+ * Computes the radius of the Brillouin sphere of a polyhedron, i.e. the smallest sphere centered at the origin of the frame
+ * in which the vertices are defined that encloses the polyhedron. The exterior spherical harmonic expansion of the gravity
+ * field of the polyhedron converges outside of this sphere.
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @return Radius of Brillouin sphere.
+ */
+double computePolyhedronBrillouinSphereRadius( const Eigen::MatrixXd& verticesCoordinates );
+
+/*! Computes the spherical harmonic coefficients of the exterior gravity field of a constant-density polyhedron.
+ *
+ * Computes the (geodesy-normalized) spherical harmonic coefficients of the exterior gravity field of a constant-density
+ * polyhedron, expanded about the origin of the frame in which the vertices are defined. The volume integrals of the solid
+ * harmonics are computed per facet, over the cone spanned by the origin and the facet. Since the solid harmonics of degree n
+ * are homogeneous polynomials, each cone integral reduces to a surface integral over the facet, which is evaluated exactly
+ * using a (collapsed) Gauss-Legendre quadrature rule on the triangle.
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @param maximumDegree Maximum degree (and order) of the expansion.
+ * @param referenceRadius Reference radius of the expansion (typically radius of the Brillouin sphere).
+ * @return Pair with cosine and sine coefficients (entry (n,m) denoting degree n and order m).
+ */
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > computePolyhedronSphericalHarmonicCoefficients(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int maximumDegree,
+        const double referenceRadius );
+
 }  // namespace basic_astrodynamics
 }  // namespace tudat
 
@@ -391,6 +391,11 @@ private:
     std::vector< double > savedPanelIrradiances_;
 
     std::vector< Eigen::Vector7d > savedPanelGeometries_;
+
+    // Irradiances and directions (in target frame) of visible source panels, passed to target model in a single call
+    std::vector< double > visibleSourcePanelIrradiances_;
+
+    std::vector< Eigen::Vector3d > visibleSourcePanelDirections_;
 };
 
 }  // namespace electromagnetism
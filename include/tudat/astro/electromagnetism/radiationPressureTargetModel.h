@@ -61,6 +61,25 @@ public:
                                                  const bool resetForces,
                                                  const std::string sourceName = "" ) = 0;
 
+    /*!
+     * Calculate radiation pressure force from multiple incident radiation sources (e.g. the panels of a paneled source),
+     * adding the contributions of all sources to the current force (and torque) for the given source name. Forces are not
+     * reset by this function.
+     *
+     * @param sourceIrradiances Incident irradiance magnitudes, one per (sub-)source [W/m²]
+     * @param sourceToTargetDirections Directions of incoming radiation, one per (sub-)source
+     * @param sourceName Name of source body for which forces are stored
+     */
+    virtual void updateRadiationPressureForcingFromMultipleSources( const std::vector< double >& sourceIrradiances,
+                                                                    const std::vector< Eigen::Vector3d >& sourceToTargetDirections,
+                                                                    const std::string sourceName = "" )
+    {
+        for( unsigned int i = 0; i < sourceIrradiances.size( ); i++ )
+        {
+            updateRadiationPressureForcing( sourceIrradiances.at( i ), sourceToTargetDirections.at( i ), false, sourceName );
+        }
+    }
+
     std::map< std::string, std::vector< std::string > > getSourceToTargetOccultingBodies( ) const
     {
         return sourceToTargetOccultingBodies_;
@@ -282,6 +301,18 @@ public:
         }
 
         unityIlluminationFraction_ = std::vector< double >( totalNumberOfPanels_, 1.0 );
+
+        panelNormalsStore_.resize( 3, totalNumberOfPanels_ );
+        panelMomentArmsStore_.resize( 3, totalNumberOfPanels_ );
+        panelForcesStore_.resize( 3, totalNumberOfPanels_ );
+        panelAreasStore_.resize( totalNumberOfPanels_ );
+        panelAbsorptivitiesStore_.resize( totalNumberOfPanels_ );
+        panelSpecularReflectivitiesStore_.resize( totalNumberOfPanels_ );
+        panelDiffuseReflectivitiesStore_.resize( totalNumberOfPanels_ );
+        panelCosinesStore_.resize( totalNumberOfPanels_ );
+        panelIlluminationStore_.resize( totalNumberOfPanels_ );
+        panelReflectionLaws_.resize( totalNumberOfPanels_ );
+        panelSpecularDiffuseReflectionLaws_.resize( totalNumberOfPanels_ );
     }
 
     void enableTorqueComputation( const std::function< Eigen::Vector3d( ) > centerOfMassFunction ) override
@@ -307,6 +338,10 @@ public:
                                          const bool resetForces,
                                          const std::string sourceName = "" ) override;
 
+    void updateRadiationPressureForcingFromMultipleSources( const std::vector< double >& sourceIrradiances,
+                                                            const std::vector< Eigen::Vector3d >& sourceToTargetDirectionsLocalFrame,
+                                                            const std::string sourceName = "" ) override;
+
     Eigen::Vector3d evaluateRadiationPressureForcePartialWrtDiffuseReflectivity( double sourceIrradiance,
                                                                                  const Eigen::Vector3d& sourceToTargetDirectionLocalFrame );
 
@@ -386,9 +421,50 @@ public:
         return totalNumberOfPanels_;
     }
 
+    //! Function to check whether the batched (flattened panel store) kernel is used for the current panel reflection laws
+    bool isBatchedReflectionKernelUsed( )
+    {
+        updatePanelReflectionLaws( );
+        return useBatchedReflectionKernel_;
+    }
+
 private:
     void updateMembers_( double currentTime ) override;
 
+    /*!
+     * Function to (re)retrieve the reflection laws of all panels, and determine whether the batched kernel can be used. The
+     * batched kernel is used if all panels have a SpecularDiffuseMixReflectionLaw with identical instantaneous reradiation
+     * setting. Casts are only redone for panels of which the reflection law object has been changed.
+     */
+    void updatePanelReflectionLaws( );
+
+    /*!
+     * Function to fill the flattened panel store (normals, areas, optical coefficients and, if required, moment arms) from
+     * the current panel properties. Called once per evaluation, so that all sources evaluated in a single call use the
+     * same store.
+     */
+    void updatePanelStore( );
+
+    /*!
+     * Function to compute the radiation pressure force (and torque) of all panels due to a single source, using the
+     * original per-panel evaluation of the reflection law.
+     */
+    void computePanelForcesPerPanel( const double radiationPressure,
+                                     const Eigen::Vector3d& sourceToTargetDirectionLocalFrame,
+                                     const Eigen::Vector3d& currentCenterOfMass,
+                                     const std::string& sourceName );
+
+    /*!
+     * Function to compute the radiation pressure force (and torque) of all panels due to a single source, using the
+     * flattened panel store. Requires updatePanelStore to have been called.
+     */
+    void computePanelForcesBatched( const double radiationPressure,
+                                    const Eigen::Vector3d& sourceToTargetDirectionLocalFrame,
+                                    const std::string& sourceName );
+
+    //! Function to retrieve the illuminated panel fractions (including self-shadowing, if any) for given source direction
+    void updateIlluminatedPanelFractions( const Eigen::Vector3d& sourceToTargetDirectionLocalFrame, const std::string& sourceName );
+
     void resetDerivedComputations( const std::string sourceName ) override
     {
         for( unsigned int i = 0; i < panelForces_.size( ); i++ )
@@ -450,6 +526,24 @@ private:
     std::vector< double > unityIlluminationFraction_;
     const std::vector< std::shared_ptr< system_models::VehicleExteriorPanel > >& allPanels_;
     bool panelGeometryDefined_;
+
+    // Flattened (structure-of-arrays) panel store, used by batched kernel
+    Eigen::Matrix< double, 3, Eigen::Dynamic > panelNormalsStore_;
+    Eigen::Matrix< double, 3, Eigen::Dynamic > panelMomentArmsStore_;
+    Eigen::Matrix< double, 3, Eigen::Dynamic > panelForcesStore_;
+    Eigen::ArrayXd panelAreasStore_;
+    Eigen::ArrayXd panelAbsorptivitiesStore_;
+    Eigen::ArrayXd panelSpecularReflectivitiesStore_;
+    Eigen::ArrayXd panelDiffuseReflectivitiesStore_;
+    Eigen::ArrayXd panelCosinesStore_;
+    Eigen::ArrayXd panelIlluminationStore_;
+
+    // Reflection laws of panels, as last retrieved by updatePanelReflectionLaws
+    std::vector< std::shared_ptr< ReflectionLaw > > panelReflectionLaws_;
+    std::vector< std::shared_ptr< SpecularDiffuseMixReflectionLaw > > panelSpecularDiffuseReflectionLaws_;
+
+    bool useBatchedReflectionKernel_ = false;
+    bool batchedKernelWithInstantaneousReradiation_ = false;
 };
 
 }  // namespace electromagnetism
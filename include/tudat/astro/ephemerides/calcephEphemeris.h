@@ -18,9 +18,12 @@
 #ifdef TUDAT_BUILD_WITH_CALCEPH
 
 #include <string>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <vector>
 
 #include <Eigen/Core>
 
@@ -50,6 +53,14 @@ namespace ephemerides
  *   1. Create a CalcephEphemeris for each SPK file
  *   2. Query states using getCartesianState()
  *   3. The file handle is automatically closed on destruction
+ *
+ * The ephemeris can be evaluated concurrently from multiple threads. If CALCEPH reports that
+ * the (prefetched) file handle is thread-safe, it is shared by all threads without locking.
+ * Otherwise, each evaluation borrows a handle from a pool for the duration of the CALCEPH call.
+ * A new handle is only opened if all existing ones are in use, up to a maximum number of
+ * handles; beyond that, evaluations wait for a handle to be returned to the pool. The number
+ * of open handles is therefore bounded by the peak number of concurrent evaluations, and does
+ * not depend on how many (short-lived) threads have evaluated the ephemeris.
  */
 class CalcephEphemeris : public Ephemeris
 {
@@ -61,13 +72,16 @@ public:
      * \param observerNaifId NAIF ID of the observer/center body (e.g., 10 for Sun)
      * \param referenceFrameOrigin Name of the reference frame origin (for Tudat compatibility)
      * \param referenceFrameOrientation Name of the reference frame (for Tudat compatibility)
+     * \param maximumNumberOfHandles Maximum number of file handles opened for concurrent evaluations, if the handle is not
+     * thread-safe (if 0, the number of hardware threads is used)
      */
     CalcephEphemeris(
         const std::string& spkFilePath,
         int targetNaifId,
         int observerNaifId,
         const std::string& referenceFrameOrigin = "SSB",
-        const std::string& referenceFrameOrientation = "J2000" );
+        const std::string& referenceFrameOrientation = "J2000",
+        const int maximumNumberOfHandles = 0 );
 
     //! Destructor - closes the ephemeris file handle.
     ~CalcephEphemeris( );
@@ -89,6 +103,15 @@ public:
     //! Check if the ephemeris file was loaded successfully.
     bool isLoaded( ) const { return ephemerisHandle_ != nullptr; }
 
+    //! Check if a single file handle is shared by all threads (otherwise, handles are taken from a pool).
+    bool isHandleThreadSafe( ) const { return isHandleThreadSafe_; }
+
+    //! Get the number of file handles that are currently open (at most maximumNumberOfHandles_).
+    int getNumberOfOpenHandles( ) const;
+
+    //! Get the maximum number of file handles that are opened for concurrent evaluations.
+    int getMaximumNumberOfHandles( ) const { return maximumNumberOfHandles_; }
+
     //! Get the target NAIF ID.
     int getTargetNaifId( ) const { return targetNaifId_; }
 
@@ -96,9 +119,33 @@ public:
     int getObserverNaifId( ) const { return observerNaifId_; }
 
 private:
-    //! CALCEPH ephemeris handle
+    //! Open and prefetch a new handle to the ephemeris file (nullptr if file could not be opened)
+    t_calcephbin* openHandle( ) const;
+
+    //! Take a handle from the pool, opening a new one or waiting for one to be released if none is available
+    t_calcephbin* acquireHandle( );
+
+    //! Return a handle obtained from acquireHandle to the pool
+    void releaseHandle( t_calcephbin* handle );
+
+    //! Path to the ephemeris file
+    std::string spkFilePath_;
+
+    //! CALCEPH ephemeris handle (used by all threads if isHandleThreadSafe_ is true)
     t_calcephbin* ephemerisHandle_;
 
+    //! Boolean denoting whether ephemerisHandle_ can be used concurrently by multiple threads
+    bool isHandleThreadSafe_;
+
+    //! Handles that are open, but not in use by any evaluation (used if isHandleThreadSafe_ is false)
+    std::vector< t_calcephbin* > availableHandles_;
+
+    //! Number of handles that are open (including those in use), including ephemerisHandle_
+    int numberOfOpenHandles_;
+
+    //! Maximum number of handles that are opened for concurrent evaluations
+    int maximumNumberOfHandles_;
+
     //! Target body NAIF ID
     int targetNaifId_;
 
@@ -109,14 +156,19 @@ private:
     double startEpoch_;
     double endEpoch_;
 
-    //! Mutex for thread safety (CALCEPH file access)
-    mutable std::mutex mutex_;
+    //! Mutex for access to availableHandles_ and numberOfOpenHandles_
+    mutable std::mutex handleMutex_;
+
+    //! Condition variable signalled when a handle is returned to the pool
+    std::condition_variable handleReleasedCondition_;
 };
 
 //! Global manager for CALCEPH-based ephemeris files.
 /*!
  * This singleton class manages multiple SPK files loaded via CALCEPH,
- * providing a unified interface for querying body states.
+ * providing a unified interface for querying body states. States can be
+ * queried concurrently from multiple threads; loading and clearing files
+ * blocks until ongoing lookups have finished.
  */
 class CalcephEphemerisManager
 {
@@ -212,8 +264,8 @@ private:
     //! Loaded ephemeris objects
     std::map<std::string, std::shared_ptr<CalcephEphemeris>> ephemerides_;
 
-    //! Mutex for thread safety
-    mutable std::mutex mutex_;
+    //! Mutex for thread safety (shared for lookups, exclusive for loading/clearing files)
+    mutable std::shared_mutex mutex_;
 };
 
 }  // namespace ephemerides
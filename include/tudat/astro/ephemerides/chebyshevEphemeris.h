@@ -0,0 +1,176 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tudat/astro/ephemerides/ephemeris.h"
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that determines an ephemeris from piecewise Chebyshev polynomials of the position.
+/*!
+ *  Class that determines an ephemeris from piecewise Chebyshev polynomials of the Cartesian position, defined on a set of
+ *  equal-length segments (similar to the representation used in JPL DE and SPICE type 2 kernels). The segment in which a
+ *  given time lies is found directly from its index, and the polynomials are evaluated using the Clenshaw recurrence. The
+ *  velocity is obtained from the derivative of the position series. Only the position coefficients are stored, so that the
+ *  memory use is typically much lower than that of a tabulated ephemeris of similar accuracy. Objects of this class are
+ *  typically created using the createChebyshevEphemeris or readChebyshevEphemerisFile functions.
+ */
+class ChebyshevEphemeris : public Ephemeris
+{
+public:
+    using Ephemeris::getCartesianState;
+
+    //! Constructor, sets the segment definition and Chebyshev coefficients.
+    /*!
+     *  Constructor, sets the segment definition and Chebyshev coefficients.
+     *  \param startTime Start time of the first segment.
+     *  \param segmentLength Length (in time) of each segment.
+     *  \param polynomialDegree Degree of the Chebyshev polynomials.
+     *  \param coefficients Chebyshev coefficients, in the order [segment][position component][degree], so that the size must be
+     *  (number of segments) x 3 x (polynomial degree + 1).
+     *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+     *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+     */
+    ChebyshevEphemeris( const double startTime,
+                        const double segmentLength,
+                        const int polynomialDegree,
+                        const std::vector< double >& coefficients,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Destructor
+    ~ChebyshevEphemeris( ) { }
+
+    //! Get cartesian state from ephemeris.
+    /*!
+     *  Returns cartesian state from ephemeris, by evaluating the Chebyshev series of the segment in which the time lies.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return State given by combined position and velocity.
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Function to retrieve the start time of the first segment.
+    double getStartTime( ) const
+    {
+        return startTime_;
+    }
+
+    //! Function to retrieve the end time of the last segment.
+    double getEndTime( ) const
+    {
+        return startTime_ + numberOfSegments_ * segmentLength_;
+    }
+
+    //! Function to retrieve the length (in time) of each segment.
+    double getSegmentLength( ) const
+    {
+        return segmentLength_;
+    }
+
+    //! Function to retrieve the degree of the Chebyshev polynomials.
+    int getPolynomialDegree( ) const
+    {
+        return polynomialDegree_;
+    }
+
+    //! Function to retrieve the number of segments.
+    int getNumberOfSegments( ) const
+    {
+        return numberOfSegments_;
+    }
+
+    //! Function to retrieve the Chebyshev coefficients, in the order [segment][position component][degree].
+    const std::vector< double >& getCoefficients( ) const
+    {
+        return coefficients_;
+    }
+
+private:
+    //! Start time of the first segment.
+    double startTime_;
+
+    //! Length (in time) of each segment.
+    double segmentLength_;
+
+    //! Degree of the Chebyshev polynomials.
+    int polynomialDegree_;
+
+    //! Number of segments.
+    int numberOfSegments_;
+
+    //! Chebyshev coefficients, in the order [segment][position component][degree].
+    std::vector< double > coefficients_;
+};
+
+//! Function to create a Chebyshev ephemeris by fitting a state function.
+/*!
+ *  Function to create a Chebyshev ephemeris by interpolating the position given by a state function (e.g. from a SPICE,
+ *  CALCEPH or tabulated ephemeris) at the Chebyshev nodes of each segment. The number of segments is doubled, starting from
+ *  the number required for the maximum segment length, until the position (and optionally velocity) error at test points in
+ *  between the nodes is below the tolerance for all segments.
+ *  \param stateFunction Function returning the Cartesian state that is to be fitted, as a function of time.
+ *  \param startTime Start time of the ephemeris.
+ *  \param endTime End time of the ephemeris.
+ *  \param polynomialDegree Degree of the Chebyshev polynomials.
+ *  \param positionTolerance Maximum position error of the fit at the test points.
+ *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+ *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+ *  \param maximumSegmentLength Maximum length of a segment (no maximum if NaN).
+ *  \param velocityTolerance Maximum velocity error of the fit at the test points (not checked if NaN).
+ *  \param maximumNumberOfSegments Maximum number of segments, an exception is thrown if the tolerance is not met with this
+ *  number of segments.
+ *  \return Chebyshev ephemeris fitted to the state function.
+ */
+std::shared_ptr< ChebyshevEphemeris > createChebyshevEphemeris( const std::function< Eigen::Vector6d( const double ) > stateFunction,
+                                                                const double startTime,
+                                                                const double endTime,
+                                                                const int polynomialDegree,
+                                                                const double positionTolerance,
+                                                                const std::string& referenceFrameOrigin = "SSB",
+                                                                const std::string& referenceFrameOrientation = "ECLIPJ2000",
+                                                                const double maximumSegmentLength = TUDAT_NAN,
+                                                                const double velocityTolerance = TUDAT_NAN,
+                                                                const int maximumNumberOfSegments = 1048576 );
+
+//! Function to write the coefficients of a Chebyshev ephemeris to a binary file.
+/*!
+ *  Function to write the segment definition, frame definition and coefficients of a Chebyshev ephemeris to a binary file (in
+ *  native byte order), from which it can be recreated using readChebyshevEphemerisFile.
+ *  \param ephemeris Ephemeris that is to be written.
+ *  \param fileName Name of the file to which the ephemeris is to be written.
+ */
+void writeChebyshevEphemerisFile( const std::shared_ptr< ChebyshevEphemeris > ephemeris, const std::string& fileName );
+
+//! Function to create a Chebyshev ephemeris from a binary file.
+/*!
+ *  Function to create a Chebyshev ephemeris from a binary file written by writeChebyshevEphemerisFile.
+ *  \param fileName Name of the file from which the ephemeris is to be read.
+ *  \return Chebyshev ephemeris read from the file.
+ */
+std::shared_ptr< ChebyshevEphemeris > readChebyshevEphemerisFile( const std::string& fileName );
+
+}  // namespace ephemerides
+
+}  // namespace tudat
+
+#endif  // TUDAT_CHEBYSHEVEPHEMERIS_H
@@ -0,0 +1,254 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_MUTUALPOINTMASSGRAVITYMODEL_H
+#define TUDAT_MUTUALPOINTMASSGRAVITYMODEL_H
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/basic_astro/accelerationModel.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Class to compute the mutual point-mass gravitational accelerations of a group of bodies.
+/*!
+ *  Class to compute the mutual point-mass gravitational accelerations of a group of bodies in a single evaluation. The group
+ *  consists of bodies undergoing the acceleration (which attract one another if they have a gravitational parameter) and
+ *  external bodies, which attract all bodies undergoing the acceleration, but are not themselves accelerated (e.g. planets
+ *  for which an ephemeris is used). The positions and gravitational parameters of all bodies are stored per coordinate in
+ *  contiguous arrays, so that the interactions of a body with all other bodies are evaluated with vectorized array
+ *  operations. Each pair of accelerated bodies is evaluated only once, and its contribution is added to both bodies (Newton's
+ *  third law). Pairs of two bodies that both have a zero gravitational parameter (e.g. debris objects) are not evaluated.
+ *  The accelerations are computed in the frame in which the positions are provided, which must be inertial.
+ */
+class MutualPointMassGravity
+{
+public:
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param acceleratedBodies Names of bodies undergoing the acceleration
+     *  \param externalBodies Names of bodies exerting, but not undergoing, the acceleration
+     *  \param gravitationalParameterFunctions Functions returning the gravitational parameters of the accelerated and external
+     *  bodies (in that order). Empty functions may be provided for accelerated bodies that exert no acceleration.
+     *  \param positionFunctions Functions returning the inertial positions of the accelerated and external bodies (in that
+     *  order).
+     */
+    MutualPointMassGravity( const std::vector< std::string >& acceleratedBodies,
+                            const std::vector< std::string >& externalBodies,
+                            const std::vector< std::function< double( ) > >& gravitationalParameterFunctions,
+                            const std::vector< std::function< Eigen::Vector3d( ) > >& positionFunctions );
+
+    //! Function to update the accelerations of all bodies to the current time
+    /*!
+     *  Function to update the accelerations of all bodies to the current time, retrieving the current positions and
+     *  gravitational parameters of all bodies. If the time is equal to the time of the previous update, no computations are
+     *  performed.
+     *  \param currentTime Time at which accelerations are to be computed
+     */
+    void update( const double currentTime );
+
+    //! Function to retrieve the current acceleration of a body
+    /*!
+     *  Function to retrieve the current acceleration of a body
+     *  \param bodyIndex Index of body in list of bodies undergoing acceleration (see getBodiesUndergoingAcceleration)
+     *  \return Current acceleration of body
+     */
+    Eigen::Vector3d getAccelerationOfBody( const int bodyIndex )
+    {
+        return Eigen::Vector3d( accelerationsX_( bodyIndex ), accelerationsY_( bodyIndex ), accelerationsZ_( bodyIndex ) );
+    }
+
+    //! Function to retrieve the current acceleration of a body
+    /*!
+     *  Function to retrieve the current acceleration of a body
+     *  \param bodyName Name of body undergoing acceleration
+     *  \return Current acceleration of body
+     */
+    Eigen::Vector3d getAccelerationOfBody( const std::string& bodyName )
+    {
+        return getAccelerationOfBody( acceleratedBodyMap_.at( bodyName ) );
+    }
+
+    //! Function to retrieve the names of bodies undergoing acceleration, in the order in which they are stored internally
+    std::vector< std::string > getBodiesUndergoingAcceleration( )
+    {
+        return std::vector< std::string >( bodyNames_.begin( ), bodyNames_.begin( ) + numberOfAcceleratedBodies_ );
+    }
+
+    //! Function to retrieve the names of all bodies that are involved in the acceleration (accelerated and external)
+    std::vector< std::string > getBodiesExertingAcceleration( )
+    {
+        return bodyNames_;
+    }
+
+    //! Function to retrieve the names of bodies exerting, but not undergoing, the acceleration
+    std::vector< std::string > getExternalBodies( )
+    {
+        return std::vector< std::string >( bodyNames_.begin( ) + numberOfAcceleratedBodies_, bodyNames_.end( ) );
+    }
+
+    //! Function to retrieve the number of accelerated bodies with a non-zero gravitational parameter function
+    int getNumberOfAttractingAcceleratedBodies( )
+    {
+        return numberOfAttractingAcceleratedBodies_;
+    }
+
+    //! Function to reset the current time, so that the accelerations are recomputed at the next call to update
+    void resetCurrentTime( )
+    {
+        currentTime_ = TUDAT_NAN;
+    }
+
+private:
+    //! Function to compute the accelerations from the current positions and gravitational parameters
+    void computeAccelerations( );
+
+    //! Names of all bodies: attracting accelerated bodies, other accelerated bodies, and external bodies (in that order)
+    std::vector< std::string > bodyNames_;
+
+    //! Map from name of accelerated body to its index in bodyNames_
+    std::map< std::string, int > acceleratedBodyMap_;
+
+    //! Functions returning the gravitational parameters of the bodies in bodyNames_ (empty if body does not attract)
+    std::vector< std::function< double( ) > > gravitationalParameterFunctions_;
+
+    //! Functions returning the positions of the bodies in bodyNames_
+    std::vector< std::function< Eigen::Vector3d( ) > > positionFunctions_;
+
+    //! Total number of bodies in bodyNames_
+    int numberOfBodies_;
+
+    //! Number of bodies undergoing acceleration
+    int numberOfAcceleratedBodies_;
+
+    //! Number of bodies undergoing acceleration with a non-zero gravitational parameter function (first entries of bodyNames_)
+    int numberOfAttractingAcceleratedBodies_;
+
+    //! Current gravitational parameters of all bodies
+    Eigen::ArrayXd gravitationalParameters_;
+
+    //! Current x-, y- and z-components of the positions of all bodies
+    Eigen::ArrayXd positionsX_;
+    Eigen::ArrayXd positionsY_;
+    Eigen::ArrayXd positionsZ_;
+
+    //! Current x-, y- and z-components of the accelerations of all accelerated bodies
+    Eigen::ArrayXd accelerationsX_;
+    Eigen::ArrayXd accelerationsY_;
+    Eigen::ArrayXd accelerationsZ_;
+
+    //! Pre-allocated buffers for the relative positions of a single body w.r.t. all other bodies
+    Eigen::ArrayXd relativePositionsX_;
+    Eigen::ArrayXd relativePositionsY_;
+    Eigen::ArrayXd relativePositionsZ_;
+
+    //! Pre-allocated buffer for the inverse cubed distances of a single body w.r.t. all other bodies
+    Eigen::ArrayXd inverseCubedDistances_;
+
+    //! Time of the current accelerations
+    double currentTime_;
+};
+
+//! Class for the point-mass gravitational acceleration of a single body, computed as part of a MutualPointMassGravity group.
+/*!
+ *  Class for the point-mass gravitational acceleration of a single body, computed as part of a MutualPointMassGravity group. The
+ *  acceleration is the sum of the point-mass accelerations exerted by all other bodies in the group. The first object in a
+ *  group that is updated to a new time updates the full group.
+ */
+class MutualPointMassGravityAcceleration : public basic_astrodynamics::AccelerationModel< Eigen::Vector3d >
+{
+public:
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param mutualGravity Object computing the accelerations of the full group of bodies
+     *  \param bodyUndergoingAcceleration Name of body undergoing the acceleration
+     */
+    MutualPointMassGravityAcceleration( const std::shared_ptr< MutualPointMassGravity > mutualGravity,
+                                        const std::string& bodyUndergoingAcceleration ):
+        mutualGravity_( mutualGravity ), bodyUndergoingAcceleration_( bodyUndergoingAcceleration )
+    {
+        std::vector< std::string > acceleratedBodies = mutualGravity_->getBodiesUndergoingAcceleration( );
+        bodyIndex_ = static_cast< int >( std::find( acceleratedBodies.begin( ), acceleratedBodies.end( ), bodyUndergoingAcceleration ) -
+                                         acceleratedBodies.begin( ) );
+        if( bodyIndex_ == static_cast< int >( acceleratedBodies.size( ) ) )
+        {
+            throw std::runtime_error( "Error when creating mutual point-mass gravity acceleration, body " + bodyUndergoingAcceleration +
+                                      " is not accelerated by the group." );
+        }
+    }
+
+    //! Update member variables used by the acceleration model.
+    virtual void updateMembers( const double currentTime = TUDAT_NAN )
+    {
+        if( !( currentTime == currentTime_ ) )
+        {
+            mutualGravity_->update( currentTime );
+            currentAcceleration_ = mutualGravity_->getAccelerationOfBody( bodyIndex_ );
+            currentTime_ = currentTime;
+        }
+    }
+
+    //! Function to reset the current time of the acceleration model, and of the group computation.
+    virtual void resetCurrentTime( )
+    {
+        currentTime_ = TUDAT_NAN;
+        mutualGravity_->resetCurrentTime( );
+    }
+
+    //! Function to retrieve the names of all bodies involved in the group (including this body)
+    std::vector< std::string > getBodiesExertingAcceleration( )
+    {
+        return mutualGravity_->getBodiesExertingAcceleration( );
+    }
+
+    //! Function to retrieve the object computing the accelerations of the full group of bodies
+    std::shared_ptr< MutualPointMassGravity > getMutualGravity( )
+    {
+        return mutualGravity_;
+    }
+
+    //! Function to retrieve the name of body undergoing the acceleration
+    std::string getBodyUndergoingAcceleration( )
+    {
+        return bodyUndergoingAcceleration_;
+    }
+
+private:
+    //! Object computing the accelerations of the full group of bodies
+    std::shared_ptr< MutualPointMassGravity > mutualGravity_;
+
+    //! Name of body undergoing the acceleration
+    std::string bodyUndergoingAcceleration_;
+
+    //! Index of body undergoing the acceleration in mutualGravity_
+    int bodyIndex_;
+};
+
+}  // namespace gravitation
+
+}  // namespace tudat
+
+#endif  // TUDAT_MUTUALPOINTMASSGRAVITYMODEL_H
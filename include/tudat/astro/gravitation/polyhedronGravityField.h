@@ -24,6 +24,7 @@
 #include <iostream>
 
 #include "tudat/astro/gravitation/gravityFieldModel.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
@@ -35,12 +36,19 @@ namespace gravitation
 {
 
 //! Cache object in which variables that are required for the computation of polyhedron gravity field are stored.
+/*!
+ * Cache object in which variables that are required for the computation of polyhedron gravity field are stored. If the
+ * cache is created with the facet and edge dyads, the per-facet and per-edge factors are computed together with the potential
+ * and its gradient in a single pass (see basic_mathematics::PolyhedronGravityKernel), optionally distributed over multiple
+ * threads. In addition, an exterior spherical harmonic expansion of the field may be set, which is then used (instead of the
+ * polyhedron) for the potential and its gradient at field points outside a given switch radius.
+ */
 class PolyhedronGravityCache
 {
 public:
     /*! Constructor.
      *
-     * Constructor.
+     * Constructor, only the per-facet and per-edge factors are computed by the update function.
      * @param verticesCoordinates Matrix with coordinates of the polyhedron vertices. Each row represents the (x,y,z)
      * coordinates of one vertex.
      * @param verticesDefiningEachFacet Matrix with the indices (0 indexed) of the vertices defining each facet. Each
@@ -52,31 +60,60 @@ public:
                             const Eigen::MatrixXi& verticesDefiningEachFacet,
                             const Eigen::MatrixXi& verticesDefiningEachEdge ):
         verticesCoordinates_( verticesCoordinates ), verticesDefiningEachFacet_( verticesDefiningEachFacet ),
-        verticesDefiningEachEdge_( verticesDefiningEachEdge )
+        verticesDefiningEachEdge_( verticesDefiningEachEdge ), currentPotentialPerUnitDensity_( TUDAT_NAN ),
+        relativeCoordinatesAreCurrent_( false ), farFieldPotentialIsCurrent_( false ), farFieldSwitchRadius_( TUDAT_NAN ),
+        farFieldReferenceRadius_( TUDAT_NAN ), farFieldVolume_( TUDAT_NAN ), isFarFieldExpansionUsed_( false )
     {
         currentBodyFixedPosition_ = ( Eigen::Vector3d( ) << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN ).finished( );
+        currentGradientPerUnitDensity_.setConstant( TUDAT_NAN );
+    }
+
+    /*! Constructor.
+     *
+     * Constructor, the per-facet and per-edge factors, as well as the potential and its gradient (per unit of gravitational
+     * constant times density) are computed by the update function.
+     * @param verticesCoordinates Matrix with coordinates of the polyhedron vertices. Each row represents the (x,y,z)
+     * coordinates of one vertex.
+     * @param verticesDefiningEachFacet Matrix with the indices (0 indexed) of the vertices defining each facet. Each
+     * row contains 3 indices, which must be provided in counterclockwise order when seen from outise the polyhedron.
+     * @param verticesDefiningEachEdge Matrix with the indices (0 indexed) of the vertices defining each facet. Each
+     * row contains 2 indices.
+     * @param facetDyads Vector containing facet dyads.
+     * @param edgeDyads Vector containing edge dyads.
+     * @param numberOfThreads Number of threads over which the facets and edges are distributed.
+     */
+    PolyhedronGravityCache( const Eigen::MatrixXd& verticesCoordinates,
+                            const Eigen::MatrixXi& verticesDefiningEachFacet,
+                            const Eigen::MatrixXi& verticesDefiningEachEdge,
+                            const std::vector< Eigen::MatrixXd >& facetDyads,
+                            const std::vector< Eigen::MatrixXd >& edgeDyads,
+                            const int numberOfThreads = 1 ):
+        PolyhedronGravityCache( verticesCoordinates, verticesDefiningEachFacet, verticesDefiningEachEdge )
+    {
+        polyhedronKernel_ = std::make_shared< basic_mathematics::PolyhedronGravityKernel >(
+                verticesCoordinates, verticesDefiningEachFacet, verticesDefiningEachEdge, facetDyads, edgeDyads, numberOfThreads );
     }
 
     /*! Update cached variables to current state.
      *
      * Update cached variables to current state.
      * @param currentBodyFixedPosition Current body fixed position.
+     * @param useFarFieldExpansion Boolean denoting whether the far-field spherical harmonic expansion (if any) may be used
+     * instead of the polyhedron. If false (or if the position is inside the switch radius), the per-facet and per-edge
+     * factors are always updated.
      */
-    void update( const Eigen::Vector3d& currentBodyFixedPosition );
+    void update( const Eigen::Vector3d& currentBodyFixedPosition, const bool useFarFieldExpansion = true );
 
     /*! Function to retrieve the coordinates of the polyhedron vertices wrt field point.
      *
      * Function to retrieve the coordinates of the polyhedron vertices wrt field point.
      * @return Coordinates of the polyhedron vertices wrt field point.
      */
-    Eigen::MatrixXd& getVerticesCoordinatesRelativeToFieldPoint( )
-    {
-        return currentVerticesCoordinatesRelativeToFieldPoint_;
-    }
+    Eigen::MatrixXd& getVerticesCoordinatesRelativeToFieldPoint( );
 
     /*! Function to retrieve the vector of per-facet factors.
      *
-     * Function to retrieve the vector of per-facet factors.
+     * Function to retrieve the vector of per-facet factors (not updated if far-field expansion was used in last update).
      * @return Per-facet factors.
      */
     Eigen::VectorXd& getPerFacetFactor( )
@@ -86,7 +123,7 @@ public:
 
     /*! Function to retrieve the vector of per-edge factors.
      *
-     * Function to retrieve the vector of per-edge factors.
+     * Function to retrieve the vector of per-edge factors (not updated if far-field expansion was used in last update).
      * @return Per-edge factors.
      */
     Eigen::VectorXd& getPerEdgeFactor( )
@@ -94,6 +131,58 @@ public:
         return currentPerEdgeFactor_;
     }
 
+    /*! Function to retrieve the current gravitational potential, divided by gravitational constant times density.
+     *
+     * Function to retrieve the current gravitational potential, divided by gravitational constant times density. Only
+     * available if the cache was created with the facet and edge dyads.
+     * @return Current potential per unit of gravitational constant times density.
+     */
+    double getPotentialPerUnitDensity( );
+
+    /*! Function to retrieve the current gradient of the potential, divided by gravitational constant times density.
+     *
+     * Function to retrieve the current gradient of the potential, divided by gravitational constant times density. Only
+     * available if the cache was created with the facet and edge dyads.
+     * @return Current gradient of potential per unit of gravitational constant times density.
+     */
+    const Eigen::Vector3d& getGradientOfPotentialPerUnitDensity( );
+
+    /*! Function to set the exterior spherical harmonic expansion used for field points outside a given switch radius.
+     *
+     * Function to set the exterior spherical harmonic expansion used for field points outside a given switch radius.
+     * @param cosineCoefficients Geodesy-normalized cosine coefficients of the expansion.
+     * @param sineCoefficients Geodesy-normalized sine coefficients of the expansion.
+     * @param referenceRadius Reference radius of the expansion.
+     * @param switchRadius Distance from the origin beyond which the expansion is used.
+     * @param volume Volume of the polyhedron.
+     */
+    void setFarFieldExpansion( const Eigen::MatrixXd& cosineCoefficients,
+                               const Eigen::MatrixXd& sineCoefficients,
+                               const double referenceRadius,
+                               const double switchRadius,
+                               const double volume );
+
+    //! Function to check whether the far-field spherical harmonic expansion was used in the last update.
+    bool isFarFieldExpansionUsed( )
+    {
+        return isFarFieldExpansionUsed_;
+    }
+
+    //! Function to retrieve the body-fixed position of the last update.
+    const Eigen::Vector3d& getCurrentBodyFixedPosition( )
+    {
+        return currentBodyFixedPosition_;
+    }
+
+    //! Function to reset the number of threads over which the facets and edges are distributed.
+    void setNumberOfThreads( const int numberOfThreads );
+
+    //! Function to retrieve the kernel used to evaluate the per-facet and per-edge terms (nullptr if not created).
+    std::shared_ptr< basic_mathematics::PolyhedronGravityKernel > getPolyhedronKernel( )
+    {
+        return polyhedronKernel_;
+    }
+
 protected:
 private:
     // Current body fixed position.
@@ -116,6 +205,42 @@ private:
 
     // Current value of the per-edge factors.
     Eigen::VectorXd currentPerEdgeFactor_;
+
+    // Kernel for fused evaluation of per-facet and per-edge terms (nullptr if cache was created without dyads).
+    std::shared_ptr< basic_mathematics::PolyhedronGravityKernel > polyhedronKernel_;
+
+    // Current potential, per unit of gravitational constant times density.
+    double currentPotentialPerUnitDensity_;
+
+    // Current gradient of potential, per unit of gravitational constant times density.
+    Eigen::Vector3d currentGradientPerUnitDensity_;
+
+    // Boolean denoting whether currentVerticesCoordinatesRelativeToFieldPoint_ has been set for the current position.
+    bool relativeCoordinatesAreCurrent_;
+
+    // Boolean denoting whether currentPotentialPerUnitDensity_ has been set by the far-field expansion for current position.
+    bool farFieldPotentialIsCurrent_;
+
+    // Cosine coefficients of far-field spherical harmonic expansion.
+    Eigen::MatrixXd farFieldCosineCoefficients_;
+
+    // Sine coefficients of far-field spherical harmonic expansion.
+    Eigen::MatrixXd farFieldSineCoefficients_;
+
+    // Distance from origin beyond which far-field expansion is used (NaN if no expansion is set).
+    double farFieldSwitchRadius_;
+
+    // Reference radius of far-field expansion.
+    double farFieldReferenceRadius_;
+
+    // Volume of polyhedron, used as gravitational parameter of far-field expansion (per unit gravitational constant times density).
+    double farFieldVolume_;
+
+    // Boolean denoting whether the far-field expansion was used in the last update.
+    bool isFarFieldExpansionUsed_;
+
+    // Cache for evaluation of far-field spherical harmonic expansion.
+    basic_mathematics::SphericalHarmonicsCache sphericalHarmonicsCache_;
 };
 
 //! Class to represent the gravity field of a constant density polyhedron.
@@ -140,7 +265,8 @@ public:
                             const std::function< void( ) > updateInertiaTensor = std::function< void( ) >( ) ):
         GravityFieldModel( gravitationalParameter, updateInertiaTensor ), gravitationalParameter_( gravitationalParameter ),
         verticesCoordinates_( verticesCoordinates ), verticesDefiningEachFacet_( verticesDefiningEachFacet ),
-        fixedReferenceFrame_( fixedReferenceFrame )
+        fixedReferenceFrame_( fixedReferenceFrame ), numberOfThreads_( 1 ), farFieldMaximumDegree_( -1 ),
+        farFieldBrillouinSphereMarginFactor_( TUDAT_NAN ), brillouinSphereRadius_( TUDAT_NAN )
     {
         // Check if provided arguments are valid
         basic_mathematics::checkValidityOfPolyhedronSettings( verticesCoordinates, verticesDefiningEachFacet );
@@ -159,8 +285,8 @@ public:
         computeEdgeDyads( );
 
         // Create cache object
-        polyhedronGravityCache_ =
-                std::make_shared< PolyhedronGravityCache >( verticesCoordinates_, verticesDefiningEachFacet_, verticesDefiningEachEdge_ );
+        polyhedronGravityCache_ = std::make_shared< PolyhedronGravityCache >(
+                verticesCoordinates_, verticesDefiningEachFacet_, verticesDefiningEachEdge_, facetDyads_, edgeDyads_ );
 
         inertiaTensor_ = basic_astrodynamics::computePolyhedronInertiaTensor( verticesCoordinates_, verticesDefiningEachFacet_, density_ );
     }
@@ -175,15 +301,7 @@ public:
     {
         polyhedronGravityCache_->update( bodyFixedPosition );
 
-        return basic_mathematics::calculatePolyhedronGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                polyhedronGravityCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
-                verticesDefiningEachFacet_,
-                verticesDefiningEachEdge_,
-                facetDyads_,
-                edgeDyads_,
-                polyhedronGravityCache_->getPerFacetFactor( ),
-                polyhedronGravityCache_->getPerEdgeFactor( ) );
+        return gravitationalParameter_ / volume_ * polyhedronGravityCache_->getPotentialPerUnitDensity( );
     }
 
     /*! Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
@@ -196,15 +314,7 @@ public:
     {
         polyhedronGravityCache_->update( bodyFixedPosition );
 
-        return basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
-                gravitationalParameter_ / volume_,
-                polyhedronGravityCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
-                verticesDefiningEachFacet_,
-                verticesDefiningEachEdge_,
-                facetDyads_,
-                edgeDyads_,
-                polyhedronGravityCache_->getPerFacetFactor( ),
-                polyhedronGravityCache_->getPerEdgeFactor( ) );
+        return gravitationalParameter_ / volume_ * polyhedronGravityCache_->getGradientOfPotentialPerUnitDensity( );
     }
 
     /*! Function to calculate the hessian matrix of the gravitational potential.
@@ -215,7 +325,7 @@ public:
      */
     Eigen::Matrix3d getHessianOfPotential( const Eigen::Vector3d& bodyFixedPosition )
     {
-        polyhedronGravityCache_->update( bodyFixedPosition );
+        polyhedronGravityCache_->update( bodyFixedPosition, false );
 
         return basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential( gravitationalParameter_ / volume_,
                                                                                       facetDyads_,
@@ -232,7 +342,7 @@ public:
      */
     virtual double getLaplacianOfPotential( const Eigen::Vector3d& bodyFixedPosition )
     {
-        polyhedronGravityCache_->update( bodyFixedPosition );
+        polyhedronGravityCache_->update( bodyFixedPosition, false );
 
         return basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential( gravitationalParameter_ / volume_,
                                                                                         polyhedronGravityCache_->getPerFacetFactor( ) );
@@ -285,6 +395,85 @@ public:
         return inertiaTensor_;
     }
 
+    /*! Function to reset the number of threads used to evaluate the field.
+     *
+     * Function to reset the number of threads over which the facets and edges are distributed when evaluating the field.
+     * Using multiple threads is only beneficial for polyhedra with a large number of facets.
+     * @param numberOfThreads Number of threads.
+     */
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        polyhedronGravityCache_->setNumberOfThreads( numberOfThreads );
+        numberOfThreads_ = numberOfThreads;
+    }
+
+    //! Function to retrieve the number of threads used to evaluate the field.
+    int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    /*! Function to set the far-field spherical harmonic expansion of the field.
+     *
+     * Function to derive an exterior spherical harmonic expansion from the polyhedron (with the radius of the Brillouin
+     * sphere as reference radius), which is used instead of the polyhedron for the potential and its gradient at field
+     * points that are further from the origin than the radius of the Brillouin sphere times the given margin factor. The
+     * Hessian and Laplacian are always computed from the polyhedron.
+     * @param maximumDegree Maximum degree (and order) of the expansion.
+     * @param brillouinSphereMarginFactor Ratio of the switch radius and the radius of the Brillouin sphere (must be >= 1).
+     */
+    void setFarFieldSphericalHarmonicExpansion( const int maximumDegree, const double brillouinSphereMarginFactor );
+
+    //! Function to retrieve the cache used to evaluate the field.
+    std::shared_ptr< PolyhedronGravityCache > getPolyhedronGravityCache( )
+    {
+        return polyhedronGravityCache_;
+    }
+
+    //! Function to check whether a far-field spherical harmonic expansion has been set.
+    bool isFarFieldExpansionSet( )
+    {
+        return farFieldMaximumDegree_ >= 0;
+    }
+
+    //! Function to retrieve the maximum degree of the far-field expansion (-1 if not set).
+    int getFarFieldMaximumDegree( )
+    {
+        return farFieldMaximumDegree_;
+    }
+
+    //! Function to retrieve the ratio of the far-field switch radius and the radius of the Brillouin sphere.
+    double getFarFieldBrillouinSphereMarginFactor( )
+    {
+        return farFieldBrillouinSphereMarginFactor_;
+    }
+
+    //! Function to retrieve the radius of the Brillouin sphere (reference radius of the far-field expansion).
+    double getBrillouinSphereRadius( )
+    {
+        return brillouinSphereRadius_;
+    }
+
+    //! Function to retrieve the cosine coefficients of the far-field expansion.
+    const Eigen::MatrixXd& getFarFieldCosineCoefficients( )
+    {
+        return farFieldCosineCoefficients_;
+    }
+
+    //! Function to retrieve the sine coefficients of the far-field expansion.
+    const Eigen::MatrixXd& getFarFieldSineCoefficients( )
+    {
+        return farFieldSineCoefficients_;
+    }
+
+    /*! Function to apply the number of threads and the far-field expansion of this field to a polyhedron cache.
+     *
+     * Function to apply the number of threads and the far-field expansion of this field to a polyhedron cache, typically
+     * that of a polyhedron acceleration model created from this field.
+     * @param polyhedronCache Cache to which the settings are applied.
+     */
+    void configurePolyhedronGravityCache( const std::shared_ptr< PolyhedronGravityCache > polyhedronCache );
+
 protected:
 private:
     /*! Function to compute the vertices and facets defining each edge.
@@ -350,6 +539,24 @@ private:
 
     //! Identifier for body-fixed reference frame
     std::string fixedReferenceFrame_;
+
+    //! Number of threads over which the facets and edges are distributed.
+    int numberOfThreads_;
+
+    //! Maximum degree of the far-field expansion (-1 if not set).
+    int farFieldMaximumDegree_;
+
+    //! Ratio of the far-field switch radius and the radius of the Brillouin sphere.
+    double farFieldBrillouinSphereMarginFactor_;
+
+    //! Radius of the Brillouin sphere.
+    double brillouinSphereRadius_;
+
+    //! Cosine coefficients of the far-field expansion.
+    Eigen::MatrixXd farFieldCosineCoefficients_;
+
+    //! Sine coefficients of the far-field expansion.
+    Eigen::MatrixXd farFieldSineCoefficients_;
 };
 
 }  // namespace gravitation
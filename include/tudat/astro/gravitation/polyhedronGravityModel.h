@@ -95,7 +95,9 @@ public:
         isMutualAttractionUsed_( isMutualAttractionUsed ),
         polyhedronCache_( std::make_shared< PolyhedronGravityCache >( aVerticesCoordinatesMatrix,
                                                                       aVerticesDefiningEachFacetMatrix,
-                                                                      aVerticesDefiningEachEdgeMatrix ) ),
+                                                                      aVerticesDefiningEachEdgeMatrix,
+                                                                      aFacetDyadsVector,
+                                                                      aEdgeDyadsVector ) ),
         currentPotential_( TUDAT_NAN ), currentLaplacianOfPotential_( TUDAT_NAN ), updatePotential_( updateGravitationalPotential ),
         updateLaplacianOfPotential_( updateLaplacianOfGravitationalPotential )
     { }
@@ -150,7 +152,9 @@ public:
         isMutualAttractionUsed_( isMutualAttractionUsed ),
         polyhedronCache_( std::make_shared< PolyhedronGravityCache >( verticesCoordinatesFunction( ),
                                                                       verticesDefiningEachFacetFunction( ),
-                                                                      verticesDefiningEachEdgeFunction( ) ) ),
+                                                                      verticesDefiningEachEdgeFunction( ),
+                                                                      facetDyadsFunction( ),
+                                                                      edgeDyadsFunction( ) ) ),
         currentPotential_( TUDAT_NAN ), currentLaplacianOfPotential_( TUDAT_NAN ), updatePotential_( updateGravitationalPotential ),
         updateLaplacianOfPotential_( updateLaplacianOfGravitationalPotential )
     { }
@@ -177,38 +181,32 @@ public:
 
             polyhedronCache_->update( currentRelativePosition_ );
 
-            // Compute the current acceleration
-            currentAccelerationInBodyFixedFrame_ = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
-                    gravitationalParameterFunction_( ) / volumeFunction_( ),
-                    polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
-                    getVerticesDefiningEachFacet_( ),
-                    getVerticesDefiningEachEdge_( ),
-                    getFacetDyads_( ),
-                    getEdgeDyads_( ),
-                    polyhedronCache_->getPerFacetFactor( ),
-                    polyhedronCache_->getPerEdgeFactor( ) );
+            // Compute the current acceleration (per-facet/edge terms are accumulated by the cache)
+            const double gravitationalParameterPerUnitVolume = gravitationalParameterFunction_( ) / volumeFunction_( );
+            currentAccelerationInBodyFixedFrame_ =
+                    gravitationalParameterPerUnitVolume * polyhedronCache_->getGradientOfPotentialPerUnitDensity( );
 
             currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
 
             // Compute the current gravitational potential
             if( updatePotential_ )
             {
-                currentPotential_ = basic_mathematics::calculatePolyhedronGravitationalPotential(
-                        gravitationalParameterFunction_( ) / volumeFunction_( ),
-                        polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
-                        getVerticesDefiningEachFacet_( ),
-                        getVerticesDefiningEachEdge_( ),
-                        getFacetDyads_( ),
-                        getEdgeDyads_( ),
-                        polyhedronCache_->getPerFacetFactor( ),
-                        polyhedronCache_->getPerEdgeFactor( ) );
+                currentPotential_ = gravitationalParameterPerUnitVolume * polyhedronCache_->getPotentialPerUnitDensity( );
             }
 
             // Compute the current laplacian
             if( updateLaplacianOfPotential_ )
             {
-                currentLaplacianOfPotential_ = basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
-                        gravitationalParameterFunction_( ) / volumeFunction_( ), polyhedronCache_->getPerFacetFactor( ) );
+                // Laplacian vanishes outside the Brillouin sphere, where the far-field expansion is used
+                if( polyhedronCache_->isFarFieldExpansionUsed( ) )
+                {
+                    currentLaplacianOfPotential_ = 0.0;
+                }
+                else
+                {
+                    currentLaplacianOfPotential_ = basic_mathematics::calculatePolyhedronLaplacianOfGravitationalPotential(
+                            gravitationalParameterPerUnitVolume, polyhedronCache_->getPerFacetFactor( ) );
+                }
             }
         }
     }
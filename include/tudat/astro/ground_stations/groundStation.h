@@ -18,6 +18,7 @@
 #include "tudat/astro/ground_stations/groundStationState.h"
 #include "tudat/astro/ground_stations/pointingAnglesCalculator.h"
 #include "tudat/astro/ground_stations/meteorologicalConditions.h"
+#include "tudat/astro/ground_stations/stationMediaCorrectionCache.h"
 #include "tudat/astro/system_models/timingSystem.h"
 #include "tudat/astro/ground_stations/transmittingFrequencies.h"
 #include "tudat/astro/system_models/vehicleSystems.h"
@@ -45,7 +46,8 @@ public:
                    const std::string& stationId,
                    const std::shared_ptr< StationFrequencyInterpolator > transmittingFrequencyCalculator = nullptr ):
         nominalStationState_( stationState ), pointingAnglesCalculator_( pointingAnglesCalculator ), stationId_( stationId ),
-        transmittingFrequencyCalculator_( transmittingFrequencyCalculator )
+        transmittingFrequencyCalculator_( transmittingFrequencyCalculator ),
+        mediaCorrectionCache_( std::make_shared< StationMediaCorrectionCache >( ) )
     {
         stationState->setSiteId( stationId );
     }
@@ -200,6 +202,7 @@ public:
     void setMeteoData( const std::shared_ptr< StationMeteoData > meteoData )
     {
         meteoData_ = meteoData;
+        mediaCorrectionCache_->clearCache( );
     }
 
     std::shared_ptr< StationTroposphereData > getTroposphereData( )
@@ -210,6 +213,13 @@ public:
     void setTroposphereData( const std::shared_ptr< StationTroposphereData > troposphereData )
     {
         troposphereData_ = troposphereData;
+        mediaCorrectionCache_->clearCache( );
+    }
+
+    //! Function to retrieve the cache of station- and epoch-dependent media-correction terms, shared between observation models
+    std::shared_ptr< StationMediaCorrectionCache > getMediaCorrectionCache( )
+    {
+        return mediaCorrectionCache_;
     }
 
 private:
@@ -231,6 +241,9 @@ private:
 
     std::shared_ptr< StationTroposphereData > troposphereData_;
 
+    //! Cache of station- and epoch-dependent media-correction terms, shared between observation models
+    std::shared_ptr< StationMediaCorrectionCache > mediaCorrectionCache_;
+
     //! Container object with hardware systems present on/in body (typically only non-nullptr for a vehicle).
     std::shared_ptr< system_models::VehicleSystems > vehicleSystems_;
 };
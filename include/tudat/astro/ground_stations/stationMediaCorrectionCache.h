@@ -0,0 +1,210 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_STATIONMEDIACORRECTIONCACHE_H
+#define TUDAT_STATIONMEDIACORRECTIONCACHE_H
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace ground_stations
+{
+
+//! Class to cache station- and epoch-dependent (but not line-of-sight dependent) terms of media corrections.
+/*!
+ *  Class to cache station- and epoch-dependent (but not line-of-sight dependent) terms of media corrections, such as zenith
+ *  delays and mapping-function coefficients. The terms depend only on the station and the epoch, so that they can be shared
+ *  between all light-time iterations, and between all observation models (range, Doppler, n-way, etc.) that use the same
+ *  station. Each type of term is registered once (see getTermIndex), after which its values are stored in a small ring
+ *  buffer per term, keyed on the (quantized) epoch.
+ *
+ *  If the epoch quantization is zero (default), terms are only reused for exactly the same epoch, and results are identical
+ *  to those without the cache. For a positive quantization, epochs are rounded to the nearest multiple of the quantization,
+ *  and the terms are evaluated at this rounded epoch.
+ */
+class StationMediaCorrectionCache
+{
+public:
+    //! Constructor
+    /*!
+     * Constructor
+     * \param epochQuantization Interval to which epochs are rounded before cache lookup (no rounding if zero)
+     * \param numberOfEntriesPerTerm Number of epochs for which each term is retained
+     */
+    StationMediaCorrectionCache( const double epochQuantization = 0.0, const unsigned int numberOfEntriesPerTerm = 8 ):
+        epochQuantization_( epochQuantization ), numberOfEntriesPerTerm_( numberOfEntriesPerTerm ), numberOfCacheHits_( 0 ),
+        numberOfCacheMisses_( 0 )
+    {
+        if( numberOfEntriesPerTerm_ == 0 )
+        {
+            throw std::runtime_error( "Error when creating station media correction cache, number of entries per term must be positive" );
+        }
+    }
+
+    //! Function to retrieve the index of a term, registering the term if it is not yet known
+    /*!
+     * Function to retrieve the index of a term, registering the term if it is not yet known. A term is identified by its name
+     * and an (optional) owner object, typically the settings object from which the correction was created. The owner object
+     * is retained by the cache, so that its identity remains unique for the lifetime of the cache.
+     * \param termName Name of the type of term
+     * \param termOwner Object (typically correction settings) of which the identity distinguishes terms of the same name
+     * \return Index of the term, to be used in getTerm
+     */
+    int getTermIndex( const std::string& termName, const std::shared_ptr< const void > termOwner = nullptr )
+    {
+        for( unsigned int i = 0; i < terms_.size( ); i++ )
+        {
+            if( terms_.at( i ).termName == termName && terms_.at( i ).termOwner == termOwner )
+            {
+                return static_cast< int >( i );
+            }
+        }
+
+        terms_.push_back( CachedTerm( termName, termOwner, numberOfEntriesPerTerm_ ) );
+        return static_cast< int >( terms_.size( ) - 1 );
+    }
+
+    //! Function to retrieve the value of a term at a given epoch, computing it if it is not yet cached
+    /*!
+     * Function to retrieve the value of a term at a given epoch, computing (and caching) it if it is not yet cached.
+     * \param termIndex Index of the term (as returned by getTermIndex)
+     * \param time Epoch at which the term is to be retrieved
+     * \param termFunction Function computing the term as a function of epoch (called with quantized epoch)
+     * \return Value of the term at the (quantized) epoch
+     */
+    template< typename TermFunction >
+    const Eigen::VectorXd& getTerm( const int termIndex, const double time, TermFunction termFunction )
+    {
+        CachedTerm& currentTerm = terms_.at( termIndex );
+        const double quantizedTime = getQuantizedEpoch( time );
+
+        // Search most recently added entries first.
+        const unsigned int numberOfEntries = currentTerm.epochs.size( );
+        for( unsigned int i = 0; i < numberOfEntries; i++ )
+        {
+            unsigned int entryIndex = ( currentTerm.lastEntryIndex + numberOfEntries - i ) % numberOfEntries;
+            if( currentTerm.epochs.at( entryIndex ) == quantizedTime )
+            {
+                numberOfCacheHits_++;
+                return currentTerm.values.at( entryIndex );
+            }
+        }
+
+        // Compute term and overwrite oldest entry.
+        numberOfCacheMisses_++;
+        currentTerm.lastEntryIndex = ( currentTerm.lastEntryIndex + 1 ) % numberOfEntries;
+        currentTerm.values[ currentTerm.lastEntryIndex ] = termFunction( quantizedTime );
+        currentTerm.epochs[ currentTerm.lastEntryIndex ] = quantizedTime;
+        return currentTerm.values.at( currentTerm.lastEntryIndex );
+    }
+
+    //! Function to round an epoch to the epoch quantization of the cache
+    double getQuantizedEpoch( const double time ) const
+    {
+        if( epochQuantization_ > 0.0 )
+        {
+            return std::round( time / epochQuantization_ ) * epochQuantization_;
+        }
+        else
+        {
+            return time;
+        }
+    }
+
+    //! Function to reset the epoch quantization, clears the cache
+    void setEpochQuantization( const double epochQuantization )
+    {
+        epochQuantization_ = epochQuantization;
+        clearCache( );
+    }
+
+    //! Function to retrieve the epoch quantization
+    double getEpochQuantization( ) const
+    {
+        return epochQuantization_;
+    }
+
+    //! Function to remove all cached values (registered terms are retained)
+    void clearCache( )
+    {
+        for( unsigned int i = 0; i < terms_.size( ); i++ )
+        {
+            terms_[ i ] = CachedTerm( terms_.at( i ).termName, terms_.at( i ).termOwner, numberOfEntriesPerTerm_ );
+        }
+    }
+
+    //! Function to retrieve the number of term retrievals that were found in the cache
+    unsigned long long getNumberOfCacheHits( ) const
+    {
+        return numberOfCacheHits_;
+    }
+
+    //! Function to retrieve the number of term retrievals that required the term to be computed
+    unsigned long long getNumberOfCacheMisses( ) const
+    {
+        return numberOfCacheMisses_;
+    }
+
+    //! Function to reset the cache hit/miss counters
+    void resetStatistics( )
+    {
+        numberOfCacheHits_ = 0;
+        numberOfCacheMisses_ = 0;
+    }
+
+private:
+    //! Cached values of single type of term, stored in ring buffer
+    struct CachedTerm {
+        CachedTerm( const std::string& name, const std::shared_ptr< const void > owner, const unsigned int numberOfEntries ):
+            termName( name ), termOwner( owner ), epochs( numberOfEntries, std::numeric_limits< double >::quiet_NaN( ) ),
+            values( numberOfEntries ), lastEntryIndex( 0 )
+        { }
+
+        std::string termName;
+
+        std::shared_ptr< const void > termOwner;
+
+        std::vector< double > epochs;
+
+        std::vector< Eigen::VectorXd > values;
+
+        unsigned int lastEntryIndex;
+    };
+
+    //! Interval to which epochs are rounded before cache lookup (no rounding if zero)
+    double epochQuantization_;
+
+    //! Number of epochs for which each term is retained
+    unsigned int numberOfEntriesPerTerm_;
+
+    //! List of registered terms, with cached values
+    std::vector< CachedTerm > terms_;
+
+    //! Number of term retrievals that were found in the cache
+    unsigned long long numberOfCacheHits_;
+
+    //! Number of term retrievals that required the term to be computed
+    unsigned long long numberOfCacheMisses_;
+};
+
+}  // namespace ground_stations
+
+}  // namespace tudat
+
+#endif  // TUDAT_STATIONMEDIACORRECTIONCACHE_H
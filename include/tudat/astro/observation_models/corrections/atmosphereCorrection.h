@@ -30,6 +30,7 @@
 
 #include "tudat/math/interpolators.h"
 #include "tudat/astro/ground_stations/meteorologicalConditions.h"
+#include "tudat/astro/ground_stations/stationMediaCorrectionCache.h"
 #include "tudat/astro/observation_models/observableTypes.h"
 #include "tudat/astro/observation_models/corrections/lightTimeCorrection.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
@@ -622,7 +623,57 @@ public:
         return wetZenithRangeCorrectionFunction_;
     }
 
+    /*!
+     * Function to set the cache through which the station- and epoch-dependent terms (e.g. zenith corrections) are retrieved,
+     * so that these are shared between light-time iterations and between observation models using the same station.
+     *
+     * @param stationCache Cache of the ground station for which the correction is computed.
+     * @param stationCacheTermIndex Index of the terms of this correction in the cache (see StationMediaCorrectionCache::getTermIndex)
+     */
+    void setStationMediaCorrectionCache( const std::shared_ptr< ground_stations::StationMediaCorrectionCache > stationCache,
+                                         const int stationCacheTermIndex )
+    {
+        stationCache_ = stationCache;
+        stationCacheTermIndex_ = stationCacheTermIndex;
+    }
+
 protected:
+    /*!
+     * Computes the station- and epoch-dependent terms of the correction. By default, these are the dry and wet zenith range
+     * corrections (in meters); derived classes may append additional terms.
+     *
+     * @param stationTime Time at the ground station.
+     * @return Station- and epoch-dependent terms of the correction.
+     */
+    virtual Eigen::VectorXd computeStationTerms( const double stationTime )
+    {
+        return ( Eigen::VectorXd( 2 ) << dryZenithRangeCorrectionFunction_( stationTime ),
+                 wetZenithRangeCorrectionFunction_( stationTime ) )
+                .finished( );
+    }
+
+    /*!
+     * Retrieves the station- and epoch-dependent terms of the correction (see computeStationTerms), from the station cache if
+     * it is set, or by direct computation otherwise.
+     *
+     * @param stationTime Time at the ground station.
+     * @return Station- and epoch-dependent terms of the correction.
+     */
+    const Eigen::VectorXd& getStationTerms( const double stationTime )
+    {
+        if( stationCache_ != nullptr )
+        {
+            return stationCache_->getTerm( stationCacheTermIndex_, stationTime, [ this ]( const double time ) {
+                return computeStationTerms( time );
+            } );
+        }
+        else
+        {
+            currentStationTerms_ = computeStationTerms( stationTime );
+            return currentStationTerms_;
+        }
+    }
+
     // Dry atmosphere zenith range correction (in meters)
     std::function< double( double time ) > dryZenithRangeCorrectionFunction_;
 
@@ -634,6 +685,15 @@ protected:
 
     // Boolean indicating whether the correction is for uplink or donwlink (necessary when computing the elevation)
     bool isUplinkCorrection_;
+
+    // Cache of station- and epoch-dependent terms, shared between observation models (nullptr if not used)
+    std::shared_ptr< ground_stations::StationMediaCorrectionCache > stationCache_;
+
+    // Index of the terms of this correction in stationCache_
+    int stationCacheTermIndex_;
+
+    // Station- and epoch-dependent terms, as last computed without the cache
+    Eigen::VectorXd currentStationTerms_;
 };
 
 // Class to compute the tabulated tropospheric corrections using DSN data, according to Moyer (2000), section 10.2.1.
@@ -744,46 +804,6 @@ private:
     std::function< double( const double ) > waterVaporPartialPressureFunction_;
 };
 
-// Class to compute tropospheric delay models from:
-//  VMF3 & GPT3: Landskron & Böhm (2018) VMF3/GPT3: refined discrete and empirical troposphere mapping functions.
-//  DOI:10.1007/s00190-017-1066-2
-class VMF3TroposphericCorrection : public MappedTroposphericCorrection
-{
-public:
-    VMF3TroposphericCorrection( const std::shared_ptr< TroposhericElevationMapping > elevationMapping,
-                                const bool isUplinkCorrection,
-                                const std::shared_ptr< ground_stations::StationTroposphereData > troposphereData,
-                                const bool useGradient ):
-        MappedTroposphericCorrection( vmf3_tropospheric, elevationMapping, isUplinkCorrection ), troposphereData_( troposphereData ),
-        useGradient_( useGradient )
-    { }
-
-    // Computes the dry atmosphere zenith range correction (in meters)
-    double computeDryZenithRangeCorrection( const double stationTime )
-    {
-        return troposphereData_->getZenithDelay( stationTime )( 0 );
-    }
-
-    // Computes the wet atmosphere zenith range correction (in meters)
-    double computeWetZenithRangeCorrection( const double stationTime )
-    {
-        return troposphereData_->getZenithDelay( stationTime )( 1 );
-    }
-
-    double calculateLightTimeCorrectionWithMultiLegLinkEndStates(
-            const std::vector< Eigen::Vector6d >& linkEndsStates,
-            const std::vector< double >& linkEndsTimes,
-            const unsigned int currentMultiLegTransmitterIndex,
-            const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancillarySettings = nullptr ) override;
-
-private:
-    // VMF3 data container (interpolated coefficients)
-    std::shared_ptr< ground_stations::StationTroposphereData > troposphereData_;
-
-    //! Whether gradient data should be used
-    bool useGradient_;
-};
-
 class VMF3MappingModel : public TroposhericElevationMapping
 {
 public:
@@ -794,8 +814,8 @@ public:
         elevationFunction_( std::move( elevationFunction ) ), azimuthFunction_( std::move( azimuthFunction ) ),
         groundStationGeodeticPositionFunction_( std::move( groundStationGeodeticPositionFunction ) ),
         isUplinkCorrection_( isUplinkCorrection ), currentElevation_( TUDAT_NAN ), currentAzimuth_( TUDAT_NAN ),
-        currentStationLatitude_( TUDAT_NAN ), currentStationLongitude_( TUDAT_NAN ), currentDayOfYear_( TUDAT_NAN ),
-        currentDryMappingCoefficient_( TUDAT_NAN ), currentWetMappingCoefficient_( TUDAT_NAN )
+        currentGroundStationTime_( TUDAT_NAN ), currentDryMappingCoefficient_( TUDAT_NAN ), currentWetMappingCoefficient_( TUDAT_NAN ),
+        seasonalMappingCoefficientsTime_( TUDAT_NAN ), currentSeasonalMappingCoefficients_( Eigen::Vector4d::Constant( TUDAT_NAN ) )
     {
         legendreCache_ = basic_mathematics::LegendreCache( 12, 1 );
         loadLegendreCoefficientTables( );
@@ -832,14 +852,29 @@ public:
         currentWetMappingCoefficient_ = mappingCoefficients( 1 );
     }
 
+    //! Compute seasonal mapping coefficients (hydrostatic b and c, wet b and c) at the ground station at given time
+    Eigen::Vector4d computeSeasonalMappingCoefficients( const double groundStationTime );
+
+    //! Set seasonal mapping coefficients (hydrostatic b and c, wet b and c) that are to be used at given ground station time,
+    //! as an alternative to computing them internally (e.g. when retrieved from a station cache)
+    void updateSeasonalMappingCoefficients( const Eigen::Vector4d& seasonalMappingCoefficients, const double groundStationTime )
+    {
+        currentSeasonalMappingCoefficients_ = seasonalMappingCoefficients;
+        seasonalMappingCoefficientsTime_ = groundStationTime;
+    }
+
 private:
     std::function< double( Eigen::Vector3d, double ) > elevationFunction_;
     std::function< double( Eigen::Vector3d, double ) > azimuthFunction_;
     std::function< Eigen::Vector3d( double ) > groundStationGeodeticPositionFunction_;
     bool isUplinkCorrection_;
-    double currentElevation_, currentAzimuth_, currentStationLatitude_, currentStationLongitude_;
-    double currentDayOfYear_;
+    double currentElevation_, currentAzimuth_;
+    double currentGroundStationTime_;
     double currentDryMappingCoefficient_, currentWetMappingCoefficient_;
+
+    // Seasonal mapping coefficients (hydrostatic b and c, wet b and c), and ground station time for which they were set
+    double seasonalMappingCoefficientsTime_;
+    Eigen::Vector4d currentSeasonalMappingCoefficients_;
     mutable tudat::basic_mathematics::LegendreCache legendreCache_;
     std::shared_ptr< earth_orientation::TerrestrialTimeScaleConverter > timeScaleConverter_;
 
@@ -880,6 +915,59 @@ private:
                                        const std::vector< std::vector< double > >& W ) const;
 };
 
+// Class to compute tropospheric delay models from:
+//  VMF3 & GPT3: Landskron & Böhm (2018) VMF3/GPT3: refined discrete and empirical troposphere mapping functions.
+//  DOI:10.1007/s00190-017-1066-2
+class VMF3TroposphericCorrection : public MappedTroposphericCorrection
+{
+public:
+    VMF3TroposphericCorrection( const std::shared_ptr< TroposhericElevationMapping > elevationMapping,
+                                const bool isUplinkCorrection,
+                                const std::shared_ptr< ground_stations::StationTroposphereData > troposphereData,
+                                const bool useGradient ):
+        MappedTroposphericCorrection( vmf3_tropospheric, elevationMapping, isUplinkCorrection ), troposphereData_( troposphereData ),
+        useGradient_( useGradient ), vmf3Mapping_( std::dynamic_pointer_cast< VMF3MappingModel >( elevationMapping ) )
+    { }
+
+    // Computes the dry atmosphere zenith range correction (in meters)
+    double computeDryZenithRangeCorrection( const double stationTime )
+    {
+        return troposphereData_->getZenithDelay( stationTime )( 0 );
+    }
+
+    // Computes the wet atmosphere zenith range correction (in meters)
+    double computeWetZenithRangeCorrection( const double stationTime )
+    {
+        return troposphereData_->getZenithDelay( stationTime )( 1 );
+    }
+
+    double calculateLightTimeCorrectionWithMultiLegLinkEndStates(
+            const std::vector< Eigen::Vector6d >& linkEndsStates,
+            const std::vector< double >& linkEndsTimes,
+            const unsigned int currentMultiLegTransmitterIndex,
+            const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancillarySettings = nullptr ) override;
+
+protected:
+    /*!
+     * Computes the station- and epoch-dependent terms of the correction: the dry and wet zenith range corrections, the dry and
+     * wet mapping coefficients a, and the seasonal mapping coefficients (b and c, dry and wet) at the station.
+     *
+     * @param stationTime Time at the ground station.
+     * @return Station- and epoch-dependent terms of the correction.
+     */
+    Eigen::VectorXd computeStationTerms( const double stationTime ) override;
+
+private:
+    // VMF3 data container (interpolated coefficients)
+    std::shared_ptr< ground_stations::StationTroposphereData > troposphereData_;
+
+    //! Whether gradient data should be used
+    bool useGradient_;
+
+    //! VMF3 mapping model (nullptr if elevation mapping is not of VMF3 type)
+    std::shared_ptr< VMF3MappingModel > vmf3Mapping_;
+};
+
 //
 // class VMF1TroposphericCorrection : public MappedTroposphericCorrection
 //{
@@ -950,7 +1038,24 @@ public:
             const unsigned int currentMultiLegTransmitterIndex,
             const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancillarySettings ) override;
 
+    /*!
+     * Function to set the cache through which the reference range correction is retrieved, so that it is shared between
+     * light-time iterations and between observation models using the same station.
+     *
+     * @param stationCache Cache of the ground station for which the correction is computed.
+     * @param stationCacheTermIndex Index of the terms of this correction in the cache (see StationMediaCorrectionCache::getTermIndex)
+     */
+    void setStationMediaCorrectionCache( const std::shared_ptr< ground_stations::StationMediaCorrectionCache > stationCache,
+                                         const int stationCacheTermIndex )
+    {
+        stationCache_ = stationCache;
+        stationCacheTermIndex_ = stationCacheTermIndex;
+    }
+
 private:
+    // Computes the reference range correction (for referenceFrequency_) at the given station time
+    double computeReferenceRangeCorrection( const double stationTime );
+
     // Range correction calculator. Correction determined for referenceFrequency_
     std::shared_ptr< TabulatedMediaReferenceCorrectionManager > referenceCorrectionCalculator_;
 
@@ -962,6 +1067,12 @@ private:
 
     // Boolean indicating whether the correction is for uplink or downlink
     bool isUplinkCorrection_;
+
+    // Cache of station- and epoch-dependent terms, shared between observation models (nullptr if not used)
+    std::shared_ptr< ground_stations::StationMediaCorrectionCache > stationCache_;
+
+    // Index of the terms of this correction in stationCache_
+    int stationCacheTermIndex_;
 };
 
 // Base class for calculating the vertical total electron content (VTEC) of the ionosphere.
@@ -41,6 +41,16 @@ enum ObservationViabilityType {
     body_occultation          // properties: string = occulting body, no double
 };
 
+//! Enum defining the outcome of the batch screening of a candidate observation epoch
+enum ObservationViabilityScreeningResult {
+    screened_viable_observation,
+    screened_non_viable_observation,
+    undetermined_observation_viability
+};
+
+//! Typedef for the states of a single entry of the link end state vector, for a grid of observation epochs (one column per epoch)
+typedef Eigen::Matrix< double, 6, Eigen::Dynamic > LinkEndStateGrid;
+
 //! Base class for determining whether an observation is possible or not
 /*!
  *  Base class for determining whether an observation is possible or not. Derived classes implement specific checks, such as
@@ -69,6 +79,21 @@ public:
      *  \return True if observation is viable, false if not.
      */
     virtual bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates, const std::vector< double >& linkEndTimes ) = 0;
+
+    //! Function to compute the margin w.r.t. the viability criterion, for a full grid of observation epochs.
+    /*!
+     *  Function to compute the margin w.r.t. the viability criterion, for a full grid of observation epochs. A positive margin
+     *  denotes a viable observation, a negative margin a non-viable one. The margin is expressed as an (approximate) angle, so
+     *  that margins of different calculators can be compared to a single screening tolerance. The base class implementation
+     *  returns NaN for all epochs, denoting that the calculator does not support screening.
+     *  \param linkEndStateGrids Link end states for all epochs; each entry corresponds to the entry of the linkEndStates input
+     *  to isObservationViable, each column to a single epoch.
+     *  \param linkEndTimeGrids Link end times for all epochs; each entry corresponds to the entry of the linkEndTimes input
+     *  to isObservationViable, each row to a single epoch.
+     *  \return Viability margin for each epoch.
+     */
+    virtual Eigen::VectorXd computeViabilityMargins( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                                     const std::vector< Eigen::VectorXd >& linkEndTimeGrids );
 };
 
 double getEvaluationEpochOfViabilityBody( const std::vector< Eigen::Vector6d >& linkEndStates,
@@ -76,6 +101,22 @@ double getEvaluationEpochOfViabilityBody( const std::vector< Eigen::Vector6d >&
                                           const std::pair< int, int > linkEndIndexPair,
                                           const std::function< Eigen::Vector6d( const double ) > viabilityBodyStateFunction );
 
+//! Function to compute the positions of a viability body (occulting/avoided body), for a grid of observation epochs.
+/*!
+ *  Function to compute the positions of a viability body (occulting/avoided body), for a grid of observation epochs, evaluated at the
+ *  epochs given by getEvaluationEpochOfViabilityBody. If both link ends of the pair are evaluated at the same epochs (as is the case
+ *  for an instantaneous schedule), a single state function evaluation per epoch is used.
+ *  \param linkEndStateGrids Link end states for all epochs (see ObservationViabilityCalculator::computeViabilityMargins)
+ *  \param linkEndTimeGrids Link end times for all epochs (see ObservationViabilityCalculator::computeViabilityMargins)
+ *  \param linkEndIndexPair Indices of the link ends between which the viability body is evaluated
+ *  \param viabilityBodyStateFunction Function returning the inertial state of the viability body
+ *  \return Positions of viability body, one column per epoch.
+ */
+Eigen::Matrix3Xd getViabilityBodyPositionGrid( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                               const std::vector< Eigen::VectorXd >& linkEndTimeGrids,
+                                               const std::pair< int, int > linkEndIndexPair,
+                                               const std::function< Eigen::Vector6d( const double ) > viabilityBodyStateFunction );
+
 //! Function to check whether an observation is viable
 /*!
  * Function to check whether an observation is viable. The input from which the viability of an observation is calculated are a
@@ -110,6 +151,53 @@ bool isObservationViable( const std::vector< Eigen::Vector6d >& states,
                           const std::vector< double >& times,
                           const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators );
 
+//! Function to compute the combined viability margin of a list of viability calculators, for a grid of observation epochs
+/*!
+ * Function to compute the combined viability margin of a list of viability calculators, for a grid of observation epochs. The
+ * combined margin is the minimum of the margins of the separate calculators, and is NaN if any of the calculators does not
+ * support screening. If the list of calculators is empty, all margins are infinite.
+ * \param linkEndStateGrids Link end states for all epochs (see ObservationViabilityCalculator::computeViabilityMargins)
+ * \param linkEndTimeGrids Link end times for all epochs (see ObservationViabilityCalculator::computeViabilityMargins)
+ * \param viabilityCalculators List of viability calculators
+ * \return Combined viability margin for each epoch.
+ */
+Eigen::VectorXd computeObservationViabilityMargins(
+        const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+        const std::vector< Eigen::VectorXd >& linkEndTimeGrids,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators );
+
+//! Function to screen a grid of candidate observation epochs for viability
+/*!
+ * Function to screen a grid of candidate observation epochs for viability, from the combined viability margins of a list of
+ * viability calculators. Epochs for which the margin exceeds the screening tolerance are classified as (non-)viable, the epochs
+ * close to a rise/set boundary (or for which no margin could be computed) are left undetermined, and require an exact check.
+ * The screening tolerance should cover the difference between the link end data used for the screening and the link end data of the
+ * final observation (e.g. due to light-time effects when screening with instantaneous link end states).
+ * \param linkEndStateGrids Link end states for all epochs (see ObservationViabilityCalculator::computeViabilityMargins)
+ * \param linkEndTimeGrids Link end times for all epochs (see ObservationViabilityCalculator::computeViabilityMargins)
+ * \param viabilityCalculators List of viability calculators
+ * \param screeningTolerance Margin (as angle) below which the viability of an epoch is considered undetermined
+ * \return Screening result for each epoch.
+ */
+std::vector< ObservationViabilityScreeningResult > screenObservationViability(
+        const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+        const std::vector< Eigen::VectorXd >& linkEndTimeGrids,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators,
+        const double screeningTolerance );
+
+//! Function to compute the windows (rise/set times) in which observations are viable, from the viability margins on an epoch grid
+/*!
+ * Function to compute the windows (rise/set times) in which observations are viable, from the viability margins on a sorted
+ * epoch grid. Rise and set times are obtained by linear interpolation of the margins between the epochs at which the margin
+ * changes sign. Windows that are open at the start or end of the grid are bounded by the first/last epoch. Epochs with a NaN
+ * margin are regarded as non-viable.
+ * \param epochs Sorted grid of epochs
+ * \param viabilityMargins Viability margins at the epochs
+ * \return List of rise and set times of the viability windows
+ */
+std::vector< std::pair< double, double > > getObservationViabilityWindows( const Eigen::VectorXd& epochs,
+                                                                           const Eigen::VectorXd& viabilityMargins );
+
 //! Function to check whether an observation is possible based on minimum elevation angle criterion at one link end.
 class MinimumElevationAngleCalculator : public ObservationViabilityCalculator
 {
@@ -147,6 +235,10 @@ public:
      */
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates, const std::vector< double >& linkEndTimes );
 
+    //! Function to compute the elevation angle margin (elevation angle minus minimum elevation angle) for a grid of epochs
+    Eigen::VectorXd computeViabilityMargins( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                             const std::vector< Eigen::VectorXd >& linkEndTimeGrids );
+
 private:
     //! Vector of indices denoting which combinations of entries of vectors are to be used in isObservationViable  function
     /*!
@@ -226,6 +318,10 @@ public:
      */
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates, const std::vector< double >& linkEndTimes );
 
+    //! Function to compute the avoidance angle margin (avoidance angle minus minimum avoidance angle) for a grid of epochs
+    Eigen::VectorXd computeViabilityMargins( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                             const std::vector< Eigen::VectorXd >& linkEndTimeGrids );
+
 private:
     //! Vector of indices denoting which combinations of entries of vectors to isObservationViable are to be used.
     /*!
@@ -281,6 +377,17 @@ public:
      */
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates, const std::vector< double >& linkEndTimes );
 
+    //! Function to compute the occultation margin for a grid of epochs
+    /*!
+     *  Function to compute the occultation margin for a grid of epochs, defined as the minimum distance between the link and the
+     *  center of the occulting body, minus its radius, divided by the distance from the first link end to the occulting body.
+     *  \param linkEndStateGrids Link end states for all epochs (see ObservationViabilityCalculator::computeViabilityMargins)
+     *  \param linkEndTimeGrids Link end times for all epochs (see ObservationViabilityCalculator::computeViabilityMargins)
+     *  \return Occultation margin for each epoch.
+     */
+    Eigen::VectorXd computeViabilityMargins( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                             const std::vector< Eigen::VectorXd >& linkEndTimeGrids );
+
 private:
     //! Vector of indices denoting which combinations of entries of vectors to isObservationViable are to be used.
     /*!
@@ -29,6 +29,7 @@
 #include "tudat/basics/timeType.h"
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
 #include "tudat/math/integrators/createNumericalIntegrator.h"
+#include "tudat/math/integrators/integrationEventLocator.h"
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
 #include "tudat/math/root_finders/createRootFinder.h"
 #include "tudat/simulation/propagation_setup/propagationTermination.h"
@@ -69,11 +70,39 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
     return dependentVariableError;
 }
 
+//! Function to determine, from the dense output of the numerical integrator, the error in termination dependent variable
+/*!
+ *  Function to determine, from the dense output of the numerical integrator, the error in termination dependent variable at a
+ *  given time step w.r.t. the start of the last step. This function is used as input for the root finder when the propagation
+ *  must terminate exactly on a dependent variable value, and the exact final condition is to be located on the dense output.
+ *  Compared to getTerminationDependentVariableErrorForGivenTimeStep, only a single state derivative evaluation (to update the
+ *  environment and state derivative models) is needed, instead of a full integration step.
+ *  \param timeStep Time step w.r.t. the start of the last step at which the error is to be computed
+ *  \param integrator Numerical integrator used for propagation (must provide dense output over the last step)
+ *  \param dependentVariableTerminationCondition Settings used to determine value/type of dependent variable at which propagation
+ *  is to terminate
+ *  \param stepStartTime Time at the start of the last step
+ *  \return The difference between the reached and required value of the termination dependent variable
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType >
+TimeStepType getTerminationDependentVariableErrorFromDenseOutput(
+        TimeStepType timeStep,
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition,
+        const TimeType stepStartTime )
+{
+    // Update state derivative model to dense output state, and retrieve value of dependent variable
+    TimeType currentTime = stepStartTime + timeStep;
+    integrator->getStateDerivativeFunction( )( currentTime, integrator->getDenseOutputState( currentTime ) );
+    return static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
+}
+
 //! Function that propagates to an exact final condition (within tolerance) for dependent variable termination condition
 /*!
  * Function that propagates to an exact final condition (within tolerance) for dependent variable termination condition.
  * Determines the time step that is to be taken by using a root finder, and returns (by reference) the converged final time
- * and state.
+ * and state. If requested by the termination condition, and available from the integrator, the root is located on the dense
+ * output of the last step, after which a single step to the converged final time is taken.
  * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is rolled
  * back to the secondToLastTime/secondToLastState
  * \param dependentVariableTerminationCondition Termination condition that is to be used
@@ -99,11 +128,26 @@ void getFinalStateForExactDependentVariableTerminationCondition(
     TUDAT_UNUSED_PARAMETER( secondToLastState );
 
     // Function for which the root (zero value) occurs at the required end time/state
-    std::function< TimeStepType( TimeStepType ) > dependentVariableErrorFunction =
-            std::bind( &getTerminationDependentVariableErrorForGivenTimeStep< StateType, TimeType, TimeStepType >,
-                       std::placeholders::_1,
-                       integrator,
-                       dependentVariableTerminationCondition );
+    std::function< TimeStepType( TimeStepType ) > dependentVariableErrorFunction;
+    bool useDenseOutput = dependentVariableTerminationCondition->getLocateTerminationOnDenseOutput( ) &&
+            integrator->isDenseOutputAvailable( secondToLastTime ) && integrator->isDenseOutputAvailable( lastTime );
+    if( useDenseOutput )
+    {
+        dependentVariableErrorFunction =
+                std::bind( &getTerminationDependentVariableErrorFromDenseOutput< StateType, TimeType, TimeStepType >,
+                           std::placeholders::_1,
+                           integrator,
+                           dependentVariableTerminationCondition,
+                           secondToLastTime );
+    }
+    else
+    {
+        dependentVariableErrorFunction =
+                std::bind( &getTerminationDependentVariableErrorForGivenTimeStep< StateType, TimeType, TimeStepType >,
+                           std::placeholders::_1,
+                           integrator,
+                           dependentVariableTerminationCondition );
+    }
 
     // Create root finder.
     bool increasingTime = static_cast< double >( lastTime - secondToLastTime ) > 0.0;
@@ -133,6 +177,28 @@ void getFinalStateForExactDependentVariableTerminationCondition(
                 std::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >( dependentVariableErrorFunction ),
                 ( lastTime - secondToLastTime ) / 2.0 );
 
+        // Correct root located on dense output for interpolation error, using a single Newton iteration on the integrated
+        // solution, with the slope of the error function taken from the dense output
+        if( useDenseOutput )
+        {
+            const TimeStepType lastTimeStep = static_cast< TimeStepType >( lastTime - secondToLastTime );
+            const TimeStepType slopeTimeStep = static_cast< TimeStepType >( 1.0E-4 ) * lastTimeStep;
+            const TimeStepType slopeStartTimeStep = finalTimeStep - static_cast< TimeStepType >( 1.0E-4 ) * finalTimeStep;
+            const TimeStepType errorSlope = ( dependentVariableErrorFunction( slopeStartTimeStep + slopeTimeStep ) -
+                                              dependentVariableErrorFunction( slopeStartTimeStep ) ) /
+                    slopeTimeStep;
+
+            const TimeStepType integratedError = getTerminationDependentVariableErrorForGivenTimeStep(
+                    finalTimeStep, integrator, dependentVariableTerminationCondition );
+            const TimeStepType correctedFinalTimeStep = finalTimeStep - integratedError / errorSlope;
+            if( correctedFinalTimeStep == correctedFinalTimeStep &&
+                static_cast< double >( correctedFinalTimeStep / lastTimeStep ) > 0.0 &&
+                static_cast< double >( correctedFinalTimeStep / lastTimeStep ) <= 1.0 )
+            {
+                finalTimeStep = correctedFinalTimeStep;
+            }
+        }
+
         endState = integrator->performIntegrationStep( finalTimeStep );
         endTime = integrator->getCurrentIndependentVariable( );
     }
@@ -455,6 +521,9 @@ void propagateToExactTerminationCondition(
  *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  *  derivative model).
  *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+ *  \param processingSettings Settings for printing and saving of the propagation results.
+ *  \param eventLocator Object to locate events on the dense output of the integrator after each step (default none). If a
+ *  terminal event is located, the last step is redone to end exactly at the event, and the propagation is terminated.
  */
 template< typename SimulationResults, typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType >
 void integrateEquationsFromIntegrator(
@@ -464,7 +533,9 @@ void integrateEquationsFromIntegrator(
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
         const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
         const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings =
-                std::make_shared< SingleArcPropagatorProcessingSettings >( ) )
+                std::make_shared< SingleArcPropagatorProcessingSettings >( ),
+        const std::shared_ptr< numerical_integrators::IntegrationEventLocator< TimeType, StateType, StateType, TimeStepType > >
+                eventLocator = nullptr )
 {
     int saveFrequency = 1;
 
@@ -496,6 +567,13 @@ void integrateEquationsFromIntegrator(
         dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
     }
 
+    // Evaluate event functions at initial state
+    if( eventLocator != nullptr )
+    {
+        eventLocator->initialize( currentTime, newState );
+    }
+    bool terminalEventIsLocated = false;
+
     // Add CPU time after first saving step
     cumulativeComputationTimeHistory.clear( );
     double currentCPUTime =
@@ -582,12 +660,32 @@ void integrateEquationsFromIntegrator(
                     break;
                 }
 
+                // Locate events in last step. If a terminal event is found, redo the step such that it ends exactly at the event.
+                if( eventLocator != nullptr )
+                {
+                    if( eventLocator->processStep( integrator ) )
+                    {
+                        terminalEventIsLocated = true;
+                        integrator->rollbackToPreviousState( );
+                        integrator->setStepSizeControl( false );
+                        newState = integrator->performIntegrationStep( static_cast< TimeStepType >(
+                                eventLocator->getTerminalEvent( ).independentVariable_ - integrator->getCurrentIndependentVariable( ) ) );
+                        integrator->setStepSizeControl( true );
+                        if( statePostProcessingFunction != nullptr )
+                        {
+                            statePostProcessingFunction( newState );
+                            integrator->modifyCurrentState( newState, true );
+                        }
+                    }
+                }
+
                 // Update epoch and step-size
                 currentTime = integrator->getCurrentIndependentVariable( );
                 timeStep = integrator->getNextStepSize( );
 
-                // Save integration result in map
-                if( processingSettings->saveCurrentStep( stepsSinceLastSave,
+                // Save integration result in map (always saving the state at a terminal event)
+                if( terminalEventIsLocated ||
+                    processingSettings->saveCurrentStep( stepsSinceLastSave,
                                                          std::fabs( static_cast< double >( currentTime ) - timeOfLastSave ) ) )
                 {
                     solutionHistory[ currentTime ] = newState;
@@ -618,7 +716,12 @@ void integrateEquationsFromIntegrator(
                     1.0e-9;
             cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
 
-            if( propagationTerminationCondition->checkStopCondition(
+            if( terminalEventIsLocated )
+            {
+                propagationTerminationReason = std::make_shared< PropagationTerminationDetails >( termination_condition_reached, true );
+                breakPropagation = true;
+            }
+            else if( propagationTerminationCondition->checkStopCondition(
                         static_cast< double >( currentTime ), currentCPUTime, newState.template cast< double >( ) ) )
             {
                 // Propagate to the exact termination conditions
@@ -707,6 +810,7 @@ void integrateEquationsFromIntegrator(
  *  \param statePrintInterval Frequency with which to print progress to console (nan = never).
  *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
  *  By default now(), i.e. the moment at which this function is called.
+ *  \param eventLocator Object to locate events on the dense output of the integrator after each step (default none).
  *  \return Event that triggered the termination of the propagation
  */
 template< typename SimulationResults, typename StateType, typename TimeType = double >
@@ -719,7 +823,12 @@ void integrateEquations( std::function< StateType( const TimeType, const StateTy
                          const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
                          const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
                          const std::shared_ptr< SingleArcPropagatorProcessingSettings > processingSettings =
-                                 std::make_shared< SingleArcPropagatorProcessingSettings >( ) )
+                                 std::make_shared< SingleArcPropagatorProcessingSettings >( ),
+                         const std::shared_ptr< numerical_integrators::IntegrationEventLocator<
+                                 TimeType,
+                                 StateType,
+                                 StateType,
+                                 typename scalar_type< TimeType >::value_type > > eventLocator = nullptr )
 {
     std::function< bool( const double, const double, const Eigen::MatrixXd& ) > stopPropagationFunction =
             std::bind( &PropagationTerminationCondition::checkStopCondition,
@@ -745,7 +854,8 @@ void integrateEquations( std::function< StateType( const TimeType, const StateTy
             simulationResults,
             dependentVariableFunction,
             statePostProcessingFunction,
-            processingSettings );
+            processingSettings,
+            eventLocator );
 }
 
 }  // namespace propagators
@@ -14,6 +14,8 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
 
 #include <memory>
 #include <functional>
@@ -174,12 +176,9 @@ public:
             accelerationModelList_.at( i )->resetCurrentTime( );
         }
 
-        for( unsigned int i = 0; i < updateRemovedAccelerations_.size( ); i++ )
+        for( unsigned int i = 0; i < removedAccelerationsToUpdate_.size( ); i++ )
         {
-            if( removedCentralAccelerations_.count( updateRemovedAccelerations_.at( i ) ) > 0 )
-            {
-                removedCentralAccelerations_[ updateRemovedAccelerations_.at( i ) ]->resetCurrentTime( );
-            }
+            removedAccelerationsToUpdate_[ i ]->resetCurrentTime( );
         }
     }
 
@@ -205,17 +204,15 @@ public:
      */
     void updateStateDerivativeModel( const TimeType currentTime )
     {
-        for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+        // Update models per group of identical concrete type (see createAccelerationModelList)
+        for( unsigned int i = 0; i < accelerationModelsToUpdate_.size( ); i++ )
         {
-            accelerationModelList_.at( i )->updateMembers( currentTime );
+            accelerationModelsToUpdate_[ i ]->updateMembers( currentTime );
         }
 
-        for( unsigned int i = 0; i < updateRemovedAccelerations_.size( ); i++ )
+        for( unsigned int i = 0; i < removedAccelerationsToUpdate_.size( ); i++ )
         {
-            if( removedCentralAccelerations_.count( updateRemovedAccelerations_.at( i ) ) > 0 )
-            {
-                removedCentralAccelerations_[ updateRemovedAccelerations_.at( i ) ]->updateMembers( currentTime );
-            }
+            removedAccelerationsToUpdate_[ i ]->updateMembers( currentTime );
         }
     }
 
@@ -360,6 +357,7 @@ public:
         if( removedCentralAccelerations_.count( bodyName ) > 0 )
         {
             updateRemovedAccelerations_.push_back( bodyName );
+            removedAccelerationsToUpdate_.push_back( removedCentralAccelerations_.at( bodyName ).get( ) );
         }
     }
 
@@ -387,28 +385,70 @@ protected:
         }
     }
 
-    // Function to set the vector of acceleration models (accelerationModelList_) form the map of map of
-    // acceleration models (accelerationModelsPerBody_).
+    // Function to set the vector of acceleration models (accelerationModelList_) from the map of map of acceleration models
+    // (accelerationModelsPerBody_). In addition, the lists of (raw pointers to) the acceleration models that are used at each
+    // state derivative evaluation are created, so that the nested maps need not be traversed during the propagation: a list of
+    // models in the order in which they are summed, with the index of the acceleration in the state derivative, and a list of
+    // models in the order in which they are updated. In the latter, models of identical concrete type are stored consecutively
+    // (in order of first occurrence of each type), so that successive updates call the same implementation. The order in which
+    // the accelerations acting on a single body are summed is unchanged w.r.t. accelerationModelsPerBody_.
     void createAccelerationModelList( )
     {
-        // Iterate over all accelerations and update their internal state.
         accelerationModelList_.clear( );
+        accelerationModelsToSum_.clear( );
+        accelerationStateIndices_.clear( );
+
+        std::vector< std::type_index > accelerationModelTypes;
+        std::vector< std::vector< basic_astrodynamics::AccelerationModel< Eigen::Vector3d >* > > accelerationModelsPerType;
+
+        // Iterate over all bodies with accelerations.
         for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
              outerAccelerationIterator != accelerationModelsPerBody_.end( );
              outerAccelerationIterator++ )
         {
+            int currentBodyIndex = static_cast< int >(
+                    std::distance( bodiesToBeIntegratedNumerically_.begin( ),
+                                   std::find( bodiesToBeIntegratedNumerically_.begin( ),
+                                              bodiesToBeIntegratedNumerically_.end( ),
+                                              outerAccelerationIterator->first ) ) );
+
             // Iterate over all accelerations acting on body
             for( innerAccelerationIterator = outerAccelerationIterator->second.begin( );
                  innerAccelerationIterator != outerAccelerationIterator->second.end( );
                  innerAccelerationIterator++ )
             {
-                // Update accelerations
                 for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                 {
+                    basic_astrodynamics::AccelerationModel< Eigen::Vector3d >* currentAcceleration =
+                            innerAccelerationIterator->second.at( j ).get( );
+
                     accelerationModelList_.push_back( innerAccelerationIterator->second.at( j ) );
+                    accelerationModelsToSum_.push_back( currentAcceleration );
+                    accelerationStateIndices_.push_back( currentBodyIndex * 6 + 3 );
+
+                    // Add model to list of models of the same concrete type
+                    std::type_index currentType = std::type_index( typeid( *currentAcceleration ) );
+                    unsigned int typeIndex = static_cast< unsigned int >(
+                            std::find( accelerationModelTypes.begin( ), accelerationModelTypes.end( ), currentType ) -
+                            accelerationModelTypes.begin( ) );
+                    if( typeIndex == accelerationModelTypes.size( ) )
+                    {
+                        accelerationModelTypes.push_back( currentType );
+                        accelerationModelsPerType.push_back(
+                                std::vector< basic_astrodynamics::AccelerationModel< Eigen::Vector3d >* >( ) );
+                    }
+                    accelerationModelsPerType.at( typeIndex ).push_back( currentAcceleration );
                 }
             }
         }
+
+        accelerationModelsToUpdate_.clear( );
+        for( unsigned int i = 0; i < accelerationModelsPerType.size( ); i++ )
+        {
+            accelerationModelsToUpdate_.insert( accelerationModelsToUpdate_.end( ),
+                                                accelerationModelsPerType.at( i ).begin( ),
+                                                accelerationModelsPerType.at( i ).end( ) );
+        }
     }
 
     // Function to get the state derivative of the system in Cartesian coordinates.
@@ -425,41 +465,24 @@ protected:
                                           Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > stateDerivative,
                                           const bool addPositionDerivatives = true )
     {
-        using namespace basic_astrodynamics;
-
         stateDerivative.setZero( );
 
-        int currentBodyIndex = 0;
-        int currentAccelerationIndex = 0;
-
-        // Iterate over all bodies with accelerations.
-        for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
-             outerAccelerationIterator != accelerationModelsPerBody_.end( );
-             outerAccelerationIterator++ )
+        // Add all accelerations to state derivative.
+        for( unsigned int i = 0; i < accelerationModelsToSum_.size( ); i++ )
         {
-            currentBodyIndex = bodyOrder_[ currentAccelerationIndex ];
-
-            // Iterate over all accelerations acting on body
-            for( innerAccelerationIterator = outerAccelerationIterator->second.begin( );
-                 innerAccelerationIterator != outerAccelerationIterator->second.end( );
-                 innerAccelerationIterator++ )
-            {
-                for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
-                {
-                    // Calculate acceleration and add to state derivative.
-                    stateDerivative.block( currentBodyIndex * 6 + 3, 0, 3, 1 ) +=
-                            ( innerAccelerationIterator->second[ j ]->getAccelerationScalingFactor( ) *
-                              innerAccelerationIterator->second[ j ]->getUnscaledAccelerationReference( ) ).template cast< StateScalarType >( );
-                }
-            }
+            stateDerivative.template block< 3, 1 >( accelerationStateIndices_[ i ], 0 ) +=
+                    ( accelerationModelsToSum_[ i ]->getAccelerationScalingFactor( ) *
+                      accelerationModelsToSum_[ i ]->getUnscaledAccelerationReference( ) ).template cast< StateScalarType >( );
+        }
 
-            if( addPositionDerivatives )
+        if( addPositionDerivatives )
+        {
+            // Add body velocity as derivative of its position.
+            for( unsigned int i = 0; i < bodyOrder_.size( ); i++ )
             {
-                // Add body velocity as derivative of its position.
-                stateDerivative.block( currentBodyIndex * 6, 0, 3, 1 ) =
-                        ( stateOfSystemToBeIntegrated.segment( currentBodyIndex * 6 + 3, 3 ) );
+                stateDerivative.template block< 3, 1 >( bodyOrder_[ i ] * 6, 0 ) =
+                        stateOfSystemToBeIntegrated.template segment< 3 >( bodyOrder_[ i ] * 6 + 3 );
             }
-            currentAccelerationIndex++;
         }
     }
 
@@ -501,6 +524,18 @@ protected:
     // Vector of acceleration models, containing all entries of accelerationModelsPerBody_.
     std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > accelerationModelList_;
 
+    // List of acceleration models, in the order in which they are added to the state derivative
+    std::vector< basic_astrodynamics::AccelerationModel< Eigen::Vector3d >* > accelerationModelsToSum_;
+
+    // Index in state derivative at which the accelerations in accelerationModelsToSum_ are to be added
+    std::vector< int > accelerationStateIndices_;
+
+    // List of acceleration models, in the order in which they are updated (grouped by concrete type)
+    std::vector< basic_astrodynamics::AccelerationModel< Eigen::Vector3d >* > accelerationModelsToUpdate_;
+
+    // List of removed central accelerations that are to be updated (see setUpdateRemovedAcceleration)
+    std::vector< gravitation::CentralGravitationalAccelerationModel3d* > removedAccelerationsToUpdate_;
+
     // Object responsible for providing the current integration origins from the global origins.
     std::shared_ptr< CentralBodyData< StateScalarType, TimeType > > centralBodyData_;
 
@@ -29,7 +29,7 @@ public:
 
     Eigen::Vector3d getAccelerationOfBody( const int bodyIndex )
     {
-        return currentAccelerations_[ bodyIndex ];
+        return currentAccelerations_.col( bodyIndex );
     }
 
     Eigen::Vector3d getAccelerationOfBody( const std::string bodyName )
@@ -37,88 +37,94 @@ public:
         return getAccelerationOfBody( acceleratedBodyMap_.at( bodyName ) );
     }
 
-    Eigen::Vector3d& getRelativePositions( const int bodyUndergoing, const int bodyExerting )
+    Eigen::Vector3d getRelativePositions( const int bodyUndergoing, const int bodyExerting )
     {
-        return currentRelativePositions_.at( bodyUndergoing ).at( bodyExerting );
+        return getPairSign( bodyUndergoing, bodyExerting ) * pairRelativePositions_.col( pairIndices_( bodyUndergoing, bodyExerting ) );
     }
 
     double getRelativeDistance( const int bodyUndergoing, const int bodyExerting )
     {
-        return currentRelativeDistances_.at( bodyUndergoing ).at( bodyExerting );
+        return pairDistances_( pairIndices_( bodyUndergoing, bodyExerting ) );
     }
 
     double getInverseSquareDistance( const int bodyUndergoing, const int bodyExerting )
     {
-        return currentInverseSquareDistances_.at( bodyUndergoing ).at( bodyExerting );
+        return pairInverseSquareDistances_( pairIndices_( bodyUndergoing, bodyExerting ) );
     }
 
-    Eigen::Vector3d& getRelativeVelocity( const int bodyUndergoing, const int bodyExerting )
+    Eigen::Vector3d getRelativeVelocity( const int bodyUndergoing, const int bodyExerting )
     {
-        return currentRelativeVelocities_.at( bodyUndergoing ).at( bodyExerting );
+        return getPairSign( bodyUndergoing, bodyExerting ) * pairRelativeVelocities_.col( pairIndices_( bodyUndergoing, bodyExerting ) );
     }
 
-    Eigen::Vector3d& getVelocity( const int bodyIndex )
+    Eigen::Vector3d getVelocity( const int bodyIndex )
     {
-        return currentVelocities_.at( bodyIndex );
+        return currentVelocities_.col( bodyIndex );
     }
 
     double getGravitationalParameter( const int bodyIndex )
     {
-        return currentGravitationalParameters_.at( bodyIndex );
+        return currentGravitationalParameters_( bodyIndex );
     }
 
     double getTotalScalarTermCorrection( const int bodyUndergoing, const int bodyExerting )
     {
-        return totalScalarTermCorrection.at( bodyUndergoing ).at( bodyExerting );
+        return totalScalarTermCorrections_( bodyUndergoing, bodyExerting );
     }
 
-    Eigen::Vector3d& getTotalVectorTermCorrection( const int bodyUndergoing, const int bodyExerting )
+    Eigen::Vector3d getTotalVectorTermCorrection( const int bodyUndergoing, const int bodyExerting )
     {
-        return totalVectorTermCorrection_.at( bodyUndergoing ).at( bodyExerting );
+        return totalVectorTermCorrections_.col( bodyUndergoing * numberOfAcceleratingBodies_ + bodyExerting );
     }
 
     double getSingleSourceLocalPotential( const int bodyUndergoing, const int bodyExerting )
     {
-        return currentSingleSourceLocalPotential_.at( bodyUndergoing ).at( bodyExerting );
+        return currentGravitationalParameters_( bodyExerting ) *
+                pairInverseDistances_( pairIndices_( bodyUndergoing, bodyExerting ) );
     }
 
-    Eigen::Vector3d& getSinglePointMassAccelerations( const int bodyUndergoing, const int bodyExerting )
+    Eigen::Vector3d getSinglePointMassAccelerations( const int bodyUndergoing, const int bodyExerting )
     {
-        return singlePointMassAccelerations_.at( bodyUndergoing ).at( bodyExerting );
+        return ( getPairSign( bodyUndergoing, bodyExerting ) * currentGravitationalParameters_( bodyExerting ) ) *
+                pairScaledRelativePositions_.col( pairIndices_( bodyUndergoing, bodyExerting ) );
     }
 
     double getLineOfSighSpeed( const int bodyUndergoing, const int bodyExerting )
     {
-        return lineOfSightSpeed_.at( bodyUndergoing ).at( bodyExerting );
+        return lineOfSightSpeed_( bodyUndergoing, bodyExerting );
     }
 
     double getLocalPotential( const int bodyIndex )
     {
-        return currentLocalPotentials_.at( bodyIndex );
+        return currentLocalPotentials_( bodyIndex );
     }
 
-    Eigen::Vector3d& getTotalPointMassAcceleration( const int bodyIndex )
+    Eigen::Vector3d getTotalPointMassAcceleration( const int bodyIndex )
     {
-        return totalPointMassAccelerations_.at( bodyIndex );
+        return totalPointMassAccelerations_.col( bodyIndex );
     }
 
     std::vector< std::vector< std::vector< double > > > getScalarEihCorrections( )
     {
+        computeExpansionTerms( );
         return scalarEihCorrections_;
     }
 
     double getScalarEihCorrection( const int k, const int bodyUndergoing, const int bodyExerting )
     {
+        computeExpansionTerms( );
         return scalarEihCorrections_.at( k ).at( bodyUndergoing ).at( bodyExerting );
     }
 
     std::vector< std::vector< std::vector< Eigen::Vector3d > > > getVectorEihCorrections( )
     {
+        computeExpansionTerms( );
         return vectorEihCorrections_;
     }
 
     Eigen::Vector3d getVectorEihCorrection( const int k, const int bodyUndergoing, const int bodyExerting )
     {
+        computeExpansionTerms( );
         return vectorEihCorrections_.at( k ).at( bodyUndergoing ).at( bodyExerting );
     }
 
@@ -167,6 +173,16 @@ public:
 private:
     void calculateAccelerations( );
 
+    // Computes the individual terms of the EIH expansion, which are only needed by the partials, and are therefore not
+    // computed by update( ), but on request of one of the get*EihCorrection(s) functions.
+    void computeExpansionTerms( );
+
+    // Sign with which the pairwise buffers are to be multiplied to obtain the (anti-symmetric) quantity for i and j.
+    double getPairSign( const int bodyUndergoing, const int bodyExerting )
+    {
+        return ( bodyUndergoing < bodyExerting ) ? 1.0 : -1.0;
+    }
+
     std::vector< std::string > acceleratedBodies_;
 
     std::vector< std::string > acceleratingBodies_;
@@ -185,55 +201,71 @@ private:
 
     std::map< std::string, int > acceleratingBodyMap_;
 
+    int numberOfAcceleratedBodies_;
+
+    int numberOfAcceleratingBodies_;
+
+    // Number of unique body pairs, N(N-1)/2 for N accelerating bodies
+    int numberOfBodyPairs_;
+
+    // Index of the pair (i,j) in the pairwise buffers below, which store only the upper triangle (i < j). The diagonal
+    // entries point to an additional column at the end of the buffers, which is kept at zero.
+    Eigen::MatrixXi pairIndices_;
+
     // mu_{i}
-    std::vector< double > currentGravitationalParameters_;
+    Eigen::VectorXd currentGravitationalParameters_;
 
-    // v_{i}
-    std::vector< Eigen::Vector3d > currentVelocities_;
+    // v_{i}, stored per column
+    Eigen::Matrix3Xd currentVelocities_;
 
-    // r_{i}
-    std::vector< Eigen::Vector3d > currentPositions_;
+    // r_{i}, stored per column
+    Eigen::Matrix3Xd currentPositions_;
 
     // v_{i} * v_{i}
-    std::vector< double > currentSquareSpeeds_;
+    Eigen::VectorXd currentSquareSpeeds_;
+
+    // sum_(j not i) ( mu_j / ||r_{ij}|| )
+    Eigen::VectorXd currentLocalPotentials_;
 
-    // sum_(j not i) ( mu_j / ||r_{ij}|| ) = sum( currentSingleSourceLocalPotential_ )
-    std::vector< double > currentLocalPotentials_;
+    // sum_(j not i) ( mu_{j} * r_{ij} / ||r_{ij}||^3 ), stored per column
+    Eigen::Matrix3Xd totalPointMassAccelerations_;
 
-    // sum_(j not i) ( mu_{j} * r_{ij} / ||r_{ij}||^3 ) = sum( singlePointMassAccelerations_ )
-    std::vector< Eigen::Vector3d > totalPointMassAccelerations_;
+    // r_{ij} = r_{j} - r_{i}, for i < j
+    Eigen::Matrix3Xd pairRelativePositions_;
 
-    // r_{ij} = r_{j} - r_{i}
-    std::vector< std::vector< Eigen::Vector3d > > currentRelativePositions_;
+    // v_{ij} = v_{j} - v_{i}, for i < j
+    Eigen::Matrix3Xd pairRelativeVelocities_;
 
-    // v_{ij} = v_{j} - v_{i}
-    std::vector< std::vector< Eigen::Vector3d > > currentRelativeVelocities_;
+    // || r_{ij} ||, for i < j
+    Eigen::VectorXd pairDistances_;
 
-    // || r_{ij} ||
-    std::vector< std::vector< double > > currentRelativeDistances_;
+    // 1 / || r_{ij} ||, for i < j
+    Eigen::VectorXd pairInverseDistances_;
 
-    // 1  / || r_{ij} ||^2
-    std::vector< std::vector< double > > currentInverseSquareDistances_;
+    // 1 / || r_{ij} ||^2, for i < j
+    Eigen::VectorXd pairInverseSquareDistances_;
+
+    // r_{ij} / ||r_{ij}||^3, for i < j
+    Eigen::Matrix3Xd pairScaledRelativePositions_;
 
     // r_{ij} * v_{j}
-    std::vector< std::vector< double > > lineOfSightSpeed_;
+    Eigen::MatrixXd lineOfSightSpeed_;
 
     // v_{i} * v_{j}
-    std::vector< std::vector< double > > velocityInnerProducts_;
-
-    // mu_j / ||r_{ij}||
-    std::vector< std::vector< double > > currentSingleSourceLocalPotential_;
+    Eigen::MatrixXd velocityInnerProducts_;
 
-    // mu_{j} * r_{ij} / ||r_{ij}||^3
-    std::vector< std::vector< Eigen::Vector3d > > singlePointMassAccelerations_;
+    // Sum of scalar terms of EIH expansion, per (i,j)
+    Eigen::MatrixXd totalScalarTermCorrections_;
 
-    std::vector< std::vector< Eigen::Vector3d > > currentSingleAccelerations_;
+    // Sum of vector terms of EIH expansion, column i * N + j for (i,j)
+    Eigen::Matrix3Xd totalVectorTermCorrections_;
 
-    std::vector< std::vector< double > > totalScalarTermCorrection;
+    // Part of scalar EIH terms that depends only on the exerting body j
+    Eigen::VectorXd exertingBodyScalarTerms_;
 
-    std::vector< std::vector< Eigen::Vector3d > > totalVectorTermCorrection_;
+    Eigen::Matrix3Xd currentAccelerations_;
 
-    std::vector< Eigen::Vector3d > currentAccelerations_;
+    bool expansionTermsAreComputed_;
 
     std::vector< std::vector< std::vector< double > > > scalarEihCorrections_;
 
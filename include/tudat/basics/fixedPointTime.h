@@ -0,0 +1,838 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_FIXEDPOINTTIME_H
+#define TUDAT_FIXEDPOINTTIME_H
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "tudat/basics/timeType.h"
+
+namespace tudat
+{
+
+//! Number of fixed-point ticks per second in FixedPointTime (2^50, so that conversion from and to double is exact scaling)
+static constexpr int64_t FIXED_POINT_TIME_TICKS_PER_SECOND = static_cast< int64_t >( 1 ) << 50;
+
+//! Number of fixed-point ticks per full period (hour) in FixedPointTime (about 4.05E18, which fits in a 64-bit integer)
+static constexpr int64_t FIXED_POINT_TIME_TICKS_PER_PERIOD =
+        static_cast< int64_t >( TIME_NORMALIZATION_INTEGER_TERM ) * FIXED_POINT_TIME_TICKS_PER_SECOND;
+
+//! Class for defining time with sub-femtosecond resolution over very long periods of time, without long double arithmetic.
+/*!
+ *  Class for defining time with sub-femtosecond resolution over very long periods of time, with the same interface as the
+ *  Time class. Where the Time class represents the time into the current hour as a long double (which on x86 results in x87
+ *  instructions for every operation), this class uses an int to represent the number of hours since an epoch, and a 64-bit
+ *  integer to represent the time into the present hour as a fixed-point number, in ticks of 2^-50 s (about 0.89 fs).
+ *  Addition, subtraction and comparison of two FixedPointTime objects are therefore exact integer operations, and conversion
+ *  from and to double requires only a scaling by a power of two. Multiplication and division by a floating point value are
+ *  performed using error-free double products, and are accurate to about 1.0E-16 times the result (and at least to one
+ *  tick). Long double values can be used as input and output, but are split into two double values on conversion.
+ */
+class FixedPointTime
+{
+public:
+    constexpr FixedPointTime( ): fullPeriods_( 0 ), ticksIntoFullPeriod_( 0 ) { }
+
+    //! Constructor, sets current hour and time into current hour directly
+    /*!
+     * Constructor, sets current hour and time into current hour directly
+     * \param fullPeriods Number of full hours since epoch
+     * \param secondsIntoFullPeriod Number of seconds into current hour. Note that this value need not be in the range
+     * between 0 and 3600: the time representation is normalized upon construction.
+     */
+    FixedPointTime( const int fullPeriods, const double secondsIntoFullPeriod ): FixedPointTime( secondsIntoFullPeriod )
+    {
+        fullPeriods_ += fullPeriods;
+    }
+
+    //! Constructor, sets current hour and time into current hour (as long double) directly
+    /*!
+     * Constructor, sets current hour and time into current hour (as long double) directly
+     * \param fullPeriods Number of full hours since epoch
+     * \param secondsIntoFullPeriod Number of seconds into current hour. Note that this value need not be in the range
+     * between 0 and 3600: the time representation is normalized upon construction.
+     */
+    FixedPointTime( const int fullPeriods, const long double secondsIntoFullPeriod ): FixedPointTime( secondsIntoFullPeriod )
+    {
+        fullPeriods_ += fullPeriods;
+    }
+
+    //! Constructor, sets number of seconds since epoch (with long double representation as input)
+    /*!
+     * Constructor, sets number of seconds since epoch (with long double representation as input). The input is split into
+     * two doubles, which are converted separately.
+     * \param numberOfSeconds Number of seconds since epoch.
+     */
+    FixedPointTime( const long double numberOfSeconds ): FixedPointTime( static_cast< double >( numberOfSeconds ) )
+    {
+        const double highSeconds = static_cast< double >( numberOfSeconds );
+        *this += FixedPointTime( static_cast< double >( numberOfSeconds - static_cast< long double >( highSeconds ) ) );
+    }
+
+    //! Constructor, sets number of seconds since epoch (with double representation as input)
+    /*!
+     * Constructor, sets number of seconds since epoch (with double representation as input), rounded to the nearest tick
+     * \param numberOfSeconds Number of seconds since epoch.
+     */
+    FixedPointTime( const double numberOfSeconds )
+    {
+        if( numberOfSeconds >= 0.0 && numberOfSeconds < TIME_NORMALIZATION_DOUBLE_TERM )
+        {
+            // Convert directly to ticks if input is inside first period (scaling is exact)
+            fullPeriods_ = 0;
+            ticksIntoFullPeriod_ = roundToInteger( numberOfSeconds * TICKS_PER_SECOND_DOUBLE );
+            normalizeMembers( );
+        }
+        else
+        {
+            // Split input in full periods and remainder, where the latter is computed exactly as a double-double value
+            const double fullPeriods = std::floor( numberOfSeconds / TIME_NORMALIZATION_DOUBLE_TERM );
+            const double negativePeriodSeconds = -fullPeriods * TIME_NORMALIZATION_DOUBLE_TERM;
+            const double secondsIntoFullPeriod = numberOfSeconds + negativePeriodSeconds;
+            const double roundingTerm = secondsIntoFullPeriod - numberOfSeconds;
+            const double secondsIntoFullPeriodError = ( numberOfSeconds - ( secondsIntoFullPeriod - roundingTerm ) ) +
+                    ( negativePeriodSeconds - roundingTerm );
+
+            *this = fromScaledComponents( fullPeriods,
+                                          0.0,
+                                          secondsIntoFullPeriod * TICKS_PER_SECOND_DOUBLE,
+                                          secondsIntoFullPeriodError * TICKS_PER_SECOND_DOUBLE );
+        }
+    }
+
+    //! Constructor, sets number of seconds since epoch (with int representation as input)
+    /*!
+     * Constructor, sets number of seconds since epoch (with int representation as input)
+     * \param numberOfSeconds Number of seconds since epoch.
+     */
+    FixedPointTime( const int numberOfSeconds ):
+        fullPeriods_( numberOfSeconds / TIME_NORMALIZATION_INTEGER_TERM ),
+        ticksIntoFullPeriod_( static_cast< int64_t >( numberOfSeconds % TIME_NORMALIZATION_INTEGER_TERM ) *
+                              FIXED_POINT_TIME_TICKS_PER_SECOND )
+    {
+        normalizeMembers( );
+    }
+
+    //! Constructor, converts a Time object to a FixedPointTime object
+    /*!
+     * Constructor, converts a Time object to a FixedPointTime object (rounded to the nearest tick).
+     * \param time Time object that is to be converted.
+     */
+    explicit FixedPointTime( const Time& time ): FixedPointTime( time.getFullPeriods( ), time.getSecondsIntoFullPeriod( ) ) { }
+
+    //! Function to create a FixedPointTime object directly from its internal representation
+    /*!
+     * Function to create a FixedPointTime object directly from its internal representation
+     * \param fullPeriods Number of full hours since epoch
+     * \param ticksIntoFullPeriod Number of ticks (of 2^-50 s) into current hour (need not be in the range of a single hour)
+     * \return FixedPointTime object
+     */
+    static FixedPointTime fromTicks( const int fullPeriods, const int64_t ticksIntoFullPeriod )
+    {
+        FixedPointTime time;
+        time.fullPeriods_ = fullPeriods;
+        time.ticksIntoFullPeriod_ = ticksIntoFullPeriod;
+        time.normalizeMembers( );
+        return time;
+    }
+
+    //! Function to convert this object to a Time object (exact, since the ticks are exactly representable as long double)
+    Time getTime( ) const
+    {
+        return Time( fullPeriods_,
+                     static_cast< long double >( ticksIntoFullPeriod_ ) /
+                             static_cast< long double >( FIXED_POINT_TIME_TICKS_PER_SECOND ) );
+    }
+
+    std::size_t hash( ) const
+    {
+        std::size_t h1 = std::hash< int >{ }( fullPeriods_ );
+        std::size_t h2 = std::hash< int64_t >{ }( ticksIntoFullPeriod_ );
+        return h1 ^ ( h2 << 1 );
+    }
+
+    //! Addition operator for two FixedPointTime objects
+    /*!
+     * Addition operator for two FixedPointTime objects (exact, using integer arithmetic only)
+     * \param timeToAdd1 First time that is to be added.
+     * \param timeToAdd2 Second time that is to be added.
+     * \return Input arguments, added together
+     */
+    friend FixedPointTime operator+( const FixedPointTime& timeToAdd1, const FixedPointTime& timeToAdd2 )
+    {
+        FixedPointTime result = timeToAdd1;
+        result += timeToAdd2;
+        return result;
+    }
+
+    //! Addition operator for double variable with FixedPointTime object.
+    friend FixedPointTime operator+( const double timeToAdd1, const FixedPointTime& timeToAdd2 )
+    {
+        return FixedPointTime( timeToAdd1 ) + timeToAdd2;
+    }
+
+    //! Addition operator for long double variable with FixedPointTime object.
+    friend FixedPointTime operator+( const long double timeToAdd1, const FixedPointTime& timeToAdd2 )
+    {
+        return FixedPointTime( timeToAdd1 ) + timeToAdd2;
+    }
+
+    //! Addition operator for FixedPointTime object with double variable
+    friend FixedPointTime operator+( const FixedPointTime& timeToAdd1, const double timeToAdd2 )
+    {
+        return timeToAdd1 + FixedPointTime( timeToAdd2 );
+    }
+
+    //! Addition operator for FixedPointTime object with long double variable
+    friend FixedPointTime operator+( const FixedPointTime& timeToAdd1, const long double timeToAdd2 )
+    {
+        return timeToAdd1 + FixedPointTime( timeToAdd2 );
+    }
+
+    //! Subtraction operator for two FixedPointTime objects
+    /*!
+     * Subtraction operator for two FixedPointTime objects (exact, using integer arithmetic only)
+     * \param timeToSubtract1 Time from which second time is to be subtracted
+     * \param timeToSubtract2 Time that is to be subtracted from first input
+     * \return Input arguments, subtracted from one another
+     */
+    friend FixedPointTime operator-( const FixedPointTime& timeToSubtract1, const FixedPointTime& timeToSubtract2 )
+    {
+        FixedPointTime result = timeToSubtract1;
+        result -= timeToSubtract2;
+        return result;
+    }
+
+    //! Subtraction operator for double from FixedPointTime object
+    friend FixedPointTime operator-( const FixedPointTime& timeToSubtract1, const double timeToSubtract2 )
+    {
+        return timeToSubtract1 - FixedPointTime( timeToSubtract2 );
+    }
+
+    //! Subtraction operator for long double from FixedPointTime object
+    friend FixedPointTime operator-( const FixedPointTime& timeToSubtract1, const long double timeToSubtract2 )
+    {
+        return timeToSubtract1 - FixedPointTime( timeToSubtract2 );
+    }
+
+    //! Subtraction operator for FixedPointTime object from double
+    friend FixedPointTime operator-( const double timeToSubtract1, const FixedPointTime& timeToSubtract2 )
+    {
+        return FixedPointTime( timeToSubtract1 ) - timeToSubtract2;
+    }
+
+    //! Subtraction operator for FixedPointTime object from long double
+    friend FixedPointTime operator-( const long double timeToSubtract1, const FixedPointTime& timeToSubtract2 )
+    {
+        return FixedPointTime( timeToSubtract1 ) - timeToSubtract2;
+    }
+
+    //! Multiplication operator of a double with a FixedPointTime object (i.e. to rescale time)
+    /*!
+     * Multiplication operator of a double with a FixedPointTime object (i.e. to rescale time). The products of the factor with
+     * the full periods and ticks are computed as double-double values, so that no precision is lost before rounding
+     * to the nearest tick.
+     * \param timeToMultiply1 Value by which time is to be multiplied
+     * \param timeToMultiply2 Time that is to be multiplied by first input argument
+     * \return Multiplied FixedPointTime object.
+     */
+    friend FixedPointTime operator*( const double timeToMultiply1, const FixedPointTime& timeToMultiply2 )
+    {
+        const double fullPeriods = static_cast< double >( timeToMultiply2.fullPeriods_ );
+        const double scaledPeriods = timeToMultiply1 * fullPeriods;
+        const double scaledPeriodsError = computeProductError( timeToMultiply1, fullPeriods, scaledPeriods );
+
+        double ticksHigh, ticksLow;
+        timeToMultiply2.getSplitTicks( ticksHigh, ticksLow );
+        const double scaledTicks = timeToMultiply1 * ticksHigh;
+        const double scaledTicksError =
+                computeProductError( timeToMultiply1, ticksHigh, scaledTicks ) + timeToMultiply1 * ticksLow;
+
+        return fromScaledComponents( scaledPeriods, scaledPeriodsError, scaledTicks, scaledTicksError );
+    }
+
+    //! Multiplication operator of a FixedPointTime object with a double (i.e. to rescale time)
+    friend FixedPointTime operator*( const FixedPointTime& timeToMultiply1, const double timeToMultiply2 )
+    {
+        return timeToMultiply2 * timeToMultiply1;
+    }
+
+    //! Multiplication operator of a long double with a FixedPointTime object (factor is used in double precision)
+    friend FixedPointTime operator*( const long double timeToMultiply1, const FixedPointTime& timeToMultiply2 )
+    {
+        return static_cast< double >( timeToMultiply1 ) * timeToMultiply2;
+    }
+
+    //! Multiplication operator of a FixedPointTime object with a long double (factor is used in double precision)
+    friend FixedPointTime operator*( const FixedPointTime& timeToMultiply1, const long double timeToMultiply2 )
+    {
+        return static_cast< double >( timeToMultiply2 ) * timeToMultiply1;
+    }
+
+    //! Division operator of a FixedPointTime object with a double (i.e. to rescale time)
+    /*!
+     * Division operator of a FixedPointTime object with a double (i.e. to rescale time). The quotients of the full periods and
+     * ticks with the divisor are computed as double-double values, so that no precision is lost before rounding to
+     * the nearest tick.
+     * \param original Time that is to be divided by second input argument
+     * \param doubleToDivideBy Value by which first argument is to be divided.
+     * \return Divided FixedPointTime object.
+     */
+    friend FixedPointTime operator/( const FixedPointTime& original, const double doubleToDivideBy )
+    {
+        const double fullPeriods = static_cast< double >( original.fullPeriods_ );
+        const double dividedPeriods = fullPeriods / doubleToDivideBy;
+        const double dividedPeriodsError = computeDivisionRemainder( fullPeriods, doubleToDivideBy, dividedPeriods ) / doubleToDivideBy;
+
+        double ticksHigh, ticksLow;
+        original.getSplitTicks( ticksHigh, ticksLow );
+        const double dividedTicks = ticksHigh / doubleToDivideBy;
+        const double dividedTicksError =
+                ( computeDivisionRemainder( ticksHigh, doubleToDivideBy, dividedTicks ) + ticksLow ) / doubleToDivideBy;
+
+        return fromScaledComponents( dividedPeriods, dividedPeriodsError, dividedTicks, dividedTicksError );
+    }
+
+    //! Division operator of a FixedPointTime object with a long double (divisor is used in double precision)
+    friend FixedPointTime operator/( const FixedPointTime& original, const long double doubleToDivideBy )
+    {
+        return original / static_cast< double >( doubleToDivideBy );
+    }
+
+    //! Add and assign operator for adding a FixedPointTime
+    void operator+=( const FixedPointTime& timeToAdd )
+    {
+        fullPeriods_ += timeToAdd.fullPeriods_;
+        ticksIntoFullPeriod_ += timeToAdd.ticksIntoFullPeriod_;
+        if( ticksIntoFullPeriod_ >= FIXED_POINT_TIME_TICKS_PER_PERIOD )
+        {
+            ticksIntoFullPeriod_ -= FIXED_POINT_TIME_TICKS_PER_PERIOD;
+            fullPeriods_++;
+        }
+    }
+
+    //! Add and assign operator for adding a double
+    void operator+=( const double timeToAdd )
+    {
+        *this += FixedPointTime( timeToAdd );
+    }
+
+    //! Add and assign operator for adding a long double
+    void operator+=( const long double timeToAdd )
+    {
+        *this += FixedPointTime( timeToAdd );
+    }
+
+    //! Subtract and assign operator for subtracting a FixedPointTime
+    void operator-=( const FixedPointTime& timeToSubtract )
+    {
+        fullPeriods_ -= timeToSubtract.fullPeriods_;
+        ticksIntoFullPeriod_ -= timeToSubtract.ticksIntoFullPeriod_;
+        if( ticksIntoFullPeriod_ < 0 )
+        {
+            ticksIntoFullPeriod_ += FIXED_POINT_TIME_TICKS_PER_PERIOD;
+            fullPeriods_--;
+        }
+    }
+
+    //! Subtract and assign operator for subtracting a double
+    void operator-=( const double timeToSubtract )
+    {
+        *this -= FixedPointTime( timeToSubtract );
+    }
+
+    //! Subtract and assign operator for subtracting a long double
+    void operator-=( const long double timeToSubtract )
+    {
+        *this -= FixedPointTime( timeToSubtract );
+    }
+
+    //! Multiply and assign operator for multiplying by double
+    void operator*=( const double timeToMultiply )
+    {
+        *this = timeToMultiply * *this;
+    }
+
+    //! Multiply and assign operator for multiplying by long double (factor is used in double precision)
+    void operator*=( const long double timeToMultiply )
+    {
+        *this = static_cast< double >( timeToMultiply ) * *this;
+    }
+
+    //! Divide and assign operator for dividing by double
+    void operator/=( const double timeToDivide )
+    {
+        *this = *this / timeToDivide;
+    }
+
+    //! Divide and assign operator for dividing by long double (divisor is used in double precision)
+    void operator/=( const long double timeToDivide )
+    {
+        *this = *this / static_cast< double >( timeToDivide );
+    }
+
+    //! Equality operator for two FixedPointTime objects
+    friend bool operator==( const FixedPointTime& timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return ( timeToCompare1.fullPeriods_ == timeToCompare2.fullPeriods_ ) &&
+                ( timeToCompare1.ticksIntoFullPeriod_ == timeToCompare2.ticksIntoFullPeriod_ );
+    }
+
+    //! Inequality operator for two FixedPointTime objects
+    friend bool operator!=( const FixedPointTime& timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Equality operator for a FixedPointTime object with an integer (compared at double precision).
+    friend bool operator==( const FixedPointTime& timeToCompare1, const int timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) == static_cast< double >( timeToCompare2 ) );
+    }
+
+    //! Equality operator for a FixedPointTime object with a double (compared at double precision).
+    friend bool operator==( const FixedPointTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) == timeToCompare2 );
+    }
+
+    //! Equality operator for a double with a FixedPointTime object (compared at double precision).
+    friend bool operator==( const double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return ( timeToCompare2.getSeconds< double >( ) == timeToCompare1 );
+    }
+
+    //! Inequality operator for a FixedPointTime object with a double (compared at double precision).
+    friend bool operator!=( const FixedPointTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Inequality operator for a double with a FixedPointTime object (compared at double precision).
+    friend bool operator!=( const double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Equality operator for a FixedPointTime object with a long double (compared as FixedPointTime).
+    friend bool operator==( const FixedPointTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return timeToCompare1 == FixedPointTime( timeToCompare2 );
+    }
+
+    //! Equality operator for a long double with a FixedPointTime object (compared as FixedPointTime).
+    friend bool operator==( const long double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return FixedPointTime( timeToCompare1 ) == timeToCompare2;
+    }
+
+    //! Inequality operator for a FixedPointTime object with a long double (compared as FixedPointTime).
+    friend bool operator!=( const FixedPointTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Inequality operator for a long double with a FixedPointTime object (compared as FixedPointTime).
+    friend bool operator!=( const long double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return !operator==( timeToCompare1, timeToCompare2 );
+    }
+
+    //! Greater-than operator for two FixedPointTime objects
+    friend bool operator>( const FixedPointTime& timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return ( timeToCompare1.fullPeriods_ > timeToCompare2.fullPeriods_ ) ||
+                ( ( timeToCompare1.fullPeriods_ == timeToCompare2.fullPeriods_ ) &&
+                  ( timeToCompare1.ticksIntoFullPeriod_ > timeToCompare2.ticksIntoFullPeriod_ ) );
+    }
+
+    //! Greater-than-or-equal-to operator for two FixedPointTime objects
+    friend bool operator>=( const FixedPointTime& timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return !( timeToCompare1 < timeToCompare2 );
+    }
+
+    //! Smaller-than operator for two FixedPointTime objects
+    friend bool operator<( const FixedPointTime& timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return timeToCompare2 > timeToCompare1;
+    }
+
+    //! Smaller-than-or-equal-to operator for two FixedPointTime objects
+    friend bool operator<=( const FixedPointTime& timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return !( timeToCompare1 > timeToCompare2 );
+    }
+
+    //! Smaller-than operator for FixedPointTime object with double (compared at double precision)
+    friend bool operator<( const FixedPointTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) < timeToCompare2 );
+    }
+
+    //! Smaller-than operator for FixedPointTime object with long double (compared as FixedPointTime)
+    friend bool operator<( const FixedPointTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return timeToCompare1 < FixedPointTime( timeToCompare2 );
+    }
+
+    //! Smaller-than-or-equal operator for FixedPointTime object with double (compared at double precision)
+    friend bool operator<=( const FixedPointTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) <= timeToCompare2 );
+    }
+
+    //! Smaller-than-or-equal operator for FixedPointTime object with long double (compared as FixedPointTime)
+    friend bool operator<=( const FixedPointTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return timeToCompare1 <= FixedPointTime( timeToCompare2 );
+    }
+
+    //! Greater-than operator for FixedPointTime object with double (compared at double precision)
+    friend bool operator>( const FixedPointTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) > timeToCompare2 );
+    }
+
+    //! Greater-than operator for FixedPointTime object with long double (compared as FixedPointTime)
+    friend bool operator>( const FixedPointTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return timeToCompare1 > FixedPointTime( timeToCompare2 );
+    }
+
+    //! Greater-than-or-equal operator for FixedPointTime object with double (compared at double precision)
+    friend bool operator>=( const FixedPointTime& timeToCompare1, const double timeToCompare2 )
+    {
+        return ( timeToCompare1.getSeconds< double >( ) >= timeToCompare2 );
+    }
+
+    //! Greater-than-or-equal operator for FixedPointTime object with long double (compared as FixedPointTime)
+    friend bool operator>=( const FixedPointTime& timeToCompare1, const long double timeToCompare2 )
+    {
+        return timeToCompare1 >= FixedPointTime( timeToCompare2 );
+    }
+
+    //! Smaller-than operator for double with FixedPointTime object (compared at double precision)
+    friend bool operator<( const double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 < timeToCompare2.getSeconds< double >( ) );
+    }
+
+    //! Smaller-than operator for long double with FixedPointTime object (compared as FixedPointTime)
+    friend bool operator<( const long double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return FixedPointTime( timeToCompare1 ) < timeToCompare2;
+    }
+
+    //! Smaller-than-or-equal operator for double with FixedPointTime object (compared at double precision)
+    friend bool operator<=( const double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 <= timeToCompare2.getSeconds< double >( ) );
+    }
+
+    //! Smaller-than-or-equal operator for long double with FixedPointTime object (compared as FixedPointTime)
+    friend bool operator<=( const long double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return FixedPointTime( timeToCompare1 ) <= timeToCompare2;
+    }
+
+    //! Greater-than operator for double with FixedPointTime object (compared at double precision)
+    friend bool operator>( const double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 > timeToCompare2.getSeconds< double >( ) );
+    }
+
+    //! Greater-than operator for long double with FixedPointTime object (compared as FixedPointTime)
+    friend bool operator>( const long double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return FixedPointTime( timeToCompare1 ) > timeToCompare2;
+    }
+
+    //! Greater-than-or-equal operator for double with FixedPointTime object (compared at double precision)
+    friend bool operator>=( const double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return ( timeToCompare1 >= timeToCompare2.getSeconds< double >( ) );
+    }
+
+    //! Greater-than-or-equal operator for long double with FixedPointTime object (compared as FixedPointTime)
+    friend bool operator>=( const long double timeToCompare1, const FixedPointTime& timeToCompare2 )
+    {
+        return FixedPointTime( timeToCompare1 ) >= timeToCompare2;
+    }
+
+    //! Output operator for FixedPointTime object
+    friend std::ostream& operator<<( std::ostream& stream, const FixedPointTime& timeToPrint )
+    {
+        stream << "(" << timeToPrint.getFullPeriods( ) << ", " << timeToPrint.getSecondsIntoFullPeriod( ) << ") ";
+        return stream;
+    }
+
+    //! Function to get the total seconds since epoch, in templated precision
+    /*!
+     *  Function to get the total seconds since epoch, in templated precision. The integer number of seconds is computed
+     *  exactly, so that only a single rounding occurs when converting to floating point precision.
+     *  \return Total seconds since epoch.
+     */
+    template< typename ScalarType >
+    ScalarType getSeconds( ) const
+    {
+        return static_cast< ScalarType >( static_cast< int64_t >( fullPeriods_ ) * TIME_NORMALIZATION_INTEGER_TERM +
+                                          ( ticksIntoFullPeriod_ >> TICKS_PER_SECOND_EXPONENT ) ) +
+                static_cast< ScalarType >( ticksIntoFullPeriod_ & TICKS_INTO_SECOND_MASK ) /
+                static_cast< ScalarType >( FIXED_POINT_TIME_TICKS_PER_SECOND );
+    }
+
+    //! Function to get the total seconds since epoch, in int precision (cast of FixedPointTime to int)
+    operator int( ) const
+    {
+        return fullPeriods_ * TIME_NORMALIZATION_INTEGER_TERM + static_cast< int >( ticksIntoFullPeriod_ >> TICKS_PER_SECOND_EXPONENT );
+    }
+
+    //! Function to get the total seconds since epoch, in double precision (cast of FixedPointTime to double)
+    operator double( ) const
+    {
+        return getSeconds< double >( );
+    }
+
+    //! Function to get the total seconds since epoch, in long double precision (cast of FixedPointTime to long double)
+    operator long double( ) const
+    {
+        return getSeconds< long double >( );
+    }
+
+    //! Function to get the number of full hours since epoch
+    int getFullPeriods( ) const
+    {
+        return fullPeriods_;
+    }
+
+    //! Function to get the number of seconds into current hour
+    double getSecondsIntoFullPeriod( ) const
+    {
+        return static_cast< double >( ticksIntoFullPeriod_ ) / TICKS_PER_SECOND_DOUBLE;
+    }
+
+    //! Function to get the number of ticks (of 2^-50 s) into current hour
+    int64_t getTicksIntoFullPeriod( ) const
+    {
+        return ticksIntoFullPeriod_;
+    }
+
+    int fullDaysSinceEpoch( ) const
+    {
+        if( fullPeriods_ >= 0 || ( ( fullPeriods_ % TIME_NORMALIZATION_TERMS_PER_DAY ) == 0 ) )
+        {
+            return fullPeriods_ / TIME_NORMALIZATION_TERMS_PER_DAY;
+        }
+        else
+        {
+            return fullPeriods_ / TIME_NORMALIZATION_TERMS_PER_DAY - 1;
+        }
+    }
+
+    int fullPeriodsIntoCurrentDay( ) const
+    {
+        return fullPeriods_ - fullDaysSinceEpoch( ) * TIME_NORMALIZATION_TERMS_PER_DAY;
+    }
+
+    double secondsSinceNoon( ) const
+    {
+        return static_cast< double >( fullPeriodsIntoCurrentDay( ) * TIME_NORMALIZATION_INTEGER_TERM ) + getSecondsIntoFullPeriod( );
+    }
+
+    int fullPeriodsSinceMidnight( ) const
+    {
+        int fullPeriodsIntoCurrentDay = this->fullPeriodsIntoCurrentDay( );
+        if( fullPeriodsIntoCurrentDay < TIME_NORMALIZATION_TERMS_PER_HALF_DAY )
+        {
+            return fullPeriodsIntoCurrentDay + TIME_NORMALIZATION_TERMS_PER_HALF_DAY;
+        }
+        else
+        {
+            return fullPeriodsIntoCurrentDay - TIME_NORMALIZATION_TERMS_PER_HALF_DAY;
+        }
+    }
+
+    double secondsSinceMidnight( ) const
+    {
+        return static_cast< double >( fullPeriodsSinceMidnight( ) * TIME_NORMALIZATION_INTEGER_TERM ) + getSecondsIntoFullPeriod( );
+    }
+
+protected:
+    //! Number of seconds in a full period, as double
+    static constexpr double TIME_NORMALIZATION_DOUBLE_TERM = static_cast< double >( TIME_NORMALIZATION_INTEGER_TERM );
+
+    //! Number of ticks in a second, as double
+    static constexpr double TICKS_PER_SECOND_DOUBLE = static_cast< double >( FIXED_POINT_TIME_TICKS_PER_SECOND );
+
+    //! Base-2 logarithm of the number of ticks in a second
+    static constexpr int TICKS_PER_SECOND_EXPONENT = 50;
+
+    //! Bit mask to retrieve the ticks into the current second from the (non-negative) ticks into the current period
+    static constexpr int64_t TICKS_INTO_SECOND_MASK = FIXED_POINT_TIME_TICKS_PER_SECOND - 1;
+
+    //! Number of ticks in a full period, as double (exactly representable)
+    static constexpr double TICKS_PER_PERIOD_DOUBLE = static_cast< double >( FIXED_POINT_TIME_TICKS_PER_PERIOD );
+
+    //! Maximum absolute number of ticks that is rounded to int64 without first removing full periods
+    static constexpr double MAXIMUM_DIRECTLY_ROUNDED_TICKS = 4.5E18;
+
+    //! Function to renormalize the members, so that ticksIntoFullPeriod_ is between 0 and FIXED_POINT_TIME_TICKS_PER_PERIOD
+    void normalizeMembers( )
+    {
+        if( ticksIntoFullPeriod_ < 0 || ticksIntoFullPeriod_ >= FIXED_POINT_TIME_TICKS_PER_PERIOD )
+        {
+            int64_t periodsToAdd = ticksIntoFullPeriod_ / FIXED_POINT_TIME_TICKS_PER_PERIOD;
+            ticksIntoFullPeriod_ -= periodsToAdd * FIXED_POINT_TIME_TICKS_PER_PERIOD;
+            if( ticksIntoFullPeriod_ < 0 )
+            {
+                ticksIntoFullPeriod_ += FIXED_POINT_TIME_TICKS_PER_PERIOD;
+                periodsToAdd--;
+            }
+            fullPeriods_ += static_cast< int >( periodsToAdd );
+        }
+    }
+
+    //! Function to split the ticks into the current hour into a double and (exact) double remainder
+    void getSplitTicks( double& ticksHigh, double& ticksLow ) const
+    {
+        ticksHigh = static_cast< double >( ticksIntoFullPeriod_ );
+        ticksLow = static_cast< double >( ticksIntoFullPeriod_ - static_cast< int64_t >( ticksHigh ) );
+    }
+
+    //! Function to compute the rounding error of the product of two doubles (exactly, barring underflow)
+    static double computeProductError( const double factor1, const double factor2, const double product )
+    {
+#ifdef FP_FAST_FMA
+        return std::fma( factor1, factor2, -product );
+#else
+        // Dekker's algorithm (avoids software emulation of fma on targets without hardware support)
+        double factor1High, factor1Low, factor2High, factor2Low;
+        splitDouble( factor1, factor1High, factor1Low );
+        splitDouble( factor2, factor2High, factor2Low );
+        return ( ( ( factor1High * factor2High - product ) + factor1High * factor2Low ) + factor1Low * factor2High ) +
+                factor1Low * factor2Low;
+#endif
+    }
+
+    //! Function to split a double into two doubles with non-overlapping 26-bit mantissas (Veltkamp splitting)
+    static void splitDouble( const double value, double& highPart, double& lowPart )
+    {
+        const double scaledValue = 134217729.0 * value;
+        highPart = scaledValue - ( scaledValue - value );
+        lowPart = value - highPart;
+    }
+
+    //! Function to compute the remainder dividend - quotient * divisor (exactly, if quotient is close to dividend / divisor)
+    static double computeDivisionRemainder( const double dividend, const double divisor, const double quotient )
+    {
+        const double product = quotient * divisor;
+        return ( dividend - product ) - computeProductError( quotient, divisor, product );
+    }
+
+    //! Function to round a double (with absolute value below 2^62) to the nearest integer, without calls to libm
+    static int64_t roundToInteger( const double value )
+    {
+        const int64_t truncatedValue = static_cast< int64_t >( value );
+        const double fraction = value - static_cast< double >( truncatedValue );
+        return truncatedValue + static_cast< int64_t >( fraction >= 0.5 ) - static_cast< int64_t >( fraction <= -0.5 );
+    }
+
+    //! Function to create a FixedPointTime from a double-double number of periods and of ticks
+    /*!
+     *  Function to create a FixedPointTime from a double-double number of periods and a double-double number of ticks
+     *  (which need not be in the range of a single period). The fractional part of the periods is converted to ticks,
+     *  and all parts are rounded to integers separately, so that the rounding errors can be accumulated in double precision.
+     *  \param scaledPeriods High part of the number of periods
+     *  \param scaledPeriodsError Low part of the number of periods
+     *  \param ticksHigh High part of the number of ticks into the full period
+     *  \param ticksLow Low part of the number of ticks into the full period
+     *  \return FixedPointTime object, rounded to the nearest tick
+     */
+    static FixedPointTime fromScaledComponents( const double scaledPeriods,
+                                                const double scaledPeriodsError,
+                                                const double ticksHigh,
+                                                const double ticksLow )
+    {
+        // Convert fractional part of periods to ticks
+        const double roundedPeriods = std::floor( scaledPeriods );
+        const double periodFraction = scaledPeriods - roundedPeriods;
+        const double periodTicks = periodFraction * TICKS_PER_PERIOD_DOUBLE;
+        const int64_t roundedPeriodTicks = roundToInteger( periodTicks );
+        double remainingTicks = ( periodTicks - static_cast< double >( roundedPeriodTicks ) ) +
+                computeProductError( periodFraction, TICKS_PER_PERIOD_DOUBLE, periodTicks ) +
+                scaledPeriodsError * TICKS_PER_PERIOD_DOUBLE + ticksLow;
+
+        // Move full periods out of high part of ticks, if it cannot be rounded to int64 directly (exact, since the
+        // result is then a multiple of the spacing of ticksHigh)
+        double periodsInHighPart = 0.0;
+        double reducedTicksHigh = ticksHigh;
+        if( std::fabs( ticksHigh ) > MAXIMUM_DIRECTLY_ROUNDED_TICKS )
+        {
+            periodsInHighPart = std::floor( ticksHigh / TICKS_PER_PERIOD_DOUBLE );
+            reducedTicksHigh = computeDivisionRemainder( ticksHigh, TICKS_PER_PERIOD_DOUBLE, periodsInHighPart );
+        }
+        const int64_t roundedTicksHigh = roundToInteger( reducedTicksHigh );
+        remainingTicks += reducedTicksHigh - static_cast< double >( roundedTicksHigh );
+
+        return fromTicks( static_cast< int >( roundedPeriods + periodsInHighPart ),
+                          roundedPeriodTicks + roundedTicksHigh + roundToInteger( remainingTicks ) );
+    }
+
+    //! Number of full hours since epoch
+    int fullPeriods_;
+
+    //! Number of ticks into current hour
+    int64_t ticksIntoFullPeriod_;
+};
+
+//! Function to convert a list of times in seconds since epoch to FixedPointTime objects
+/*!
+ *  Function to convert a list of times in seconds since epoch to FixedPointTime objects, using only double and integer
+ *  arithmetic.
+ *  \param secondsSinceEpoch List of times in seconds since epoch
+ *  \return List of FixedPointTime objects
+ */
+std::vector< FixedPointTime > convertSecondsToFixedPointTimes( const std::vector< double >& secondsSinceEpoch );
+
+//! Function to convert a list of FixedPointTime objects to seconds since epoch (in double precision)
+/*!
+ *  Function to convert a list of FixedPointTime objects to seconds since epoch (in double precision). The loop contains no
+ *  branches or long double arithmetic, so that it can be vectorized by the compiler.
+ *  \param times List of FixedPointTime objects
+ *  \return List of times in seconds since epoch
+ */
+std::vector< double > convertFixedPointTimesToSeconds( const std::vector< FixedPointTime >& times );
+
+//! Function to compute the seconds (in double precision) of a list of FixedPointTime objects since a reference time
+/*!
+ *  Function to compute the seconds (in double precision) of a list of FixedPointTime objects since a reference time. The
+ *  difference with the reference time is computed exactly, before conversion to double, so that the result is accurate
+ *  to double precision of the difference (rather than of the absolute time).
+ *  \param times List of FixedPointTime objects
+ *  \param referenceTime Reference time w.r.t. which the seconds are computed
+ *  \return List of seconds since the reference time
+ */
+std::vector< double > computeSecondsSinceReferenceTime( const std::vector< FixedPointTime >& times, const FixedPointTime& referenceTime );
+
+//! Function to convert a list of Time objects to FixedPointTime objects
+std::vector< FixedPointTime > convertTimesToFixedPointTimes( const std::vector< Time >& times );
+
+//! Function to convert a list of FixedPointTime objects to Time objects
+std::vector< Time > convertFixedPointTimesToTimes( const std::vector< FixedPointTime >& times );
+
+}  // namespace tudat
+
+#endif  // TUDAT_FIXEDPOINTTIME_H
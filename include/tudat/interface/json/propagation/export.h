@@ -14,6 +14,7 @@
 #include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
 #include "tudat/simulation/estimation_setup/variationalEquationsSolver.h"
 #include "tudat/interface/json/propagation/variable.h"
+#include "tudat/io/columnarBinaryFile.h"
 
 #include "tudat/interface/json/support/valueAccess.h"
 #include "tudat/interface/json/support/valueConversions.h"
@@ -67,6 +68,13 @@ public:
 
     //! Whether to show, in the terminal, the indices in the output vector where variables are saved
     bool printVariableIndicesToTerminal_ = false;
+
+    //! Whether to export the results to a binary columnar file (see input_output::ColumnarBinaryFileWriter) instead of a text file.
+    //! The epochs are always stored in the first column, and the header (if any) is stored as metadata.
+    bool binary_ = false;
+
+    //! Whether to compress the results, if they are exported to a binary columnar file.
+    bool compressBinary_ = false;
 };
 
 //! Create a `json` object from a shared pointer to a `ExportSettings` object.
@@ -103,6 +111,7 @@ void exportResultsOfDynamicsSimulator(
         std::vector< std::shared_ptr< VariableSettings > > variables;
         std::vector< unsigned int > variableSizes;
         std::vector< unsigned int > variableIndices;
+        std::vector< std::string > columnNames = { "epoch" };
 
         // Determine number of columns (not including first column = epoch).
         unsigned int cols = 0;
@@ -195,6 +204,12 @@ void exportResultsOfDynamicsSimulator(
                     std::cout << cols << ", " << getVariableId( variable ) << std::endl;
                 }
 
+                for( unsigned int j = 0; j < variableSize; j++ )
+                {
+                    columnNames.push_back( variableSize == 1 ? getVariableId( variable )
+                                                             : getVariableId( variable ) + "[" + std::to_string( j ) + "]" );
+                }
+
                 cols += variableSize;
             }
         }
@@ -259,7 +274,18 @@ void exportResultsOfDynamicsSimulator(
             results[ epoch ] = result;
         }
 
-        if( exportSettings->epochsInFirstColumn_ )
+        if( exportSettings->binary_ )
+        {
+            // Write results map to binary file.
+            writeDataMapToColumnarBinaryFile(
+                    results,
+                    exportSettings->outputFile_.string( ),
+                    columnNames,
+                    generic_columnar_content,
+                    exportSettings->compressBinary_ ? xor_delta_run_length_compression : no_columnar_compression,
+                    exportSettings->header_ );
+        }
+        else if( exportSettings->epochsInFirstColumn_ )
         {
             // Write results map to file.
             writeDataMapToTextFile( results, exportSettings->outputFile_, exportSettings->header_, exportSettings->numericalPrecision_ );
@@ -298,7 +324,16 @@ void exportResultsOfVariationalEquations(
             switch( variable->variableType_ )
             {
                 case stateTransitionMatrix: {
-                    if( exportSettings->epochsInFirstColumn_ )
+                    if( exportSettings->binary_ )
+                    {
+                        // Write results map to binary file.
+                        writeMatrixHistoryToColumnarBinaryFile(
+                                variationalEquationsSolver->getNumericalVariationalEquationsSolution( )[ 0 ],
+                                exportSettings->outputFile_.string( ),
+                                exportSettings->compressBinary_ ? xor_delta_run_length_compression : no_columnar_compression,
+                                exportSettings->header_ );
+                    }
+                    else if( exportSettings->epochsInFirstColumn_ )
                     {
                         // Write results map to file.
                         writeDataMapToTextFile( variationalEquationsSolver->getNumericalVariationalEquationsSolution( )[ 0 ],
@@ -313,7 +348,16 @@ void exportResultsOfVariationalEquations(
                     break;
                 }
                 case sensitivityMatrix: {
-                    if( exportSettings->epochsInFirstColumn_ )
+                    if( exportSettings->binary_ )
+                    {
+                        // Write results map to binary file.
+                        writeMatrixHistoryToColumnarBinaryFile(
+                                variationalEquationsSolver->getNumericalVariationalEquationsSolution( )[ 1 ],
+                                exportSettings->outputFile_.string( ),
+                                exportSettings->compressBinary_ ? xor_delta_run_length_compression : no_columnar_compression,
+                                exportSettings->header_ );
+                    }
+                    else if( exportSettings->epochsInFirstColumn_ )
                     {
                         // Write results map to file.
                         writeDataMapToTextFile( variationalEquationsSolver->getNumericalVariationalEquationsSolution( )[ 1 ],
@@ -483,6 +483,8 @@ struct Keys {
         static const std::string onlyFinalStep;
         static const std::string numericalPrecision;
         static const std::string printVariableIndicesToTerminal;
+        static const std::string binary;
+        static const std::string compressBinary;
     };
 
     static const std::string options;
@@ -12,9 +12,11 @@
 #ifndef TUDAT_SPICE_EPHEMERIS_H
 #define TUDAT_SPICE_EPHEMERIS_H
 
+#include <memory>
 #include <string>
 
 #include "tudat/astro/basic_astro/timeConversions.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
 #include "tudat/astro/ephemerides/ephemeris.h"
 
 #include "tudat/interface/spice/spiceInterface.h"
@@ -44,6 +46,35 @@ public:
     //! @get_docstring(SpiceEphemeris.get_cartesian_state)
     Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
 
+    //! Function to precompute Chebyshev segments of this ephemeris in a given time interval
+    /*!
+     *  Function to precompute Chebyshev segments of this ephemeris in a given time interval (see createChebyshevEphemeris).
+     *  Subsequent calls to getCartesianState for times inside this interval evaluate the (read-only) segments, without
+     *  calling CSPICE. Since all calls to CSPICE are serialized (see spice_interface::getSpiceMutex), this allows the
+     *  ephemeris to be evaluated concurrently from many threads. Times outside the interval are still retrieved from CSPICE.
+     *  This function should not be called while other threads are evaluating this ephemeris.
+     *  \param startTime Start time of the interval in which segments are computed.
+     *  \param endTime End time of the interval in which segments are computed.
+     *  \param polynomialDegree Degree of the Chebyshev polynomials.
+     *  \param positionTolerance Maximum position error of the segments w.r.t. the CSPICE ephemeris.
+     */
+    void precomputeSegments( const double startTime,
+                             const double endTime,
+                             const int polynomialDegree = 12,
+                             const double positionTolerance = 1.0E-3 );
+
+    //! Function to remove the precomputed segments, so that all states are retrieved from CSPICE.
+    void clearPrecomputedSegments( )
+    {
+        std::atomic_store( &precomputedSegments_, std::shared_ptr< ChebyshevEphemeris >( ) );
+    }
+
+    //! Function to retrieve the precomputed segments (nullptr if none)
+    std::shared_ptr< ChebyshevEphemeris > getPrecomputedSegments( ) const
+    {
+        return std::atomic_load( &precomputedSegments_ );
+    }
+
 private:
     //! Name of body of which ephemeris is to be determined
     /*!
@@ -80,6 +111,9 @@ private:
 
     //! Offset of reference julian day (from J2000) w.r.t. which ephemeris is evaluated.
     double referenceDayOffSet_;
+
+    //! Chebyshev segments precomputed from CSPICE, used for evaluation inside their interval (nullptr if none)
+    std::shared_ptr< ChebyshevEphemeris > precomputedSegments_;
 };
 
 }  // namespace ephemerides
@@ -24,6 +24,7 @@
 #ifndef TUDAT_SPICE_INTERFACE_H
 #define TUDAT_SPICE_INTERFACE_H
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -48,6 +49,16 @@ namespace tudat
 namespace spice_interface
 {
 
+//! Function to retrieve the mutex through which all calls to CSPICE are serialized
+/*!
+ *  Function to retrieve the mutex through which all calls to CSPICE are serialized. CSPICE uses process-wide state (kernel
+ *  pool, error status and internal buffers), and is not thread-safe. All functions in this interface lock this mutex for
+ *  the duration of their CSPICE calls, so that they can be safely called from multiple threads. Code that calls CSPICE
+ *  directly, while other threads may use this interface, must lock this mutex as well.
+ *  \return Mutex through which all calls to CSPICE are serialized
+ */
+std::recursive_mutex& getSpiceMutex( );
+
 //! @get_docstring(convert_julian_date_to_ephemeris_time)
 double convertJulianDateToEphemerisTime( const double julianDate );
 
@@ -0,0 +1,486 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_COLUMNARBINARYFILE_H
+#define TUDAT_COLUMNARBINARYFILE_H
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Type of content stored in a binary columnar file
+enum ColumnarBinaryContentType {
+    generic_columnar_content = 0,
+    state_history_columnar_content = 1,
+    dependent_variable_history_columnar_content = 2,
+    matrix_history_columnar_content = 3,
+    observation_residual_columnar_content = 4
+};
+
+//! Compression applied to the columns of a chunk in a binary columnar file
+/*!
+ *  Compression applied to the columns of a chunk in a binary columnar file. The xor_delta_run_length_compression option
+ *  replaces each value by its bitwise XOR with the previous value in the same column, regroups the resulting words per byte
+ *  significance and run-length encodes the result. It is lossless, requires no external libraries, and is effective for smooth
+ *  histories (where the sign, exponent and leading mantissa bits of consecutive values coincide) and for integer-valued columns.
+ */
+enum ColumnarBinaryCompression { no_columnar_compression = 0, xor_delta_run_length_compression = 1 };
+
+//! Description of the contents of a binary columnar file, stored in its header.
+struct ColumnarBinaryFileDescription {
+    ColumnarBinaryFileDescription( ):
+        contentType( generic_columnar_content ), compression( no_columnar_compression ), chunkSize( 4096 ), entryRows( 0 ),
+        entryColumns( 0 )
+    { }
+
+    //! Type of content stored in the file
+    ColumnarBinaryContentType contentType;
+
+    //! Compression applied to chunks written to the file
+    ColumnarBinaryCompression compression;
+
+    //! Maximum number of rows per chunk
+    int32_t chunkSize;
+
+    //! Number of rows of a single (matrix) entry, for matrix histories (0 if not applicable)
+    int32_t entryRows;
+
+    //! Number of columns of a single (matrix) entry, for matrix histories (0 if not applicable)
+    int32_t entryColumns;
+
+    //! Names of the columns (first column is, by convention, the epoch)
+    std::vector< std::string > columnNames;
+
+    //! Free-form metadata (e.g. frame origin/orientation, propagator settings)
+    std::string metadata;
+};
+
+//! Class to write a binary columnar file, in which a table of float64 values is stored per column in chunks of rows.
+/*!
+ *  Class to write a binary columnar file, in which a table of float64 values is stored in a sequence of chunks, each containing
+ *  a number of rows that are stored contiguously per column. The file starts with a self-describing header (column names,
+ *  content type and metadata). Rows are buffered, and written to file (and flushed) each time a chunk is full, so that the
+ *  file can be written incrementally (e.g. during a propagation) and read while it is being written. A chunk that is only
+ *  partially written (e.g. due to a crash) is ignored when reading, and overwritten when the file is reopened for appending.
+ *  The file is written in the native byte order.
+ */
+class ColumnarBinaryFileWriter
+{
+public:
+    //! Constructor, opens the file and writes its header (or checks the existing header when appending).
+    /*!
+     *  Constructor, opens the file and writes its header (or checks the existing header when appending).
+     *  \param fileName Name of the file to which the data is to be written
+     *  \param description Description of the file contents (column names, content type, compression, etc.). When appending to
+     *  an existing file, the column names must match those in the file, and the settings in the file are used for the other
+     *  fields.
+     *  \param appendToExistingFile Boolean denoting whether rows are to be appended to an existing file (if it exists).
+     */
+    ColumnarBinaryFileWriter( const std::string& fileName,
+                              const ColumnarBinaryFileDescription& description,
+                              const bool appendToExistingFile = false );
+
+    //! Destructor, writes any buffered rows and closes the file
+    ~ColumnarBinaryFileWriter( );
+
+    ColumnarBinaryFileWriter( const ColumnarBinaryFileWriter& ) = delete;
+
+    ColumnarBinaryFileWriter& operator=( const ColumnarBinaryFileWriter& ) = delete;
+
+    //! Function to append a single row to the file
+    /*!
+     *  Function to append a single row to the file, writing a chunk to file if the buffer is full.
+     *  \param row Values in the row, of size equal to the number of columns
+     */
+    void appendRow( const Eigen::Ref< const Eigen::VectorXd >& row );
+
+    //! Function to append a single row to the file, with the epoch in the first column
+    /*!
+     *  Function to append a single row to the file, with the epoch in the first column.
+     *  \param epoch Epoch, stored in first column
+     *  \param values Values in the remaining columns (size must be one less than the number of columns)
+     */
+    void appendRow( const double epoch, const Eigen::Ref< const Eigen::VectorXd >& values );
+
+    //! Function to append a block of rows to the file
+    /*!
+     *  Function to append a block of rows to the file.
+     *  \param rows Block of rows, with number of columns equal to the number of columns in the file
+     */
+    void appendRows( const Eigen::Ref< const Eigen::MatrixXd >& rows );
+
+    //! Function to write all buffered rows to file as a (possibly incomplete) chunk, and flush the stream
+    void flush( );
+
+    //! Function to write all buffered rows to file and close the file
+    void close( );
+
+    //! Function to retrieve the description of the file contents
+    const ColumnarBinaryFileDescription& getDescription( ) const
+    {
+        return description_;
+    }
+
+    //! Function to retrieve the total number of rows in the file (including those that are buffered)
+    std::size_t getNumberOfRows( ) const
+    {
+        return numberOfWrittenRows_ + numberOfBufferedRows_;
+    }
+
+private:
+    //! Function to write the file header
+    void writeHeader( );
+
+    //! Name of the file
+    std::string fileName_;
+
+    //! Description of the file contents
+    ColumnarBinaryFileDescription description_;
+
+    //! Number of columns in the file
+    int numberOfColumns_;
+
+    //! Stream to which data is written
+    std::ofstream stream_;
+
+    //! Buffered rows, stored per column (column i starts at index i * chunkSize)
+    std::vector< double > buffer_;
+
+    //! Number of rows currently in the buffer
+    int numberOfBufferedRows_;
+
+    //! Number of rows written to file
+    std::size_t numberOfWrittenRows_;
+
+    //! Buffer used to store compressed column data
+    std::vector< unsigned char > compressionBuffer_;
+};
+
+//! Class to read a binary columnar file (as written by ColumnarBinaryFileWriter)
+/*!
+ *  Class to read a binary columnar file (as written by ColumnarBinaryFileWriter). The file is memory mapped (on POSIX
+ *  systems), so that uncompressed columns can be accessed without copying, using getChunkColumnData. On other systems, the
+ *  file is read into memory in its entirety. A trailing chunk that is incomplete (e.g. because the file is still being written)
+ *  is ignored.
+ */
+class ColumnarBinaryFileReader
+{
+public:
+    //! Constructor, opens (and maps) the file, reads its header and locates all complete chunks
+    /*!
+     *  Constructor, opens (and maps) the file, reads its header and locates all complete chunks
+     *  \param fileName Name of the binary columnar file
+     */
+    ColumnarBinaryFileReader( const std::string& fileName );
+
+    //! Destructor, unmaps the file
+    ~ColumnarBinaryFileReader( );
+
+    ColumnarBinaryFileReader( const ColumnarBinaryFileReader& ) = delete;
+
+    ColumnarBinaryFileReader& operator=( const ColumnarBinaryFileReader& ) = delete;
+
+    //! Function to retrieve the description of the file contents
+    const ColumnarBinaryFileDescription& getDescription( ) const
+    {
+        return description_;
+    }
+
+    //! Function to retrieve the names of the columns
+    const std::vector< std::string >& getColumnNames( ) const
+    {
+        return description_.columnNames;
+    }
+
+    //! Function to retrieve the metadata string
+    const std::string& getMetadata( ) const
+    {
+        return description_.metadata;
+    }
+
+    //! Function to retrieve the number of columns
+    int getNumberOfColumns( ) const
+    {
+        return static_cast< int >( description_.columnNames.size( ) );
+    }
+
+    //! Function to retrieve the total number of (complete) rows in the file
+    std::size_t getNumberOfRows( ) const
+    {
+        return numberOfRows_;
+    }
+
+    //! Function to retrieve the number of complete chunks in the file
+    int getNumberOfChunks( ) const
+    {
+        return static_cast< int >( chunks_.size( ) );
+    }
+
+    //! Function to retrieve the number of rows in a given chunk
+    int getNumberOfRowsInChunk( const int chunkIndex ) const
+    {
+        return static_cast< int >( chunks_.at( chunkIndex ).numberOfRows );
+    }
+
+    //! Function to retrieve the size (in bytes) of the valid part of the file (header and all complete chunks)
+    std::size_t getValidFileSize( ) const
+    {
+        return validFileSize_;
+    }
+
+    //! Function to retrieve the index of a column from its name
+    int getColumnIndex( const std::string& columnName ) const;
+
+    //! Function to retrieve a pointer to the contiguous values of a column in a single chunk, without copying
+    /*!
+     *  Function to retrieve a pointer to the contiguous values of a column in a single chunk, without copying. This is only
+     *  possible for uncompressed chunks; for compressed chunks, a nullptr is returned (use readColumn instead). The pointer
+     *  is valid for the lifetime of this object.
+     *  \param chunkIndex Index of the chunk
+     *  \param columnIndex Index of the column
+     *  \return Pointer to getNumberOfRowsInChunk( chunkIndex ) values, or nullptr if the chunk is compressed
+     */
+    const double* getChunkColumnData( const int chunkIndex, const int columnIndex ) const;
+
+    //! Function to read (and decompress, if needed) all values of a single column
+    Eigen::VectorXd readColumn( const int columnIndex ) const;
+
+    //! Function to read (and decompress, if needed) all values of a single column, identified by its name
+    Eigen::VectorXd readColumn( const std::string& columnName ) const
+    {
+        return readColumn( getColumnIndex( columnName ) );
+    }
+
+    //! Function to read (and decompress, if needed) the full table, with one row per row in the file
+    Eigen::MatrixXd readAll( ) const;
+
+private:
+    //! Location and properties of a single chunk in the file
+    struct ChunkEntry {
+        std::size_t numberOfRows;
+        int32_t compression;
+        std::vector< std::size_t > columnOffsets;
+        std::vector< std::size_t > columnSizes;
+    };
+
+    //! Function to read and check the file header, and locate all complete chunks
+    void readHeaderAndChunks( );
+
+    //! Function to read (and decompress, if needed) a single column in a single chunk into a pre-allocated array
+    void readChunkColumn( const int chunkIndex, const int columnIndex, double* values ) const;
+
+    //! Function to release the memory-mapped file (if any)
+    void unmapFile( );
+
+    //! Name of the file
+    std::string fileName_;
+
+    //! Description of the file contents
+    ColumnarBinaryFileDescription description_;
+
+    //! List of complete chunks in the file
+    std::vector< ChunkEntry > chunks_;
+
+    //! Total number of rows in all complete chunks
+    std::size_t numberOfRows_;
+
+    //! Size (in bytes) of the valid part of the file
+    std::size_t validFileSize_;
+
+    //! Start of the file contents (either memory mapped, or in fileContents_)
+    const char* fileData_;
+
+    //! Size of the file
+    std::size_t fileSize_;
+
+    //! Boolean denoting whether fileData_ points to a memory-mapped file
+    bool isFileMapped_;
+
+    //! Contents of the file (if file is not mapped)
+    std::vector< char > fileContents_;
+};
+
+//! Function to write a map of vectors (e.g. a state or dependent variable history) to a binary columnar file
+/*!
+ *  Function to write a map of vectors (e.g. a state or dependent variable history) to a binary columnar file, with the epochs
+ *  (converted to double) in the first column, and the entries of the vectors in the subsequent columns.
+ *  \param dataMap Map of vectors that is to be written (all vectors must be of equal size)
+ *  \param fileName Name of the file to which the data is to be written
+ *  \param columnNames Names of the columns (including the epoch column). If empty, default names are used.
+ *  \param contentType Type of content stored in the file
+ *  \param compression Compression applied to the data
+ *  \param metadata Free-form metadata that is stored in the file header
+ */
+template< typename TimeType, typename ScalarType >
+void writeDataMapToColumnarBinaryFile( const std::map< TimeType, Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > >& dataMap,
+                                       const std::string& fileName,
+                                       const std::vector< std::string >& columnNames = std::vector< std::string >( ),
+                                       const ColumnarBinaryContentType contentType = generic_columnar_content,
+                                       const ColumnarBinaryCompression compression = no_columnar_compression,
+                                       const std::string& metadata = "" )
+{
+    const int numberOfValues = dataMap.size( ) > 0 ? dataMap.begin( )->second.rows( ) : 0;
+
+    ColumnarBinaryFileDescription description;
+    description.contentType = contentType;
+    description.compression = compression;
+    description.metadata = metadata;
+    description.columnNames = columnNames;
+    if( columnNames.size( ) == 0 )
+    {
+        description.columnNames.push_back( "epoch" );
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            description.columnNames.push_back( "column_" + std::to_string( i + 1 ) );
+        }
+    }
+
+    ColumnarBinaryFileWriter writer( fileName, description );
+    Eigen::VectorXd row = Eigen::VectorXd( numberOfValues + 1 );
+    for( auto it = dataMap.begin( ); it != dataMap.end( ); it++ )
+    {
+        if( it->second.rows( ) != numberOfValues )
+        {
+            throw std::runtime_error( "Error when writing data map to columnar binary file " + fileName +
+                                      ", entries are of inconsistent size." );
+        }
+        row( 0 ) = static_cast< double >( it->first );
+        row.segment( 1, numberOfValues ) = it->second.template cast< double >( );
+        writer.appendRow( row );
+    }
+    writer.close( );
+}
+
+//! Function to read a map of vectors from a binary columnar file (with the epochs in the first column)
+/*!
+ *  Function to read a map of vectors from a binary columnar file (with the epochs in the first column), as written by
+ *  writeDataMapToColumnarBinaryFile.
+ *  \param fileName Name of the file from which the data is to be read
+ *  \return Map of vectors, with the epochs as keys
+ */
+template< typename TimeType = double, typename ScalarType = double >
+std::map< TimeType, Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > > readDataMapFromColumnarBinaryFile( const std::string& fileName )
+{
+    ColumnarBinaryFileReader reader( fileName );
+    Eigen::MatrixXd table = reader.readAll( );
+
+    std::map< TimeType, Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > > dataMap;
+    for( int i = 0; i < table.rows( ); i++ )
+    {
+        dataMap[ static_cast< TimeType >( table( i, 0 ) ) ] =
+                table.block( i, 1, 1, table.cols( ) - 1 ).transpose( ).template cast< ScalarType >( );
+    }
+    return dataMap;
+}
+
+//! Function to write a map of matrices (e.g. a covariance or state transition matrix history) to a binary columnar file
+/*!
+ *  Function to write a map of matrices (e.g. a covariance or state transition matrix history) to a binary columnar file, with
+ *  the epochs (converted to double) in the first column, and the entries of the matrices (in row-major order) in the
+ *  subsequent columns. The size of the matrices is stored in the file header.
+ *  \param dataMap Map of matrices that is to be written (all matrices must be of equal size)
+ *  \param fileName Name of the file to which the data is to be written
+ *  \param compression Compression applied to the data
+ *  \param metadata Free-form metadata that is stored in the file header
+ */
+template< typename TimeType, typename ScalarType >
+void writeMatrixHistoryToColumnarBinaryFile(
+        const std::map< TimeType, Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > >& dataMap,
+        const std::string& fileName,
+        const ColumnarBinaryCompression compression = no_columnar_compression,
+        const std::string& metadata = "" )
+{
+    const int numberOfRows = dataMap.size( ) > 0 ? dataMap.begin( )->second.rows( ) : 0;
+    const int numberOfColumns = dataMap.size( ) > 0 ? dataMap.begin( )->second.cols( ) : 0;
+
+    ColumnarBinaryFileDescription description;
+    description.contentType = matrix_history_columnar_content;
+    description.compression = compression;
+    description.metadata = metadata;
+    description.entryRows = numberOfRows;
+    description.entryColumns = numberOfColumns;
+    description.columnNames.push_back( "epoch" );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        for( int j = 0; j < numberOfColumns; j++ )
+        {
+            description.columnNames.push_back( "entry_" + std::to_string( i ) + "_" + std::to_string( j ) );
+        }
+    }
+
+    ColumnarBinaryFileWriter writer( fileName, description );
+    Eigen::VectorXd row = Eigen::VectorXd( numberOfRows * numberOfColumns + 1 );
+    for( auto it = dataMap.begin( ); it != dataMap.end( ); it++ )
+    {
+        if( it->second.rows( ) != numberOfRows || it->second.cols( ) != numberOfColumns )
+        {
+            throw std::runtime_error( "Error when writing matrix history to columnar binary file " + fileName +
+                                      ", entries are of inconsistent size." );
+        }
+        row( 0 ) = static_cast< double >( it->first );
+        for( int i = 0; i < numberOfRows; i++ )
+        {
+            row.segment( 1 + i * numberOfColumns, numberOfColumns ) = it->second.row( i ).transpose( ).template cast< double >( );
+        }
+        writer.appendRow( row );
+    }
+    writer.close( );
+}
+
+//! Function to read a map of matrices from a binary columnar file (as written by writeMatrixHistoryToColumnarBinaryFile)
+/*!
+ *  Function to read a map of matrices from a binary columnar file (as written by writeMatrixHistoryToColumnarBinaryFile)
+ *  \param fileName Name of the file from which the data is to be read
+ *  \return Map of matrices, with the epochs as keys
+ */
+template< typename TimeType = double, typename ScalarType = double >
+std::map< TimeType, Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > > readMatrixHistoryFromColumnarBinaryFile(
+        const std::string& fileName )
+{
+    ColumnarBinaryFileReader reader( fileName );
+    const int numberOfRows = reader.getDescription( ).entryRows;
+    const int numberOfColumns = reader.getDescription( ).entryColumns;
+    if( reader.getDescription( ).contentType != matrix_history_columnar_content ||
+        reader.getNumberOfColumns( ) != numberOfRows * numberOfColumns + 1 )
+    {
+        throw std::runtime_error( "Error when reading matrix history from columnar binary file " + fileName +
+                                  ", file does not contain a matrix history." );
+    }
+
+    Eigen::MatrixXd table = reader.readAll( );
+    std::map< TimeType, Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > > dataMap;
+    for( int k = 0; k < table.rows( ); k++ )
+    {
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > entry( numberOfRows, numberOfColumns );
+        for( int i = 0; i < numberOfRows; i++ )
+        {
+            entry.row( i ) = table.block( k, 1 + i * numberOfColumns, 1, numberOfColumns ).template cast< ScalarType >( );
+        }
+        dataMap[ static_cast< TimeType >( table( k, 0 ) ) ] = entry;
+    }
+    return dataMap;
+}
+
+}  // namespace input_output
+
+}  // namespace tudat
+
+#endif  // TUDAT_COLUMNARBINARYFILE_H
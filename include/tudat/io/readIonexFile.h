@@ -88,6 +88,16 @@ void readIonexFile( const std::string& filePath, IonexTecMap& data );
 //! Read and merge multiple IONEX files
 void readIonexFiles( const std::vector< std::string >& filePaths, IonexTecMap& data );
 
+//! Read and merge multiple IONEX files, and write the TEC maps to a binary time-indexed grid file
+/*!
+ *  Read and merge multiple IONEX files, and write the TEC maps to a binary time-indexed grid file (see
+ *  writeTimeIndexedGridFile), with a single field (TEC in TECU), on a grid of epochs [s since J2000], latitudes [deg]
+ *  and longitudes [deg]. The resulting file can be loaded (without parsing) using the TimeIndexedGridFile class.
+ *  \param filePaths List of IONEX files
+ *  \param gridFilePath Name of the binary grid file that is to be written
+ */
+void convertIonexFilesToTimeIndexedGridFile( const std::vector< std::string >& filePaths, const std::string& gridFilePath );
+
 }  // namespace input_output
 
 }  // namespace tudat
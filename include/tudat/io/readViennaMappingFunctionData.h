@@ -48,6 +48,25 @@ void readVMFFiles( const std::vector< std::string >& fileName,
                    const bool fileHasMeteo,
                    const bool fileHasGradient );
 
+//! Function to read VMF files, and write the data of each station to a binary time-indexed grid file
+/*!
+ *  Function to read (station-wise) VMF files, and write the data of each station to a binary time-indexed grid file (see
+ *  writeTimeIndexedGridFile), as a time series (on a 1x1 grid) with epochs in UTC seconds since J2000. The fields are the
+ *  troposphere data (ah, aw, zhd, zwd, and, if present, the gradients), followed by the meteo data (pressure, temperature,
+ *  water vapor pressure) if present, in the same units as produced by VMFData::getFullDataSet. The station name is stored as
+ *  the name of the data set. The resulting files can be loaded (without parsing) using the TimeIndexedGridFile class.
+ *  An exception is thrown if no troposphere data (or, if fileHasMeteo is true, no meteo data) is found for a station.
+ *  \param fileNames List of VMF files
+ *  \param fileHasMeteo Boolean denoting whether the VMF files contain meteo data
+ *  \param fileHasGradient Boolean denoting whether the VMF files contain gradient data
+ *  \param outputFilePrefix Prefix of the grid files that are written (file name is prefix + station name + ".bin")
+ *  \return List of grid files that have been written
+ */
+std::vector< std::string > convertVMFFilesToTimeIndexedGridFiles( const std::vector< std::string >& fileNames,
+                                                                  const bool fileHasMeteo,
+                                                                  const bool fileHasGradient,
+                                                                  const std::string& outputFilePrefix );
+
 }  // namespace input_output
 
 }  // namespace tudat
@@ -0,0 +1,282 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TIMEINDEXEDGRIDFILE_H
+#define TUDAT_TIMEINDEXEDGRIDFILE_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Type of content stored in a binary time-indexed grid file
+enum TimeIndexedGridContentType { generic_grid_content = 0, ionex_tec_grid_content = 1, vmf_station_data_content = 2 };
+
+//! Flag (in TimeIndexedGridData::contentFlags) denoting that VMF station data contains meteorological data
+static const int32_t vmfMeteoDataFlag = 1;
+
+//! Flag (in TimeIndexedGridData::contentFlags) denoting that VMF station data contains gradient data
+static const int32_t vmfGradientDataFlag = 2;
+
+//! In-memory contents of a binary, time-indexed grid file.
+/*!
+ *  In-memory contents of a binary, time-indexed grid file, containing a number of fields tabulated on a latitude/longitude grid
+ *  at a list of epochs. The data is stored contiguously per epoch, in the order [epoch][field][latitude][longitude]. Latitudes,
+ *  longitudes and epochs must be strictly increasing. Time series at a single point (e.g. station-wise VMF data) are stored as
+ *  a 1x1 grid.
+ */
+struct TimeIndexedGridData {
+    TimeIndexedGridData( ):
+        contentType( generic_grid_content ), contentFlags( 0 ), numberOfFields( 0 ), referenceHeight( 0.0 )
+    { }
+
+    //! Index of an entry in the data vector
+    std::size_t getDataIndex( const int epochIndex, const int fieldIndex, const int latitudeIndex, const int longitudeIndex ) const
+    {
+        return ( ( static_cast< std::size_t >( epochIndex ) * numberOfFields + fieldIndex ) * latitudes.size( ) + latitudeIndex ) *
+                longitudes.size( ) +
+                longitudeIndex;
+    }
+
+    //! Type of content stored in the grid
+    TimeIndexedGridContentType contentType;
+
+    //! Content-specific flags (e.g. vmfMeteoDataFlag)
+    int32_t contentFlags;
+
+    //! Number of fields tabulated at each grid point and epoch
+    int32_t numberOfFields;
+
+    //! Reference height of the grid (e.g. ionospheric shell height)
+    double referenceHeight;
+
+    //! Name of the data set (e.g. station name for station-wise data)
+    std::string name;
+
+    //! Epochs at which the data is tabulated
+    std::vector< double > epochs;
+
+    //! Latitudes at which the data is tabulated
+    std::vector< double > latitudes;
+
+    //! Longitudes at which the data is tabulated
+    std::vector< double > longitudes;
+
+    //! Tabulated data, in the order [epoch][field][latitude][longitude]
+    std::vector< double > data;
+};
+
+//! Function to write grid data to a binary, time-indexed grid file
+/*!
+ *  Function to write grid data to a binary, time-indexed grid file, which can be read efficiently (without parsing, and only
+ *  for the epochs that are needed) using the TimeIndexedGridFile class. The file is written in the native byte order.
+ *  \param gridData Grid data that is to be written
+ *  \param fileName Name of the file to which the data is to be written
+ */
+void writeTimeIndexedGridFile( const TimeIndexedGridData& gridData, const std::string& fileName );
+
+//! Class to read and interpolate a binary, time-indexed grid file.
+/*!
+ *  Class to read and interpolate a binary, time-indexed grid file (as written by writeTimeIndexedGridFile). The file is memory
+ *  mapped (on POSIX systems), so that only the parts of the file that are accessed are loaded. On other systems, the data
+ *  for the two epochs bracketing the most recent interpolation time is read on demand. Data is interpolated bilinearly in
+ *  latitude and longitude, and linearly in time. Values outside the tabulated range are taken at the boundary of the range.
+ */
+class TimeIndexedGridFile
+{
+public:
+    //! Constructor, opens (and maps) the file and reads its header
+    /*!
+     *  Constructor, opens (and maps) the file and reads its header
+     *  \param fileName Name of the binary grid file
+     */
+    TimeIndexedGridFile( const std::string& fileName );
+
+    //! Destructor, unmaps and closes the file
+    ~TimeIndexedGridFile( );
+
+    TimeIndexedGridFile( const TimeIndexedGridFile& ) = delete;
+
+    TimeIndexedGridFile& operator=( const TimeIndexedGridFile& ) = delete;
+
+    //! Function to interpolate a single field in space and time
+    /*!
+     *  Function to interpolate a single field, bilinearly in latitude and longitude, and linearly in time.
+     *  \param fieldIndex Index of the field that is to be interpolated
+     *  \param time Time at which the field is to be interpolated
+     *  \param latitude Latitude at which the field is to be interpolated (in same units as the grid)
+     *  \param longitude Longitude at which the field is to be interpolated (in same units as the grid)
+     *  \return Interpolated value of field
+     */
+    double interpolateField( const int fieldIndex, const double time, const double latitude, const double longitude );
+
+    //! Function to interpolate all fields in space and time
+    /*!
+     *  Function to interpolate all fields, bilinearly in latitude and longitude, and linearly in time.
+     *  \param time Time at which the fields are to be interpolated
+     *  \param latitude Latitude at which the fields are to be interpolated (in same units as the grid)
+     *  \param longitude Longitude at which the fields are to be interpolated (in same units as the grid)
+     *  \return Interpolated values of all fields
+     */
+    Eigen::VectorXd interpolateFields( const double time, const double latitude, const double longitude );
+
+    //! Function to retrieve all fields at a given grid point and epoch index
+    /*!
+     *  Function to retrieve all fields at a given grid point and epoch index, without interpolation
+     *  \param epochIndex Index of the epoch
+     *  \param latitudeIndex Index of the latitude
+     *  \param longitudeIndex Index of the longitude
+     *  \return Tabulated values of all fields
+     */
+    Eigen::VectorXd getFieldsAtGridPoint( const int epochIndex, const int latitudeIndex, const int longitudeIndex );
+
+    //! Function to retrieve the index of the epoch interval [t_i, t_{i+1}) in which a given time lies (clamped to valid range)
+    int getEpochIntervalIndex( const double time );
+
+    //! Function to retrieve the epochs at which the data is tabulated
+    const std::vector< double >& getEpochs( ) const
+    {
+        return epochs_;
+    }
+
+    //! Function to retrieve the latitudes at which the data is tabulated
+    const std::vector< double >& getLatitudes( ) const
+    {
+        return latitudes_;
+    }
+
+    //! Function to retrieve the longitudes at which the data is tabulated
+    const std::vector< double >& getLongitudes( ) const
+    {
+        return longitudes_;
+    }
+
+    //! Function to retrieve the number of fields tabulated at each grid point and epoch
+    int getNumberOfFields( ) const
+    {
+        return numberOfFields_;
+    }
+
+    //! Function to retrieve the type of content stored in the grid
+    TimeIndexedGridContentType getContentType( ) const
+    {
+        return contentType_;
+    }
+
+    //! Function to retrieve the content-specific flags
+    int32_t getContentFlags( ) const
+    {
+        return contentFlags_;
+    }
+
+    //! Function to retrieve the reference height of the grid
+    double getReferenceHeight( ) const
+    {
+        return referenceHeight_;
+    }
+
+    //! Function to retrieve the name of the data set
+    const std::string& getName( ) const
+    {
+        return name_;
+    }
+
+    //! Function to retrieve the number of epochs for which data has been accessed
+    /*!
+     *  Function to retrieve the number of epochs for which data has been accessed (i.e. loaded from file, if the file is not
+     *  memory mapped, or touched in the mapped file otherwise)
+     *  \return Number of accessed epochs
+     */
+    int getNumberOfAccessedEpochs( ) const;
+
+private:
+    //! Function to read and check the file header and grid definition
+    void readHeaderAndGrid( const std::size_t fileSize );
+
+    //! Function to release the memory-mapped file (if any)
+    void unmapFile( );
+
+    //! Function to retrieve pointer to the contiguous data of a single epoch
+    const double* getEpochData( const int epochIndex );
+
+    //! Function to compute the index and interpolation fraction of a value in a grid (clamped to the grid range)
+    static void getGridInterval( const std::vector< double >& grid, const double value, int& lowerIndex, double& fraction );
+
+    //! Name of the file
+    std::string fileName_;
+
+    //! Type of content stored in the grid
+    TimeIndexedGridContentType contentType_;
+
+    //! Content-specific flags
+    int32_t contentFlags_;
+
+    //! Number of fields tabulated at each grid point and epoch
+    int numberOfFields_;
+
+    //! Reference height of the grid
+    double referenceHeight_;
+
+    //! Name of the data set
+    std::string name_;
+
+    //! Epochs at which the data is tabulated
+    std::vector< double > epochs_;
+
+    //! Latitudes at which the data is tabulated
+    std::vector< double > latitudes_;
+
+    //! Longitudes at which the data is tabulated
+    std::vector< double > longitudes_;
+
+    //! Number of values stored per epoch
+    std::size_t epochBlockSize_;
+
+    //! Offset (in bytes) of the tabulated data in the file
+    std::size_t dataOffset_;
+
+    //! Index of the most recently used epoch interval (used as starting point of search)
+    int currentEpochIntervalIndex_;
+
+    //! List of booleans denoting for each epoch whether its data has been accessed
+    std::vector< bool > isEpochAccessed_;
+
+    //! Start of the memory-mapped file (nullptr if file is not mapped)
+    const char* mappedFile_;
+
+    //! Size of the memory-mapped file
+    std::size_t mappedFileSize_;
+
+    //! Stream from which data is read on demand (if file is not mapped)
+    std::ifstream fileStream_;
+
+    //! Indices of epochs of which the data is currently loaded in epochDataBuffer_ (if file is not mapped)
+    int bufferedEpochIndices_[ 2 ];
+
+    //! Data of most recently loaded epochs (if file is not mapped)
+    std::vector< double > epochDataBuffer_[ 2 ];
+
+    //! Index in bufferedEpochIndices_ that is to be overwritten next (if file is not mapped)
+    int nextBufferIndex_;
+};
+
+}  // namespace input_output
+
+}  // namespace tudat
+
+#endif  // TUDAT_TIMEINDEXEDGRIDFILE_H
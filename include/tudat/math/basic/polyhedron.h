@@ -144,6 +144,127 @@ Eigen::Matrix3d calculatePolyhedronHessianOfGravitationalPotential( const double
 double calculatePolyhedronLaplacianOfGravitationalPotential( const double gravitationalConstantTimesDensity,
                                                              const Eigen::VectorXd& perFacetFactor );
 
+/*! Class for the fused evaluation of the per-facet and per-edge terms of the polyhedron gravity field.
+ *
+ * Class for the fused evaluation of the per-facet and per-edge terms of the polyhedron gravity field (Werner and Scheeres,
+ * 1997). The vertex coordinates, the vertex indices of the facets and edges, and the (symmetric) facet and edge dyads are
+ * stored in a structure-of-arrays layout, such that the per-vertex computations are done on contiguous arrays, and the
+ * per-facet and per-edge factors are computed in the same pass as the sums required for the potential and its gradient.
+ * The facets and edges can optionally be distributed over multiple threads, which is only beneficial for polyhedra with
+ * a large number (typically more than several thousand) of facets.
+ */
+class PolyhedronGravityKernel
+{
+public:
+    /*! Constructor.
+     *
+     * Constructor.
+     * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+     * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+     * @param verticesDefiningEachEdge Index (0 based) of the vertices constituting each edge (one row per edge, 2 columns).
+     * @param facetDyads Vector containing facet dyads.
+     * @param edgeDyads Vector containing edge dyads.
+     * @param numberOfThreads Number of threads over which the facets and edges are distributed.
+     */
+    PolyhedronGravityKernel( const Eigen::MatrixXd& verticesCoordinates,
+                             const Eigen::MatrixXi& verticesDefiningEachFacet,
+                             const Eigen::MatrixXi& verticesDefiningEachEdge,
+                             const std::vector< Eigen::MatrixXd >& facetDyads,
+                             const std::vector< Eigen::MatrixXd >& edgeDyads,
+                             const int numberOfThreads = 1 );
+
+    /*! Function to evaluate the per-facet and per-edge factors, and the sums for the potential and its gradient.
+     *
+     * Function to evaluate the per-facet and per-edge factors (Eqs. 7 and 27 of Werner and Scheeres, 1997), and the sums
+     * over all facets and edges in the potential and its gradient (Eqs. 10 and 15 of Werner and Scheeres, 1997). The
+     * potential and gradient are returned per unit of the product of the gravitational constant and density.
+     * @param bodyFixedPosition Body fixed position of field point (input).
+     * @param perFacetFactor Vector with the per-facet factor of each facet (output).
+     * @param perEdgeFactor Vector with the per-edge factor of each edge (output).
+     * @param potentialPerUnitDensity Gravitational potential, divided by gravitational constant times density (output).
+     * @param gradientPerUnitDensity Gradient of the potential, divided by gravitational constant times density (output).
+     */
+    void evaluate( const Eigen::Vector3d& bodyFixedPosition,
+                   Eigen::VectorXd& perFacetFactor,
+                   Eigen::VectorXd& perEdgeFactor,
+                   double& potentialPerUnitDensity,
+                   Eigen::Vector3d& gradientPerUnitDensity );
+
+    /*! Function to retrieve the coordinates of the vertices wrt the field point of the last evaluation.
+     *
+     * Function to retrieve the coordinates of the vertices wrt the field point of the last evaluation.
+     * @param verticesCoordinatesRelativeToFieldPoint Matrix with coordinates of each vertex wrt field point (output).
+     */
+    void getVerticesCoordinatesRelativeToFieldPoint( Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint ) const;
+
+    //! Function to reset the number of threads over which the facets and edges are distributed.
+    void setNumberOfThreads( const int numberOfThreads );
+
+    //! Function to retrieve the number of threads over which the facets and edges are distributed.
+    int getNumberOfThreads( ) const
+    {
+        return numberOfThreads_;
+    }
+
+private:
+    //! Partial sums over a block of facets and edges.
+    struct PolyhedronTermSums {
+        PolyhedronTermSums( ): edgePotentialSum( 0.0 ), facetPotentialSum( 0.0 )
+        {
+            edgeGradientSum.setZero( );
+            facetGradientSum.setZero( );
+        }
+
+        double edgePotentialSum;
+
+        double facetPotentialSum;
+
+        Eigen::Vector3d edgeGradientSum;
+
+        Eigen::Vector3d facetGradientSum;
+    };
+
+    //! Function to compute the factors and partial sums for a block of facets and a block of edges.
+    void evaluateBlock( const int firstFacet,
+                        const int endFacet,
+                        const int firstEdge,
+                        const int endEdge,
+                        double* perFacetFactor,
+                        double* perEdgeFactor,
+                        PolyhedronTermSums& termSums ) const;
+
+    //! Number of vertices, facets and edges
+    int numberOfVertices_;
+
+    int numberOfFacets_;
+
+    int numberOfEdges_;
+
+    //! Number of threads over which the facets and edges are distributed
+    int numberOfThreads_;
+
+    //! Cartesian coordinates of the vertices
+    std::vector< double > vertexX_, vertexY_, vertexZ_;
+
+    //! Indices of the vertices of each facet
+    std::vector< int > facetVertex0_, facetVertex1_, facetVertex2_;
+
+    //! Indices of the vertices of each edge
+    std::vector< int > edgeVertex0_, edgeVertex1_;
+
+    //! Length of each edge
+    std::vector< double > edgeLength_;
+
+    //! Unique entries of the (symmetric) facet dyads
+    std::vector< double > facetDyadXX_, facetDyadXY_, facetDyadXZ_, facetDyadYY_, facetDyadYZ_, facetDyadZZ_;
+
+    //! Unique entries of the (symmetric) edge dyads
+    std::vector< double > edgeDyadXX_, edgeDyadXY_, edgeDyadXZ_, edgeDyadYY_, edgeDyadYZ_, edgeDyadZZ_;
+
+    //! Coordinates of the vertices wrt the current field point, and their norms
+    std::vector< double > relativeX_, relativeY_, relativeZ_, relativeNorm_;
+};
+
 }  // namespace basic_mathematics
 }  // namespace tudat
 
@@ -21,9 +21,12 @@
 #ifndef TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 #define TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 
-#include <deque>
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <memory>
 
@@ -39,6 +42,185 @@ namespace tudat
 namespace numerical_integrators
 {
 
+//! Fixed-capacity ring buffer used to store the history of a multi-step integrator.
+/*!
+ * Fixed-capacity ring buffer used to store the history of a multi-step integrator, with the most recent entry at index 0. All
+ * entries are allocated when the buffer is initialized, so that adding and removing entries (for dynamically sized Eigen types
+ * of constant size) does not require any memory allocation.
+ * \tparam EntryType Type of the entries of the buffer.
+ */
+template< typename EntryType >
+class MultiStepHistoryBuffer
+{
+public:
+    //! Constructor
+    MultiStepHistoryBuffer( ): firstEntryIndex_( 0 ), numberOfEntries_( 0 ) { }
+
+    //! Function to (re)allocate the buffer, and remove all entries
+    /*!
+     * Function to (re)allocate the buffer, and remove all entries
+     * \param capacity Maximum number of entries in the buffer
+     * \param entryPrototype Entry used to set the size of all allocated entries
+     */
+    void initialize( const unsigned int capacity, const EntryType& entryPrototype )
+    {
+        entries_.assign( capacity, entryPrototype );
+        firstEntryIndex_ = 0;
+        numberOfEntries_ = 0;
+    }
+
+    //! Function to retrieve the number of entries in the buffer
+    unsigned int size( ) const
+    {
+        return numberOfEntries_;
+    }
+
+    //! Function to retrieve the entry at given index (0 is most recent)
+    EntryType& at( const unsigned int index )
+    {
+        if( index >= numberOfEntries_ )
+        {
+            throw std::out_of_range( "Error in multi-step history buffer, requested index " + std::to_string( index ) +
+                                     " exceeds size " + std::to_string( numberOfEntries_ ) );
+        }
+        return entries_[ getEntryPosition( index ) ];
+    }
+
+    //! Function to retrieve the entry at given index (0 is most recent)
+    const EntryType& at( const unsigned int index ) const
+    {
+        if( index >= numberOfEntries_ )
+        {
+            throw std::out_of_range( "Error in multi-step history buffer, requested index " + std::to_string( index ) +
+                                     " exceeds size " + std::to_string( numberOfEntries_ ) );
+        }
+        return entries_[ getEntryPosition( index ) ];
+    }
+
+    //! Function to retrieve the entry at given index (0 is most recent), without bounds checking
+    EntryType& operator[]( const unsigned int index )
+    {
+        return entries_[ getEntryPosition( index ) ];
+    }
+
+    //! Function to retrieve the entry at given index (0 is most recent), without bounds checking
+    const EntryType& operator[]( const unsigned int index ) const
+    {
+        return entries_[ getEntryPosition( index ) ];
+    }
+
+    //! Function to retrieve the most recent entry
+    EntryType& front( )
+    {
+        return at( 0 );
+    }
+
+    //! Function to retrieve the oldest entry
+    EntryType& back( )
+    {
+        return at( numberOfEntries_ - 1 );
+    }
+
+    //! Function to add an entry as the most recent entry (copied into pre-allocated entry)
+    void pushFront( const EntryType& entry )
+    {
+        checkCapacity( );
+        firstEntryIndex_ = ( firstEntryIndex_ + entries_.size( ) - 1 ) % entries_.size( );
+        numberOfEntries_++;
+        entries_[ firstEntryIndex_ ] = entry;
+    }
+
+    //! Function to add an entry as the oldest entry (copied into pre-allocated entry)
+    void pushBack( const EntryType& entry )
+    {
+        checkCapacity( );
+        numberOfEntries_++;
+        entries_[ getEntryPosition( numberOfEntries_ - 1 ) ] = entry;
+    }
+
+    //! Function to remove the most recent entry
+    void popFront( )
+    {
+        if( numberOfEntries_ > 0 )
+        {
+            firstEntryIndex_ = ( firstEntryIndex_ + 1 ) % entries_.size( );
+            numberOfEntries_--;
+        }
+    }
+
+    //! Function to remove the oldest entry
+    void popBack( )
+    {
+        if( numberOfEntries_ > 0 )
+        {
+            numberOfEntries_--;
+        }
+    }
+
+    //! Function to remove the oldest entries, so that the buffer contains at most the given number of entries
+    void truncate( const unsigned int maximumNumberOfEntries )
+    {
+        numberOfEntries_ = std::min( numberOfEntries_, maximumNumberOfEntries );
+    }
+
+    //! Function to retain only every other entry (indices 1, 3, 5, ...), as required when doubling the step size
+    void retainOddEntries( )
+    {
+        unsigned int newNumberOfEntries = numberOfEntries_ / 2;
+        for( unsigned int i = 0; i < newNumberOfEntries; i++ )
+        {
+            std::swap( ( *this )[ i ], ( *this )[ 2 * i + 1 ] );
+        }
+        numberOfEntries_ = newNumberOfEntries;
+    }
+
+    //! Function to set the number of entries, with the contents of newly added entries undefined
+    void resize( const unsigned int numberOfEntries )
+    {
+        if( numberOfEntries > entries_.size( ) )
+        {
+            throw std::runtime_error( "Error in multi-step history buffer, capacity of " + std::to_string( entries_.size( ) ) +
+                                      " entries exceeded" );
+        }
+        numberOfEntries_ = numberOfEntries;
+    }
+
+    //! Function to swap the contents of two buffers (without copying the entries)
+    void swap( MultiStepHistoryBuffer< EntryType >& otherBuffer )
+    {
+        entries_.swap( otherBuffer.entries_ );
+        std::swap( firstEntryIndex_, otherBuffer.firstEntryIndex_ );
+        std::swap( numberOfEntries_, otherBuffer.numberOfEntries_ );
+    }
+
+private:
+    //! Function to retrieve the position in entries_ of entry with given index
+    unsigned int getEntryPosition( const unsigned int index ) const
+    {
+        unsigned int position = firstEntryIndex_ + index;
+        return ( position >= entries_.size( ) ) ? position - entries_.size( ) : position;
+    }
+
+    //! Function to check whether an entry can be added to the buffer
+    void checkCapacity( ) const
+    {
+        if( numberOfEntries_ >= entries_.size( ) )
+        {
+            throw std::runtime_error( "Error in multi-step history buffer, capacity of " + std::to_string( entries_.size( ) ) +
+                                      " entries exceeded" );
+        }
+    }
+
+    //! Pre-allocated entries of the buffer
+    std::vector< EntryType > entries_;
+
+    //! Position in entries_ of most recent entry
+    unsigned int firstEntryIndex_;
+
+    //! Number of entries currently in the buffer
+    unsigned int numberOfEntries_;
+};
+
 //! Adams-Bashforth-Moulton Variable Order and Stepsize integrator.
 /*!
  * Class that implements the Adams-Bashforth-Moulton integrator, variable order, variable
@@ -129,9 +311,23 @@ public:
             fixedStepSize_ = true;
         }
 
-        // Start filling the state and state derivative history deques.
-        stateHistory_.push_front( currentState_ );
-        derivHistory_.push_front( this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) );
+        // Allocate history and work variables, so that no allocations are needed to manage them during the integration.
+        stateHistory_.initialize( maximumNumberOfHistoryEntries, currentState_ );
+        derivHistory_.initialize( maximumNumberOfHistoryEntries, currentState_ );
+        halvedStateHistory_.initialize( maximumNumberOfHistoryEntries, currentState_ );
+        halvedDerivativeHistory_.initialize( maximumNumberOfHistoryEntries, currentState_ );
+        predictedState_ = currentState_;
+        correctedState_ = currentState_;
+        doubleStepCorrectedState_ = currentState_;
+        absoluteError_ = currentState_;
+        relativeError_ = currentState_;
+        predictorAbsoluteError_ = currentState_;
+        predictorRelativeError_ = currentState_;
+        lastState_ = currentState_;
+
+        // Start filling the state and state derivative history.
+        stateHistory_.pushFront( currentState_ );
+        derivHistory_.pushFront( this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) );
     }
 
     //! Default constructor.
@@ -231,6 +427,71 @@ public:
         return currentIndependentVariable_;
     }
 
+    //! Function to check whether the state at a given independent variable can be retrieved from dense output.
+    /*!
+     * Function to check whether the state at a given independent variable can be retrieved from dense output, i.e. whether it is
+     * within the span of the history of state derivatives that is used by getDenseOutputState.
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return True if the dense output state can be computed at the given independent variable.
+     */
+    virtual bool isDenseOutputAvailable( const IndependentVariableType independentVariable )
+    {
+        double stepFraction =
+                static_cast< double >( independentVariable - currentIndependentVariable_ ) / static_cast< double >( stepSize_ );
+        double minimumStepFraction = -static_cast< double >( std::max( getNumberOfDenseOutputDerivatives( ) - 1, 1u ) );
+        return ( stepFraction >= minimumStepFraction - 1.0E-10 ) && ( stepFraction <= 1.0E-10 );
+    }
+
+    //! Function to compute the state within the span of the current history (dense output).
+    /*!
+     * Function to compute the state at a value of the independent variable within the span of the current history (typically
+     * within the last step), without evaluating the state derivative. The state is obtained by integrating the polynomial through
+     * the most recent state derivatives in the history from the current state (as done by the Adams-Bashforth predictor, but for
+     * a fractional step). The number of derivatives that is used is equal to the current order (or the size of the history, if
+     * smaller).
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return State at the requested independent variable.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        StateType denseOutputState = currentState_;
+        computeDenseOutputState( independentVariable, denseOutputState );
+        return denseOutputState;
+    }
+
+    //! Function to compute the state within the span of the current history (dense output), without allocating a new state.
+    /*!
+     * Function to compute the state within the span of the current history (dense output), see getDenseOutputState. No memory is
+     * allocated if the output is already of the correct size.
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \param denseOutputState State at the requested independent variable (returned by reference).
+     */
+    void computeDenseOutputState( const IndependentVariableType independentVariable, StateType& denseOutputState )
+    {
+        unsigned int numberOfDerivatives = getNumberOfDenseOutputDerivatives( );
+
+        // Compute fraction of step size w.r.t. current independent variable, and check if it is in range of history
+        double stepFraction =
+                static_cast< double >( independentVariable - currentIndependentVariable_ ) / static_cast< double >( stepSize_ );
+        double minimumStepFraction = -static_cast< double >( std::max( numberOfDerivatives - 1, 1u ) );
+        if( !isDenseOutputAvailable( independentVariable ) )
+        {
+            throw std::runtime_error( "Error in ABM dense output, requested independent variable is outside range of history; " +
+                                      std::string( "step fraction " ) + std::to_string( stepFraction ) + " should be in range [" +
+                                      std::to_string( minimumStepFraction ) + ", 0]" );
+        }
+
+        // Compute integrated Lagrange polynomial coefficients, with derivative i at node -i
+        double integratedCoefficients[ maximumNumberOfDenseOutputDerivatives ];
+        computeIntegratedLagrangeCoefficients( stepFraction, numberOfDerivatives, integratedCoefficients );
+
+        denseOutputState = currentState_;
+        for( unsigned int i = 0; i < numberOfDerivatives; i++ )
+        {
+            denseOutputState += integratedCoefficients[ i ] * stepSize_ * derivHistory_[ i ];
+        }
+    }
+
     //! Perform a single integration step.
     /*!
      * Perform a single integration step.
@@ -247,17 +508,11 @@ public:
         // If stepSize is not same as old, clear the step-size dependent histories.
         if( stepSize != stepSize_ )
         {
-            // Pop all values from the history deque (the history is
+            // Pop all values from the history (the history is
             // invalid as it is dependent on the stepSize), except for
             // the current state and state derivative.
-            while( stateHistory_.size( ) > 1 )
-            {
-                stateHistory_.pop_back( );
-            }
-            while( derivHistory_.size( ) > 1 )
-            {
-                derivHistory_.pop_back( );
-            }
+            stateHistory_.truncate( 1 );
+            derivHistory_.truncate( 1 );
             stepSize_ = stepSize;
         }
         return performIntegrationStep( );
@@ -280,54 +535,43 @@ public:
 
         // Remove old elements so enough are left to calculate predicted and corrected.
         // max twice the order, to facilitatie a doubling, halving, and order change.
-        while( stateHistory_.size( ) > order_ * 2 )
-        {
-            stateHistory_.pop_back( );
-        }
-        while( derivHistory_.size( ) > order_ * 2 )
-        {
-            derivHistory_.pop_back( );
-        }
-        unsigned int sizeStateHistory = static_cast< unsigned int >( stateHistory_.size( ) );
-        unsigned int sizeDerivativeHistory = static_cast< unsigned int >( derivHistory_.size( ) );
+        stateHistory_.truncate( order_ * 2 );
+        derivHistory_.truncate( order_ * 2 );
+        unsigned int sizeStateHistory = stateHistory_.size( );
+        unsigned int sizeDerivativeHistory = derivHistory_.size( );
         unsigned int possibleOrder = std::min( sizeStateHistory, sizeDerivativeHistory );
 
-        StateType correctedState;
-        StateType predictedState;
-
         // Check if enough history steps are available to perform AM
         // step if not use a single-step method.
         if( possibleOrder < minimumOrder_ || possibleOrder < order_ )
         {
-            correctedState = performSingleStep( );
+            correctedState_ = performSingleStep( );
         }
         else
         {
-            StateType predictedState = performPredictorStep( order_, false );
-            predictedDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_ + stepSize_, predictedState );
-            correctedState = performCorrectorStep( predictedState, order_, false );
-            absoluteError_ = estimateAbsoluteError( predictedState, correctedState, order_ );
-            relativeError_ = estimateRelativeError( predictedState, correctedState, absoluteError_ );
+            performPredictorStep( order_, false, predictedState_ );
+            predictedDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_ + stepSize_, predictedState_ );
+            performCorrectorStep( order_, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_, absoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, absoluteError_, relativeError_ );
         }
 
         // Change order to one that gives a higher predicted accuracy
         // Add tolenaces
-        StateType predictorAbsoluteError;
-        StateType predictorRelativeError;
 
         // If order is not fixed, order is not max yet and enough
         // history is available, then predict the error of an order
         // more.
         if( !fixedOrder_ && order_ < maximumOrder_ && order_ < possibleOrder )
         {
-            predictedState = performPredictorStep( order_ + 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ + 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ + 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ + 1, false, predictedState_ );
+            performCorrectorStep( order_ + 1, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_ + 1, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, predictorAbsoluteError_, predictorRelativeError_ );
 
             // If the predicted error is less than the current error,
             // increase the error.
-            if( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) )
+            if( errorCompare( predictorAbsoluteError_, predictorRelativeError_, absoluteError_, relativeError_ ) )
             {
                 order_++;
             }
@@ -337,38 +581,34 @@ public:
         }
         else if( !fixedOrder_ && order_ > minimumOrder_ && order_ - 1 <= possibleOrder )
         {
-            predictedState = performPredictorStep( order_ - 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ - 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ - 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ - 1, false, predictedState_ );
+            performCorrectorStep( order_ - 1, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_ - 1, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, predictorAbsoluteError_, predictorRelativeError_ );
             // If it is less than the current order, lower the order.
-            if( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) )
+            if( errorCompare( predictorAbsoluteError_, predictorRelativeError_, absoluteError_, relativeError_ ) )
             {
                 order_--;
             }
             else
             {
-                predictorAbsoluteError = absoluteError_;
-                predictorRelativeError = relativeError_;
+                predictorAbsoluteError_ = absoluteError_;
+                predictorRelativeError_ = relativeError_;
             }
         }
         else
         {
-            predictorAbsoluteError = absoluteError_;
-            predictorRelativeError = relativeError_;
+            predictorAbsoluteError_ = absoluteError_;
+            predictorRelativeError_ = relativeError_;
         }
 
         // If the error (after order change) is too big, stepsize
         // isn't fixed and will not become too small, then halve the
         // stepsize.
-        if( errorTooLarge( predictorAbsoluteError, predictorRelativeError ) && std::fabs( stepSize_ / 2.0 ) > minimumStepSize_ &&
+        if( errorTooLarge( predictorAbsoluteError_, predictorRelativeError_ ) && std::fabs( stepSize_ / 2.0 ) > minimumStepSize_ &&
             !fixedStepSize_ )
         {
             // Set up new data for halving
-            std::deque< StateType > tempStateHistory;
-            std::deque< StateType > tempDerivativeHistory;
-            StateType midState = currentState_;
-            StateDerivativeType midDerivative = midState;
             unsigned int interpolationStateIndex;
             unsigned int interpolationDerivativeIndex;
 
@@ -385,19 +625,23 @@ public:
                 order_ = minimumOrder_;
             }
 
+            halvedStateHistory_.resize( possibleHalvingOrder );
+            halvedDerivativeHistory_.resize( possibleHalvingOrder );
             for( unsigned int i = 0; i < possibleHalvingOrder; i++ )
             {
                 // If states are even, they already exist, no need to interpolate
                 if( i % 2 == 0 )
                 {
-                    tempStateHistory.push_back( stateHistory_.at( i / 2 ) );
-                    tempDerivativeHistory.push_back( derivHistory_.at( i / 2 ) );
+                    halvedStateHistory_[ i ] = stateHistory_.at( i / 2 );
+                    halvedDerivativeHistory_[ i ] = derivHistory_.at( i / 2 );
                 }
                 else
                 {
                     // Reset midpoint state and deriv to zero
-                    midState = 0 * midState;
-                    midDerivative = midState;
+                    StateType& midState = halvedStateHistory_[ i ];
+                    StateType& midDerivative = halvedDerivativeHistory_[ i ];
+                    midState.setZero( );
+                    midDerivative.setZero( );
                     interpolationDerivativeIndex = ( order_ - 1 ) * ( order_ - 1 ) + ( i - 1 ) / 2;
                     interpolationStateIndex = interpolationDerivativeIndex - order_ + 1;
                     for( unsigned int j = 0; j < order_; j++ )
@@ -408,14 +652,12 @@ public:
                                 interpolationCoefficients[ interpolationDerivativeIndex ][ j ] * stateHistory_.at( j ) / stepSize_ +
                                 interpolationCoefficients[ interpolationDerivativeIndex ][ order_ + j ] * derivHistory_.at( j );
                     }
-                    tempStateHistory.push_back( midState );
-                    tempDerivativeHistory.push_back( midDerivative );
                 }
             }
 
             // Set the new history and stepsize
-            stateHistory_ = tempStateHistory;
-            derivHistory_ = tempDerivativeHistory;
+            stateHistory_.swap( halvedStateHistory_ );
+            derivHistory_.swap( halvedDerivativeHistory_ );
             stepSize_ = stepSize_ / 2.0;
 
             // Temporarily turn halving off.
@@ -428,7 +670,7 @@ public:
         // If the error (after order change ) is too small, the
         // stepsize isn't fixed and the and will not become too big,
         // then double the stepsize.
-        if( errorTooSmall( predictorAbsoluteError, predictorRelativeError ) && sizeDerivativeHistory >= 2 * order_ &&
+        if( errorTooSmall( predictorAbsoluteError_, predictorRelativeError_ ) && sizeDerivativeHistory >= 2 * order_ &&
             std::fabs( stepSize_ * 2.0 ) <= maximumStepSize_ && !fixedStepSize_ )
         {
             // Predict error after doubling, to prevent error from becoming too big
@@ -442,41 +684,28 @@ public:
             //    is neglibile. This assumption saves one function evaluation.
             // It's possible to reuse previously defined variables here except for correctedState
             // which is still used below.
-            predictedState = performPredictorStep( order_, true );
-            StateType doubleStepCorrectedState = performCorrectorStep( predictedState, order_, true );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, doubleStepCorrectedState, order_ );
-            predictorRelativeError = estimateRelativeError( predictedState, doubleStepCorrectedState, predictorAbsoluteError );
+            performPredictorStep( order_, true, predictedState_ );
+            performCorrectorStep( order_, true, doubleStepCorrectedState_ );
+            estimateAbsoluteError( predictedState_, doubleStepCorrectedState_, order_, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, doubleStepCorrectedState_, predictorAbsoluteError_, predictorRelativeError_ );
 
             // Only update the history if the error will not be too large
-            if( !errorTooLarge( predictorAbsoluteError, predictorRelativeError ) )
+            if( !errorTooLarge( predictorAbsoluteError_, predictorRelativeError_ ) )
             {
                 // Note that the history should be at least 7 to allow successful
                 // continuation of the AM scheme.
-                std::deque< StateType > tempStateHistory;
-                std::deque< StateType > tempDerivativeHistory;
-
-                // Use old history to fill new history, skipping every other entry starting at 1
-                for( unsigned int i = 1; i < sizeStateHistory; i += 2 )
-                {
-                    tempStateHistory.push_back( stateHistory_.at( i ) );
-                }
-                for( unsigned int i = 1; i < sizeDerivativeHistory; i += 2 )
-                {
-                    tempDerivativeHistory.push_back( derivHistory_.at( i ) );
-                }
-
-                // Set the new history and stepsize
-                stateHistory_ = tempStateHistory;
-                derivHistory_ = tempDerivativeHistory;
+                // Use old history as new history, skipping every other entry starting at 1
+                stateHistory_.retainOddEntries( );
+                derivHistory_.retainOddEntries( );
                 stepSize_ = stepSize_ * 2.0;
             }
         }  // end if ( errorTooSmall( ...
 
         // Move computed state to history
         currentIndependentVariable_ += lastStepSize_;
-        currentState_ = correctedState;
-        stateHistory_.push_front( currentState_ );
-        derivHistory_.push_front( this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) );
+        currentState_ = correctedState_;
+        stateHistory_.pushFront( currentState_ );
+        derivHistory_.pushFront( this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) );
         return currentState_;
     }
 
@@ -496,15 +725,15 @@ public:
         }
         currentIndependentVariable_ = lastIndependentVariable_;
         stepSize_ = lastStepSize_;
-        stateHistory_.push_back( lastState_ );
-        derivHistory_.push_back( lastDerivative_ );
-        stateHistory_.pop_front( );
-        derivHistory_.pop_front( );
-        derivHistory_.pop_front( );
+        stateHistory_.pushBack( lastState_ );
+        derivHistory_.pushBack( lastDerivative_ );
+        stateHistory_.popFront( );
+        derivHistory_.popFront( );
+        derivHistory_.popFront( );
         currentState_ = stateHistory_.front( );
         // Recalculate the derivative in order to make sure that all
         // update functions inside state derivative model get reactivated
-        derivHistory_.push_front( this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) );
+        derivHistory_.pushFront( this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) );
         return true;
     }
 
@@ -825,6 +1054,63 @@ protected:
      */
     const static double interpolationCoefficients[ 132 ][ 24 ];
 
+    //! Function to retrieve the number of state derivatives from the history that is used for dense output.
+    /*!
+     * Function to retrieve the number of state derivatives from the history that is used for dense output, equal to the
+     * current order (or the size of the history, if smaller).
+     * \return Number of state derivatives used for dense output.
+     */
+    unsigned int getNumberOfDenseOutputDerivatives( ) const
+    {
+        return std::min( std::min( static_cast< unsigned int >( derivHistory_.size( ) ), std::max( order_, 1u ) ),
+                         maximumNumberOfDenseOutputDerivatives );
+    }
+
+    //! Function to compute the integrals of the Lagrange polynomials on equidistant nodes 0, -1, -2, ...
+    /*!
+     * Function to compute the integrals (from 0 to stepFraction) of the Lagrange polynomials on the equidistant nodes
+     * 0, -1, ..., -( numberOfNodes - 1 ), used for dense output.
+     * \param stepFraction Upper bound of integration (in units of the step size).
+     * \param numberOfNodes Number of nodes (at most maximumNumberOfDenseOutputDerivatives).
+     * \param integratedCoefficients Integrals of the Lagrange polynomials for each node (returned by reference).
+     */
+    static void computeIntegratedLagrangeCoefficients( const double stepFraction,
+                                                       const unsigned int numberOfNodes,
+                                                       double* integratedCoefficients )
+    {
+        double polynomialCoefficients[ maximumNumberOfDenseOutputDerivatives ];
+        for( unsigned int i = 0; i < numberOfNodes; i++ )
+        {
+            // Expand Lagrange polynomial of node i as product of ( s + j ) / ( j - i ), for all j != i
+            std::fill( polynomialCoefficients, polynomialCoefficients + numberOfNodes, 0.0 );
+            polynomialCoefficients[ 0 ] = 1.0;
+            unsigned int currentDegree = 0;
+            for( unsigned int j = 0; j < numberOfNodes; j++ )
+            {
+                if( j != i )
+                {
+                    double nodeIndex = static_cast< double >( j );
+                    double denominator = nodeIndex - static_cast< double >( i );
+                    currentDegree++;
+                    for( unsigned int k = currentDegree; k > 0; k-- )
+                    {
+                        polynomialCoefficients[ k ] =
+                                ( polynomialCoefficients[ k - 1 ] + nodeIndex * polynomialCoefficients[ k ] ) / denominator;
+                    }
+                    polynomialCoefficients[ 0 ] = nodeIndex * polynomialCoefficients[ 0 ] / denominator;
+                }
+            }
+
+            // Integrate polynomial from 0 to step fraction (Horner scheme)
+            double integral = 0.0;
+            for( unsigned int k = numberOfNodes; k > 0; k-- )
+            {
+                integral = integral * stepFraction + polynomialCoefficients[ k - 1 ] / static_cast< double >( k );
+            }
+            integratedCoefficients[ i ] = integral * stepFraction;
+        }
+    }
+
     //! Perform integration step.
     /*!
      * Perform integration step using built-in Runge-Kutta fourth
@@ -883,7 +1169,7 @@ protected:
         }
 
         // Even if a different step size is suggested, let's stick with the old one, since the goal is to start
-        // filling up the deque at a constant stepsize interval
+        // filling up the history at a constant stepsize interval
         stepSize_ = lastStepSize_;  // singleStepIntegrator_.getNextStepSize( );
 
         // Disregard the ABAM error control in the performIntegrationStep function when using single steps.
@@ -898,42 +1184,39 @@ protected:
      * Using the order find predicted estimate using the Adams-Bashforth predictor
      * \param order Order of the integration.
      * \param doubleStep Boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return state after predictor step
+     * \param predictedState State after predictor step (returned by reference)
      */
-    StateType performPredictorStep( unsigned int order, bool doubleStep )
+    void performPredictorStep( const unsigned int order, const bool doubleStep, StateType& predictedState )
     {
         // Calculate predicted state
         unsigned int stepsToSkip = static_cast< unsigned int >( doubleStep );
         TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType predictedState = stateHistory_.at( stepsToSkip );
+        predictedState = stateHistory_.at( stepsToSkip );
         for( unsigned int i = 0; i < order; i++ )
         {
             predictedState +=
-                    extrapolationCoefficients[ order * 2 - 2 ][ i ] * stepSize * derivHistory_.at( i * ( stepsToSkip + 1 ) + stepsToSkip );
+                    extrapolationCoefficients[ order * 2 - 2 ][ i ] * stepSize * derivHistory_[ i * ( stepsToSkip + 1 ) + stepsToSkip ];
         }
-        return predictedState;
     }
 
     //! Perform correcter step.
     /*!
-     * Using the order and predicted state, find corrected estimate using the Adams-Moulton corrector
-     * \param predictedState by the predictor.
+     * Using the order and derivative at the predicted state, find corrected estimate using the Adams-Moulton corrector
      * \param order of the integration.
      * \param doubleStep boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return  after corrector step
+     * \param correctedState State after corrector step (returned by reference)
      */
-    StateType performCorrectorStep( StateType predictedState, unsigned int order, bool doubleStep )
+    void performCorrectorStep( const unsigned int order, const bool doubleStep, StateType& correctedState )
     {
         unsigned int stepsToSkip = static_cast< unsigned int >( doubleStep );
         TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType correctedState =
+        correctedState =
                 stateHistory_.at( stepsToSkip ) + extrapolationCoefficients[ order * 2 - 1 ][ 0 ] * stepSize * predictedDerivative_;
         for( unsigned int i = 1; i < order; i++ )
         {
             correctedState += stepSize * extrapolationCoefficients[ order * 2 - 1 ][ i ] *
-                    derivHistory_.at( ( i - 1 ) * ( stepsToSkip + 1 ) + stepsToSkip );
+                    derivHistory_[ ( i - 1 ) * ( stepsToSkip + 1 ) + stepsToSkip ];
         }
-        return correctedState;
     }
 
     //! Estimate the absolute error
@@ -942,12 +1225,15 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param order of the integration.
-     * \return absolute error vector.
+     * \param absoluteError absolute error vector (returned by reference).
      */
-    StateType estimateAbsoluteError( StateType predictedState, StateType correctedState, unsigned int order )
+    void estimateAbsoluteError( const StateType& predictedState,
+                                const StateType& correctedState,
+                                const unsigned int order,
+                                StateType& absoluteError )
     {
         // Estimate the maximum truncation error
-        return truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( ).array( );
+        absoluteError = truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( );
     }
 
     //! Estimate the relative error
@@ -956,12 +1242,15 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param absoluteError
-     * \return relative error vector.
+     * \param relativeError relative error vector (returned by reference).
      */
-    StateType estimateRelativeError( StateType predictedState, StateType correctedState, StateType absoluteError )
+    void estimateRelativeError( const StateType& predictedState,
+                                const StateType& correctedState,
+                                const StateType& absoluteError,
+                                StateType& relativeError )
     {
         // Estimate the maximum truncation error
-        return absoluteError.cwiseQuotient( ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
+        relativeError = absoluteError.cwiseQuotient( ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
     }
 
     //! Compare two errors
@@ -974,24 +1263,26 @@ protected:
      * \param relativeError2 relative error two.
      * \return true if one is better than two, false otherwise.
      */
-    bool errorCompare( StateType absoluteError1, StateType relativeError1, StateType absoluteError2, StateType relativeError2 )
+    bool errorCompare( const StateType& absoluteError1,
+                       const StateType& relativeError1,
+                       const StateType& absoluteError2,
+                       const StateType& relativeError2 )
     {
         // Find compound error
-        StateType c1 = absoluteError1.cwiseMin( relativeError1 );
-        StateType c2 = absoluteError2.cwiseMin( relativeError2 );
         bool oneBetter = true;
         if( strictCompare_ )
         {
             // Needs to be better or equal for each component
-            for( int i = 0; i < c1.size( ); ++i )
+            for( int i = 0; i < absoluteError1.size( ); ++i )
             {
-                oneBetter = oneBetter && ( c1( i ) <= c2( i ) );
+                oneBetter = oneBetter &&
+                        ( std::min( absoluteError1( i ), relativeError1( i ) ) <= std::min( absoluteError2( i ), relativeError2( i ) ) );
             }
         }
         else
         {
             // Needs to be overal better
-            oneBetter = ( c1.norm( ) <= c2.norm( ) );
+            oneBetter = ( absoluteError1.cwiseMin( relativeError1 ).norm( ) <= absoluteError2.cwiseMin( relativeError2 ).norm( ) );
         }
         return oneBetter;
     }
@@ -1004,7 +1295,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too big, false if within limits
      */
-    bool errorTooLarge( StateType absoluteError, StateType relativeError )
+    bool errorTooLarge( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components needs to be below the upper limit (tol)
@@ -1024,7 +1315,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too small, false if within limits
      */
-    bool errorTooSmall( StateType absoluteError, StateType relativeError )
+    bool errorTooSmall( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components need to be above lower limit ( tol / bw )
@@ -1044,17 +1335,48 @@ protected:
      */
     StateDerivativeType predictedDerivative_;
 
+    //! Maximum number of entries in the state and derivative history.
+    /*!
+     * Maximum number of entries in the state and derivative history: twice the maximum order supported by the coefficients (to
+     * facilitate doubling), plus margin for the new entry and rollback.
+     */
+    static constexpr unsigned int maximumNumberOfHistoryEntries = 28;
+
+    //! Maximum number of derivatives used for dense output (equal to maximum order supported by the coefficients).
+    static constexpr unsigned int maximumNumberOfDenseOutputDerivatives = 12;
+
     //! State history.
     /*!
-     * History of states, dynamic deque size depends on order.
+     * History of states, size depends on order.
      */
-    std::deque< StateType > stateHistory_;
+    MultiStepHistoryBuffer< StateType > stateHistory_;
 
     //! Derivative history.
     /*!
-     * History of derivatives, dynamic deque size depends on order.
+     * History of derivatives, size depends on order.
      */
-    std::deque< StateType > derivHistory_;
+    MultiStepHistoryBuffer< StateType > derivHistory_;
+
+    //! State history used to construct the new history when halving the step size.
+    MultiStepHistoryBuffer< StateType > halvedStateHistory_;
+
+    //! Derivative history used to construct the new history when halving the step size.
+    MultiStepHistoryBuffer< StateType > halvedDerivativeHistory_;
+
+    //! Predicted state, as computed by performPredictorStep( ) during the current step.
+    StateType predictedState_;
+
+    //! Corrected state, as computed by performCorrectorStep( ) during the current step.
+    StateType correctedState_;
+
+    //! Corrected state for doubled step size, used to predict the error after doubling.
+    StateType doubleStepCorrectedState_;
+
+    //! Absolute truncation error after order change, used for step size control.
+    StateType predictorAbsoluteError_;
+
+    //! Relative truncation error after order change, used for step size control.
+    StateType predictorRelativeError_;
 
     //! Last state.
     /*!
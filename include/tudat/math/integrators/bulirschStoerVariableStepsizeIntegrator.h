@@ -7,12 +7,17 @@
  *    a copy of the license with this file. If not, please or visit:
  *    http://tudat.tudelft.nl/LICENSE.
  *
+ *    References
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *
  */
 
 #ifndef TUDAT_BULIRSCH_STOER_VARIABLE_STEP_SIZE_INTEGRATOR_H
 #define TUDAT_BULIRSCH_STOER_VARIABLE_STEP_SIZE_INTEGRATOR_H
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include <boost/assign/std/vector.hpp>
 
@@ -81,22 +86,17 @@ public:
             const StateType& initialState,
             const TimeStepType initialStepSize,
             const std::shared_ptr< IntegratorStepSizeController< TimeStepType, StateType > > stepSizeController,
-            const std::shared_ptr< IntegratorStepSizeValidator< TimeStepType > > stepSizeValidator ):
+            const std::shared_ptr< IntegratorStepSizeValidator< TimeStepType > > stepSizeValidator,
+            const bool useAdaptiveOrder = false ):
         Base( stateDerivativeFunction ), currentIndependentVariable_( intervalStart ), currentState_( initialState ),
         lastIndependentVariable_( intervalStart ), sequence_( sequence ), stepSize_( initialStepSize ),
         stepSizeController_( stepSizeController ), stepSizeValidator_( stepSizeValidator )
     {
-        maximumStepIndex_ = sequence_.size( ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1 );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1 );
-        }
+        initializeExtrapolationTableau( initialState );
 
         useFixedStep_ = false;
         stepSizeController_->initialize( initialState );
+        initializeAdaptiveOrderControl( useAdaptiveOrder );
     }
 
     BulirschStoerVariableStepSizeIntegrator( const std::vector< unsigned int >& sequence,
@@ -108,20 +108,10 @@ public:
         lastIndependentVariable_( intervalStart ), sequence_( sequence ), stepSize_( initialStepSize ), stepSizeController_( nullptr ),
         stepSizeValidator_( nullptr )
     {
-        if( sequence_.size( ) <= 0 )
-        {
-            throw std::runtime_error( "Error when creating BS integrator, sequence is empty." );
-        }
-        maximumStepIndex_ = static_cast< unsigned int >( sequence_.size( ) ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1 );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1 );
-        }
+        initializeExtrapolationTableau( initialState );
 
         useFixedStep_ = true;
+        initializeAdaptiveOrderControl( false );
     }
 
     // Default constructor.
@@ -142,6 +132,8 @@ public:
      * \param safetyFactorForNextStepSize Safety factor used to scale prediction of next step size.
      * \param maximumFactorIncreaseForNextStepSize Maximum factor increase for next step size.
      * \param minimumFactorDecreaseForNextStepSize Maximum factor decrease for next step size.
+     * \param useAdaptiveOrder Boolean denoting whether the number of extrapolation steps (and thereby the order) is
+     *          adapted during the integration, in addition to the step size (see performIntegrationStep).
      * \sa NumericalIntegrator::NumericalIntegrator.
      */
     BulirschStoerVariableStepSizeIntegrator( const std::vector< unsigned int >& sequence,
@@ -155,18 +147,12 @@ public:
                                              const StateType& absoluteErrorTolerance,
                                              const TimeStepType safetyFactorForNextStepSize = 0.6,
                                              const TimeStepType maximumFactorIncreaseForNextStepSize = 4.0,
-                                             const TimeStepType minimumFactorDecreaseForNextStepSize = 0.1 ):
+                                             const TimeStepType minimumFactorDecreaseForNextStepSize = 0.1,
+                                             const bool useAdaptiveOrder = false ):
         Base( stateDerivativeFunction ), currentIndependentVariable_( intervalStart ), currentState_( initialState ),
         lastIndependentVariable_( intervalStart ), sequence_( sequence ), stepSize_( initialStepSize )
     {
-        maximumStepIndex_ = sequence_.size( ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1 );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1 );
-        }
+        initializeExtrapolationTableau( initialState );
 
         useFixedStep_ = false;
         if( ( initialStepSize == minimumStepSize ) && ( initialStepSize == maximumStepSize ) && !relativeErrorTolerance.allFinite( ) &&
@@ -185,6 +171,7 @@ public:
         stepSizeController_->initialize( initialState );
 
         stepSizeValidator_ = std::make_shared< BasicIntegratorStepSizeValidator< TimeStepType > >( minimumStepSize, maximumStepSize );
+        initializeAdaptiveOrderControl( useAdaptiveOrder );
     }
 
     // Default constructor.
@@ -205,6 +192,8 @@ public:
      * \param safetyFactorForNextStepSize Safety factor used to scale prediction of next step size.
      * \param maximumFactorIncreaseForNextStepSize Maximum factor increase for next step size.
      * \param minimumFactorDecreaseForNextStepSize Maximum factor decrease for next step size.
+     * \param useAdaptiveOrder Boolean denoting whether the number of extrapolation steps (and thereby the order) is
+     *          adapted during the integration, in addition to the step size (see performIntegrationStep).
      * \sa NumericalIntegrator::NumericalIntegrator.
      */
     BulirschStoerVariableStepSizeIntegrator( const std::vector< unsigned int >& sequence,
@@ -218,18 +207,12 @@ public:
                                              const typename StateType::Scalar absoluteErrorTolerance = 1.0e-12,
                                              const TimeStepType safetyFactorForNextStepSize = 0.75,
                                              const TimeStepType maximumFactorIncreaseForNextStepSize = 4.0,
-                                             const TimeStepType minimumFactorDecreaseForNextStepSize = 0.1 ):
+                                             const TimeStepType minimumFactorDecreaseForNextStepSize = 0.1,
+                                             const bool useAdaptiveOrder = false ):
         Base( stateDerivativeFunction ), currentIndependentVariable_( intervalStart ), currentState_( initialState ),
         lastIndependentVariable_( intervalStart ), sequence_( sequence ), stepSize_( stepSize )
     {
-        maximumStepIndex_ = sequence_.size( ) - 1;
-        subSteps_.resize( maximumStepIndex_ + 1 );
-
-        integratedStates_.resize( maximumStepIndex_ + 1 );
-        for( unsigned int i = 0; i < maximumStepIndex_ + 1; i++ )
-        {
-            integratedStates_[ i ].resize( maximumStepIndex_ + 1 );
-        }
+        initializeExtrapolationTableau( initialState );
 
         useFixedStep_ = false;
         if( ( stepSize == minimumStepSize ) && ( stepSize == maximumStepSize ) && std::isinf( relativeErrorTolerance ) &&
@@ -248,6 +231,7 @@ public:
         stepSizeController_->initialize( initialState );
 
         stepSizeValidator_ = std::make_shared< BasicIntegratorStepSizeValidator< TimeStepType > >( minimumStepSize, maximumStepSize );
+        initializeAdaptiveOrderControl( useAdaptiveOrder );
     }
 
     ~BulirschStoerVariableStepSizeIntegrator( ) { }
@@ -284,7 +268,15 @@ public:
 
     // Perform a single integration step.
     /*
-     * Perform a single integration step and compute a new step size.
+     * Perform a single integration step and compute a new step size. The state at the end of the step is obtained by
+     * Aitken-Neville extrapolation of modified mid-point integrations with the sub-step numbers in the sequence. The
+     * extrapolation tableau is preallocated and updated in place, row by row, so that only the current row needs to be stored.
+     *
+     * If adaptive order control is used, the number of rows that is computed is adapted during the integration, using
+     * the order and step size selection strategy of Hairer et al. (1993, Section II.9): rows are computed up to one row
+     * beyond the current target row, and the step is accepted as soon as the error estimate of a row (within one row of the
+     * target) meets the tolerances. The target row and step size for the next step are then chosen to minimize the number
+     * of state derivative evaluations per unit step.
      * \param stepSize The step size to take. If the time step is too large to satisfy the error
      *          constraints, the step is redone until the error constraint is satisfied.
      * \return The state at the end of the interval.
@@ -296,67 +288,21 @@ public:
             throw std::runtime_error( "Error in BS integrator, step size is NaN" );
         }
 
-        StateType stateAtFirstPoint_;
-        StateType stateAtCenterPoint_;
-        StateType stateAtLastPoint_;
+        // State derivative at start of step is common to all rows of the extrapolation tableau
+        initialStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
 
-        bool stepSuccessful = 0;
-
-        // Compute sub steps to take.
-        for( unsigned int p = 0; p < subSteps_.size( ); p++ )
+        // Repeat step with step size recommended by the step-size control until it is accepted
+        unsigned int acceptedRowIndex = maximumStepIndex_;
+        TimeStepType currentStepSize = stepSize;
+        while( !attemptIntegrationStep( currentStepSize, acceptedRowIndex ) )
         {
-            subSteps_.at( p ) = stepSize / static_cast< double >( sequence_.at( p ) );
+            currentStepSize = this->stepSize_;
         }
 
-        double errorScaleTerm = TUDAT_NAN;
-        for( unsigned int i = 0; i <= maximumStepIndex_; i++ )
-        {
-            // Compute Euler step and set as state at center point for use with mid-point method.
-            stateAtCenterPoint_ =
-                    currentState_ + subSteps_.at( i ) * this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
-
-            // Apply modified mid-point rule.
-            stateAtFirstPoint_ = currentState_;
-            IndependentVariableType independentVariableAtFirstPoint_ = currentIndependentVariable_;
-            for( unsigned int j = 0; j < sequence_.at( i ) - 1; j++ )
-            {
-                stateAtLastPoint_ = executeMidPointMethod(
-                        stateAtFirstPoint_, stateAtCenterPoint_, independentVariableAtFirstPoint_, subSteps_.at( i ) );
-
-                if( j < sequence_.at( i ) - 2 )
-                {
-                    stateAtFirstPoint_ = stateAtCenterPoint_;
-                    stateAtCenterPoint_ = stateAtLastPoint_;
-                    independentVariableAtFirstPoint_ += subSteps_.at( i );
-                }
-            }
-
-            // Apply end-point correction.
-            integratedStates_[ i ][ 0 ] = 0.5 *
-                    ( stateAtLastPoint_ + stateAtCenterPoint_ +
-                      subSteps_.at( i ) * this->stateDerivativeFunction_( currentIndependentVariable_ + stepSize, stateAtLastPoint_ ) );
-
-            for( unsigned int k = 1; k < i + 1; k++ )
-            {
-                integratedStates_[ i ][ k ] = integratedStates_[ i ][ k - 1 ] +
-                        1.0 / ( pow( subSteps_.at( i - k ), 2.0 ) / std::pow( subSteps_.at( i ), 2.0 ) - 1.0 ) *
-                                ( integratedStates_[ i ][ k - 1 ] - integratedStates_[ i - 1 ][ k - 1 ] );
-            }
-        }
-
-        if( computeNextStepSizeAndValidateResult( integratedStates_.at( maximumStepIndex_ ).at( maximumStepIndex_ - 1 ),
-                                                  integratedStates_.at( maximumStepIndex_ ).at( maximumStepIndex_ ),
-                                                  stepSize ) )
-        {
-            this->lastIndependentVariable_ = this->currentIndependentVariable_;
-            this->lastState_ = this->currentState_;
-            this->currentIndependentVariable_ += stepSize;
-            currentState_ = integratedStates_[ maximumStepIndex_ ][ maximumStepIndex_ ];
-        }
-        else
-        {
-            performIntegrationStep( this->stepSize_ );
-        }
+        this->lastIndependentVariable_ = this->currentIndependentVariable_;
+        this->lastState_ = this->currentState_;
+        this->currentIndependentVariable_ += currentStepSize;
+        currentState_ = extrapolationTableau_[ acceptedRowIndex ];
 
         return currentState_;
     }
@@ -384,6 +330,18 @@ public:
         }
     }
 
+    // Function to retrieve whether the number of extrapolation steps is adapted during the integration
+    bool getUseAdaptiveOrder( ) const
+    {
+        return useAdaptiveOrder_;
+    }
+
+    // Function to retrieve the index in the step sequence up to which the next step is (nominally) computed
+    unsigned int getTargetExtrapolationRowIndex( ) const
+    {
+        return useAdaptiveOrder_ ? targetRowIndex_ : maximumStepIndex_;
+    }
+
     // Rollback internal state to the last state.
     /*
      * Performs rollback of the internal state to the last state. This function can only be called
@@ -465,30 +423,319 @@ private:
      */
     TimeStepType stepSize_;
 
-    // Execute mid-point method.
+    // Function to preallocate the extrapolation tableau and precompute the extrapolation coefficients
+    void initializeExtrapolationTableau( const StateType& initialState )
+    {
+        if( sequence_.size( ) <= 0 )
+        {
+            throw std::runtime_error( "Error when creating BS integrator, sequence is empty." );
+        }
+        maximumStepIndex_ = static_cast< unsigned int >( sequence_.size( ) ) - 1;
+        subSteps_.resize( maximumStepIndex_ + 1 );
+
+        extrapolationTableau_.assign( maximumStepIndex_ + 1, initialState );
+        extrapolatedState_ = initialState;
+        firstPointState_ = initialState;
+        centerPointState_ = initialState;
+        lastPointState_ = initialState;
+
+        // Compute Aitken-Neville coefficients 1 / ( ( n_i / n_{i-k} )^2 - 1 ), stored row-wise
+        extrapolationCoefficients_.assign( ( maximumStepIndex_ + 1 ) * ( maximumStepIndex_ + 1 ), TUDAT_NAN );
+        for( unsigned int i = 1; i <= maximumStepIndex_; i++ )
+        {
+            for( unsigned int k = 1; k <= i; k++ )
+            {
+                const double stepRatio = static_cast< double >( sequence_.at( i ) ) / static_cast< double >( sequence_.at( i - k ) );
+                extrapolationCoefficients_[ i * ( maximumStepIndex_ + 1 ) + k ] = 1.0 / ( stepRatio * stepRatio - 1.0 );
+            }
+        }
+
+        // Compute number of state derivative evaluations needed to compute rows of tableau
+        cumulativeNumberOfEvaluations_.resize( maximumStepIndex_ + 1 );
+        for( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+        {
+            cumulativeNumberOfEvaluations_[ i ] = ( i == 0 ? 1.0 : cumulativeNumberOfEvaluations_[ i - 1 ] ) + sequence_.at( i );
+        }
+    }
+
+    // Function to initialize the settings for the adaptive order control
+    void initializeAdaptiveOrderControl( const bool useAdaptiveOrder )
+    {
+        useAdaptiveOrder_ = useAdaptiveOrder && !useFixedStep_;
+        if( useAdaptiveOrder_ && maximumStepIndex_ < 2 )
+        {
+            throw std::runtime_error( "Error when creating BS integrator, adaptive order control requires at least 3 sequence entries" );
+        }
+
+        targetRowIndex_ = ( maximumStepIndex_ > 1 ) ? maximumStepIndex_ - 1 : maximumStepIndex_;
+        lastStepRejected_ = false;
+        optimalStepSizes_.assign( maximumStepIndex_ + 1, TUDAT_NAN );
+        numberOfEvaluationsPerUnitStep_.assign( maximumStepIndex_ + 1, TUDAT_NAN );
+    }
+
+    // Function to compute a single row of the extrapolation tableau.
     /*
-     * Executes mid-point method, given a known state and state derivative.
-     * \param stateAtFirstPoint State at first point.
-     * \param stateAtCenterPoint State at center point.
-     * \param independentVariableAtFirstPoint Independent variable at first point.
-     * \param subStepSize Sub step size between successive states used by mid-point method.
-     * \return Result of midpoint method
+     * Function to compute a single row of the extrapolation tableau, by performing a modified mid-point integration with the
+     * sub-step of this row, and extrapolating the result using the previous row. On input, extrapolationTableau_ contains
+     * the previous row of the tableau; on output, it contains the row with index rowIndex (entries up to and including
+     * rowIndex). The initialStateDerivative_ must be set before calling this function.
+     * \param rowIndex Index of row that is to be computed
+     * \param stepSize Size of the full integration step
      */
-    StateType executeMidPointMethod( StateType stateAtFirstPoint,
-                                     StateType stateAtCenterPoint,
-                                     const IndependentVariableType independentVariableAtFirstPoint,
-                                     const IndependentVariableType subStepSize )
+    void computeExtrapolationTableauRow( const unsigned int rowIndex, const TimeStepType stepSize )
     {
-        return stateAtFirstPoint +
-                2.0 * subStepSize * this->stateDerivativeFunction_( independentVariableAtFirstPoint + subStepSize, stateAtCenterPoint );
+        // Compute Euler step and set as state at center point for use with mid-point method.
+        centerPointState_ = currentState_ + subSteps_.at( rowIndex ) * initialStateDerivative_;
+
+        // Apply modified mid-point rule, cycling through the preallocated states.
+        const IndependentVariableType subStepSize = subSteps_.at( rowIndex );
+        firstPointState_ = currentState_;
+        IndependentVariableType independentVariableAtFirstPoint = currentIndependentVariable_;
+        for( unsigned int j = 0; j < sequence_.at( rowIndex ) - 1; j++ )
+        {
+            lastPointState_ = firstPointState_ +
+                    2.0 * subStepSize * this->stateDerivativeFunction_( independentVariableAtFirstPoint + subStepSize, centerPointState_ );
+
+            if( j < sequence_.at( rowIndex ) - 2 )
+            {
+                firstPointState_.swap( centerPointState_ );
+                centerPointState_.swap( lastPointState_ );
+                independentVariableAtFirstPoint += subStepSize;
+            }
+        }
+
+        // Apply end-point correction.
+        extrapolatedState_ = 0.5 *
+                ( lastPointState_ + centerPointState_ +
+                  subSteps_.at( rowIndex ) * this->stateDerivativeFunction_( currentIndependentVariable_ + stepSize, lastPointState_ ) );
+
+        // Perform Aitken-Neville extrapolation in place: entry k - 1 of the previous row is replaced by entry k - 1 of this row.
+        const double* rowCoefficients = extrapolationCoefficients_.data( ) + rowIndex * ( maximumStepIndex_ + 1 );
+        for( unsigned int k = 1; k <= rowIndex; k++ )
+        {
+            extrapolationTableau_[ k - 1 ] =
+                    extrapolatedState_ + rowCoefficients[ k ] * ( extrapolatedState_ - extrapolationTableau_[ k - 1 ] );
+            extrapolationTableau_[ k - 1 ].swap( extrapolatedState_ );
+        }
+        extrapolationTableau_[ rowIndex ] = extrapolatedState_;
     }
 
-    std::vector< std::vector< StateType > > integratedStates_;
+    // Function to attempt an integration step
+    /*
+     * Function to attempt an integration step, computing the extrapolation tableau and a new step size.
+     * \param stepSize Size of the integration step
+     * \param acceptedRowIndex Index of tableau row that is to be used as new state (returned by reference)
+     * \return True if the step is accepted, false otherwise
+     */
+    bool attemptIntegrationStep( const TimeStepType stepSize, unsigned int& acceptedRowIndex )
+    {
+        // Compute sub steps to take.
+        for( unsigned int p = 0; p < subSteps_.size( ); p++ )
+        {
+            subSteps_.at( p ) = stepSize / static_cast< double >( sequence_.at( p ) );
+        }
+
+        if( !useAdaptiveOrder_ )
+        {
+            for( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+            {
+                computeExtrapolationTableauRow( i, stepSize );
+            }
+            acceptedRowIndex = maximumStepIndex_;
+            return computeNextStepSizeAndValidateResult(
+                    extrapolationTableau_.at( maximumStepIndex_ - 1 ), extrapolationTableau_.at( maximumStepIndex_ ), stepSize );
+        }
+        else
+        {
+            return attemptAdaptiveOrderIntegrationStep( stepSize, acceptedRowIndex );
+        }
+    }
+
+    // Function to attempt an integration step with adaptive order control (see performIntegrationStep)
+    bool attemptAdaptiveOrderIntegrationStep( const TimeStepType stepSize, unsigned int& acceptedRowIndex )
+    {
+        const unsigned int targetRowIndex = targetRowIndex_;
+        const unsigned int firstRowToCheck = std::max( 1U, lastStepRejected_ ? targetRowIndex : targetRowIndex - 1 );
+        const double firstSequenceEntry = static_cast< double >( sequence_.at( 0 ) );
+
+        // Compute rows of tableau, until convergence is reached, or is not expected to be reached (convergence monitor)
+        bool isConverged = false;
+        unsigned int rowIndex = 0;
+        for( ; rowIndex <= targetRowIndex + 1; rowIndex++ )
+        {
+            computeExtrapolationTableauRow( rowIndex, stepSize );
+            if( rowIndex == 0 )
+            {
+                continue;
+            }
+
+            // Compute optimal step size and number of evaluations per unit step for this row
+            const TimeStepType normalizedError = stepSizeController_->computeNormalizedErrorEstimate(
+                    extrapolationTableau_[ rowIndex - 1 ], extrapolationTableau_[ rowIndex ] );
+            optimalStepSizes_[ rowIndex ] =
+                    stepSizeController_->computeTimeStepFromErrorEstimate( normalizedError, stepSize, 2.0 * rowIndex + 1.0 ).first;
+            numberOfEvaluationsPerUnitStep_[ rowIndex ] =
+                    cumulativeNumberOfEvaluations_[ rowIndex ] / std::fabs( static_cast< double >( optimalStepSizes_[ rowIndex ] ) );
+
+            if( rowIndex >= firstRowToCheck )
+            {
+                if( normalizedError <= 1.0 )
+                {
+                    isConverged = true;
+                    break;
+                }
+
+                // Reject step if error is not expected to meet the tolerances in the final row (with thresholds as in ODEX code)
+                double maximumErrorReduction = 1.0;
+                for( unsigned int j = rowIndex + 1; j <= targetRowIndex + 1; j++ )
+                {
+                    const double sequenceRatio = static_cast< double >( sequence_.at( j ) ) / firstSequenceEntry;
+                    maximumErrorReduction *= sequenceRatio * sequenceRatio;
+                }
+                if( normalizedError > maximumErrorReduction )
+                {
+                    break;
+                }
+            }
+        }
+        rowIndex = std::min( rowIndex, targetRowIndex + 1 );
+
+        std::pair< TimeStepType, bool > recommendedNewStepSizePair;
+        if( isConverged )
+        {
+            // Select target row for next step, based on number of evaluations per unit step
+            unsigned int newTargetRowIndex;
+            if( rowIndex == 1 )
+            {
+                newTargetRowIndex = lastStepRejected_ ? 1 : std::min( 2U, maximumStepIndex_ - 1 );
+            }
+            else if( rowIndex <= targetRowIndex )
+            {
+                newTargetRowIndex = rowIndex;
+                if( numberOfEvaluationsPerUnitStep_[ rowIndex - 1 ] < orderDecreaseFactor_ * numberOfEvaluationsPerUnitStep_[ rowIndex ] )
+                {
+                    newTargetRowIndex = rowIndex - 1;
+                }
+                if( numberOfEvaluationsPerUnitStep_[ rowIndex ] < orderIncreaseFactor_ * numberOfEvaluationsPerUnitStep_[ rowIndex - 1 ] )
+                {
+                    newTargetRowIndex = std::min( rowIndex + 1, maximumStepIndex_ - 1 );
+                }
+            }
+            else
+            {
+                newTargetRowIndex = rowIndex - 1;
+                if( rowIndex > 2 &&
+                    numberOfEvaluationsPerUnitStep_[ rowIndex - 2 ] <
+                            orderDecreaseFactor_ * numberOfEvaluationsPerUnitStep_[ rowIndex - 1 ] )
+                {
+                    newTargetRowIndex = rowIndex - 2;
+                }
+                if( numberOfEvaluationsPerUnitStep_[ rowIndex ] <
+                    orderIncreaseFactor_ * numberOfEvaluationsPerUnitStep_[ newTargetRowIndex ] )
+                {
+                    newTargetRowIndex = std::min( rowIndex, maximumStepIndex_ - 1 );
+                }
+            }
+
+            // Select step size for next step, scaling with number of evaluations if order is increased
+            TimeStepType newStepSize;
+            if( lastStepRejected_ )
+            {
+                newTargetRowIndex = std::min( newTargetRowIndex, rowIndex );
+                newStepSize = ( std::fabs( static_cast< double >( optimalStepSizes_[ newTargetRowIndex ] ) ) <
+                                std::fabs( static_cast< double >( stepSize ) ) )
+                        ? optimalStepSizes_[ newTargetRowIndex ]
+                        : stepSize;
+            }
+            else if( newTargetRowIndex <= rowIndex )
+            {
+                newStepSize = optimalStepSizes_[ newTargetRowIndex ];
+            }
+            else if( rowIndex < targetRowIndex &&
+                     numberOfEvaluationsPerUnitStep_[ rowIndex ] <
+                             orderIncreaseFactor_ * numberOfEvaluationsPerUnitStep_[ rowIndex - 1 ] )
+            {
+                newStepSize = optimalStepSizes_[ rowIndex ] * cumulativeNumberOfEvaluations_[ newTargetRowIndex + 1 ] /
+                        cumulativeNumberOfEvaluations_[ rowIndex ];
+            }
+            else
+            {
+                newStepSize = optimalStepSizes_[ rowIndex ] * cumulativeNumberOfEvaluations_[ newTargetRowIndex ] /
+                        cumulativeNumberOfEvaluations_[ rowIndex ];
+            }
+
+            targetRowIndex_ = newTargetRowIndex;
+            recommendedNewStepSizePair = std::make_pair( newStepSize, true );
+        }
+        else
+        {
+            // Reduce step size (and possibly target row) after rejected step
+            unsigned int newTargetRowIndex = std::min( targetRowIndex, rowIndex );
+            if( newTargetRowIndex > 1 &&
+                numberOfEvaluationsPerUnitStep_[ newTargetRowIndex - 1 ] <
+                        orderDecreaseFactor_ * numberOfEvaluationsPerUnitStep_[ newTargetRowIndex ] )
+            {
+                newTargetRowIndex--;
+            }
+
+            targetRowIndex_ = newTargetRowIndex;
+            recommendedNewStepSizePair = std::make_pair( optimalStepSizes_[ newTargetRowIndex ], false );
+        }
+
+        std::pair< TimeStepType, bool > validatedNewStepSizePair = stepSizeValidator_->validateStep( recommendedNewStepSizePair, stepSize );
+        this->stepSize_ = validatedNewStepSizePair.first;
+        lastStepRejected_ = !validatedNewStepSizePair.second;
+        acceptedRowIndex = rowIndex;
+
+        return validatedNewStepSizePair.second;
+    }
+
+    // Preallocated row of the extrapolation tableau, updated in place during each step (see computeExtrapolationTableauRow).
+    std::vector< StateType > extrapolationTableau_;
+
+    // Aitken-Neville coefficients for each entry of extrapolation tableau (stored row-wise, with maximumStepIndex_ + 1 columns)
+    std::vector< double > extrapolationCoefficients_;
+
+    // Most recently extrapolated entry of the tableau
+    StateType extrapolatedState_;
+
+    // Work states for the modified mid-point method
+    StateType firstPointState_;
+
+    StateType centerPointState_;
+
+    StateType lastPointState_;
+
+    // State derivative at the start of the current step
+    StateDerivativeType initialStateDerivative_;
 
     unsigned int maximumStepIndex_;
 
     std::vector< double > subSteps_;
 
+    // Total number of state derivative evaluations needed to compute tableau up to and including a given row
+    std::vector< double > cumulativeNumberOfEvaluations_;
+
+    // Boolean denoting whether the number of rows in the tableau is adapted during the integration
+    bool useAdaptiveOrder_;
+
+    // Index of row up to which the tableau is nominally computed, if adaptive order control is used
+    unsigned int targetRowIndex_;
+
+    // Boolean denoting whether the most recent step attempt was rejected, if adaptive order control is used
+    bool lastStepRejected_;
+
+    // Optimal step size computed from error estimate of each row in most recent step attempt
+    std::vector< TimeStepType > optimalStepSizes_;
+
+    // Number of state derivative evaluations per unit step for each row in most recent step attempt
+    std::vector< double > numberOfEvaluationsPerUnitStep_;
+
+    // Factors by which number of evaluations per unit step must be reduced to decrease/increase the target row
+    static constexpr double orderDecreaseFactor_ = 0.8;
+
+    static constexpr double orderIncreaseFactor_ = 0.9;
+
     std::shared_ptr< IntegratorStepSizeController< TimeStepType, StateType > > stepSizeController_;
 
     std::shared_ptr< IntegratorStepSizeValidator< TimeStepType > > stepSizeValidator_;
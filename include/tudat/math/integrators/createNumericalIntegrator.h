@@ -821,10 +821,12 @@ public:
                                      const unsigned int maximumNumberOfSteps,
                                      const std::shared_ptr< IntegratorStepSizeControlSettings > stepSizeControlSettings,
                                      const std::shared_ptr< IntegratorStepSizeValidationSettings > stepSizeAcceptanceSettings,
-                                     const bool assessTerminationOnMinorSteps = false ):
+                                     const bool assessTerminationOnMinorSteps = false,
+                                     const bool useAdaptiveOrder = false ):
         IntegratorSettings< IndependentVariableType >( bulirschStoer, TUDAT_NAN, initialTimeStep, assessTerminationOnMinorSteps ),
         extrapolationSequence_( extrapolationSequence ), maximumNumberOfSteps_( maximumNumberOfSteps ),
-        stepSizeControlSettings_( stepSizeControlSettings ), stepSizeAcceptanceSettings_( stepSizeAcceptanceSettings )
+        stepSizeControlSettings_( stepSizeControlSettings ), stepSizeAcceptanceSettings_( stepSizeAcceptanceSettings ),
+        useAdaptiveOrder_( useAdaptiveOrder )
     { }
 
     // Constructor.
@@ -880,7 +882,8 @@ public:
                                                                                                maximumNumberOfSteps_,
                                                                                                stepSizeControlSettings_,
                                                                                                stepSizeAcceptanceSettings_,
-                                                                                               this->assessTerminationOnMinorSteps_ );
+                                                                                               this->assessTerminationOnMinorSteps_,
+                                                                                               useAdaptiveOrder_ );
     }
 
     // Destructor.
@@ -898,6 +901,10 @@ public:
     std::shared_ptr< IntegratorStepSizeControlSettings > stepSizeControlSettings_;
 
     std::shared_ptr< IntegratorStepSizeValidationSettings > stepSizeAcceptanceSettings_;
+
+    // Boolean denoting whether the number of entries of the sequence that is used is adapted during the integration (only
+    // for variable step size; maximumNumberOfSteps_ is then the upper limit)
+    bool useAdaptiveOrder_ = false;
 };
 
 // Class to define settings of variable step ABAM numerical integrator
@@ -1191,14 +1198,16 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > bulirsch
         const unsigned int maximumNumberOfSteps,
         const std::shared_ptr< IntegratorStepSizeControlSettings > stepSizeControlSettings,
         const std::shared_ptr< IntegratorStepSizeValidationSettings > stepSizeAcceptanceSettings,
-        const bool assessTerminationOnMinorSteps = false )
+        const bool assessTerminationOnMinorSteps = false,
+        const bool useAdaptiveOrder = false )
 {
     return std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType > >( initialTimeStep,
                                                                                            extrapolationSequence,
                                                                                            maximumNumberOfSteps,
                                                                                            stepSizeControlSettings,
                                                                                            stepSizeAcceptanceSettings,
-                                                                                           assessTerminationOnMinorSteps );
+                                                                                           assessTerminationOnMinorSteps,
+                                                                                           useAdaptiveOrder );
 }
 
 template< typename IndependentVariableType = double >
@@ -1690,7 +1699,8 @@ createIntegrator(
                             initialState,
                             static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
                             stepSizeController,
-                            stepSizeValidator );
+                            stepSizeValidator,
+                            bulirschStoerIntegratorSettings->useAdaptiveOrder_ );
                 }
                 else
                 {
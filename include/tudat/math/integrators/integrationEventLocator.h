@@ -0,0 +1,386 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *
+ */
+
+#ifndef TUDAT_INTEGRATION_EVENT_LOCATOR_H
+#define TUDAT_INTEGRATION_EVENT_LOCATOR_H
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/basic/functionProxy.h"
+#include "tudat/math/integrators/numericalIntegrator.h"
+#include "tudat/math/root_finders/createRootFinder.h"
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Enum defining which zero crossings of an event function are to be detected.
+enum IntegrationEventDirection { any_event_crossing, increasing_event_crossing, decreasing_event_crossing };
+
+//! Class defining an event (zero crossing of a function of the independent variable and state) to locate during integration.
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd >
+class IntegrationEventSettings
+{
+public:
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event, used to identify it in the list of located events.
+     * \param eventFunction Function of independent variable and state, for which the zero crossings define the event. For
+     * instance, the z-component of the position for node crossings, or the radial velocity for apsis passages.
+     * \param eventDirection Direction of zero crossings that are to be detected.
+     * \param isTerminal Boolean denoting whether the integration is to be terminated when the event is located.
+     */
+    IntegrationEventSettings( const std::string& eventName,
+                              const std::function< double( const IndependentVariableType, const StateType& ) > eventFunction,
+                              const IntegrationEventDirection eventDirection = any_event_crossing,
+                              const bool isTerminal = false ):
+        eventName_( eventName ), eventFunction_( eventFunction ), eventDirection_( eventDirection ), isTerminal_( isTerminal )
+    { }
+
+    //! Destructor
+    virtual ~IntegrationEventSettings( ) { }
+
+    //! Name of the event, used to identify it in the list of located events.
+    std::string eventName_;
+
+    //! Function of independent variable and state, for which the zero crossings define the event.
+    std::function< double( const IndependentVariableType, const StateType& ) > eventFunction_;
+
+    //! Direction of zero crossings that are to be detected.
+    IntegrationEventDirection eventDirection_;
+
+    //! Boolean denoting whether the integration is to be terminated when the event is located.
+    bool isTerminal_;
+};
+
+//! Structure containing the details of an event located during the integration.
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd >
+struct LocatedIntegrationEvent {
+    //! Index of the event in the list of event settings provided to the IntegrationEventLocator.
+    unsigned int eventIndex_;
+
+    //! Name of the event.
+    std::string eventName_;
+
+    //! Value of the independent variable at which the event occurs.
+    IndependentVariableType independentVariable_;
+
+    //! State (from dense output) at which the event occurs.
+    StateType state_;
+
+    //! Boolean denoting whether the event function is increasing (true) or decreasing (false) at the event.
+    bool isIncreasing_;
+
+    //! Boolean denoting whether the event is terminal.
+    bool isTerminal_;
+};
+
+//! Class to locate events (zero crossings of event functions) during numerical integration, using dense output.
+/*!
+ * Class to locate events (zero crossings of event functions) during numerical integration. After each step, the event
+ * functions are evaluated at the end of the step, and a sign change w.r.t. the value at the start of the step indicates an
+ * event. The time of the event is then found by a root finder, using the dense output (continuous extension) of the
+ * integrator to evaluate the state inside the step (Hairer et al., 1993, Section II.6). As a result, locating any number of
+ * events only requires evaluations of the (typically inexpensive) event functions and of the dense output, and never requires
+ * rejecting or redoing integration steps. Events occurring more than once within a single step are not detected, as for any
+ * sign-change based method. An event located at the exact end of a step (event function equal to zero) is reported once.
+ *
+ * NOTE: the times and states of located events are only as accurate as the dense output, not as the integrator itself. For
+ * the Runge-Kutta integrators, the dense output is a cubic Hermite interpolant over the step, with an error of O(h^4) for step
+ * size h, regardless of the order of the integrator. For high-order integrators taking large steps, the event time and state
+ * may therefore be orders of magnitude less accurate than the integrated states. When a terminal event is used to stop the
+ * propagation (see integrateEquationsFromIntegrator), the last step is redone to end at the located event time, so that the
+ * final state is computed by the integrator itself, but the event time still has the accuracy of the dense output.
+ */
+template< typename IndependentVariableType = double,
+          typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = StateType,
+          typename TimeStepType = IndependentVariableType >
+class IntegrationEventLocator
+{
+public:
+    //! Typedef of the numerical integrator from which events are located.
+    typedef NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > Integrator;
+
+    //! Typedef of settings for a single event.
+    typedef IntegrationEventSettings< IndependentVariableType, StateType > EventSettings;
+
+    //! Typedef of a single located event.
+    typedef LocatedIntegrationEvent< IndependentVariableType, StateType > LocatedEvent;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventSettings List of events that are to be located.
+     * \param rootFinderSettings Settings for the root finder used to locate the events inside a step. The root finder operates
+     * on the time since the start of the step, and is provided with the start and end of the step as bounds. By default, a
+     * bisection root finder is used, with a relative tolerance of 1.0E-12 (w.r.t. the time since the start of the step).
+     */
+    IntegrationEventLocator( const std::vector< std::shared_ptr< EventSettings > >& eventSettings,
+                             const std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings =
+                                     root_finders::bisectionRootFinderSettings(
+                                             1.0E-12, TUDAT_NAN, TUDAT_NAN, 100, root_finders::accept_result ) ):
+        eventSettings_( eventSettings ), rootFinderSettings_( rootFinderSettings ), isInitialized_( false ),
+        terminalEventIsLocated_( false )
+    {
+        if( rootFinderSettings_->rootFinderType_ == root_finders::newton_raphson_root_finder ||
+            rootFinderSettings_->rootFinderType_ == root_finders::halley_root_finder )
+        {
+            throw std::runtime_error( "Error when creating integration event locator, root finder may not require derivatives." );
+        }
+        previousEventFunctionValues_.resize( eventSettings_.size( ) );
+        currentEventFunctionValues_.resize( eventSettings_.size( ) );
+    }
+
+    //! Destructor
+    virtual ~IntegrationEventLocator( ) { }
+
+    //! Function to (re)initialize the event locator at the start of the integration.
+    /*!
+     * Function to (re)initialize the event locator at the start of the integration, evaluating the event functions at the
+     * initial state. Any previously located events are removed.
+     * \param independentVariable Initial value of the independent variable.
+     * \param state Initial state.
+     */
+    void initialize( const IndependentVariableType independentVariable, const StateType& state )
+    {
+        previousIndependentVariable_ = independentVariable;
+        for( unsigned int i = 0; i < eventSettings_.size( ); i++ )
+        {
+            previousEventFunctionValues_[ i ] = eventSettings_.at( i )->eventFunction_( independentVariable, state );
+        }
+        locatedEvents_.clear( );
+        terminalEventIsLocated_ = false;
+        isInitialized_ = true;
+    }
+
+    //! Function to locate the events in the last step that was taken by an integrator.
+    /*!
+     * Function to locate the events in the last step that was taken by an integrator, i.e. between the independent variable
+     * at which this function was last called (or initialize was called), and the current independent variable of the
+     * integrator. The integrator must provide dense output over this interval if an event is detected. Located events are
+     * added to the list retrieved by getLocatedEvents (in order of occurrence). If a terminal event is located, events after
+     * it are discarded.
+     * \param integrator Numerical integrator that has just taken a step.
+     * \return True if a terminal event was located in the step.
+     */
+    bool processStep( const std::shared_ptr< Integrator > integrator )
+    {
+        if( !isInitialized_ )
+        {
+            throw std::runtime_error( "Error when locating integration events, locator is not initialized." );
+        }
+
+        const IndependentVariableType currentIndependentVariable = integrator->getCurrentIndependentVariable( );
+        const StateType currentState = integrator->getCurrentState( );
+        const TimeStepType stepSize = static_cast< TimeStepType >( currentIndependentVariable - previousIndependentVariable_ );
+
+        // Detect sign changes of event functions, and locate corresponding events
+        std::vector< LocatedEvent > eventsInStep;
+        for( unsigned int i = 0; i < eventSettings_.size( ); i++ )
+        {
+            currentEventFunctionValues_[ i ] = eventSettings_.at( i )->eventFunction_( currentIndependentVariable, currentState );
+
+            const double previousValue = previousEventFunctionValues_[ i ];
+            const double currentValue = currentEventFunctionValues_[ i ];
+            bool isIncreasing = ( previousValue < 0.0 && currentValue >= 0.0 );
+            bool isDecreasing = ( previousValue > 0.0 && currentValue <= 0.0 );
+            if( ( isIncreasing && eventSettings_.at( i )->eventDirection_ != decreasing_event_crossing ) ||
+                ( isDecreasing && eventSettings_.at( i )->eventDirection_ != increasing_event_crossing ) )
+            {
+                LocatedEvent locatedEvent;
+                locatedEvent.eventIndex_ = i;
+                locatedEvent.eventName_ = eventSettings_.at( i )->eventName_;
+                locatedEvent.isIncreasing_ = isIncreasing;
+                locatedEvent.isTerminal_ = eventSettings_.at( i )->isTerminal_;
+
+                if( currentValue == 0.0 )
+                {
+                    locatedEvent.independentVariable_ = currentIndependentVariable;
+                    locatedEvent.state_ = currentState;
+                }
+                else
+                {
+                    locateEventInStep( integrator, i, stepSize, locatedEvent );
+                }
+                eventsInStep.push_back( locatedEvent );
+            }
+        }
+
+        // Sort events in order of occurrence, and discard events after the first terminal event
+        const bool isForwardPropagation = ( stepSize >= mathematical_constants::getFloatingInteger< TimeStepType >( 0 ) );
+        std::stable_sort( eventsInStep.begin( ), eventsInStep.end( ), [ = ]( const LocatedEvent& first, const LocatedEvent& second ) {
+            return isForwardPropagation ? ( first.independentVariable_ < second.independentVariable_ )
+                                        : ( second.independentVariable_ < first.independentVariable_ );
+        } );
+        for( unsigned int i = 0; i < eventsInStep.size( ); i++ )
+        {
+            locatedEvents_.push_back( eventsInStep.at( i ) );
+            if( eventsInStep.at( i ).isTerminal_ )
+            {
+                terminalEventIsLocated_ = true;
+                break;
+            }
+        }
+
+        previousIndependentVariable_ = currentIndependentVariable;
+        previousEventFunctionValues_.swap( currentEventFunctionValues_ );
+
+        return terminalEventIsLocated_;
+    }
+
+    //! Function to retrieve all located events, in order of occurrence.
+    /*!
+     * Function to retrieve all located events, in order of occurrence.
+     * \return All located events, in order of occurrence.
+     */
+    const std::vector< LocatedEvent >& getLocatedEvents( ) const
+    {
+        return locatedEvents_;
+    }
+
+    //! Function to retrieve the located events with a given name, in order of occurrence.
+    /*!
+     * Function to retrieve the located events with a given name, in order of occurrence.
+     * \param eventName Name of the event
+     * \return Located events with the given name, in order of occurrence.
+     */
+    std::vector< LocatedEvent > getLocatedEvents( const std::string& eventName ) const
+    {
+        std::vector< LocatedEvent > locatedEvents;
+        for( unsigned int i = 0; i < locatedEvents_.size( ); i++ )
+        {
+            if( locatedEvents_.at( i ).eventName_ == eventName )
+            {
+                locatedEvents.push_back( locatedEvents_.at( i ) );
+            }
+        }
+        return locatedEvents;
+    }
+
+    //! Function to retrieve whether a terminal event has been located.
+    /*!
+     * Function to retrieve whether a terminal event has been located.
+     * \return True if a terminal event has been located.
+     */
+    bool getTerminalEventIsLocated( ) const
+    {
+        return terminalEventIsLocated_;
+    }
+
+    //! Function to retrieve the terminal event that has been located.
+    /*!
+     * Function to retrieve the terminal event that has been located (last entry of list of located events).
+     * \return Terminal event that has been located.
+     */
+    const LocatedEvent& getTerminalEvent( ) const
+    {
+        if( !terminalEventIsLocated_ )
+        {
+            throw std::runtime_error( "Error when retrieving terminal integration event, no terminal event has been located." );
+        }
+        return locatedEvents_.back( );
+    }
+
+    //! Function to retrieve the list of events that are to be located.
+    /*!
+     * Function to retrieve the list of events that are to be located.
+     * \return List of events that are to be located.
+     */
+    const std::vector< std::shared_ptr< EventSettings > >& getEventSettings( ) const
+    {
+        return eventSettings_;
+    }
+
+private:
+    //! Function to locate a single event inside the last step, using the dense output of the integrator.
+    /*!
+     * Function to locate a single event inside the last step, using the dense output of the integrator. The located time and
+     * state have the accuracy of the dense output (O(h^4) for the cubic Hermite interpolant of the Runge-Kutta integrators),
+     * see class description.
+     * \param integrator Numerical integrator that has just taken a step.
+     * \param eventIndex Index of event that is to be located.
+     * \param stepSize Size of the step in which the event is to be located.
+     * \param locatedEvent Event for which the independent variable and state are to be set (returned by reference).
+     */
+    void locateEventInStep( const std::shared_ptr< Integrator > integrator,
+                            const unsigned int eventIndex,
+                            const TimeStepType stepSize,
+                            LocatedEvent& locatedEvent )
+    {
+        if( !integrator->isDenseOutputAvailable( previousIndependentVariable_ ) )
+        {
+            throw std::runtime_error( "Error when locating integration event " + eventSettings_.at( eventIndex )->eventName_ +
+                                      ", integrator does not provide dense output over last step." );
+        }
+
+        const IndependentVariableType startIndependentVariable = previousIndependentVariable_;
+        const std::function< double( const IndependentVariableType, const StateType& ) > eventFunction =
+                eventSettings_.at( eventIndex )->eventFunction_;
+        std::function< TimeStepType( TimeStepType ) > eventFunctionInStep = [ = ]( const TimeStepType timeSinceStepStart ) {
+            const IndependentVariableType independentVariable = startIndependentVariable + timeSinceStepStart;
+            return static_cast< TimeStepType >(
+                    eventFunction( independentVariable, integrator->getDenseOutputState( independentVariable ) ) );
+        };
+
+        const TimeStepType zero = mathematical_constants::getFloatingInteger< TimeStepType >( 0 );
+        std::shared_ptr< root_finders::RootFinder< TimeStepType > > rootFinder = root_finders::createRootFinder< TimeStepType >(
+                rootFinderSettings_, std::min( zero, stepSize ), std::max( zero, stepSize ), stepSize );
+        const TimeStepType eventTimeSinceStepStart = rootFinder->execute(
+                std::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >( eventFunctionInStep ),
+                stepSize / mathematical_constants::getFloatingInteger< TimeStepType >( 2 ) );
+
+        locatedEvent.independentVariable_ = startIndependentVariable + eventTimeSinceStepStart;
+        locatedEvent.state_ = integrator->getDenseOutputState( locatedEvent.independentVariable_ );
+    }
+
+    //! List of events that are to be located.
+    std::vector< std::shared_ptr< EventSettings > > eventSettings_;
+
+    //! Settings for the root finder used to locate the events inside a step.
+    std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings_;
+
+    //! Boolean denoting whether initialize has been called.
+    bool isInitialized_;
+
+    //! Independent variable at the start of the step that is to be processed.
+    IndependentVariableType previousIndependentVariable_;
+
+    //! Values of the event functions at the start of the step that is to be processed.
+    std::vector< double > previousEventFunctionValues_;
+
+    //! Values of the event functions at the end of the step that is being processed.
+    std::vector< double > currentEventFunctionValues_;
+
+    //! List of all located events, in order of occurrence.
+    std::vector< LocatedEvent > locatedEvents_;
+
+    //! Boolean denoting whether a terminal event has been located.
+    bool terminalEventIsLocated_;
+};
+
+}  // namespace numerical_integrators
+
+}  // namespace tudat
+
+#endif  // TUDAT_INTEGRATION_EVENT_LOCATOR_H
@@ -129,6 +129,34 @@ public:
         throw std::runtime_error( "Function getPreviousState not implemented in this integrator" );
     }
 
+    //! Function to check whether the state at a given independent variable can be retrieved from dense output.
+    /*!
+     * Function to check whether the state at a given independent variable can be retrieved from the dense output (continuous
+     * extension) of the integrator, see getDenseOutputState. Derived classes that provide dense output should override this
+     * function. By default, no dense output is available.
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return True if the dense output state can be computed at the given independent variable.
+     */
+    virtual bool isDenseOutputAvailable( const IndependentVariableType independentVariable )
+    {
+        TUDAT_UNUSED_PARAMETER( independentVariable );
+        return false;
+    }
+
+    //! Function to compute the state at a given independent variable from dense output.
+    /*!
+     * Function to compute the state at a given independent variable from the dense output (continuous extension) of the
+     * integrator, typically within the last step that was taken. Derived classes that provide dense output should override
+     * this function. If not implemented, throws error.
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return State at the requested independent variable.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        TUDAT_UNUSED_PARAMETER( independentVariable );
+        throw std::runtime_error( "Function getDenseOutputState not implemented in this integrator" );
+    }
+
     //! Perform an integration to a specified independent variable value.
     /*!
      * Performs an integration to independentVariableEnd with initial state and initial independent
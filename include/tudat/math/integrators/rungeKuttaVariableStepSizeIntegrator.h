@@ -10,6 +10,7 @@
  *    References
  *      Burden, R.L., Faires, J.D. Numerical Analysis, 7th Edition, Books/Cole, 2001.
  *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
  *
  */
 
@@ -316,6 +317,8 @@ public:
 
         this->currentIndependentVariable_ = this->lastIndependentVariable_;
         this->currentState_ = this->lastState_;
+        firstStageStateDerivativeIsAvailable_ = false;
+        denseOutputEndStateIsCurrentState_ = false;
         return true;
     }
 
@@ -352,6 +355,8 @@ public:
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
         currentState_ = newState;
+        firstStageStateDerivativeIsAvailable_ = false;
+        denseOutputEndStateIsCurrentState_ = false;
         if( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -371,6 +376,8 @@ public:
     {
         currentState_ = newState;
         currentIndependentVariable_ = newTime;
+        firstStageStateDerivativeIsAvailable_ = false;
+        denseOutputEndStateIsCurrentState_ = false;
         if( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -402,6 +409,69 @@ public:
         return stepSizeValidator_;
     }
 
+    //! Function to check whether the state at a given independent variable can be retrieved from dense output.
+    /*!
+     * Function to check whether the state at a given independent variable can be retrieved from dense output, i.e. whether it is
+     * within the last step that was accepted by performIntegrationStep (which remains available after a rollback).
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return True if the dense output state can be computed at the given independent variable.
+     */
+    virtual bool isDenseOutputAvailable( const IndependentVariableType independentVariable )
+    {
+        if( !denseOutputIsAvailable_ )
+        {
+            return false;
+        }
+        double stepFraction = static_cast< double >( independentVariable - denseOutputStartIndependentVariable_ ) /
+                static_cast< double >( denseOutputStepSize_ );
+        return ( stepFraction >= -1.0E-10 ) && ( stepFraction <= 1.0 + 1.0E-10 );
+    }
+
+    //! Function to compute the state within the last accepted step (dense output).
+    /*!
+     * Function to compute the state at a value of the independent variable within the last accepted step, using the continuous
+     * extension of the Runge-Kutta scheme. A cubic Hermite continuous extension (Hairer et al., 1993, Section II.6) is used,
+     * defined by the states and state derivatives at the start and end of the step. The state derivative at the start of the
+     * step is the first stage of the step. The state derivative at the end of the step is evaluated when dense output is first
+     * requested for the step, and is subsequently reused as the first stage of the next step, so that no additional state
+     * derivative evaluations are required when propagating with dense output.
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return State at the requested independent variable.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        if( !isDenseOutputAvailable( independentVariable ) )
+        {
+            throw std::runtime_error( "Error in RK dense output, requested independent variable is outside range of last step." );
+        }
+
+        // Evaluate state derivative at end of step, if not yet done for this step.
+        if( !denseOutputEndStateDerivativeIsAvailable_ )
+        {
+            denseOutputEndStateDerivative_ = this->stateDerivativeFunction_(
+                    denseOutputStartIndependentVariable_ + denseOutputStepSize_, denseOutputEndState_ );
+            denseOutputEndStateDerivativeIsAvailable_ = true;
+
+            // Store derivative for use as first stage of the next step, if the integrator has not since been rolled back/modified.
+            if( denseOutputEndStateIsCurrentState_ )
+            {
+                firstStageStateDerivative_ = denseOutputEndStateDerivative_;
+                firstStageStateDerivativeIsAvailable_ = true;
+            }
+        }
+
+        // Evaluate cubic Hermite polynomial.
+        const TimeStepType stepFraction =
+                static_cast< TimeStepType >( independentVariable - denseOutputStartIndependentVariable_ ) / denseOutputStepSize_;
+        const TimeStepType one = mathematical_constants::getFloatingInteger< TimeStepType >( 1 );
+        const TimeStepType two = mathematical_constants::getFloatingInteger< TimeStepType >( 2 );
+        return ( one - stepFraction ) * denseOutputStartState_ + stepFraction * denseOutputEndState_ +
+                ( stepFraction * ( stepFraction - one ) ) *
+                ( ( one - two * stepFraction ) * ( denseOutputEndState_ - denseOutputStartState_ ) +
+                  ( ( stepFraction - one ) * denseOutputStepSize_ ) * denseOutputStartStateDerivative_ +
+                  ( stepFraction * denseOutputStepSize_ ) * denseOutputEndStateDerivative_ );
+    }
+
 protected:
     //! Computes the next step size and validates the result.
     /*!
@@ -476,6 +546,43 @@ protected:
 
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
+
+    //! State derivative at current independent variable and state, to be used as first stage of the next step.
+    /*!
+     * State derivative at current independent variable and state, to be used as first stage of the next step. It is set when a
+     * step is rejected, or when the dense output of the last step is evaluated.
+     */
+    StateDerivativeType firstStageStateDerivative_;
+
+    //! Boolean denoting whether firstStageStateDerivative_ is valid for the current independent variable and state.
+    bool firstStageStateDerivativeIsAvailable_ = false;
+
+    //! Boolean denoting whether the dense output of the last accepted step is available.
+    bool denseOutputIsAvailable_ = false;
+
+    //! Independent variable at start of last accepted step (used for dense output).
+    IndependentVariableType denseOutputStartIndependentVariable_;
+
+    //! Size of last accepted step (used for dense output).
+    TimeStepType denseOutputStepSize_;
+
+    //! State at start of last accepted step (used for dense output).
+    StateType denseOutputStartState_;
+
+    //! State at end of last accepted step (used for dense output).
+    StateType denseOutputEndState_;
+
+    //! State derivative at start of last accepted step (used for dense output).
+    StateDerivativeType denseOutputStartStateDerivative_;
+
+    //! State derivative at end of last accepted step (used for dense output), evaluated when dense output is first requested.
+    StateDerivativeType denseOutputEndStateDerivative_;
+
+    //! Boolean denoting whether denseOutputEndStateDerivative_ has been evaluated for the last accepted step.
+    bool denseOutputEndStateDerivativeIsAvailable_ = false;
+
+    //! Boolean denoting whether the current state is (still) equal to the state at the end of the last accepted step.
+    bool denseOutputEndStateIsCurrentState_ = false;
 };
 
 // extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -512,9 +619,16 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
             intermediateState += stepSize * this->coefficients_.aCoefficients( stage, column ) * currentStateDerivatives_[ column ];
         }
 
-        // Compute the state derivative.
+        // Compute the state derivative (reusing the first stage if it is already available for the current state).
         const IndependentVariableType time = this->currentIndependentVariable_ + this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        if( stage == 0 && firstStageStateDerivativeIsAvailable_ && this->coefficients_.cCoefficients( 0 ) == 0.0 )
+        {
+            currentStateDerivatives_.push_back( firstStageStateDerivative_ );
+        }
+        else
+        {
+            currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        }
 
         // Check if propagation should terminate because the propagation termination condition has been reached
         // while computing the intermediate state.
@@ -543,19 +657,40 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         {
             case RungeKuttaCoefficients::lower:
                 this->currentState_ = lowerOrderEstimate;
-                return this->currentState_;
+                break;
 
             case RungeKuttaCoefficients::higher:
                 this->currentState_ = higherOrderEstimate;
-                return this->currentState_;
+                break;
 
             default:  // The default case will never occur because OrderEstimateToIntegrate is an enum.
                 throw std::runtime_error( "Order estimate to integrate is invalid." );
         }
+
+        // Store data of accepted step for dense output.
+        denseOutputIsAvailable_ = ( currentStateDerivatives_.size( ) > 0 );
+        if( denseOutputIsAvailable_ )
+        {
+            denseOutputStartIndependentVariable_ = this->lastIndependentVariable_;
+            denseOutputStepSize_ = stepSize;
+            denseOutputStartState_ = this->lastState_;
+            denseOutputEndState_ = this->currentState_;
+            denseOutputStartStateDerivative_ = currentStateDerivatives_.at( 0 );
+        }
+        denseOutputEndStateDerivativeIsAvailable_ = false;
+        denseOutputEndStateIsCurrentState_ = denseOutputIsAvailable_;
+        firstStageStateDerivativeIsAvailable_ = false;
+
+        return this->currentState_;
     }
     else
     {
-        // Reject current step.
+        // Reject current step, reusing the first stage for the next attempt.
+        if( currentStateDerivatives_.size( ) > 0 )
+        {
+            firstStageStateDerivative_ = currentStateDerivatives_.at( 0 );
+            firstStageStateDerivativeIsAvailable_ = true;
+        }
         return performIntegrationStep( this->stepSize_ );
     }
 }
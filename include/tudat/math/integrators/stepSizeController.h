@@ -182,14 +182,25 @@ public:
                                                                 const StateType& secondStateEstimate,
                                                                 const TimeStepType& currentStep ) = 0;
 
-protected:
+    // Function to compute the error of a step, normalized such that a value <= 1 meets the tolerances. Only required by
+    // integrators that vary their order during propagation (such as the adaptive-order Bulirsch-Stoer integrator), so that
+    // derived classes need not implement it.
+    virtual TimeStepType computeNormalizedErrorEstimate( const StateType& firstStateEstimate, const StateType& secondStateEstimate )
+    {
+        throw std::runtime_error( "Error, step size controller does not provide a normalized error estimate, as required for "
+                                  "integrators with adaptive order" );
+    }
+
+    // Function to compute the new step from a normalized error, for an error estimate of the given order (used by integrators
+    // that vary their order during propagation, such as the adaptive-order Bulirsch-Stoer integrator)
     std::pair< TimeStepType, bool > computeTimeStepFromErrorEstimate( const TimeStepType& maximumErrorInState,
-                                                                      const TimeStepType& currentStep )
+                                                                      const TimeStepType& currentStep,
+                                                                      const double integratorOrder )
     {
         // Compute the new step size. This is based off of the equation given in
         // (Montenbruck and Gill, 2005).
         const TimeStepType timeStepRatio = safetyFactorForNextStepSize_ *
-                std::pow( 1.0 / static_cast< double >( maximumErrorInState ), 1.0 / static_cast< double >( integratorOrder_ ) );
+                std::pow( 1.0 / static_cast< double >( maximumErrorInState ), 1.0 / static_cast< double >( integratorOrder ) );
 
         bool tolerancesMet = maximumErrorInState <= 1.0;
         if( timeStepRatio <= minimumFactorDecreaseForNextStepSize_ )
@@ -206,6 +217,13 @@ protected:
         }
     }
 
+protected:
+    std::pair< TimeStepType, bool > computeTimeStepFromErrorEstimate( const TimeStepType& maximumErrorInState,
+                                                                      const TimeStepType& currentStep )
+    {
+        return computeTimeStepFromErrorEstimate( maximumErrorInState, currentStep, integratorOrder_ );
+    }
+
     const double safetyFactorForNextStepSize_;
 
     const double integratorOrder_;
@@ -268,6 +286,12 @@ public:
     std::pair< TimeStepType, bool > computeNewStepSize( const StateType& firstStateEstimate,
                                                         const StateType& secondStateEstimate,
                                                         const TimeStepType& currentStep )
+    {
+        return this->computeTimeStepFromErrorEstimate( computeNormalizedErrorEstimate( firstStateEstimate, secondStateEstimate ),
+                                                       currentStep );
+    }
+
+    TimeStepType computeNormalizedErrorEstimate( const StateType& firstStateEstimate, const StateType& secondStateEstimate )
     {
         if( !tolerancesSet_ )
         {
@@ -288,7 +312,7 @@ public:
         // matrix.
         const typename StateType::Scalar maximumErrorInState_ = relativeTruncationError_.array( ).abs( ).maxCoeff( );
 
-        return this->computeTimeStepFromErrorEstimate( maximumErrorInState_, currentStep );
+        return maximumErrorInState_;
     }
 
 protected:
@@ -402,6 +426,12 @@ public:
     std::pair< TimeStepType, bool > computeNewStepSize( const StateType& firstStateEstimate,
                                                         const StateType& secondStateEstimate,
                                                         const TimeStepType& currentStep )
+    {
+        return this->computeTimeStepFromErrorEstimate( computeNormalizedErrorEstimate( firstStateEstimate, secondStateEstimate ),
+                                                       currentStep );
+    }
+
+    TimeStepType computeNormalizedErrorEstimate( const StateType& firstStateEstimate, const StateType& secondStateEstimate )
     {
         if( blocksToCheck_.size( ) == 0 )
         {
@@ -433,7 +463,7 @@ public:
         // matrix.
         const typename StateType::Scalar maximumErrorInState_ = relativeTruncationError_.array( ).abs( ).maxCoeff( );
 
-        return this->computeTimeStepFromErrorEstimate( maximumErrorInState_, currentStep );
+        return maximumErrorInState_;
     }
 
 protected:
@@ -476,7 +506,13 @@ public:
                                                         const StateType& secondStateEstimate,
                                                         const TimeStepType& currentStep )
     {
-        return computeTimeStepFromErrorEstimate( customErrorFunction_( firstStateEstimate, secondStateEstimate ), currentStep );
+        return this->computeTimeStepFromErrorEstimate( computeNormalizedErrorEstimate( firstStateEstimate, secondStateEstimate ),
+                                                       currentStep );
+    }
+
+    TimeStepType computeNormalizedErrorEstimate( const StateType& firstStateEstimate, const StateType& secondStateEstimate )
+    {
+        return customErrorFunction_( firstStateEstimate, secondStateEstimate );
     }
 
 protected:
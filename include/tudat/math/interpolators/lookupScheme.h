@@ -12,6 +12,7 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <atomic>
 #include <vector>
 #include <iostream>
 #include <memory>
@@ -88,7 +89,9 @@ protected:
 
 //! Look-up scheme class for nearest left neighbour search using hunting algorithm.
 /*!
- *  Look-up scheme class for nearest left neighbour search using hunting algorithm.
+ *  Look-up scheme class for nearest left neighbour search using hunting algorithm. The index found in the previous call is
+ *  stored atomically, so that the scheme (and interpolators using it) can be used from multiple threads concurrently. The
+ *  result does not depend on the stored index, which only serves as a starting guess.
  *  \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
  */
 template< typename IndependentVariableType >
@@ -104,7 +107,7 @@ public:
      * lookup procedure.
      */
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >& independentVariableValues ):
-        LookUpScheme< IndependentVariableType >( independentVariableValues ), isFirstLookupDone( 0 ), previousNearestLowerIndex_( 0 )
+        LookUpScheme< IndependentVariableType >( independentVariableValues ), isFirstLookupDone( false ), previousNearestLowerIndex_( 0 )
     { }
 
     //! Default destructor
@@ -127,20 +130,23 @@ public:
         int newNearestLowerIndex = 0;
 
         // If this is first call of function, use binary search.
-        if( !isFirstLookupDone )
+        if( !isFirstLookupDone.load( std::memory_order_relaxed ) )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch< IndependentVariableType >(
                     independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
+            isFirstLookupDone.store( true, std::memory_order_relaxed );
         }
 
         else
         {
+            // Retrieve index of previous call (possibly from another thread)
+            const int previousNearestLowerIndex = previousNearestLowerIndex_.load( std::memory_order_relaxed );
+
             // If requested value is in same interval, return same value as previous time.
             if( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >(
-                        previousNearestLowerIndex_, valueToLookup, independentVariableValues_ ) )
+                        previousNearestLowerIndex, valueToLookup, independentVariableValues_ ) )
             {
-                newNearestLowerIndex = previousNearestLowerIndex_;
+                newNearestLowerIndex = previousNearestLowerIndex;
             }
             else if( valueToLookup < independentVariableValues_.at( 0 ) )
             {
@@ -150,12 +156,12 @@ public:
             else
             {
                 newNearestLowerIndex = basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm< IndependentVariableType >(
-                        valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        valueToLookup, previousNearestLowerIndex, independentVariableValues_ );
             }
         }
 
         // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        previousNearestLowerIndex_.store( newNearestLowerIndex, std::memory_order_relaxed );
 
         return newNearestLowerIndex;
     }
@@ -165,13 +171,13 @@ private:
     /*!
      * Boolean to denote whether a lookup has been done.
      */
-    bool isFirstLookupDone;
+    std::atomic< bool > isFirstLookupDone;
 
     //! Nearest left index during previous call.
     /*!
      * Nearest left index during previous call
      */
-    int previousNearestLowerIndex_;
+    std::atomic< int > previousNearestLowerIndex_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
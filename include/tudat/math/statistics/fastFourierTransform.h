@@ -2,6 +2,7 @@
 #define FASTFOURIERTRANSFORM_H
 
 #include <complex>
+#include <string>
 #include <vector>
 #include <map>
 
@@ -26,6 +27,65 @@ std::vector< double > performInverseFftToRealData( const std::vector< std::compl
 // i.e. assuming other terms are conjugates.
 double* performRawInverseFFtToRealData( fftw_complex* frequencyDomainData, const int numberOfDataPoints );
 
+//! Function to perform the Fourier transform of a set of real data series of equal length, using a single FFTW plan.
+/*!
+ *  Function to perform the Fourier transform of a set of real data series of equal length, using a single (batched) FFTW
+ *  plan. Each output entry has length realTimeDomainData.at( i ).size( ) / 2 + 1, i.e. without the conjugate terms
+ *  (as for performFftOfRealData).
+ *  \param realTimeDomainData List of real time-domain data series (all of equal length)
+ *  \return List of frequency-domain data series (one per input series)
+ */
+std::vector< std::vector< std::complex< double > > > performFftOfMultipleRealDataSeries(
+        const std::vector< std::vector< double > >& realTimeDomainData );
+
+//! Function to perform the inverse Fourier transform of a set of frequency-domain series of equal length, using a single FFTW
+//! plan.
+/*!
+ *  Function to perform the inverse Fourier transform of a set of frequency-domain series (without conjugate terms) of equal
+ *  length, using a single (batched) FFTW plan. Each output entry has length 2 * frequencyDomainData.at( i ).size( ) - 2
+ *  (as for performInverseFftToRealData).
+ *  \param frequencyDomainData List of frequency-domain data series, without conjugate terms (all of equal length)
+ *  \return List of real time-domain data series (one per input series)
+ */
+std::vector< std::vector< double > > performInverseFftToMultipleRealDataSeries(
+        const std::vector< std::vector< std::complex< double > > >& frequencyDomainData );
+
+//! Function to set whether FFTW plans are created by measurement (FFTW_MEASURE), or by estimation (FFTW_ESTIMATE)
+/*!
+ *  Function to set whether FFTW plans are created by measurement (FFTW_MEASURE, default), or by estimation (FFTW_ESTIMATE).
+ *  Measured plans are typically faster to execute, but slower to create, and are only beneficial if a transform of the same
+ *  size is performed repeatedly. Since measuring very large transforms is prohibitively expensive, plans with a total size
+ *  (number of data points times number of series) above the given maximum are only measured if corresponding FFTW wisdom is
+ *  available (see importFftwWisdomFromFile), and are estimated otherwise. Calling this function clears the plan cache.
+ *  \param useMeasuredPlans Boolean denoting whether FFTW_MEASURE (if true) or FFTW_ESTIMATE (if false) is used
+ *  \param maximumMeasuredPlanSize Maximum total size of a transform for which a plan is measured without available wisdom
+ */
+void setUseMeasuredFftPlans( const bool useMeasuredPlans, const int maximumMeasuredPlanSize = 1048576 );
+
+//! Function to clear all cached FFTW plans and associated buffers
+void clearFftPlanCache( );
+
+//! Function to retrieve the number of FFTW plans that are currently cached
+int getNumberOfCachedFftPlans( );
+
+//! Function to import FFTW wisdom from a file, so that plans for previously measured sizes can be created quickly
+/*!
+ *  Function to import FFTW wisdom from a file (as created by exportFftwWisdomToFile), so that measured plans for previously
+ *  used transform sizes can be created without repeating the measurements.
+ *  \param fileName Name of file from which wisdom is to be read
+ *  \return True if wisdom was successfully imported, false otherwise
+ */
+bool importFftwWisdomFromFile( const std::string& fileName );
+
+//! Function to export the FFTW wisdom accumulated in the current process to a file
+/*!
+ *  Function to export the FFTW wisdom accumulated in the current process to a file, for use in later runs with
+ *  importFftwWisdomFromFile.
+ *  \param fileName Name of file to which wisdom is to be written
+ *  \return True if wisdom was successfully exported, false otherwise
+ */
+bool exportFftwWisdomToFile( const std::string& fileName );
+
 }  // namespace fftw_interface
 
 }  // namespace tudat
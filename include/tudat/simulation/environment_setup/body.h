@@ -509,6 +509,137 @@ protected:
     bool modelIsTimeDependent_;
 };
 
+//! Class for a fixed-size cache of quantities computed at a number of previous epochs.
+/*!
+ *  Class for a fixed-size cache of quantities computed at a number of previous epochs. Entries are stored in a ring buffer,
+ *  so that the oldest entry is overwritten when a new entry is added to a full cache. Entries are only retrieved for epochs
+ *  that are exactly equal to the epoch at which they were stored.
+ */
+template< typename ValueType >
+class EpochRingCache
+{
+public:
+    //! Constructor
+    /*!
+     * Constructor
+     * \param cacheSize Maximum number of entries in the cache (cache is inactive if 0)
+     */
+    EpochRingCache( const int cacheSize = 0 )
+    {
+        resize( cacheSize );
+    }
+
+    //! Function to reset the maximum number of entries in the cache, clearing all entries
+    void resize( const int cacheSize )
+    {
+        if( cacheSize < 0 )
+        {
+            throw std::runtime_error( "Error when setting epoch cache size, size must be positive, but is " +
+                                      std::to_string( cacheSize ) );
+        }
+        epochs_.resize( cacheSize );
+        values_.resize( cacheSize );
+        clear( );
+    }
+
+    //! Function to clear all entries in the cache
+    void clear( )
+    {
+        std::fill( epochs_.begin( ), epochs_.end( ), Time( TUDAT_NAN ) );
+        nextIndex_ = 0;
+    }
+
+    //! Function to retrieve the maximum number of entries in the cache
+    int size( ) const
+    {
+        return static_cast< int >( epochs_.size( ) );
+    }
+
+    //! Function to retrieve the entry at a given epoch (nullptr if there is no such entry)
+    ValueType* find( const Time& epoch )
+    {
+        for( unsigned int i = 0; i < epochs_.size( ); i++ )
+        {
+            if( epochs_[ i ] == epoch )
+            {
+                return &values_[ i ];
+            }
+        }
+        return nullptr;
+    }
+
+    //! Function to add an entry at a given epoch (overwriting the oldest entry), returns reference to value that is to be set.
+    ValueType& insert( const Time& epoch )
+    {
+        ValueType& value = values_[ nextIndex_ ];
+        epochs_[ nextIndex_ ] = epoch;
+        nextIndex_ = ( nextIndex_ + 1 ) % epochs_.size( );
+        return value;
+    }
+
+private:
+    //! Epochs at which entries are stored (NaN for empty entries)
+    std::vector< Time > epochs_;
+
+    //! Cached values
+    std::vector< ValueType > values_;
+
+    //! Index of entry that is to be overwritten next
+    unsigned int nextIndex_;
+};
+
+//! Translational state of a body retrieved from its ephemeris, as stored in the epoch cache of a Body
+struct CachedEphemerisState {
+    Eigen::Vector6d state;
+    Eigen::Matrix< long double, 6, 1 > longState;
+    Eigen::Vector6d barycentricState;
+    Eigen::Matrix< long double, 6, 1 > barycentricLongState;
+};
+
+//! Rotational state of a body retrieved from its rotational ephemeris, as stored in the epoch cache of a Body
+struct CachedEphemerisRotation {
+    Eigen::Quaterniond rotationToLocalFrame;
+    Eigen::Matrix3d rotationToLocalFrameDerivative;
+    Eigen::Vector3d angularVelocityVectorInGlobalFrame;
+};
+
+//! Number of hits and misses of the epoch caches of a Body (or of all bodies in a SystemOfBodies)
+struct EphemerisCacheStatistics {
+    EphemerisCacheStatistics( ): stateHits( 0 ), stateMisses( 0 ), rotationHits( 0 ), rotationMisses( 0 ) { }
+
+    EphemerisCacheStatistics& operator+=( const EphemerisCacheStatistics& statisticsToAdd )
+    {
+        stateHits += statisticsToAdd.stateHits;
+        stateMisses += statisticsToAdd.stateMisses;
+        rotationHits += statisticsToAdd.rotationHits;
+        rotationMisses += statisticsToAdd.rotationMisses;
+        return *this;
+    }
+
+    //! Number of translational states retrieved from the cache
+    long long stateHits;
+
+    //! Number of translational states computed from the ephemeris (with the cache active)
+    long long stateMisses;
+
+    //! Number of rotations retrieved from the cache
+    long long rotationHits;
+
+    //! Number of rotations computed from the rotational ephemeris (with the cache active)
+    long long rotationMisses;
+};
+
+//! Function to check whether a rotational ephemeris depends only on time
+/*!
+ * Function to check whether a rotational ephemeris depends only on time, or (possibly) also on the current state of the
+ * environment (e.g. aerodynamic angle, direction-based and synchronous rotation models). Only simple, constant, SPICE,
+ * GCRS-ITRS, planetary, IAU and tabulated rotation models are identified as depending only on time, all other models are
+ * conservatively assumed to depend on the environment.
+ * \param rotationalEphemeris Rotational ephemeris that is to be checked
+ * \return True if the rotational ephemeris depends only on time
+ */
+bool isRotationalEphemerisDependentOnlyOnTime( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris );
+
 //! Body class representing the properties of a celestial body (natural or artificial).
 /*!
  *  Body class representing the properties of a celestial body (natural or artificial). By storing
@@ -629,6 +760,22 @@ public:
         {
             if( !( static_cast< Time >( time ) == timeOfCurrentState_ ) )
             {
+                // Retrieve state from epoch cache, if available
+                if( stateCache_.size( ) > 0 )
+                {
+                    if( CachedEphemerisState* cachedState = stateCache_.find( static_cast< Time >( time ) ) )
+                    {
+                        currentState_ = cachedState->state;
+                        currentLongState_ = cachedState->longState;
+                        currentBarycentricState_ = cachedState->barycentricState;
+                        currentBarycentricLongState_ = cachedState->barycentricLongState;
+                        timeOfCurrentState_ = static_cast< TimeType >( time );
+                        cacheStatistics_.stateHits++;
+                        isStateSet_ = true;
+                        return;
+                    }
+                }
+
                 if( bodyEphemeris_ == nullptr )
                 {
                     throw std::runtime_error( "Error when requesting state from ephemeris of body " + bodyName_ + ", body has no ephemeris" );
@@ -676,6 +823,17 @@ public:
                 }
 
                 timeOfCurrentState_ = static_cast< TimeType >( time );
+
+                // Store state in epoch cache
+                if( stateCache_.size( ) > 0 )
+                {
+                    CachedEphemerisState& cachedState = stateCache_.insert( static_cast< Time >( time ) );
+                    cachedState.state = currentState_;
+                    cachedState.longState = currentLongState_;
+                    cachedState.barycentricState = currentBarycentricState_;
+                    cachedState.barycentricLongState = currentBarycentricLongState_;
+                    cacheStatistics_.stateMisses++;
+                }
             }
             isStateSet_ = true;
         }
@@ -866,7 +1024,11 @@ public:
      */
     void setCurrentRotationToLocalFrameFromEphemeris( const double time )
     {
-        if( rotationalEphemeris_ != nullptr )
+        if( rotationalEphemeris_ != nullptr && rotationCache_.size( ) > 0 )
+        {
+            currentRotationToLocalFrame_ = getCachedRotationFromEphemeris< double >( time ).rotationToLocalFrame;
+        }
+        else if( rotationalEphemeris_ != nullptr )
         {
             currentRotationToLocalFrame_ = rotationalEphemeris_->getRotationToTargetFrame( time );
         }
@@ -892,7 +1054,15 @@ public:
     template< typename TimeType >
     void setCurrentRotationalStateToLocalFrameFromEphemeris( const TimeType time )
     {
-        if( rotationalEphemeris_ != nullptr )
+        if( rotationalEphemeris_ != nullptr && rotationCache_.size( ) > 0 )
+        {
+            const CachedEphemerisRotation& cachedRotation = getCachedRotationFromEphemeris< TimeType >( time );
+            currentRotationToLocalFrame_ = cachedRotation.rotationToLocalFrame;
+            currentRotationToLocalFrameDerivative_ = cachedRotation.rotationToLocalFrameDerivative;
+            currentAngularVelocityVectorInGlobalFrame_ = cachedRotation.angularVelocityVectorInGlobalFrame;
+            currentAngularVelocityVectorInLocalFrame_ = currentRotationToLocalFrame_ * currentAngularVelocityVectorInGlobalFrame_;
+        }
+        else if( rotationalEphemeris_ != nullptr )
         {
             rotationalEphemeris_->getFullRotationalQuantitiesToTargetFrameTemplated< TimeType >( currentRotationToLocalFrame_,
                                                                                                  currentRotationToLocalFrameDerivative_,
@@ -915,6 +1085,86 @@ public:
         isRotationSet_ = true;
     }
 
+    //! Function to transform a state from the body-fixed to the global frame, using the rotational ephemeris
+    /*!
+     * Function to transform a state from the body-fixed to the global frame, using the rotational ephemeris at the given time.
+     * If the epoch cache of the body is active, the rotation is retrieved from (or stored in) the cache. The current rotational
+     * state of the body is not modified by this function.
+     * \param stateInLocalFrame State in body-fixed frame
+     * \param time Time at which the rotation is to be evaluated
+     * \return State in global frame
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    Eigen::Matrix< StateScalarType, 6, 1 > transformStateToGlobalFrameFromEphemeris(
+            const Eigen::Matrix< StateScalarType, 6, 1 >& stateInLocalFrame,
+            const TimeType time )
+    {
+        if( rotationalEphemeris_ == nullptr )
+        {
+            throw std::runtime_error( "Error when transforming state to global frame for body " + bodyName_ +
+                                      ", no rotational ephemeris found" );
+        }
+        else if( rotationCache_.size( ) > 0 )
+        {
+            const CachedEphemerisRotation& cachedRotation = getCachedRotationFromEphemeris< TimeType >( time );
+            return ephemerides::transformStateToFrameFromRotations< StateScalarType >(
+                    stateInLocalFrame,
+                    cachedRotation.rotationToLocalFrame.inverse( ),
+                    cachedRotation.rotationToLocalFrameDerivative.transpose( ) );
+        }
+        else
+        {
+            return ephemerides::transformStateToInertialOrientation< StateScalarType, TimeType >(
+                    stateInLocalFrame, time, rotationalEphemeris_ );
+        }
+    }
+
+    //! Function to set the size of the epoch caches of the states and rotations retrieved from the ephemerides
+    /*!
+     * Function to set the size of the epoch caches of the states and rotations retrieved from the (rotational) ephemeris. When
+     * the size is larger than 0, the states and rotations computed at the most recent cacheSize epochs are stored, and retrieved
+     * without reevaluating the ephemeris when they are requested again at exactly the same epoch. This is typically beneficial
+     * when bodies are evaluated at a number of alternating epochs (for instance in iterated light-time computations of
+     * observation models), for which the single current state is overwritten. The caches are cleared automatically when the
+     * (rotational) ephemeris is reset through this class, or when an integrated ephemeris is reset. If the ephemeris is modified
+     * in any other way, the caches must be cleared manually using clearEphemerisCache. By default, the caches are inactive.
+     * Rotations are only cached if the rotational ephemeris depends only on time (see
+     * isRotationalEphemerisDependentOnlyOnTime), since rotations that depend on the (propagated) state of the environment may
+     * differ between two evaluations at the same epoch.
+     * \param cacheSize Number of epochs that are stored in the cache (0 to deactivate cache)
+     */
+    void setEphemerisCacheSize( const int cacheSize )
+    {
+        stateCache_.resize( cacheSize );
+        resetRotationCacheSize( );
+    }
+
+    //! Function to retrieve the size of the epoch caches of the states and rotations retrieved from the ephemerides
+    int getEphemerisCacheSize( ) const
+    {
+        return stateCache_.size( );
+    }
+
+    //! Function to clear the epoch caches of the states and rotations retrieved from the ephemerides
+    void clearEphemerisCache( )
+    {
+        stateCache_.clear( );
+        rotationCache_.clear( );
+        timeOfCurrentState_ = Time( TUDAT_NAN );
+    }
+
+    //! Function to retrieve the number of hits and misses of the epoch caches since creation (or last reset of statistics)
+    EphemerisCacheStatistics getEphemerisCacheStatistics( ) const
+    {
+        return cacheStatistics_;
+    }
+
+    //! Function to reset the number of hits and misses of the epoch caches to zero
+    void resetEphemerisCacheStatistics( )
+    {
+        cacheStatistics_ = EphemerisCacheStatistics( );
+    }
+
     //! Function to set the full rotational state directly
     /*!
      * Function to set the full rotational state  directly (rotation from global to body-fixed frame
@@ -1136,6 +1386,7 @@ public:
     void setEphemeris( const std::shared_ptr< ephemerides::Ephemeris > bodyEphemeris )
     {
         bodyEphemeris_ = bodyEphemeris;
+        clearEphemerisCache( );
     }
 
     //! Function to set the gravity field of the body.
@@ -1183,6 +1434,8 @@ public:
         //            closure" << std::endl;
         //        }
         rotationalEphemeris_ = rotationalEphemeris;
+        clearEphemerisCache( );
+        resetRotationCacheSize( );
     }
 
     //! Function to set the shape model of the body.
@@ -1795,6 +2048,35 @@ public:
 
 protected:
 private:
+    //! Function to set the size of the rotation cache equal to that of the state cache if the rotational ephemeris depends only
+    //! on time, and to deactivate the rotation cache otherwise
+    void resetRotationCacheSize( )
+    {
+        rotationCache_.resize( ( stateCache_.size( ) > 0 && isRotationalEphemerisDependentOnlyOnTime( rotationalEphemeris_ ) )
+                                       ? stateCache_.size( )
+                                       : 0 );
+    }
+
+    //! Function to retrieve the rotational state from the rotation cache, computing and storing it if it is not available
+    template< typename TimeType >
+    const CachedEphemerisRotation& getCachedRotationFromEphemeris( const TimeType time )
+    {
+        if( CachedEphemerisRotation* cachedRotation = rotationCache_.find( static_cast< Time >( time ) ) )
+        {
+            cacheStatistics_.rotationHits++;
+            return *cachedRotation;
+        }
+
+        CachedEphemerisRotation& cachedRotation = rotationCache_.insert( static_cast< Time >( time ) );
+        rotationalEphemeris_->getFullRotationalQuantitiesToTargetFrameTemplated< TimeType >(
+                cachedRotation.rotationToLocalFrame,
+                cachedRotation.rotationToLocalFrameDerivative,
+                cachedRotation.angularVelocityVectorInGlobalFrame,
+                time );
+        cacheStatistics_.rotationMisses++;
+        return cachedRotation;
+    }
+
     //! Variable denoting whether this body is the global frame origin (1 if true, 0 if false, -1 if not yet set)
     int bodyIsGlobalFrameOrigin_;
 
@@ -1813,6 +2095,15 @@ private:
     //! Time at which state was last set from ephemeris
     Time timeOfCurrentState_;
 
+    //! Cache of states retrieved from the ephemeris at a number of previous epochs (inactive by default)
+    EpochRingCache< CachedEphemerisState > stateCache_;
+
+    //! Cache of rotations retrieved from the rotational ephemeris at a number of previous epochs (inactive by default)
+    EpochRingCache< CachedEphemerisRotation > rotationCache_;
+
+    //! Number of hits and misses of the epoch caches
+    EphemerisCacheStatistics cacheStatistics_;
+
     //! Class returning the state of this body's ephemeris origin w.r.t. the global origin (as typically created by
     //! setGlobalFrameBodyEphemerides function).
     std::shared_ptr< BaseStateInterface > ephemerisFrameToBaseFrame_;
@@ -2235,6 +2526,44 @@ public:
         bodyMap_.erase( bodyName );
     }
 
+    //! Function to set the size of the epoch caches of the states and rotations of all bodies (see Body::setEphemerisCacheSize)
+    void setEphemerisCacheSize( const int cacheSize ) const
+    {
+        for( auto bodyIterator: bodyMap_ )
+        {
+            bodyIterator.second->setEphemerisCacheSize( cacheSize );
+        }
+    }
+
+    //! Function to clear the epoch caches of the states and rotations of all bodies
+    void clearEphemerisCaches( ) const
+    {
+        for( auto bodyIterator: bodyMap_ )
+        {
+            bodyIterator.second->clearEphemerisCache( );
+        }
+    }
+
+    //! Function to retrieve the total number of hits and misses of the epoch caches of all bodies
+    EphemerisCacheStatistics getEphemerisCacheStatistics( ) const
+    {
+        EphemerisCacheStatistics totalStatistics;
+        for( auto bodyIterator: bodyMap_ )
+        {
+            totalStatistics += bodyIterator.second->getEphemerisCacheStatistics( );
+        }
+        return totalStatistics;
+    }
+
+    //! Function to reset the number of hits and misses of the epoch caches of all bodies to zero
+    void resetEphemerisCacheStatistics( ) const
+    {
+        for( auto bodyIterator: bodyMap_ )
+        {
+            bodyIterator.second->resetEphemerisCacheStatistics( );
+        }
+    }
+
 private:
     std::string frameOrigin_;
 
@@ -118,13 +118,13 @@ class BodyListSettings
 public:
     BodyListSettings( const std::string frameOrigin = "SSB", const std::string frameOrientation = "ECLIPJ2000" ):
         bodySettings_( std::map< std::string, std::shared_ptr< BodySettings > >( ) ), frameOrigin_( frameOrigin ),
-        frameOrientation_( frameOrientation )
+        frameOrientation_( frameOrientation ), numberOfCreationThreads_( 1 )
     { }
 
     BodyListSettings( const std::map< std::string, std::shared_ptr< BodySettings > >& bodySettings,
                       const std::string frameOrigin = "SSB",
                       const std::string frameOrientation = "ECLIPJ2000" ):
-        bodySettings_( bodySettings ), frameOrigin_( frameOrigin ), frameOrientation_( frameOrientation )
+        bodySettings_( bodySettings ), frameOrigin_( frameOrigin ), frameOrientation_( frameOrientation ), numberOfCreationThreads_( 1 )
     { }
 
     std::shared_ptr< BodySettings > at( const std::string& bodyName ) const
@@ -183,12 +183,35 @@ public:
         return bodySettings_;
     }
 
+    //! Function to set the number of threads used to create the environment models (1 by default)
+    /*!
+     * Function to set the number of threads used to create the environment models. If larger than 1, environment models that
+     * do not depend on one another (e.g. the ephemerides and gravity fields of different bodies) are created concurrently.
+     * \param numberOfCreationThreads Number of threads used to create the environment models
+     */
+    void setNumberOfCreationThreads( const int numberOfCreationThreads )
+    {
+        if( numberOfCreationThreads < 1 )
+        {
+            throw std::runtime_error( "Error when setting number of threads for body creation, number must be positive, but is " +
+                                      std::to_string( numberOfCreationThreads ) );
+        }
+        numberOfCreationThreads_ = numberOfCreationThreads;
+    }
+
+    int getNumberOfCreationThreads( ) const
+    {
+        return numberOfCreationThreads_;
+    }
+
 private:
     std::map< std::string, std::shared_ptr< BodySettings > > bodySettings_;
 
     std::string frameOrigin_;
 
     std::string frameOrientation_;
+
+    int numberOfCreationThreads_;
 };
 
 void setSimpleRotationSettingsFromSpice( const BodyListSettings& bodySettings, const std::string& bodyName, const double spiceEvaluation );
@@ -203,16 +226,96 @@ void setSimpleRotationSettingsFromSpice( const BodyListSettings& bodySettings, c
 std::vector< std::pair< std::string, std::shared_ptr< BodySettings > > > determineBodyCreationOrder(
         const std::map< std::string, std::shared_ptr< BodySettings > >& bodySettings );
 
-//! Function to create a map of bodies objects.
+//! Function to determine whether an ephemeris created from given settings may be shared between systems of bodies
 /*!
- *  Function to create a map of body objects based on model-specific settings for the bodies,
- *  containing settings for each relevant environment model.
+ * Function to determine whether an ephemeris created from given settings may be shared between different SystemOfBodies
+ * objects (e.g. clones used in parallel runs). This is the case if the model is not bound to any other environment model,
+ * and holds no state that is modified during its evaluation (or only state that is safe under concurrent evaluation).
+ * \param ephemerisSettings Settings for the ephemeris
+ * \return True if the ephemeris may be shared
+ */
+bool isEphemerisModelShareable( const std::shared_ptr< EphemerisSettings > ephemerisSettings );
+
+//! Function to determine whether a gravity field created from given settings may be shared between systems of bodies
+/*!
+ * Function to determine whether a gravity field created from given settings may be shared between systems of bodies
+ * (see isEphemerisModelShareable). Only point-mass gravity fields are shared; spherical harmonic gravity fields update their
+ * internal cache on each evaluation.
+ * \param gravityFieldSettings Settings for the gravity field
+ * \param gravityFieldVariationSettings Settings for the variations of the gravity field
+ * \return True if the gravity field may be shared
+ */
+bool isGravityFieldModelShareable(
+        const std::shared_ptr< GravityFieldSettings > gravityFieldSettings,
+        const std::vector< std::shared_ptr< GravityFieldVariationSettings > >& gravityFieldVariationSettings );
+
+//! Function to determine whether an atmosphere created from given settings may be shared between systems of bodies
+/*!
+ * Function to determine whether an atmosphere created from given settings may be shared between systems of bodies
+ * (see isEphemerisModelShareable).
+ * \param atmosphereSettings Settings for the atmosphere
+ * \return True if the atmosphere may be shared
+ */
+bool isAtmosphereModelShareable( const std::shared_ptr< AtmosphereSettings > atmosphereSettings );
+
+//! Function to determine whether a shape model created from given settings may be shared between systems of bodies
+/*!
+ * Function to determine whether a shape model created from given settings may be shared between systems of bodies
+ * (see isEphemerisModelShareable).
+ * \param shapeModelSettings Settings for the shape model
+ * \return True if the shape model may be shared
+ */
+bool isBodyShapeModelShareable( const std::shared_ptr< BodyShapeSettings > shapeModelSettings );
+
+//! Function to determine whether a rotation model created from given settings may be shared between systems of bodies
+/*!
+ * Function to determine whether a rotation model created from given settings may be shared between systems of bodies
+ * (see isEphemerisModelShareable).
+ * \param rotationModelSettings Settings for the rotation model
+ * \return True if the rotation model may be shared
+ */
+bool isRotationModelShareable( const std::shared_ptr< RotationModelSettings > rotationModelSettings );
+
+//! Function to determine whether the creation of a rotation model requires other environment models to be created first
+/*!
+ * Function to determine whether the creation of a rotation model from given settings requires other environment models (e.g.
+ * the ephemeris of the body, or flight conditions) to be created first. Rotation models for which this function returns false
+ * are created concurrently with the ephemerides in createSystemOfBodies, if multiple threads are used.
+ * \param rotationModelSettings Settings for the rotation model
+ * \return True if the creation of the rotation model depends on other environment models
+ */
+bool isRotationModelDependentOnOtherModels( const std::shared_ptr< RotationModelSettings > rotationModelSettings );
+
+//! Function to execute a list of mutually independent environment model creation tasks
+/*!
+ * Function to execute a list of mutually independent environment model creation tasks. If multiple threads are used, the tasks
+ * are distributed dynamically over the threads. If any task throws an exception, no new tasks are started, and the exception
+ * thrown by the first (in list order) of the failed tasks is rethrown after all threads have finished.
+ * \param creationTasks List of tasks that are to be executed
+ * \param numberOfThreads Number of threads over which the tasks are distributed
+ */
+void executeEnvironmentModelCreationTasks( const std::vector< std::function< void( ) > >& creationTasks, const int numberOfThreads );
+
+//! Function to create a map of bodies objects, reusing immutable environment models of an existing system of bodies
+/*!
+ *  Function to create a map of body objects based on model-specific settings for the bodies, as createSystemOfBodies.
+ *  If modelSourceBodies is provided, it must have been created from the same settings. The ephemeris, gravity field,
+ *  atmosphere, shape and rotation models for which the is...ModelShareable functions return true are then not recreated,
+ *  but taken from modelSourceBodies, so that they are shared by both systems. All other models, as well as the Body
+ *  objects themselves, are newly created.
+ *
+ *  The creation is performed in stages, such that each model is created after all models it may depend on. Within the first
+ *  stage (ephemerides, atmospheres, shapes and rotation models for which isRotationModelDependentOnOtherModels is false) and
+ *  the gravity field stage, models are created concurrently if the number of creation threads in bodySettings is larger than 1.
+ *  All other models are created sequentially.
  *  \param bodySettings List of settings for the bodies that are to be created, defined as a map of
  *  pointers to an object of class BodySettings
+ *  \param modelSourceBodies System of bodies created from bodySettings, from which shareable models are taken (if nullptr,
+ *  all models are created)
  *  \return List of bodies created according to settings in bodySettings.
  */
 template< typename StateScalarType = double, typename TimeType = double >
-SystemOfBodies createSystemOfBodies( const BodyListSettings& bodySettings )
+SystemOfBodies createSystemOfBodiesReusingModels( const BodyListSettings& bodySettings, const SystemOfBodies* modelSourceBodies )
 {
     std::vector< std::pair< std::string, std::shared_ptr< BodySettings > > > orderedBodySettings =
             determineBodyCreationOrder( bodySettings.getMap( ) );
@@ -236,47 +339,121 @@ SystemOfBodies createSystemOfBodies( const BodyListSettings& bodySettings )
         }
     }
 
-    // Create ephemeris objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
+    // Create ephemeris, atmosphere, shape and rotation models that do not depend on any other environment model (concurrently, if
+    // multiple threads are used), and retrieve models that are shared with modelSourceBodies
+    const unsigned int numberOfBodies = orderedBodySettings.size( );
+    std::vector< std::shared_ptr< ephemerides::Ephemeris > > ephemerisModels( numberOfBodies );
+    std::vector< std::shared_ptr< aerodynamics::AtmosphereModel > > atmosphereModels( numberOfBodies );
+    std::vector< std::shared_ptr< basic_astrodynamics::BodyShapeModel > > shapeModels( numberOfBodies );
+    std::vector< std::shared_ptr< ephemerides::RotationalEphemeris > > rotationModels( numberOfBodies );
+    std::vector< std::function< void( ) > > independentModelCreationTasks;
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
     {
-        if( orderedBodySettings.at( i ).second->ephemerisSettings != nullptr )
+        const std::string bodyName = orderedBodySettings.at( i ).first;
+        const std::shared_ptr< EphemerisSettings > ephemerisSettings = orderedBodySettings.at( i ).second->ephemerisSettings;
+        if( ephemerisSettings != nullptr )
         {
-            bodyList.at( orderedBodySettings.at( i ).first )
-                    ->setEphemeris( createBodyEphemeris< StateScalarType, TimeType >( orderedBodySettings.at( i ).second->ephemerisSettings,
-                                                                                      orderedBodySettings.at( i ).first ) );
+            if( modelSourceBodies != nullptr && isEphemerisModelShareable( ephemerisSettings ) )
+            {
+                ephemerisModels.at( i ) = modelSourceBodies->at( bodyName )->getEphemeris( );
+            }
+            else
+            {
+                independentModelCreationTasks.push_back( [ &ephemerisModels, ephemerisSettings, bodyName, i ]( ) {
+                    ephemerisModels.at( i ) = createBodyEphemeris< StateScalarType, TimeType >( ephemerisSettings, bodyName );
+                } );
+            }
         }
     }
-
-    // Create atmosphere model objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
     {
-        if( orderedBodySettings.at( i ).second->atmosphereSettings != nullptr )
+        const std::string bodyName = orderedBodySettings.at( i ).first;
+        const std::shared_ptr< AtmosphereSettings > atmosphereSettings = orderedBodySettings.at( i ).second->atmosphereSettings;
+        if( atmosphereSettings != nullptr )
         {
-            bodyList.at( orderedBodySettings.at( i ).first )
-                    ->setAtmosphereModel( createAtmosphereModel( orderedBodySettings.at( i ).second->atmosphereSettings,
-                                                                 orderedBodySettings.at( i ).first ) );
+            if( modelSourceBodies != nullptr && isAtmosphereModelShareable( atmosphereSettings ) )
+            {
+                atmosphereModels.at( i ) = modelSourceBodies->at( bodyName )->getAtmosphereModel( );
+            }
+            else
+            {
+                independentModelCreationTasks.push_back( [ &atmosphereModels, atmosphereSettings, bodyName, i ]( ) {
+                    atmosphereModels.at( i ) = createAtmosphereModel( atmosphereSettings, bodyName );
+                } );
+            }
         }
     }
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
+    {
+        const std::string bodyName = orderedBodySettings.at( i ).first;
+        const std::shared_ptr< BodyShapeSettings > shapeModelSettings = orderedBodySettings.at( i ).second->shapeModelSettings;
+        if( shapeModelSettings != nullptr )
+        {
+            if( modelSourceBodies != nullptr && isBodyShapeModelShareable( shapeModelSettings ) )
+            {
+                shapeModels.at( i ) = modelSourceBodies->at( bodyName )->getShapeModel( );
+            }
+            else
+            {
+                independentModelCreationTasks.push_back( [ &shapeModels, shapeModelSettings, bodyName, i ]( ) {
+                    shapeModels.at( i ) = createBodyShapeModel( shapeModelSettings, bodyName );
+                } );
+            }
+        }
+    }
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
+    {
+        const std::string bodyName = orderedBodySettings.at( i ).first;
+        const std::shared_ptr< RotationModelSettings > rotationModelSettings = orderedBodySettings.at( i ).second->rotationModelSettings;
+        if( rotationModelSettings != nullptr )
+        {
+            if( modelSourceBodies != nullptr && isRotationModelShareable( rotationModelSettings ) )
+            {
+                rotationModels.at( i ) = modelSourceBodies->at( bodyName )->getRotationalEphemeris( );
+            }
+            else if( !isRotationModelDependentOnOtherModels( rotationModelSettings ) )
+            {
+                // Set default original frame here, so that the settings are not modified by the creation task
+                if( rotationModelSettings->getOriginalFrame( ) == "" )
+                {
+                    rotationModelSettings->resetOriginalFrame( bodyList.getFrameOrientation( ) );
+                }
+                independentModelCreationTasks.push_back( [ &rotationModels, &bodyList, rotationModelSettings, bodyName, i ]( ) {
+                    rotationModels.at( i ) = createRotationModel( rotationModelSettings, bodyName, bodyList );
+                } );
+            }
+        }
+    }
+    executeEnvironmentModelCreationTasks( independentModelCreationTasks, bodySettings.getNumberOfCreationThreads( ) );
 
-    // Create body shape model objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
+    // Set ephemeris, atmosphere and shape models for each body (if required).
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
     {
-        if( orderedBodySettings.at( i ).second->shapeModelSettings != nullptr )
+        if( ephemerisModels.at( i ) != nullptr )
         {
-            bodyList.at( orderedBodySettings.at( i ).first )
-                    ->setShapeModel( createBodyShapeModel( orderedBodySettings.at( i ).second->shapeModelSettings,
-                                                           orderedBodySettings.at( i ).first ) );
+            bodyList.at( orderedBodySettings.at( i ).first )->setEphemeris( ephemerisModels.at( i ) );
+        }
+        if( atmosphereModels.at( i ) != nullptr )
+        {
+            bodyList.at( orderedBodySettings.at( i ).first )->setAtmosphereModel( atmosphereModels.at( i ) );
+        }
+        if( shapeModels.at( i ) != nullptr )
+        {
+            bodyList.at( orderedBodySettings.at( i ).first )->setShapeModel( shapeModels.at( i ) );
         }
     }
 
-    // Create rotation model objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
+    // Set rotation model objects for each body (if required), and create those that depend on other models.
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
     {
         if( orderedBodySettings.at( i ).second->rotationModelSettings != nullptr )
         {
-            bodyList.at( orderedBodySettings.at( i ).first )
-                    ->setRotationalEphemeris( createRotationModel(
-                            orderedBodySettings.at( i ).second->rotationModelSettings, orderedBodySettings.at( i ).first, bodyList ) );
+            if( rotationModels.at( i ) == nullptr )
+            {
+                rotationModels.at( i ) = createRotationModel(
+                        orderedBodySettings.at( i ).second->rotationModelSettings, orderedBodySettings.at( i ).first, bodyList );
+            }
+            bodyList.at( orderedBodySettings.at( i ).first )->setRotationalEphemeris( rotationModels.at( i ) );
         }
     }
 
@@ -291,16 +468,40 @@ SystemOfBodies createSystemOfBodies( const BodyListSettings& bodySettings )
     }
     std::vector< std::shared_ptr< BodyPanelSettings > > bodyExteriorPanelSettings_;
 
-    // Create gravity field model objects for each body (if required).
-    for( unsigned int i = 0; i < orderedBodySettings.size( ); i++ )
+    // Create gravity field model objects for each body (if required). These depend only on the (already set) rotation models,
+    // and are created concurrently if multiple threads are used
+    std::vector< std::shared_ptr< gravitation::GravityFieldModel > > gravityFieldModels( numberOfBodies );
+    std::vector< std::function< void( ) > > gravityFieldCreationTasks;
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
     {
-        if( orderedBodySettings.at( i ).second->gravityFieldSettings != nullptr )
+        const std::string bodyName = orderedBodySettings.at( i ).first;
+        const std::shared_ptr< BodySettings > singleBodySettings = orderedBodySettings.at( i ).second;
+        if( singleBodySettings->gravityFieldSettings != nullptr )
         {
-            bodyList.at( orderedBodySettings.at( i ).first )
-                    ->setGravityFieldModel( createGravityFieldModel( orderedBodySettings.at( i ).second->gravityFieldSettings,
-                                                                     orderedBodySettings.at( i ).first,
-                                                                     bodyList,
-                                                                     orderedBodySettings.at( i ).second->gravityFieldVariationSettings ) );
+            if( modelSourceBodies != nullptr &&
+                isGravityFieldModelShareable( singleBodySettings->gravityFieldSettings,
+                                              singleBodySettings->gravityFieldVariationSettings ) )
+            {
+                gravityFieldModels.at( i ) = modelSourceBodies->at( bodyName )->getGravityFieldModel( );
+            }
+            else
+            {
+                gravityFieldCreationTasks.push_back( [ &gravityFieldModels, &bodyList, singleBodySettings, bodyName, i ]( ) {
+                    gravityFieldModels.at( i ) = createGravityFieldModel( singleBodySettings->gravityFieldSettings,
+                                                                          bodyName,
+                                                                          bodyList,
+                                                                          singleBodySettings->gravityFieldVariationSettings );
+                } );
+            }
+        }
+    }
+    executeEnvironmentModelCreationTasks( gravityFieldCreationTasks, bodySettings.getNumberOfCreationThreads( ) );
+
+    for( unsigned int i = 0; i < numberOfBodies; i++ )
+    {
+        if( gravityFieldModels.at( i ) != nullptr )
+        {
+            bodyList.at( orderedBodySettings.at( i ).first )->setGravityFieldModel( gravityFieldModels.at( i ) );
         }
     }
 
@@ -429,6 +630,77 @@ SystemOfBodies createSystemOfBodies( const BodyListSettings& bodySettings )
     return bodyList;
 }
 
+//! Function to create a map of bodies objects.
+/*!
+ *  Function to create a map of body objects based on model-specific settings for the bodies,
+ *  containing settings for each relevant environment model.
+ *  \param bodySettings List of settings for the bodies that are to be created, defined as a map of
+ *  pointers to an object of class BodySettings
+ *  \return List of bodies created according to settings in bodySettings.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+SystemOfBodies createSystemOfBodies( const BodyListSettings& bodySettings )
+{
+    return createSystemOfBodiesReusingModels< StateScalarType, TimeType >( bodySettings, nullptr );
+}
+
+//! Class to store a snapshot of an environment, from which copies can be cheaply created (e.g. for parallel runs)
+/*!
+ *  Class to store a snapshot of an environment, from which copies can be cheaply created (e.g. one per thread for parallel
+ *  propagations). The snapshot stores the body settings, and a prototype system of bodies created from them. Each clone
+ *  consists of new Body objects (with their own state, mass and model-dependent quantities), which share the immutable
+ *  environment models of the prototype that hold no evaluation state (e.g. direct Spice ephemerides and rotations, point-mass
+ *  gravity fields), see createSystemOfBodiesReusingModels. Models that hold evaluation state, or depend on other bodies
+ *  (e.g. interpolated ephemerides, spherical harmonic gravity fields, GCRS-ITRS rotation, tabulated atmospheres, aerodynamic
+ *  and radiation pressure interfaces) are recreated for each clone. Since shared models are used by all clones concurrently,
+ *  they must not be modified (e.g. by estimating their parameters, or resetting a shared ephemeris with a propagated state
+ *  history).
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class SystemOfBodiesSnapshot
+{
+public:
+    //! Constructor
+    /*!
+     *  Constructor, creates the prototype system of bodies
+     *  \param bodySettings List of settings for the bodies that are to be created
+     */
+    SystemOfBodiesSnapshot( const BodyListSettings& bodySettings ):
+        bodySettings_( bodySettings ),
+        prototypeBodies_( createSystemOfBodies< StateScalarType, TimeType >( bodySettings ) )
+    { }
+
+    //! Function to create a new system of bodies, sharing the immutable models of the prototype
+    /*!
+     *  Function to create a new system of bodies, sharing the immutable models of the prototype. This function may be called
+     *  from multiple threads concurrently.
+     *  \return New system of bodies
+     */
+    SystemOfBodies clone( ) const
+    {
+        return createSystemOfBodiesReusingModels< StateScalarType, TimeType >( bodySettings_, &prototypeBodies_ );
+    }
+
+    //! Function to retrieve the prototype system of bodies (must not be modified if clones are in use)
+    const SystemOfBodies& getPrototypeBodies( ) const
+    {
+        return prototypeBodies_;
+    }
+
+    //! Function to retrieve the settings from which the bodies are created
+    const BodyListSettings& getBodySettings( ) const
+    {
+        return bodySettings_;
+    }
+
+private:
+    //! Settings from which the bodies are created
+    const BodyListSettings bodySettings_;
+
+    //! System of bodies from which shareable models are taken
+    const SystemOfBodies prototypeBodies_;
+};
+
 //! Function to create a simplified system of bodies
 /*!
  * Bodies created: Sun, all planets of solar system, Pluto
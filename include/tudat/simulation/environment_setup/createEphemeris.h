@@ -24,6 +24,7 @@
 #include "tudat/astro/ephemerides/customEphemeris.h"
 #include "tudat/astro/ephemerides/keplerEphemeris.h"
 #include "tudat/astro/ephemerides/multiArcEphemeris.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositionsCircularCoplanar.h"
 #include "tudat/astro/ephemerides/constantEphemeris.h"
@@ -54,7 +55,8 @@ enum EphemerisType {
     custom_ephemeris,
     direct_tle_ephemeris,
     interpolated_tle_ephemeris,
-    scaled_ephemeris
+    scaled_ephemeris,
+    chebyshev_ephemeris
 };
 
 // Class for providing settings for ephemeris model.
@@ -745,6 +747,118 @@ private:
     std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings_;
 };
 
+// EphemerisSettings derived class for defining settings of an ephemeris defined by piecewise Chebyshev polynomials.
+/*
+ *  EphemerisSettings derived class for defining settings of an ephemeris defined by piecewise Chebyshev polynomials (see
+ *  ChebyshevEphemeris class). The coefficients are either fitted to an ephemeris created from other settings, or read from
+ *  a binary coefficient file.
+ */
+class ChebyshevEphemerisSettings : public EphemerisSettings
+{
+public:
+    // Constructor for ephemeris fitted to an existing ephemeris.
+    /*
+     *  Constructor for ephemeris fitted to an existing ephemeris.
+     *  \param ephemerisSettings Settings of the ephemeris to which the Chebyshev polynomials are to be fitted.
+     *  \param startTime Start time of the ephemeris.
+     *  \param endTime End time of the ephemeris.
+     *  \param polynomialDegree Degree of the Chebyshev polynomials.
+     *  \param positionTolerance Maximum position error of the fit (determines the segment length).
+     *  \param maximumSegmentLength Maximum length of a segment (no maximum if NaN).
+     *  \param outputFileName Name of the binary file to which the coefficients are written after creation (none if empty).
+     */
+    ChebyshevEphemerisSettings( const std::shared_ptr< EphemerisSettings > ephemerisSettings,
+                                const double startTime,
+                                const double endTime,
+                                const int polynomialDegree,
+                                const double positionTolerance,
+                                const double maximumSegmentLength = TUDAT_NAN,
+                                const std::string& outputFileName = "" ):
+        EphemerisSettings( chebyshev_ephemeris, ephemerisSettings->getFrameOrigin( ), ephemerisSettings->getFrameOrientation( ) ),
+        ephemerisSettings_( ephemerisSettings ), startTime_( startTime ), endTime_( endTime ), polynomialDegree_( polynomialDegree ),
+        positionTolerance_( positionTolerance ), maximumSegmentLength_( maximumSegmentLength ), outputFileName_( outputFileName )
+    { }
+
+    // Constructor for ephemeris read from a binary coefficient file.
+    /*
+     *  Constructor for ephemeris read from a binary coefficient file (as written by writeChebyshevEphemerisFile).
+     *  \param inputFileName Name of the binary file from which the coefficients are read.
+     *  \param frameOrigin Origin of the reference frame (must be consistent with the file).
+     *  \param frameOrientation Orientation of the reference frame (must be consistent with the file).
+     */
+    ChebyshevEphemerisSettings( const std::string& inputFileName,
+                                const std::string& frameOrigin = "SSB",
+                                const std::string& frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( chebyshev_ephemeris, frameOrigin, frameOrientation ), startTime_( TUDAT_NAN ), endTime_( TUDAT_NAN ),
+        polynomialDegree_( -1 ), positionTolerance_( TUDAT_NAN ), maximumSegmentLength_( TUDAT_NAN ), inputFileName_( inputFileName )
+    { }
+
+    std::shared_ptr< EphemerisSettings > getEphemerisSettings( )
+    {
+        return ephemerisSettings_;
+    }
+
+    double getStartTime( )
+    {
+        return startTime_;
+    }
+
+    double getEndTime( )
+    {
+        return endTime_;
+    }
+
+    int getPolynomialDegree( )
+    {
+        return polynomialDegree_;
+    }
+
+    double getPositionTolerance( )
+    {
+        return positionTolerance_;
+    }
+
+    double getMaximumSegmentLength( )
+    {
+        return maximumSegmentLength_;
+    }
+
+    std::string getInputFileName( )
+    {
+        return inputFileName_;
+    }
+
+    std::string getOutputFileName( )
+    {
+        return outputFileName_;
+    }
+
+private:
+    // Settings of the ephemeris to which the Chebyshev polynomials are to be fitted (nullptr if read from file).
+    std::shared_ptr< EphemerisSettings > ephemerisSettings_;
+
+    // Start time of the ephemeris.
+    double startTime_;
+
+    // End time of the ephemeris.
+    double endTime_;
+
+    // Degree of the Chebyshev polynomials.
+    int polynomialDegree_;
+
+    // Maximum position error of the fit.
+    double positionTolerance_;
+
+    // Maximum length of a segment (no maximum if NaN).
+    double maximumSegmentLength_;
+
+    // Name of the binary file from which the coefficients are read (empty if fitted to ephemeris).
+    std::string inputFileName_;
+
+    // Name of the binary file to which the coefficients are written after creation (none if empty).
+    std::string outputFileName_;
+};
+
 class DirectTleEphemerisSettings : public EphemerisSettings
 {
 public:
@@ -1097,6 +1211,27 @@ inline std::shared_ptr< EphemerisSettings > scaledEphemerisSettings( const std::
     return std::make_shared< ScaledEphemerisSettings >( baseSettings, scaling, isScalingAbsolute );
 }
 
+//! @get_docstring(chebyshevEphemerisSettings)
+inline std::shared_ptr< EphemerisSettings > chebyshevEphemerisSettings( const std::shared_ptr< EphemerisSettings > ephemerisSettings,
+                                                                        const double startTime,
+                                                                        const double endTime,
+                                                                        const int polynomialDegree,
+                                                                        const double positionTolerance,
+                                                                        const double maximumSegmentLength = TUDAT_NAN,
+                                                                        const std::string& outputFileName = "" )
+{
+    return std::make_shared< ChebyshevEphemerisSettings >(
+            ephemerisSettings, startTime, endTime, polynomialDegree, positionTolerance, maximumSegmentLength, outputFileName );
+}
+
+//! @get_docstring(chebyshevEphemerisFromFileSettings)
+inline std::shared_ptr< EphemerisSettings > chebyshevEphemerisFromFileSettings( const std::string& inputFileName,
+                                                                                const std::string& frameOrigin = "SSB",
+                                                                                const std::string& frameOrientation = "ECLIPJ2000" )
+{
+    return std::make_shared< ChebyshevEphemerisSettings >( inputFileName, frameOrigin, frameOrientation );
+}
+
 // Function to create a ephemeris model.
 /*
  *  Function to create a ephemeris model based on model-specific settings for the ephemeris.
@@ -1254,6 +1389,53 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris( const std::shared
                 }
                 break;
             }
+            case chebyshev_ephemeris: {
+                // Check consistency of type and class.
+                std::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings =
+                        std::dynamic_pointer_cast< ChebyshevEphemerisSettings >( ephemerisSettings );
+                if( chebyshevEphemerisSettings == nullptr )
+                {
+                    throw std::runtime_error( "Error, expected Chebyshev ephemeris settings for " + bodyName );
+                }
+                else if( chebyshevEphemerisSettings->getInputFileName( ) != "" )
+                {
+                    // Read ephemeris from file, and check frame consistency
+                    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris =
+                            readChebyshevEphemerisFile( chebyshevEphemerisSettings->getInputFileName( ) );
+                    if( chebyshevEphemeris->getReferenceFrameOrigin( ) != chebyshevEphemerisSettings->getFrameOrigin( ) ||
+                        chebyshevEphemeris->getReferenceFrameOrientation( ) != chebyshevEphemerisSettings->getFrameOrientation( ) )
+                    {
+                        throw std::runtime_error( "Error when creating Chebyshev ephemeris for " + bodyName + " from file " +
+                                                  chebyshevEphemerisSettings->getInputFileName( ) + ", file frame (" +
+                                                  chebyshevEphemeris->getReferenceFrameOrigin( ) + ", " +
+                                                  chebyshevEphemeris->getReferenceFrameOrientation( ) +
+                                                  ") is inconsistent with settings (" + chebyshevEphemerisSettings->getFrameOrigin( ) +
+                                                  ", " + chebyshevEphemerisSettings->getFrameOrientation( ) + ")" );
+                    }
+                    ephemeris = chebyshevEphemeris;
+                }
+                else
+                {
+                    // Fit Chebyshev polynomials to ephemeris created from base settings
+                    std::shared_ptr< Ephemeris > baseEphemeris =
+                            createBodyEphemeris( chebyshevEphemerisSettings->getEphemerisSettings( ), bodyName );
+                    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = createChebyshevEphemeris(
+                            [ = ]( const double time ) { return baseEphemeris->getCartesianState( time ); },
+                            chebyshevEphemerisSettings->getStartTime( ),
+                            chebyshevEphemerisSettings->getEndTime( ),
+                            chebyshevEphemerisSettings->getPolynomialDegree( ),
+                            chebyshevEphemerisSettings->getPositionTolerance( ),
+                            chebyshevEphemerisSettings->getFrameOrigin( ),
+                            chebyshevEphemerisSettings->getFrameOrientation( ),
+                            chebyshevEphemerisSettings->getMaximumSegmentLength( ) );
+                    if( chebyshevEphemerisSettings->getOutputFileName( ) != "" )
+                    {
+                        writeChebyshevEphemerisFile( chebyshevEphemeris, chebyshevEphemerisSettings->getOutputFileName( ) );
+                    }
+                    ephemeris = chebyshevEphemeris;
+                }
+                break;
+            }
             case constant_ephemeris: {
                 // Check consistency of type and class.
                 std::shared_ptr< ConstantEphemerisSettings > constantEphemerisSettings =
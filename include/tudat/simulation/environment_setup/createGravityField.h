@@ -348,7 +348,8 @@ public:
                                     const std::string& associatedReferenceFrame ):
         GravityFieldSettings( polyhedron ), density_( density ), verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ), associatedReferenceFrame_( associatedReferenceFrame ),
-        gravitationalConstant_( gravitationalConstant )
+        gravitationalConstant_( gravitationalConstant ), numberOfThreads_( 1 ), farFieldMaximumDegree_( -1 ),
+        farFieldBrillouinSphereMarginFactor_( TUDAT_NAN )
     {
         volume_ = basic_astrodynamics::computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
         gravitationalParameter_ = gravitationalConstant_ * density_ * volume_;
@@ -370,7 +371,8 @@ public:
                                     const double gravitationalConstant = physical_constants::GRAVITATIONAL_CONSTANT ):
         GravityFieldSettings( polyhedron ), gravitationalParameter_( gravitationalParameter ), verticesCoordinates_( verticesCoordinates ),
         verticesDefiningEachFacet_( verticesDefiningEachFacet ), associatedReferenceFrame_( associatedReferenceFrame ),
-        gravitationalConstant_( gravitationalConstant )
+        gravitationalConstant_( gravitationalConstant ), numberOfThreads_( 1 ), farFieldMaximumDegree_( -1 ),
+        farFieldBrillouinSphereMarginFactor_( TUDAT_NAN )
     {
         volume_ = basic_astrodynamics::computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
         density_ = gravitationalParameter_ / ( gravitationalConstant_ * volume_ );
@@ -441,6 +443,43 @@ public:
         verticesDefiningEachFacet_ = verticesDefiningEachFacet;
     }
 
+    //! Function to return the number of threads over which the evaluation of the polyhedron is distributed.
+    int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    //! Function to reset the number of threads over which the evaluation of the polyhedron is distributed.
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        numberOfThreads_ = numberOfThreads;
+    }
+
+    /*! Function to set the far-field spherical harmonic expansion of the polyhedron.
+     *
+     * Function to set the far-field spherical harmonic expansion of the polyhedron, which is used for the potential and its
+     * gradient at distances larger than the radius of the Brillouin sphere times the margin factor.
+     * @param maximumDegree Maximum degree (and order) of the expansion.
+     * @param brillouinSphereMarginFactor Ratio of the switch radius and the radius of the Brillouin sphere (must be >= 1).
+     */
+    void setFarFieldSphericalHarmonicExpansion( const int maximumDegree, const double brillouinSphereMarginFactor = 2.0 )
+    {
+        farFieldMaximumDegree_ = maximumDegree;
+        farFieldBrillouinSphereMarginFactor_ = brillouinSphereMarginFactor;
+    }
+
+    //! Function to return the maximum degree of the far-field expansion (-1 if not used).
+    int getFarFieldMaximumDegree( )
+    {
+        return farFieldMaximumDegree_;
+    }
+
+    //! Function to return the ratio of the far-field switch radius and the radius of the Brillouin sphere.
+    double getFarFieldBrillouinSphereMarginFactor( )
+    {
+        return farFieldBrillouinSphereMarginFactor_;
+    }
+
 protected:
     // Gravitational parameter
     double gravitationalParameter_;
@@ -460,6 +499,15 @@ protected:
     double gravitationalConstant_;
 
     double volume_;
+
+    // Number of threads over which the evaluation of the polyhedron is distributed.
+    int numberOfThreads_;
+
+    // Maximum degree of the far-field spherical harmonic expansion (-1 if not used).
+    int farFieldMaximumDegree_;
+
+    // Ratio of the far-field switch radius and the radius of the Brillouin sphere.
+    double farFieldBrillouinSphereMarginFactor_;
 };
 
 // Derived class of GravityFieldSettings defining settings of polyhedron gravity
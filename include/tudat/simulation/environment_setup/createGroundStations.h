@@ -314,10 +314,10 @@ std::shared_ptr< ephemerides::Ephemeris > createReferencePointEphemeris(
     stationEphemerisVector[ 0 ] = referencePointStateFunction;
 
     std::map< int, std::function< StateType( const TimeType, const StateType& ) > > stationRotationVector;
-    stationRotationVector[ 1 ] = std::bind( &ephemerides::transformStateToInertialOrientation< StateScalarType, TimeType >,
+    stationRotationVector[ 1 ] = std::bind( &simulation_setup::Body::transformStateToGlobalFrameFromEphemeris< StateScalarType, TimeType >,
+                                            bodyWithReferencePoint,
                                             std::placeholders::_2,
-                                            std::placeholders::_1,
-                                            bodyRotationModel );
+                                            std::placeholders::_1 );
 
     // Create and return ephemeris
     return std::make_shared< ephemerides::CompositeEphemeris< TimeType, StateScalarType > >(
@@ -576,10 +576,42 @@ void setVmfTroposphereCorrections(
         const bool setMeteoData = true,
         const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings = interpolators::cubicSplineInterpolation( ) );
 
+/*!
+ * Function to set VMF troposphere and/or meteo data of ground stations from binary time-indexed grid files, as created by
+ * input_output::convertVMFFilesToTimeIndexedGridFiles. Only the epochs in the requested time range (plus a few epochs of
+ * padding) are loaded.
+ *
+ * @param gridFiles List of grid files (one per station)
+ * @param bodies System of bodies, containing Earth with the ground stations for which data is to be set
+ * @param setTropospherData Boolean denoting whether troposphere data is to be set
+ * @param setMeteoData Boolean denoting whether meteo data is to be set (ignored if grid file contains no meteo data)
+ * @param interpolatorSettings Settings for interpolation of data in time
+ * @param startTime Start of time range (UTC) for which data is to be loaded (all data is loaded if NaN)
+ * @param endTime End of time range (UTC) for which data is to be loaded (all data is loaded if NaN)
+ */
+void setVmfTroposphereCorrectionsFromTimeIndexedGridFiles(
+        const std::vector< std::string >& gridFiles,
+        const simulation_setup::SystemOfBodies& bodies,
+        const bool setTropospherData = true,
+        const bool setMeteoData = true,
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings = interpolators::cubicSplineInterpolation( ),
+        const double startTime = TUDAT_NAN,
+        const double endTime = TUDAT_NAN );
+
 void setIonosphereModelFromIonex( const std::vector< std::string >& dataFiles,
                                   const simulation_setup::SystemOfBodies& bodies,
                                   std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings = nullptr );
 
+/*!
+ * Function to set the ionosphere model of Earth from a binary time-indexed grid file, as created from IONEX files by
+ * input_output::convertIonexFilesToTimeIndexedGridFile. The grid file is memory-mapped, and the TEC is interpolated
+ * bilinearly in latitude and longitude, and linearly in time.
+ *
+ * @param gridFile Grid file containing the TEC maps
+ * @param bodies System of bodies, containing Earth
+ */
+void setIonosphereModelFromTimeIndexedGridFile( const std::string& gridFile, const simulation_setup::SystemOfBodies& bodies );
+
 /*!
  * Creates a function that returns the frequency at a given link, as a function of the frequency band used in each link
  * and of the time at which the signal was transmitted at the transmitter (of the first link).
@@ -247,6 +247,26 @@ std::map< LinkEnds, std::vector< std::shared_ptr< ObservationViabilityCalculator
         const ObservableType observationType,
         const std::vector< std::shared_ptr< ObservationViabilitySettings > >& observationViabilitySettings );
 
+//! Function to compute the instantaneous link end states for a grid of epochs, for use in viability screening
+/*!
+ * Function to compute the instantaneous link end states for a grid of epochs, for use in viability screening (see
+ * screenObservationViability). All link ends are evaluated at the grid epoch (i.e. without light-time corrections), with the link
+ * end states ordered in the same manner as those provided to the ObservationViabilityCalculator::isObservationViable function.
+ * \param bodies Map of body objects that constitutes the environment
+ * \param linkEnds Link ends of the observable
+ * \param observationType Type of observable
+ * \param epochs Grid of epochs at which link end states are to be computed
+ * \param linkEndStateGrids Link end states for all epochs (returned by reference)
+ * \param linkEndTimeGrids Link end times for all epochs (returned by reference)
+ * \return True if the ordering of the link end states could be determined for the observable, false otherwise
+ */
+bool getInstantaneousLinkEndStateGrids( const simulation_setup::SystemOfBodies& bodies,
+                                        const LinkEnds& linkEnds,
+                                        const ObservableType observationType,
+                                        const std::vector< double >& epochs,
+                                        std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                        std::vector< Eigen::VectorXd >& linkEndTimeGrids );
+
 }  // namespace observation_models
 
 }  // namespace tudat
@@ -14,6 +14,8 @@
 #include <Eigen/Core>
 #include <functional>
 #include <memory>
+#include <set>
+#include <string>
 #include <vector>
 
 #include "tudat/astro/observation_models/linkTypeDefs.h"
@@ -22,6 +24,7 @@
 #include "tudat/basics/timeType.h"
 #include "tudat/basics/tudatTypeTraits.h"
 #include "tudat/basics/utilities.h"
+#include "tudat/io/columnarBinaryFile.h"
 #include "tudat/simulation/estimation_setup/observationOutput.h"
 #include "tudat/simulation/estimation_setup/observationsProcessing.h"
 #include "tudat/simulation/estimation_setup/singleObservationSet.h"
@@ -1101,6 +1104,10 @@ namespace tudat
                         }
                     }
                 }
+
+                // Reset observation set indices and concatenated observations and times
+                setObservationSetIndices();
+                setConcatenatedObservationsAndTimes();
             }
 
             void filterObservations(
@@ -1295,10 +1302,31 @@ namespace tudat
                 setConcatenatedObservationsAndTimes();
             }
 
+            //! Function returning the indices of the single observation sets selected by the observation parser
+            /*!
+             *  Function returning the indices of the single observation sets selected by the observation parser, per observable type and
+             *  link ends. Results for parsers that only select on observable types and link ends (see
+             *  ObservationCollectionParser::getCacheKey) are cached until the structure of the collection is modified through this
+             *  class. Results for time bounds and ancillary settings parsers are recomputed on each call, as they depend on the contents
+             *  of the single observation sets. Note that the cache is not thread-safe.
+             *  \param observationParser Parser defining which observation sets are to be selected
+             *  \return Indices of selected observation sets, per observable type and link ends
+             */
             std::map<ObservableType, std::map<LinkEnds, std::vector<unsigned int>>> getSingleObservationSetsIndices(
                 const std::shared_ptr<ObservationCollectionParser> observationParser =
                     std::make_shared<ObservationCollectionParser>()) const
             {
+                // Retrieve result from cache if possible
+                const std::string parserCacheKey = observationParser->getCacheKey();
+                if (!parserCacheKey.empty())
+                {
+                    auto cacheIterator = parserResultsCache_.find(parserCacheKey);
+                    if (cacheIterator != parserResultsCache_.end())
+                    {
+                        return cacheIterator->second;
+                    }
+                }
+
                 std::map<ObservableType, std::map<LinkEnds, std::vector<unsigned int>>> observationSetsIndices;
 
                 ObservationParserType parserType = observationParser->getObservationParserType();
@@ -1388,16 +1416,11 @@ namespace tudat
                     std::vector<std::string> linkEndsNames = linkEndStringObservationParser->getLinkEndNames();
                     bool isReferencePoint = linkEndStringObservationParser->isReferencePoint();
 
-                    // Retrieve all body names
-                    std::vector<std::string> allLinkEndsNames;
-                    if (!isReferencePoint)
-                    {
-                        allLinkEndsNames = getBodiesInLinkEnds();
-                    }
-                    else
-                    {
-                        allLinkEndsNames = getReferencePointsInLinkEnds();
-                    }
+                    // Retrieve all body or reference point names, and the link ends in which they occur, from the index
+                    const std::vector<std::string> &allLinkEndsNames =
+                        isReferencePoint ? referencePointsInLinkEnds_ : bodiesInLinkEnds_;
+                    const std::map<std::string, std::map<ObservableType, std::vector<LinkEnds>>> &linkEndsPerName =
+                        isReferencePoint ? linkEndsPerReferencePoint_ : linkEndsPerBodyName_;
 
                     for (auto name : allLinkEndsNames)
                     {
@@ -1406,44 +1429,17 @@ namespace tudat
                             ((std::count(linkEndsNames.begin(), linkEndsNames.end(), name) == 0) &&
                              (observationParser->useOppositeCondition())))
                         {
-                            for (auto observableIt : observationSetList_)
+                            for (auto observableIt : linkEndsPerName.at(name))
                             {
-                                std::map<LinkEnds, std::vector<unsigned int>> indicesPerObservable;
-                                if (observationSetsIndices.count(observableIt.first))
+                                for (auto linkEnds : observableIt.second)
                                 {
-                                    indicesPerObservable = observationSetsIndices.at(observableIt.first);
-                                }
-
-                                for (auto linkEndsIt : observableIt.second)
-                                {
-                                    // FIX!
-                                    bool isBodyInLinkEnds = false;
-                                    bool isGroundStationInLinkEnds = false;
-                                    for (auto it : linkEndsIt.first)
-                                    {
-                                        if (it.second.bodyName_ == name)
-                                        {
-                                            isBodyInLinkEnds = true;
-                                        }
-                                        if (it.second.stationName_ == name)
-                                        {
-                                            isGroundStationInLinkEnds = true;
-                                        }
-                                    }
-
-                                    if ((!isReferencePoint && isBodyInLinkEnds /*( linkEndsIt.first, name )*/) ||
-                                        (isReferencePoint && isGroundStationInLinkEnds /*( linkEndsIt.first, name )*/))
+                                    const unsigned int numberOfSets = observationSetList_.at(observableIt.first).at(linkEnds).size();
+                                    std::vector<unsigned int> &currentIndices = observationSetsIndices[observableIt.first][linkEnds];
+                                    for (unsigned int k = 0; k < numberOfSets; k++)
                                     {
-                                        for (unsigned int k = 0; k < linkEndsIt.second.size(); k++)
-                                        {
-                                            indicesPerObservable[linkEndsIt.first].push_back(k);
-                                        }
+                                        currentIndices.push_back(k);
                                     }
                                 }
-                                if (indicesPerObservable.size() > 0)
-                                {
-                                    observationSetsIndices[observableIt.first] = indicesPerObservable;
-                                }
                             }
                         }
                     }
@@ -1597,7 +1593,7 @@ namespace tudat
 
                     for (auto timeBounds : timeBoundsVector)
                     {
-                        for (auto observableIt : observationSetList_)
+                        for (const auto &observableIt : observationSetList_)
                         {
                             std::map<LinkEnds, std::vector<unsigned int>> indicesPerObservable;
                             if (observationSetsIndices.count(observableIt.first))
@@ -1605,7 +1601,7 @@ namespace tudat
                                 indicesPerObservable = observationSetsIndices.at(observableIt.first);
                             }
 
-                            for (auto linkEndsIt : observableIt.second)
+                            for (const auto &linkEndsIt : observableIt.second)
                             {
                                 for (unsigned int k = 0; k < linkEndsIt.second.size(); k++)
                                 {
@@ -1638,7 +1634,7 @@ namespace tudat
 
                     for (auto setting : ancillarySettings)
                     {
-                        for (auto observableIt : observationSetList_)
+                        for (const auto &observableIt : observationSetList_)
                         {
                             std::map<LinkEnds, std::vector<unsigned int>> indicesPerObservable;
                             if (observationSetsIndices.count(observableIt.first))
@@ -1646,7 +1642,7 @@ namespace tudat
                                 indicesPerObservable = observationSetsIndices.at(observableIt.first);
                             }
 
-                            for (auto linkEndsIt : observableIt.second)
+                            for (const auto &linkEndsIt : observableIt.second)
                             {
                                 for (unsigned int k = 0; k < linkEndsIt.second.size(); k++)
                                 {
@@ -1800,9 +1796,25 @@ namespace tudat
                     throw std::runtime_error("Observation parser type not recognised.");
                 }
 
+                if (!parserCacheKey.empty())
+                {
+                    parserResultsCache_[parserCacheKey] = observationSetsIndices;
+                }
                 return observationSetsIndices;
             }
 
+            //! Function to clear the cached results of observation parsers (required only if the link ends of single observation sets
+            //! in the collection are modified directly, rather than through this class)
+            void clearObservationParserCache()
+            {
+                parserResultsCache_.clear();
+            }
+
+            unsigned int getNumberOfCachedObservationParserResults() const
+            {
+                return parserResultsCache_.size();
+            }
+
             std::vector<std::shared_ptr<SingleObservationSet<ObservationScalarType, TimeType>>> getSingleObservationSets(
                 const std::shared_ptr<ObservationCollectionParser> observationParser = std::make_shared<ObservationCollectionParser>())
             {
@@ -2313,6 +2325,10 @@ namespace tudat
                 observationTypeAndLinkEndStartAndSize_.clear();
                 observationTypeStartAndSize_.clear();
 
+                // Reset index of link end names, and invalidate cached parser results
+                setLinkEndNamesIndex();
+                parserResultsCache_.clear();
+
                 for (auto observationIterator : observationSetList_)
                 {
                     ObservableType currentObservableType = observationIterator.first;
@@ -2349,6 +2365,48 @@ namespace tudat
                 }
             }
 
+            //! Function to set the names of bodies and reference points in the link ends of the collection, and the link ends in
+            //! which each of them occurs (in the order in which they are encountered in the sorted observation set list)
+            void setLinkEndNamesIndex()
+            {
+                bodiesInLinkEnds_.clear();
+                referencePointsInLinkEnds_.clear();
+                linkEndsPerBodyName_.clear();
+                linkEndsPerReferencePoint_.clear();
+
+                for (auto observableIt : observationSetList_)
+                {
+                    for (auto linkEndsIt : observableIt.second)
+                    {
+                        std::set<std::string> currentBodyNames;
+                        std::set<std::string> currentReferencePoints;
+                        for (auto it : linkEndsIt.first)
+                        {
+                            if (linkEndsPerBodyName_.count(it.second.bodyName_) == 0)
+                            {
+                                bodiesInLinkEnds_.push_back(it.second.bodyName_);
+                            }
+                            if (currentBodyNames.insert(it.second.bodyName_).second)
+                            {
+                                linkEndsPerBodyName_[it.second.bodyName_][observableIt.first].push_back(linkEndsIt.first);
+                            }
+
+                            if (it.second.stationName_ != "")
+                            {
+                                if (linkEndsPerReferencePoint_.count(it.second.stationName_) == 0)
+                                {
+                                    referencePointsInLinkEnds_.push_back(it.second.stationName_);
+                                }
+                                if (currentReferencePoints.insert(it.second.stationName_).second)
+                                {
+                                    linkEndsPerReferencePoint_[it.second.stationName_][observableIt.first].push_back(linkEndsIt.first);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             void setConcatenatedObservationsAndTimes()
             {
                 concatenatedObservations_ = Eigen::Matrix<ObservationScalarType, Eigen::Dynamic, 1>::Zero(totalObservableSize_);
@@ -2405,15 +2463,12 @@ namespace tudat
 
                             std::pair<int, int> startAndSize =
                                 observationSetStartAndSize_.at(currentObservableType).at(currentLinkEnds).at(i);
-                            Eigen::Matrix<ObservationScalarType, Eigen::Dynamic, 1> currentObservables =
-                                Eigen::Matrix<ObservationScalarType, Eigen::Dynamic, 1>::Zero(startAndSize.second);
 
-                            std::vector<Eigen::Matrix<ObservationScalarType, Eigen::Dynamic, 1>> currentObservationSet =
-                                linkEndIterator.second.at(i)->getObservations();
-                            std::vector<TimeType> currentObservationTimes = linkEndIterator.second.at(i)->getObservationTimes();
-                            for (unsigned int j = 0; j < currentObservationSet.size(); j++)
+                            // Observations are stored contiguously per observation set, and can be copied as a single block
+                            const std::vector<TimeType> &currentObservationTimes =
+                                linkEndIterator.second.at(i)->getObservationTimesReference();
+                            for (unsigned int j = 0; j < currentObservationTimes.size(); j++)
                             {
-                                currentObservables.segment(j * observableSize, observableSize) = currentObservationSet.at(j);
                                 for (int k = 0; k < observableSize; k++)
                                 {
                                     concatenatedTimes_[observationCounter] = currentObservationTimes.at(j);
@@ -2422,7 +2477,8 @@ namespace tudat
                                     observationCounter++;
                                 }
                             }
-                            concatenatedObservations_.segment(startAndSize.first, startAndSize.second) = currentObservables;
+                            concatenatedObservations_.segment(startAndSize.first, startAndSize.second) =
+                                linkEndIterator.second.at(i)->getObservationsVector();
                         }
                     }
                 }
@@ -2568,6 +2624,21 @@ namespace tudat
             int totalObservableSize_;
 
             int totalNumberOfObservables_;
+
+            //! Names of bodies in the link ends of the collection, in order of first occurrence
+            std::vector<std::string> bodiesInLinkEnds_;
+
+            //! Names of reference points in the link ends of the collection, in order of first occurrence
+            std::vector<std::string> referencePointsInLinkEnds_;
+
+            //! Link ends in which each body name occurs, per observable type
+            std::map<std::string, std::map<ObservableType, std::vector<LinkEnds>>> linkEndsPerBodyName_;
+
+            //! Link ends in which each reference point name occurs, per observable type
+            std::map<std::string, std::map<ObservableType, std::vector<LinkEnds>>> linkEndsPerReferencePoint_;
+
+            //! Cached results of getSingleObservationSetsIndices, per parser cache key (cleared when the collection is modified)
+            mutable std::map<std::string, std::map<ObservableType, std::map<LinkEnds, std::vector<unsigned int>>>> parserResultsCache_;
         };
 
         template <typename ObservationScalarType = double,
@@ -2587,14 +2658,14 @@ namespace tudat
                     std::make_shared<SingleObservationSet<ObservationScalarType, TimeType>>(
                         oldObsSet->getObservableType(),
                         oldObsSet->getLinkEnds(),
-                        oldObsSet->getObservations(),
-                        oldObsSet->getObservationTimes(),
+                        oldObsSet->getObservationsMatrix(),
+                        oldObsSet->getObservationTimesReference(),
                         oldObsSet->getReferenceLinkEnd(),
-                        oldObsSet->getObservationsDependentVariablesReference(),
+                        oldObsSet->getDependentVariablesMatrix(),
                         oldObsSet->getDependentVariableCalculator(),
-                        oldObsSet->getAncilliarySettings());
-                newObsSet->setTabulatedWeights(oldObsSet->getWeightsVector());
-                newObsSet->setResiduals(oldObsSet->getResiduals());
+                        oldObsSet->getAncilliarySettings(),
+                        oldObsSet->getWeightsMatrix(),
+                        oldObsSet->getResidualsMatrix());
 
                 newSingleObservationSets.push_back(newObsSet);
             }
@@ -2749,6 +2820,53 @@ namespace tudat
             return std::make_shared<ObservationCollection<ObservationScalarType, TimeType>>(combinedObservationSets);
         }
 
+        //! Function to write the observations, residuals and weights in an observation collection to a binary columnar file
+        /*!
+         *  Function to write the observations, residuals and weights in an observation collection to a binary columnar file (see
+         *  input_output::ColumnarBinaryFileWriter), with one row per observable entry. The columns are: epoch, observation,
+         *  residual, weight, observable type (as integer) and link end id (see ObservationCollection::getLinkEndIdentifierMap).
+         *  \param observationCollection Observation collection that is to be written
+         *  \param fileName Name of the file to which the data is to be written
+         *  \param compression Compression applied to the data
+         *  \param metadata Free-form metadata that is stored in the file header
+         */
+        template <typename ObservationScalarType = double, typename TimeType = double>
+        void writeObservationResidualsToColumnarBinaryFile(
+            const std::shared_ptr<ObservationCollection<ObservationScalarType, TimeType>> observationCollection,
+            const std::string &fileName,
+            const input_output::ColumnarBinaryCompression compression = input_output::no_columnar_compression,
+            const std::string &metadata = "")
+        {
+            std::vector<TimeType> times = observationCollection->getConcatenatedTimeVector();
+            Eigen::Matrix<ObservationScalarType, Eigen::Dynamic, 1> observations = observationCollection->getConcatenatedObservations();
+            Eigen::Matrix<ObservationScalarType, Eigen::Dynamic, 1> residuals = observationCollection->getConcatenatedResiduals();
+            Eigen::VectorXd weights = observationCollection->getConcatenatedWeights();
+            std::vector<int> linkEndIds = observationCollection->getConcatenatedLinkEndIds();
+
+            Eigen::VectorXd observableTypes = Eigen::VectorXd::Zero(times.size());
+            for (auto observableIt : observationCollection->getObservationTypeStartAndSize())
+            {
+                observableTypes.segment(observableIt.second.first, observableIt.second.second).setConstant(
+                    static_cast<double>(observableIt.first));
+            }
+
+            input_output::ColumnarBinaryFileDescription description;
+            description.contentType = input_output::observation_residual_columnar_content;
+            description.compression = compression;
+            description.metadata = metadata;
+            description.columnNames = {"epoch", "observation", "residual", "weight", "observable_type", "link_end_id"};
+
+            input_output::ColumnarBinaryFileWriter writer(fileName, description);
+            Eigen::VectorXd row = Eigen::VectorXd(6);
+            for (unsigned int i = 0; i < times.size(); i++)
+            {
+                row << static_cast<double>(times.at(i)), static_cast<double>(observations(i)), static_cast<double>(residuals(i)),
+                    weights(i), observableTypes(i), static_cast<double>(linkEndIds.at(i));
+                writer.appendRow(row);
+            }
+            writer.close();
+        }
+
     } // namespace observation_models
 
 } // namespace tudat
@@ -258,7 +258,7 @@ public:
                                                    viabilitySettingsList,
                                                    observationNoiseFunction,
                                                    ancilliarySettings ),
-        simulationTimes_( simulationTimes )
+        simulationTimes_( simulationTimes ), viabilityScreeningTolerance_( TUDAT_NAN )
     { }
 
     //! Destructor
@@ -266,6 +266,16 @@ public:
 
     //! List of times at which to perform the observation simulation
     std::vector< TimeType > simulationTimes_;
+
+    //! Tolerance (as angle) used to screen simulation times for viability, before simulating the observations
+    /*!
+     *  Tolerance (as angle) used to screen simulation times for viability, before simulating the observations. If defined (not
+     *  NaN), the viability margins are first computed for all simulation times from the instantaneous link end states (without
+     *  light-time corrections), and times at which the observation is non-viable by more than this tolerance are discarded before
+     *  the (light-time corrected) observations are computed. The tolerance must exceed the change of the viability angles over the
+     *  light time of the link (see observation_models::screenObservationViability). By default (NaN), no screening is performed.
+     */
+    double viabilityScreeningTolerance_;
 };
 
 template< typename TimeType = double >
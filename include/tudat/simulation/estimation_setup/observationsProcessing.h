@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <functional>
+#include <string>
 
 #include <Eigen/Core>
 
@@ -331,6 +332,24 @@ enum ObservationParserType {
     multi_type_parser
 };
 
+//! Function to create a string that uniquely identifies a link end id, for use in observation parser cache keys
+inline std::string getLinkEndIdCacheKey( const LinkEndId& linkEndId )
+{
+    return std::to_string( linkEndId.bodyName_.size( ) ) + ":" + linkEndId.bodyName_ + std::to_string( linkEndId.stationName_.size( ) ) +
+            ":" + linkEndId.stationName_;
+}
+
+//! Function to create a string that uniquely identifies a set of link ends, for use in observation parser cache keys
+inline std::string getLinkEndsCacheKey( const LinkEnds& linkEnds )
+{
+    std::string cacheKey = "{";
+    for( auto linkEndIterator: linkEnds )
+    {
+        cacheKey += std::to_string( linkEndIterator.first ) + "=" + getLinkEndIdCacheKey( linkEndIterator.second ) + ";";
+    }
+    return cacheKey + "}";
+}
+
 struct ObservationCollectionParser {
 public:
     ObservationCollectionParser( ): parserType_( empty_parser ), useOppositeCondition_( false ) { }
@@ -351,7 +370,20 @@ public:
         return useOppositeCondition_;
     }
 
+    //! Function returning a string that uniquely identifies the selection made by this parser, for parsers of which the selection
+    //! depends only on the observable types and link ends in a collection (empty if results of this parser cannot be cached)
+    virtual std::string getCacheKey( ) const
+    {
+        return ( parserType_ == empty_parser ) ? "empty" : "";
+    }
+
 protected:
+    //! Function returning the part of the cache key that is common to all parser types
+    std::string getCacheKeyPrefix( ) const
+    {
+        return std::to_string( parserType_ ) + ( useOppositeCondition_ ? "!" : "" ) + "(";
+    }
+
     const ObservationParserType parserType_;
 
     const bool useOppositeCondition_;
@@ -376,6 +408,16 @@ public:
         return observableTypes_;
     }
 
+    std::string getCacheKey( ) const override
+    {
+        std::string cacheKey = getCacheKeyPrefix( );
+        for( auto observableType: observableTypes_ )
+        {
+            cacheKey += std::to_string( observableType ) + ",";
+        }
+        return cacheKey + ")";
+    }
+
 protected:
     const std::vector< ObservableType > observableTypes_;
 };
@@ -397,6 +439,16 @@ public:
         return linkEndsVector_;
     }
 
+    std::string getCacheKey( ) const override
+    {
+        std::string cacheKey = getCacheKeyPrefix( );
+        for( auto linkEnds: linkEndsVector_ )
+        {
+            cacheKey += getLinkEndsCacheKey( linkEnds );
+        }
+        return cacheKey + ")";
+    }
+
 protected:
     const std::vector< LinkEnds > linkEndsVector_;
 };
@@ -429,6 +481,16 @@ public:
         return isReferencePoint_;
     }
 
+    std::string getCacheKey( ) const override
+    {
+        std::string cacheKey = getCacheKeyPrefix( ) + ( isReferencePoint_ ? "station" : "body" );
+        for( auto linkEndName: linkEndsNames_ )
+        {
+            cacheKey += "," + std::to_string( linkEndName.size( ) ) + ":" + linkEndName;
+        }
+        return cacheKey + ")";
+    }
+
 protected:
     const std::vector< std::string > linkEndsNames_;
 
@@ -452,6 +514,16 @@ public:
         return linkEndIds_;
     }
 
+    std::string getCacheKey( ) const override
+    {
+        std::string cacheKey = getCacheKeyPrefix( );
+        for( auto linkEndId: linkEndIds_ )
+        {
+            cacheKey += getLinkEndIdCacheKey( linkEndId ) + ",";
+        }
+        return cacheKey + ")";
+    }
+
 protected:
     const std::vector< LinkEndId > linkEndIds_;
 };
@@ -474,6 +546,16 @@ public:
         return linkEndTypes_;
     }
 
+    std::string getCacheKey( ) const override
+    {
+        std::string cacheKey = getCacheKeyPrefix( );
+        for( auto linkEndType: linkEndTypes_ )
+        {
+            cacheKey += std::to_string( linkEndType ) + ",";
+        }
+        return cacheKey + ")";
+    }
+
 protected:
     const std::vector< LinkEndType > linkEndTypes_;
 };
@@ -498,6 +580,16 @@ public:
         return singleLinkEnds_;
     }
 
+    std::string getCacheKey( ) const override
+    {
+        std::string cacheKey = getCacheKeyPrefix( );
+        for( auto singleLinkEnd: singleLinkEnds_ )
+        {
+            cacheKey += std::to_string( singleLinkEnd.first ) + "=" + getLinkEndIdCacheKey( singleLinkEnd.second ) + ",";
+        }
+        return cacheKey + ")";
+    }
+
 protected:
     const std::vector< std::pair< LinkEndType, LinkEndId > > singleLinkEnds_;
 };
@@ -570,6 +662,22 @@ public:
         return combineConditions_;
     }
 
+    //! Function returning the cache key of the parser, which is only defined if the results of all constituent parsers can be cached
+    std::string getCacheKey( ) const override
+    {
+        std::string cacheKey = getCacheKeyPrefix( ) + ( combineConditions_ ? "and" : "or" );
+        for( auto observationParser: observationParsers_ )
+        {
+            std::string parserCacheKey = observationParser->getCacheKey( );
+            if( parserCacheKey.empty( ) )
+            {
+                return "";
+            }
+            cacheKey += "," + parserCacheKey;
+        }
+        return cacheKey + ")";
+    }
+
 protected:
     const std::vector< std::shared_ptr< ObservationCollectionParser > > observationParsers_;
 
@@ -1062,6 +1062,9 @@ public:
             parametersToEstimate_->template resetParameterValues< ObservationScalarType >( newParameterEstimate );
         }
         currentParameterEstimate_ = newParameterEstimate;
+
+        // Parameters may modify (rotational) ephemerides, remove previously computed values from epoch caches
+        bodies_.clearEphemerisCaches( );
     }
 
     //    //! Function to convert from one representation of all measurement data to the other
@@ -218,6 +218,65 @@ simulateObservationsWithCheckAndLinkEndIdOutput(
             ancilliarySettings );
 }
 
+//! Function to remove observation times that are screened as non-viable, prior to simulating the observations
+/*!
+ *  Function to remove observation times that are screened as non-viable, prior to simulating the observations. The screening is
+ *  performed for all times at once, using the instantaneous link end states (see observation_models::screenObservationViability),
+ *  so that no light-time calculations are needed for the discarded times. Times that are screened as (possibly) viable still
+ *  require the exact viability check after simulating the observation. If the link end states for the screening cannot be
+ *  determined for the observable, or no viability calculators are provided, the input times are returned.
+ *  \param observationTimes Candidate times at which observations are to be simulated
+ *  \param linkEnds Link ends of the observable
+ *  \param observableType Type of observable
+ *  \param linkViabilityCalculators List of observation viability calculators that are to be applied
+ *  \param bodies Map of body objects that constitutes the environment
+ *  \param screeningTolerance Tolerance (as angle) used to screen the observation times for viability
+ *  \return Observation times that are not screened as non-viable
+ */
+template< typename TimeType = double >
+std::vector< TimeType > getViabilityScreenedObservationTimes(
+        const std::vector< TimeType >& observationTimes,
+        const observation_models::LinkEnds& linkEnds,
+        const observation_models::ObservableType observableType,
+        const std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > >& linkViabilityCalculators,
+        const SystemOfBodies& bodies,
+        const double screeningTolerance )
+{
+    if( linkViabilityCalculators.size( ) == 0 )
+    {
+        return observationTimes;
+    }
+
+    std::vector< double > screeningEpochs;
+    screeningEpochs.reserve( observationTimes.size( ) );
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        screeningEpochs.push_back( static_cast< double >( observationTimes.at( i ) ) );
+    }
+
+    std::vector< observation_models::LinkEndStateGrid > linkEndStateGrids;
+    std::vector< Eigen::VectorXd > linkEndTimeGrids;
+    if( !observation_models::getInstantaneousLinkEndStateGrids(
+                bodies, linkEnds, observableType, screeningEpochs, linkEndStateGrids, linkEndTimeGrids ) )
+    {
+        return observationTimes;
+    }
+
+    std::vector< observation_models::ObservationViabilityScreeningResult > screeningResults =
+            observation_models::screenObservationViability(
+                    linkEndStateGrids, linkEndTimeGrids, linkViabilityCalculators, screeningTolerance );
+
+    std::vector< TimeType > screenedObservationTimes;
+    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    {
+        if( screeningResults.at( i ) != observation_models::screened_non_viable_observation )
+        {
+            screenedObservationTimes.push_back( observationTimes.at( i ) );
+        }
+    }
+    return screenedObservationTimes;
+}
+
 template< typename ObservationScalarType = double, typename TimeType = double, int ObservationSize = 1 >
 std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > simulatePerArcSingleObservationSet(
         const std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > observationsToSimulate,
@@ -392,9 +451,21 @@ std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType
                                                                            observationsToSimulate->getObservableType( ),
                                                                            observationsToSimulate->getViabilitySettingsList( ) );
 
+        // Discard times at which observation is clearly not viable, without computing the observation
+        std::vector< TimeType > simulationTimes = tabulatedObservationSettings->simulationTimes_;
+        if( tabulatedObservationSettings->viabilityScreeningTolerance_ == tabulatedObservationSettings->viabilityScreeningTolerance_ )
+        {
+            simulationTimes = getViabilityScreenedObservationTimes( simulationTimes,
+                                                                    observationsToSimulate->getLinkEnds( ).linkEnds_,
+                                                                    observationsToSimulate->getObservableType( ),
+                                                                    currentObservationViabilityCalculators,
+                                                                    bodies,
+                                                                    tabulatedObservationSettings->viabilityScreeningTolerance_ );
+        }
+
         // Simulate observations at requested pre-defined time.
         simulatedObservations = simulateObservationsWithCheckAndLinkEndIdOutput< ObservationSize, ObservationScalarType, TimeType >(
-                tabulatedObservationSettings->simulationTimes_,
+                simulationTimes,
                 observationModel,
                 observationsToSimulate->getReferenceLinkEndType( ),
                 currentObservationViabilityCalculators,
@@ -14,6 +14,7 @@
 #include <Eigen/Core>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "tudat/astro/observation_models/linkTypeDefs.h"
@@ -33,12 +34,98 @@ namespace observation_models
 
 using namespace simulation_setup;
 
+//! Function to stack a list of vectors of equal size into a matrix, with one row per vector
+/*!
+ *  Function to stack a list of vectors of equal size into a matrix, with one row per vector
+ *  \param vectors List of vectors that are to be stacked
+ *  \param numberOfColumns Size that each of the vectors is required to have
+ *  \return Matrix with one row per vector
+ */
+template< typename ScalarType >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > stackVectorsAsMatrixRows(
+        const std::vector< Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > >& vectors,
+        const int numberOfColumns )
+{
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > matrix( vectors.size( ), numberOfColumns );
+    for( unsigned int i = 0; i < vectors.size( ); i++ )
+    {
+        if( vectors.at( i ).rows( ) != numberOfColumns )
+        {
+            throw std::runtime_error( "Error when stacking vectors as matrix rows, vector " + std::to_string( i ) + " has size " +
+                                      std::to_string( vectors.at( i ).rows( ) ) + ", expected " + std::to_string( numberOfColumns ) );
+        }
+        matrix.row( i ) = vectors.at( i ).transpose( );
+    }
+    return matrix;
+}
+
+//! Function to split a matrix into a list of vectors, one per row
+template< typename ScalarType >
+std::vector< Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > > splitMatrixRowsIntoVectors(
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor >& matrix )
+{
+    std::vector< Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > > vectors;
+    vectors.reserve( matrix.rows( ) );
+    for( int i = 0; i < matrix.rows( ); i++ )
+    {
+        vectors.push_back( matrix.row( i ).transpose( ) );
+    }
+    return vectors;
+}
+
+//! Function to create a matrix from a subset of the rows of a matrix (in the order in which the row indices are provided)
+template< typename ScalarType >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > extractMatrixRows(
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor >& matrix,
+        const std::vector< unsigned int >& rowIndices )
+{
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > extractedRows( rowIndices.size( ), matrix.cols( ) );
+    for( unsigned int i = 0; i < rowIndices.size( ); i++ )
+    {
+        extractedRows.row( i ) = matrix.row( rowIndices.at( i ) );
+    }
+    return extractedRows;
+}
+
+//! Function to append the rows of a matrix to another matrix (with the same number of columns)
+template< typename ScalarType >
+void appendMatrixRows( Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor >& matrix,
+                       const Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor >& rowsToAppend )
+{
+    if( matrix.rows( ) == 0 )
+    {
+        matrix = rowsToAppend;
+    }
+    else if( rowsToAppend.rows( ) > 0 )
+    {
+        const int originalNumberOfRows = matrix.rows( );
+        matrix.conservativeResize( originalNumberOfRows + rowsToAppend.rows( ), Eigen::NoChange );
+        matrix.bottomRows( rowsToAppend.rows( ) ) = rowsToAppend;
+    }
+}
+
+
+//! Class to store a set of observations of a single observable type and link definition
+/*!
+ *  Class to store a set of observations of a single observable type and link definition, with their times, weights, residuals
+ *  and (optionally) dependent variables. The data is stored in columnar form: the observations, weights, residuals and
+ *  dependent variables are each stored in a single contiguous (row-major) matrix with one row per observation, sorted by
+ *  observation time, such that concatenation, filtering and residual updates do not require per-observation allocations.
+ *  The accessors returning lists of vectors (or maps) create these from the matrices, the matrices themselves can be
+ *  accessed directly through getObservationsMatrix, getWeightsMatrix, getResidualsMatrix and getDependentVariablesMatrix.
+ */
 template< typename ObservationScalarType = double,
           typename TimeType = double,
           typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
 class SingleObservationSet
 {
 public:
+    //! Typedef for matrix of observations (or residuals), with one row per observation
+    typedef Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > ObservationMatrix;
+
+    //! Typedef for matrix of weights (or dependent variables), with one row per observation
+    typedef Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > DoubleObservationMatrix;
+
     SingleObservationSet(
             const ObservableType observableType,
             const LinkDefinition& linkEnds,
@@ -48,10 +135,50 @@ public:
             const std::vector< Eigen::VectorXd >& observationsDependentVariables = std::vector< Eigen::VectorXd >( ),
             const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
             const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySettings = nullptr ):
+        SingleObservationSet( observableType,
+                              linkEnds,
+                              stackVectorsAsMatrixRows( observations,
+                                                        observations.size( ) > 0 ? static_cast< int >( observations.at( 0 ).rows( ) )
+                                                                                 : getObservableSize( observableType ) ),
+                              observationTimes,
+                              referenceLinkEnd,
+                              stackVectorsAsMatrixRows( observationsDependentVariables,
+                                                        observationsDependentVariables.size( ) > 0
+                                                                ? static_cast< int >( observationsDependentVariables.at( 0 ).rows( ) )
+                                                                : 0 ),
+                              dependentVariableCalculator,
+                              ancilliarySettings )
+    { }
+
+    //! Constructor from matrices with one row per observation
+    /*!
+     *  Constructor from matrices with one row per observation
+     *  \param observableType Type of observable
+     *  \param linkEnds Link definition of the observations
+     *  \param observations Matrix of observations (one row per observation)
+     *  \param observationTimes Times of the observations
+     *  \param referenceLinkEnd Link end at which the observation times are defined
+     *  \param observationsDependentVariables Matrix of dependent variables (one row per observation, or no rows if none)
+     *  \param dependentVariableCalculator Object used to compute the dependent variables
+     *  \param ancilliarySettings Ancilliary settings of the observations
+     *  \param weights Matrix of weights (one row per observation, or no rows to set all weights to 1)
+     *  \param residuals Matrix of residuals (one row per observation, or no rows to set all residuals to 0)
+     */
+    SingleObservationSet(
+            const ObservableType observableType,
+            const LinkDefinition& linkEnds,
+            const ObservationMatrix& observations,
+            const std::vector< TimeType >& observationTimes,
+            const LinkEndType referenceLinkEnd,
+            const DoubleObservationMatrix& observationsDependentVariables = DoubleObservationMatrix( ),
+            const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
+            const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySettings = nullptr,
+            const DoubleObservationMatrix& weights = DoubleObservationMatrix( ),
+            const ObservationMatrix& residuals = ObservationMatrix( ) ):
         observableType_( observableType ), linkEnds_( linkEnds ), observations_( observations ), observationTimes_( observationTimes ),
         referenceLinkEnd_( referenceLinkEnd ), observationsDependentVariables_( observationsDependentVariables ),
         dependentVariableCalculator_( dependentVariableCalculator ), ancilliarySettings_( ancilliarySettings ),
-        numberOfObservations_( observations_.size( ) )
+        numberOfObservations_( observations_.rows( ) )
     {
         if( dependentVariableCalculator_ != nullptr )
         {
@@ -71,47 +198,63 @@ public:
             }
         }
 
-        if( observations_.size( ) != observationTimes_.size( ) )
+        if( observations_.rows( ) != static_cast< int >( observationTimes_.size( ) ) )
         {
             throw std::runtime_error( "Error when making SingleObservationSet, input sizes are inconsistent." +
-                                      std::to_string( observations_.size( ) ) + ", " + std::to_string( observationTimes_.size( ) ) );
+                                      std::to_string( observations_.rows( ) ) + ", " + std::to_string( observationTimes_.size( ) ) );
         }
 
-        for( unsigned int i = 1; i < observations.size( ); i++ )
+        singleObservationSize_ = getObservableSize( observableType );
+        if( numberOfObservations_ == 0 )
         {
-            if( observations.at( i ).rows( ) != observations.at( i - 1 ).rows( ) )
-            {
-                throw std::runtime_error(
-                        "Error when making SingleObservationSet, input observables not of "
-                        "consistent size." );
-            }
+            observations_.resize( 0, singleObservationSize_ );
+        }
+        else if( observations_.cols( ) != static_cast< int >( singleObservationSize_ ) )
+        {
+            throw std::runtime_error(
+                    "Error when making SingleObservationSet, input observables not of "
+                    "consistent size." );
         }
-
-        singleObservationSize_ = getObservableSize( observableType );
 
         // Initialise weights
-        for( unsigned int k = 0; k < numberOfObservations_; k++ )
+        if( weights.rows( ) == 0 )
+        {
+            weights_ = DoubleObservationMatrix::Ones( numberOfObservations_, singleObservationSize_ );
+        }
+        else if( weights.rows( ) != observations_.rows( ) || weights.cols( ) != observations_.cols( ) )
+        {
+            throw std::runtime_error( "Error when making SingleObservationSet, weights size is inconsistent." );
+        }
+        else
         {
-            weights_.push_back( Eigen::Matrix< double, Eigen::Dynamic, 1 >::Ones( singleObservationSize_, 1 ) );
+            weights_ = weights;
         }
 
         // Initialise residuals
-        for( unsigned int k = 0; k < numberOfObservations_; k++ )
+        if( residuals.rows( ) == 0 )
         {
-            residuals_.push_back( Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( singleObservationSize_, 1 ) );
+            residuals_ = ObservationMatrix::Zero( numberOfObservations_, singleObservationSize_ );
+        }
+        else if( residuals.rows( ) != observations_.rows( ) || residuals.cols( ) != observations_.cols( ) )
+        {
+            throw std::runtime_error( "Error when making SingleObservationSet, residuals size is inconsistent." );
+        }
+        else
+        {
+            residuals_ = residuals;
         }
 
         // Check observation dependent variables size
-        if( observationsDependentVariables_.size( ) > 0 )
+        if( observationsDependentVariables_.rows( ) > 0 )
         {
-            if( observationsDependentVariables_.size( ) != numberOfObservations_ )
+            if( observationsDependentVariables_.rows( ) != static_cast< int >( numberOfObservations_ ) )
             {
                 throw std::runtime_error(
                         "Error when creating SingleObservationSet, the size of the observation "
                         "dependent variables input should be consistent "
                         "with the number of observations." );
             }
-            if( observationsDependentVariables_[ 0 ].size( ) != dependentVariableCalculator_->getTotalDependentVariableSize( ) )
+            if( observationsDependentVariables_.cols( ) != dependentVariableCalculator_->getTotalDependentVariableSize( ) )
             {
                 throw std::runtime_error(
                         "Error when creating SingleObservationSet, the size of the observation "
@@ -144,20 +287,16 @@ public:
 
     std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservations( )
     {
-        return observations_;
+        return splitMatrixRowsIntoVectors( observations_ );
     }
 
     void setObservations( const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& observations )
     {
-        if( observations.size( ) != observations_.size( ) )
+        if( observations.size( ) != numberOfObservations_ )
         {
             throw std::runtime_error( "Error when resetting observations, number of observations is incompatible." );
         }
-        observations_ = observations;
-        if( !observations_.empty( ) )
-        {
-            singleObservationSize_ = observations_.at( 0 ).size( );
-        }
+        observations_ = stackVectorsAsMatrixRows( observations, singleObservationSize_ );
     }
 
     void setObservations( const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observationsVector )
@@ -166,16 +305,17 @@ public:
         {
             throw std::runtime_error( "Error when resetting observations, number of observations is incompatible." );
         }
+        observations_ = Eigen::Map< const ObservationMatrix >( observationsVector.data( ), numberOfObservations_, singleObservationSize_ );
+    }
 
-        observations_.clear( );
-        for( unsigned int k = 0; k < numberOfObservations_; k++ )
-        {
-            observations_.push_back( observationsVector.segment( k * singleObservationSize_, singleObservationSize_ ) );
-        }
-        if( !observations_.empty( ) )
+    //! Function to reset the observations from a matrix with one row per observation
+    void setObservationsMatrix( const ObservationMatrix& observations )
+    {
+        if( observations.rows( ) != observations_.rows( ) || observations.cols( ) != observations_.cols( ) )
         {
-            singleObservationSize_ = observations_.at( 0 ).size( );
+            throw std::runtime_error( "Error when resetting observations, size of observation matrix is incompatible." );
         }
+        observations_ = observations;
     }
 
     void setResiduals( const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& residuals )
@@ -184,7 +324,7 @@ public:
         {
             throw std::runtime_error( "Error when setting residuals, number of observations is inconsistent." );
         }
-        residuals_ = residuals;
+        residuals_ = stackVectorsAsMatrixRows( residuals, singleObservationSize_ );
     }
 
     void setResiduals( const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& residualsVector )
@@ -193,15 +333,27 @@ public:
         {
             throw std::runtime_error( "Error when setting residuals, number of observations is inconsistent." );
         }
+        residuals_ = Eigen::Map< const ObservationMatrix >( residualsVector.data( ), numberOfObservations_, singleObservationSize_ );
+    }
 
-        residuals_.clear( );
-        for( unsigned int k = 0; k < numberOfObservations_; k++ )
+    //! Function to reset the residuals from a matrix with one row per observation
+    void setResidualsMatrix( const ObservationMatrix& residuals )
+    {
+        if( residuals.rows( ) != residuals_.rows( ) || residuals.cols( ) != residuals_.cols( ) )
         {
-            residuals_.push_back( residualsVector.segment( k * singleObservationSize_, singleObservationSize_ ) );
+            throw std::runtime_error( "Error when setting residuals, size of residual matrix is inconsistent." );
         }
+        residuals_ = residuals;
+    }
+
+    //! Function to retrieve the observations as a list of vectors (created from the matrix of observations)
+    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservationsReference( )
+    {
+        return splitMatrixRowsIntoVectors( observations_ );
     }
 
-    const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& getObservationsReference( )
+    //! Function to retrieve the matrix of observations, with one row per observation
+    const ObservationMatrix& getObservationsMatrix( ) const
     {
         return observations_;
     }
@@ -212,7 +364,7 @@ public:
         {
             throw std::runtime_error( "Error when retrieving single observation, index is out of bounds" );
         }
-        return observations_.at( index );
+        return observations_.row( index ).transpose( );
     }
 
     void setObservation( const unsigned int index, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observation )
@@ -227,7 +379,7 @@ public:
                     "Error when setting single observation value, the observation size is "
                     "inconsistent." );
         }
-        observations_.at( index ) = observation;
+        observations_.row( index ) = observation.transpose( );
     }
 
     std::vector< TimeType > getObservationTimes( )
@@ -271,15 +423,10 @@ public:
         return numberOfObservations_ * singleObservationSize_;
     }
 
-    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservationsVector( )
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservationsVector( ) const
     {
-        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector =
-                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( singleObservationSize_ * numberOfObservations_, 1 );
-        for( unsigned int i = 0; i < observations_.size( ); i++ )
-        {
-            observationsVector.segment( i * singleObservationSize_, singleObservationSize_ ) = observations_.at( i );
-        }
-        return observationsVector;
+        return Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >( observations_.data( ),
+                                                                                             observations_.size( ) );
     }
 
     std::pair< TimeType, TimeType > getTimeBounds( )
@@ -293,39 +440,45 @@ public:
 
     std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservationsHistory( )
     {
-        return utilities::createMapFromVectors< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >( observationTimes_,
-                                                                                                                       observations_ );
+        std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observationsHistory;
+        for( unsigned int i = 0; i < numberOfObservations_; i++ )
+        {
+            observationsHistory[ observationTimes_.at( i ) ] = observations_.row( i ).transpose( );
+        }
+        return observationsHistory;
     }
 
     std::vector< Eigen::VectorXd > getObservationsDependentVariables( )
     {
-        return observationsDependentVariables_;
+        return splitMatrixRowsIntoVectors( observationsDependentVariables_ );
     }
 
     Eigen::MatrixXd getObservationsDependentVariablesMatrix( )
     {
-        Eigen::MatrixXd dependentVariablesMatrix =
-                Eigen::MatrixXd::Zero( numberOfObservations_, dependentVariableCalculator_->getTotalDependentVariableSize( ) );
-        for( unsigned int i = 0; i < observationsDependentVariables_.size( ); i++ )
+        if( observationsDependentVariables_.rows( ) == 0 )
         {
-            dependentVariablesMatrix.block( i, 0, 1, dependentVariableCalculator_->getTotalDependentVariableSize( ) ) =
-                    observationsDependentVariables_[ i ].transpose( );
+            return Eigen::MatrixXd::Zero( numberOfObservations_, dependentVariableCalculator_->getTotalDependentVariableSize( ) );
         }
-        return dependentVariablesMatrix;
+        return observationsDependentVariables_;
+    }
+
+    //! Function to retrieve the matrix of dependent variables, with one row per observation (no rows if none are set)
+    const DoubleObservationMatrix& getDependentVariablesMatrix( ) const
+    {
+        return observationsDependentVariables_;
     }
 
     //! Function returning the dependent variable values for a single observation (indicated by index)
     Eigen::VectorXd getDependentVariablesForSingleObservation( unsigned int index ) const
     {
-        if( index >= numberOfObservations_ )
+        if( index >= numberOfObservations_ || observationsDependentVariables_.rows( ) == 0 )
         {
             throw std::runtime_error(
                     "Error when retrieving observation dependent variables for single observation, "
                     "required index incompatible with number of observations." );
         }
-        return observationsDependentVariables_.at( index );
+        return observationsDependentVariables_.row( index ).transpose( );
     }
-
     //! Function returning the values of a single dependent variable (specified by dependent variable settings)
     Eigen::MatrixXd getSingleDependentVariable( std::shared_ptr< ObservationDependentVariableSettings > dependentVariableSettings,
                                                 const bool returnFirstCompatibleSettings = false )
@@ -407,17 +560,18 @@ public:
         return dependentVariablesList;
     }
 
-    std::vector< Eigen::VectorXd >& getObservationsDependentVariablesReference( )
+    //! Function to retrieve the dependent variables as a list of vectors (created from the matrix of dependent variables)
+    std::vector< Eigen::VectorXd > getObservationsDependentVariablesReference( )
     {
-        return observationsDependentVariables_;
+        return splitMatrixRowsIntoVectors( observationsDependentVariables_ );
     }
 
     //! Function to reset the observation dependent variable values
     void setObservationsDependentVariables( std::vector< Eigen::VectorXd >& dependentVariables )
     {
-        if( observationsDependentVariables_.size( ) > 0 )
+        if( dependentVariables.size( ) > 0 )
         {
-            if( observationsDependentVariables_.size( ) != numberOfObservations_ )
+            if( dependentVariables.size( ) != numberOfObservations_ )
             {
                 throw std::runtime_error(
                         "Error when resetting observation dependent variables in "
@@ -434,7 +588,8 @@ public:
                         "should be consistent with the total dependent variable size." );
             }
         }
-        observationsDependentVariables_ = dependentVariables;
+        observationsDependentVariables_ =
+                stackVectorsAsMatrixRows( dependentVariables, dependentVariables.size( ) > 0 ? dependentVariables.at( 0 ).rows( ) : 0 );
     }
 
     std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > getDependentVariableCalculator( )
@@ -446,7 +601,18 @@ public:
     //! observations are computed/acquired, which might differ from the times at which the dependent variables are evaluated.
     std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( )
     {
-        return utilities::createMapFromVectors< TimeType, Eigen::VectorXd >( observationTimes_, observationsDependentVariables_ );
+        if( observationsDependentVariables_.rows( ) != static_cast< int >( numberOfObservations_ ) )
+        {
+            throw std::runtime_error(
+                    "Error when retrieving observation dependent variable history, no dependent variables are set for the "
+                    "observations." );
+        }
+        std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
+        for( unsigned int i = 0; i < numberOfObservations_; i++ )
+        {
+            dependentVariableHistory[ observationTimes_.at( i ) ] = observationsDependentVariables_.row( i ).transpose( );
+        }
+        return dependentVariableHistory;
     }
 
     //! Function that returns the time history of a single dependent variables (specified by settings). It must be noted that the reported epochs are the times
@@ -474,23 +640,24 @@ public:
 
     std::vector< Eigen::Matrix< double, Eigen::Dynamic, 1 > > getWeights( ) const
     {
-        return weights_;
+        return splitMatrixRowsIntoVectors( weights_ );
+    }
+
+    //! Function to retrieve the weights as a list of vectors (created from the matrix of weights)
+    std::vector< Eigen::Matrix< double, Eigen::Dynamic, 1 > > getWeightsReference( )
+    {
+        return splitMatrixRowsIntoVectors( weights_ );
     }
 
-    const std::vector< Eigen::Matrix< double, Eigen::Dynamic, 1 > >& getWeightsReference( )
+    //! Function to retrieve the matrix of weights, with one row per observation
+    const DoubleObservationMatrix& getWeightsMatrix( ) const
     {
         return weights_;
     }
 
     Eigen::VectorXd getWeightsVector( ) const
     {
-        Eigen::Matrix< double, Eigen::Dynamic, 1 > weightsVector =
-                Eigen::Matrix< double, Eigen::Dynamic, 1 >::Zero( singleObservationSize_ * numberOfObservations_, 1 );
-        for( unsigned int i = 0; i < numberOfObservations_; i++ )
-        {
-            weightsVector.block( i * singleObservationSize_, 0, singleObservationSize_, 1 ) = weights_.at( i );
-        }
-        return weightsVector;
+        return Eigen::Map< const Eigen::VectorXd >( weights_.data( ), weights_.size( ) );
     }
 
     Eigen::Matrix< double, Eigen::Dynamic, 1 > getWeight( unsigned int index ) const
@@ -501,26 +668,27 @@ public:
                     "Error when retrieving single observation weight, required index incompatible "
                     "with number of observations." );
         }
-        return weights_.at( index );
+        return weights_.row( index ).transpose( );
     }
 
     std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getResiduals( ) const
     {
-        return residuals_;
+        return splitMatrixRowsIntoVectors( residuals_ );
     }
 
     Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getResidualsVector( ) const
     {
-        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residualsVector =
-                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( singleObservationSize_ * numberOfObservations_, 1 );
-        for( unsigned int i = 0; i < numberOfObservations_; i++ )
-        {
-            residualsVector.block( i * singleObservationSize_, 0, singleObservationSize_, 1 ) = residuals_.at( i );
-        }
-        return residualsVector;
+        return Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >( residuals_.data( ), residuals_.size( ) );
     }
 
-    const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& getResidualsReference( )
+    //! Function to retrieve the residuals as a list of vectors (created from the matrix of residuals)
+    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getResidualsReference( )
+    {
+        return splitMatrixRowsIntoVectors( residuals_ );
+    }
+
+    //! Function to retrieve the matrix of residuals, with one row per observation
+    const ObservationMatrix& getResidualsMatrix( ) const
     {
         return residuals_;
     }
@@ -533,7 +701,7 @@ public:
                     "Error when retrieving single observation residual, required index "
                     "incompatible with number of observations." );
         }
-        return residuals_.at( index );
+        return residuals_.row( index ).transpose( );
     }
 
     Eigen::VectorXd getRmsResiduals( )
@@ -544,7 +712,7 @@ public:
             // Calculate RMS of the residuals for each observation component
             for( unsigned int j = 0; j < numberOfObservations_; j++ )
             {
-                rmsResiduals[ i ] += residuals_[ j ]( i, 0 ) * residuals_[ j ]( i, 0 );
+                rmsResiduals[ i ] += residuals_( j, i ) * residuals_( j, i );
             }
             rmsResiduals[ i ] = std::sqrt( rmsResiduals[ i ] / numberOfObservations_ );
         }
@@ -560,7 +728,7 @@ public:
             // Calculate mean residual for each observation component
             for( unsigned int j = 0; j < numberOfObservations_; j++ )
             {
-                meanResiduals[ i ] += residuals_[ j ]( i, 0 );
+                meanResiduals[ i ] += residuals_( j, i );
             }
             meanResiduals[ i ] /= numberOfObservations_;
         }
@@ -569,10 +737,7 @@ public:
 
     void setConstantWeight( const double weight )
     {
-        for( unsigned int k = 0; k < numberOfObservations_; k++ )
-        {
-            weights_.at( k ) = weight * Eigen::Matrix< double, Eigen::Dynamic, 1 >::Ones( singleObservationSize_, 1 );
-        }
+        weights_.setConstant( weight );
     }
 
     void setConstantWeight( const Eigen::Matrix< double, Eigen::Dynamic, 1 >& weight )
@@ -583,50 +748,38 @@ public:
                     "Error when setting constant weight in single observation set, weight size is "
                     "inconsistent with single observation size." );
         }
-        for( unsigned int k = 0; k < weights_.size( ); k++ )
-        {
-            weights_.at( k ) = weight;
-        }
+        weights_.rowwise( ) = weight.transpose( );
     }
 
     void setTabulatedWeights( const Eigen::VectorXd& weightsVector )
     {
-        if( weightsVector.rows( ) != static_cast< int >( singleObservationSize_ * observations_.size( ) ) )
+        if( weightsVector.rows( ) != static_cast< int >( singleObservationSize_ * numberOfObservations_ ) )
         {
             throw std::runtime_error(
                     "Error when setting weights in single observation set, sizes are "
                     "incompatible." );
         }
-        for( unsigned int k = 0; k < numberOfObservations_; k++ )
+        weights_ = Eigen::Map< const DoubleObservationMatrix >( weightsVector.data( ), numberOfObservations_, singleObservationSize_ );
+    }
+
+    //! Function to reset the weights from a matrix with one row per observation
+    void setWeightsMatrix( const DoubleObservationMatrix& weights )
+    {
+        if( weights.rows( ) != weights_.rows( ) || weights.cols( ) != weights_.cols( ) )
         {
-            for( unsigned int i = 0; i < singleObservationSize_; i++ )
-            {
-                weights_.at( k )[ i ] = weightsVector[ k * singleObservationSize_ + i ];
-            }
+            throw std::runtime_error( "Error when setting weights in single observation set, size of weight matrix is incompatible." );
         }
+        weights_ = weights;
     }
 
     std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getComputedObservations( ) const
     {
-        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > computedObservations;
-        for( unsigned int k = 0; k < observations_.size( ); k++ )
-        {
-            computedObservations.push_back( observations_.at( k ) - residuals_.at( k ) );
-        }
-        return computedObservations;
+        return splitMatrixRowsIntoVectors( ObservationMatrix( observations_ - residuals_ ) );
     }
 
     Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getComputedObservationsVector( ) const
     {
-        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > computedObservationsVector =
-                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( singleObservationSize_ * numberOfObservations_, 1 );
-
-        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > computedObservations = getComputedObservations( );
-        for( unsigned int i = 0; i < numberOfObservations_; i++ )
-        {
-            computedObservationsVector.segment( i * singleObservationSize_, singleObservationSize_ ) = computedObservations.at( i );
-        }
-        return computedObservationsVector;
+        return getObservationsVector( ) - getResidualsVector( );
     }
 
     unsigned int getNumberOfFilteredObservations( ) const
@@ -646,37 +799,37 @@ public:
 
     void removeSingleObservation( unsigned int indexToRemove )
     {
-        if( indexToRemove >= numberOfObservations_ )
+        removeObservations( { indexToRemove } );
+    }
+
+    void removeObservations( const std::vector< unsigned int >& indicesToRemove )
+    {
+        if( indicesToRemove.empty( ) )
         {
-            throw std::runtime_error(
-                    "Error when removing single observation from SingleObservationSet, index "
-                    "incompatible with number of observations." );
+            return;
         }
 
-        // Update observations
-        observations_.erase( observations_.begin( ) + indexToRemove );
-        observationTimes_.erase( observationTimes_.begin( ) + indexToRemove );
-        residuals_.erase( residuals_.begin( ) + indexToRemove );
-        weights_.erase( weights_.begin( ) + indexToRemove );
-
-        if( observationsDependentVariables_.size( ) > 0 )
+        std::vector< bool > removeObservation( numberOfObservations_, false );
+        for( auto index: indicesToRemove )
         {
-            observationsDependentVariables_.erase( observationsDependentVariables_.begin( ) + indexToRemove );
+            if( index >= numberOfObservations_ )
+            {
+                throw std::runtime_error(
+                        "Error when removing single observation from SingleObservationSet, index "
+                        "incompatible with number of observations." );
+            }
+            removeObservation.at( index ) = true;
         }
 
-        // Update number of observations and time bounds
-        numberOfObservations_ = observations_.size( );
-        updateTimeBounds( );
-    }
-
-    void removeObservations( const std::vector< unsigned int >& indicesToRemove )
-    {
-        unsigned int counter = 0;
-        for( auto ind: indicesToRemove )
+        std::vector< unsigned int > indicesToKeep;
+        for( unsigned int i = 0; i < numberOfObservations_; i++ )
         {
-            removeSingleObservation( ind - counter );  // observations are already filtered and sorted
-            counter += 1;
+            if( !removeObservation.at( i ) )
+            {
+                indicesToKeep.push_back( i );
+            }
         }
+        keepObservations( indicesToKeep );
     }
 
     void filterObservations( const std::shared_ptr< ObservationFilterBase > observationFilter, const bool saveFilteredObservations = true )
@@ -687,10 +840,10 @@ public:
             filteredObservationSet_ = std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
                     observableType_,
                     linkEnds_,
-                    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >( ),
+                    ObservationMatrix( 0, singleObservationSize_ ),
                     std::vector< TimeType >( ),
                     referenceLinkEnd_,
-                    std::vector< Eigen::VectorXd >( ),
+                    DoubleObservationMatrix( ),
                     dependentVariableCalculator_,
                     ancilliarySettings_ );
         }
@@ -705,6 +858,13 @@ public:
                 ( observationFilter->filterOut( ) ? numberOfObservations_ : filteredObservationSet_->getNumberOfObservables( ) );
         bool useOppositeCondition = observationFilter->useOppositeCondition( );
 
+        // Retrieve data of the observation set that is to be tested (without copying)
+        const std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > testedSet =
+                ( observationFilter->filterOut( ) ? nullptr : filteredObservationSet_ );
+        const ObservationMatrix& testedObservations = ( testedSet == nullptr ? observations_ : testedSet->observations_ );
+        const ObservationMatrix& testedResiduals = ( testedSet == nullptr ? residuals_ : testedSet->residuals_ );
+        const std::vector< TimeType >& testedTimes = ( testedSet == nullptr ? observationTimes_ : testedSet->observationTimes_ );
+
         std::vector< unsigned int > indicesToRemove;
         switch( observationFilter->getFilterType( ) )
         {
@@ -730,13 +890,11 @@ public:
 
                 for( unsigned int j = 0; j < nbObservationsToTest; j++ )
                 {
-                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > singleObservationResidual =
-                            ( observationFilter->filterOut( ) ? residuals_.at( j ) : filteredObservationSet_->getResidual( j ) );
                     bool removeObservation = false;
                     for( unsigned int k = 0; k < singleObservationSize_; k++ )
                     {
-                        if( ( !useOppositeCondition && ( std::fabs( singleObservationResidual[ k ] ) > residualCutOff[ k ] ) ) ||
-                            ( useOppositeCondition && ( std::fabs( singleObservationResidual[ k ] ) <= residualCutOff[ k ] ) ) )
+                        if( ( !useOppositeCondition && ( std::fabs( testedResiduals( j, k ) ) > residualCutOff[ k ] ) ) ||
+                            ( useOppositeCondition && ( std::fabs( testedResiduals( j, k ) ) <= residualCutOff[ k ] ) ) )
                         {
                             removeObservation = true;
                         }
@@ -770,13 +928,11 @@ public:
 
                 for( unsigned int j = 0; j < nbObservationsToTest; j++ )
                 {
-                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > singleObservation =
-                            ( observationFilter->filterOut( ) ? observations_.at( j ) : filteredObservationSet_->getObservation( j ) );
                     bool removeObservation = false;
                     for( unsigned int k = 0; k < singleObservationSize_; k++ )
                     {
-                        if( ( !useOppositeCondition && ( singleObservation[ k ] > absoluteValueCutOff[ k ] ) ) ||
-                            ( useOppositeCondition && ( singleObservation[ k ] <= absoluteValueCutOff[ k ] ) ) )
+                        if( ( !useOppositeCondition && ( testedObservations( j, k ) > absoluteValueCutOff[ k ] ) ) ||
+                            ( useOppositeCondition && ( testedObservations( j, k ) <= absoluteValueCutOff[ k ] ) ) )
                         {
                             removeObservation = true;
                         }
@@ -793,8 +949,7 @@ public:
                         std::dynamic_pointer_cast< ObservationFilter< std::vector< double > > >( observationFilter )->getFilterValue( );
                 for( unsigned int j = 0; j < nbObservationsToTest; j++ )
                 {
-                    TimeType singleObservationTime = ( observationFilter->filterOut( ) ? observationTimes_.at( j )
-                                                                                       : filteredObservationSet_->getObservationTime( j ) );
+                    TimeType singleObservationTime = testedTimes.at( j );
                     if( ( !useOppositeCondition &&
                           ( std::count( filterEpochs.begin( ), filterEpochs.end( ), singleObservationTime ) > 0 ) ) ||
                         ( useOppositeCondition &&
@@ -811,8 +966,7 @@ public:
                                 ->getFilterValue( );
                 for( unsigned int j = 0; j < nbObservationsToTest; j++ )
                 {
-                    TimeType singleObservationTime = ( observationFilter->filterOut( ) ? observationTimes_.at( j )
-                                                                                       : filteredObservationSet_->getObservationTime( j ) );
+                    TimeType singleObservationTime = testedTimes.at( j );
                     if( ( !useOppositeCondition &&
                           ( ( singleObservationTime >= timeBounds.first ) && ( singleObservationTime <= timeBounds.second ) ) ) ||
                         ( useOppositeCondition &&
@@ -910,58 +1064,111 @@ public:
                     "inconsistent." );
         }
 
-        for( unsigned int k = 0; k < observations.size( ); k++ )
+        ObservationMatrix observationsMatrix;
+        DoubleObservationMatrix weightsMatrix;
+        ObservationMatrix residualsMatrix;
+        try
         {
-            if( observations.at( k ).size( ) != singleObservationSize_ )
-            {
-                throw std::runtime_error(
-                        "Error when adding observations to SingleObservationSet, new observation "
-                        "size is inconsistent." );
-            }
-
-            observations_.push_back( observations.at( k ) );
-            observationTimes_.push_back( times.at( k ) );
-
-            // If residuals are provided as inputs
-            if( residuals.size( ) > 0 )
-            {
-                if( residuals.at( k ).size( ) != singleObservationSize_ )
-                {
-                    throw std::runtime_error(
-                            "Error when adding observations to SingleObservationSet, new residual "
-                            "size is inconsistent." );
-                }
-                residuals_.push_back( residuals.at( k ) );
-            }
-            else  // Otherwise, set to zero by default
-            {
-                residuals_.push_back( Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( singleObservationSize_, 1 ) );
-            }
+            observationsMatrix = stackVectorsAsMatrixRows( observations, singleObservationSize_ );
+            weightsMatrix = stackVectorsAsMatrixRows( weights, singleObservationSize_ );
+            residualsMatrix = stackVectorsAsMatrixRows( residuals, singleObservationSize_ );
+        }
+        catch( std::runtime_error& )
+        {
+            throw std::runtime_error(
+                    "Error when adding observations to SingleObservationSet, new observation, weight or residual "
+                    "size is inconsistent." );
+        }
+
+        addObservations( observationsMatrix,
+                         times,
+                         stackVectorsAsMatrixRows( dependentVariables,
+                                                   dependentVariables.size( ) > 0 ? dependentVariables.at( 0 ).rows( ) : 0 ),
+                         weightsMatrix,
+                         residualsMatrix,
+                         sortObservations );
+    }
+
+    //! Function to add observations to the set
+    /*!
+     *  Function to add observations to the set, with each input matrix containing one row per observation
+     *  \param observations Observations that are to be added
+     *  \param times Epochs of the observations that are to be added
+     *  \param dependentVariables Dependent variables of the observations that are to be added (empty if none)
+     *  \param weights Weights of the observations that are to be added (set to one if empty)
+     *  \param residuals Residuals of the observations that are to be added (set to zero if empty)
+     *  \param sortObservations Boolean denoting whether observations are to be sorted by time after adding the new observations
+     */
+    void addObservations( const ObservationMatrix& observations,
+                          const std::vector< TimeType >& times,
+                          const DoubleObservationMatrix& dependentVariables = DoubleObservationMatrix( ),
+                          const DoubleObservationMatrix& weights = DoubleObservationMatrix( ),
+                          const ObservationMatrix& residuals = ObservationMatrix( ),
+                          const bool sortObservations = true )
+    {
+        const int numberOfNewObservations = static_cast< int >( times.size( ) );
+        if( ( observations.rows( ) != numberOfNewObservations ) ||
+            ( weights.rows( ) > 0 && ( observations.rows( ) != weights.rows( ) ) ) ||
+            ( residuals.rows( ) > 0 && ( observations.rows( ) != residuals.rows( ) ) ) ||
+            ( dependentVariables.rows( ) > 0 && ( observations.rows( ) != dependentVariables.rows( ) ) ) )
+        {
+            throw std::runtime_error(
+                    "Error when adding observations to SingleObservationSet, input sizes are "
+                    "inconsistent." );
+        }
+        if( numberOfNewObservations == 0 )
+        {
+            return;
+        }
 
-            // If weights are provided as inputs
-            if( weights.size( ) > 0 )
-            {
-                if( weights.at( k ).size( ) != singleObservationSize_ )
-                {
-                    throw std::runtime_error(
-                            "Error when adding observations to SingleObservationSet, new weight "
-                            "size is inconsistent." );
-                }
-                weights_.push_back( weights.at( k ) );
-            }
-            else  // Otherwise, set to one by default
-            {
-                weights_.push_back( Eigen::Matrix< double, Eigen::Dynamic, 1 >::Ones( singleObservationSize_, 1 ) );
-            }
+        if( observations.cols( ) != singleObservationSize_ )
+        {
+            throw std::runtime_error(
+                    "Error when adding observations to SingleObservationSet, new observation "
+                    "size is inconsistent." );
+        }
+        if( residuals.rows( ) > 0 && residuals.cols( ) != singleObservationSize_ )
+        {
+            throw std::runtime_error(
+                    "Error when adding observations to SingleObservationSet, new residual "
+                    "size is inconsistent." );
+        }
+        if( weights.rows( ) > 0 && weights.cols( ) != singleObservationSize_ )
+        {
+            throw std::runtime_error(
+                    "Error when adding observations to SingleObservationSet, new weight "
+                    "size is inconsistent." );
+        }
 
-            // if dependent variables are set
-            if( ( observationsDependentVariables_.size( ) > 0 || numberOfObservations_ == 0 ) && dependentVariables.size( ) > 0 )
+        // Add dependent variables if they are set (padding with NaN if dependent variables are already set, but not provided)
+        if( ( observationsDependentVariables_.rows( ) > 0 || numberOfObservations_ == 0 ) && dependentVariables.rows( ) > 0 )
+        {
+            if( observationsDependentVariables_.rows( ) > 0 && observationsDependentVariables_.cols( ) != dependentVariables.cols( ) )
             {
-                observationsDependentVariables_.push_back( dependentVariables.at( k ) );
+                throw std::runtime_error(
+                        "Error when adding observations to SingleObservationSet, new dependent variable "
+                        "size is inconsistent." );
             }
-
-            numberOfObservations_ += 1;
+            appendMatrixRows( observationsDependentVariables_, dependentVariables );
         }
+        else if( observationsDependentVariables_.rows( ) > 0 )
+        {
+            appendMatrixRows( observationsDependentVariables_,
+                              DoubleObservationMatrix( DoubleObservationMatrix::Constant(
+                                      numberOfNewObservations, observationsDependentVariables_.cols( ), TUDAT_NAN ) ) );
+        }
+
+        appendMatrixRows( observations_, observations );
+        observationTimes_.insert( observationTimes_.end( ), times.begin( ), times.end( ) );
+        appendMatrixRows( residuals_,
+                          residuals.rows( ) > 0
+                                  ? residuals
+                                  : ObservationMatrix( ObservationMatrix::Zero( numberOfNewObservations, singleObservationSize_ ) ) );
+        appendMatrixRows( weights_,
+                          weights.rows( ) > 0
+                                  ? weights
+                                  : DoubleObservationMatrix( DoubleObservationMatrix::Ones( numberOfNewObservations, singleObservationSize_ ) ) );
+        numberOfObservations_ += numberOfNewObservations;
 
         // Sort observations
         if( sortObservations )
@@ -990,63 +1197,63 @@ private:
     {
         if( !std::is_sorted( observationTimes_.begin( ), observationTimes_.end( ) ) )
         {
-            if( observations_.size( ) != numberOfObservations_ )
+            if( observations_.rows( ) != static_cast< int >( numberOfObservations_ ) )
             {
                 throw std::runtime_error(
                         "Error when making SingleObservationSet, number of observations is "
                         "incompatible after time ordering" );
             }
-
-            std::multimap< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observationsMap;
-            for( unsigned int i = 0; i < observations_.size( ); i++ )
+            if( observationsDependentVariables_.rows( ) > 0 &&
+                observationsDependentVariables_.rows( ) != static_cast< int >( numberOfObservations_ ) )
             {
-                observationsMap.insert( { observationTimes_.at( i ), observations_.at( i ) } );
-            }
-            observationTimes_ = utilities::createVectorFromMultiMapKeys( observationsMap );
-            observations_ = utilities::createVectorFromMultiMapValues( observationsMap );
-
-            if( observationsDependentVariables_.size( ) > 0 )
-            {
-                if( observationsDependentVariables_.size( ) != numberOfObservations_ )
-                {
-                    throw std::runtime_error(
-                            "Error when making SingleObservationSet, dependent variables vector "
-                            "size is incompatible after time ordering" );
-                }
-                std::multimap< TimeType, Eigen::VectorXd > observationsDependentVariablesMap;
-                for( unsigned int i = 0; i < observationsDependentVariables_.size( ); i++ )
-                {
-                    observationsDependentVariablesMap.insert( { observationTimes_.at( i ), observationsDependentVariables_.at( i ) } );
-                }
-                observationsDependentVariables_ = utilities::createVectorFromMultiMapValues( observationsDependentVariablesMap );
+                throw std::runtime_error(
+                        "Error when making SingleObservationSet, dependent variables vector "
+                        "size is incompatible after time ordering" );
             }
-
-            if( weights_.size( ) != numberOfObservations_ )
+            if( weights_.rows( ) != static_cast< int >( numberOfObservations_ ) )
             {
                 throw std::runtime_error(
                         "Error when making SingleObservationSet, weights size is incompatible "
                         "after time ordering" );
             }
-            std::multimap< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > > weightsMap;
-            for( unsigned int i = 0; i < weights_.size( ); i++ )
-            {
-                weightsMap.insert( { observationTimes_.at( i ), weights_.at( i ) } );
-            }
-            weights_ = utilities::createVectorFromMultiMapValues( weightsMap );
-
-            if( residuals_.size( ) != numberOfObservations_ )
+            if( residuals_.rows( ) != static_cast< int >( numberOfObservations_ ) )
             {
                 throw std::runtime_error(
                         "Error when making SingleObservationSet, residuals size is incompatible "
                         "after time ordering" );
             }
-            std::multimap< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > residualsMap;
-            for( unsigned int i = 0; i < residuals_.size( ); i++ )
-            {
-                residualsMap.insert( { observationTimes_.at( i ), residuals_.at( i ) } );
-            }
-            residuals_ = utilities::createVectorFromMultiMapValues( residualsMap );
+
+            // Determine time-ordered permutation, retaining the order of observations with equal times
+            std::vector< unsigned int > sortedIndices( numberOfObservations_ );
+            std::iota( sortedIndices.begin( ), sortedIndices.end( ), 0 );
+            std::stable_sort( sortedIndices.begin( ), sortedIndices.end( ), [ & ]( const unsigned int i, const unsigned int j ) {
+                return observationTimes_.at( i ) < observationTimes_.at( j );
+            } );
+            keepObservations( sortedIndices );
+        }
+    }
+
+    //! Function to retain only the observations (and associated metadata) at the given indices, in the order in which they are given
+    void keepObservations( const std::vector< unsigned int >& indicesToKeep )
+    {
+        std::vector< TimeType > newObservationTimes;
+        newObservationTimes.reserve( indicesToKeep.size( ) );
+        for( auto index: indicesToKeep )
+        {
+            newObservationTimes.push_back( observationTimes_.at( index ) );
         }
+        observationTimes_ = newObservationTimes;
+
+        observations_ = extractMatrixRows( observations_, indicesToKeep );
+        weights_ = extractMatrixRows( weights_, indicesToKeep );
+        residuals_ = extractMatrixRows( residuals_, indicesToKeep );
+        if( observationsDependentVariables_.rows( ) > 0 )
+        {
+            observationsDependentVariables_ = extractMatrixRows( observationsDependentVariables_, indicesToKeep );
+        }
+
+        numberOfObservations_ = indicesToKeep.size( );
+        updateTimeBounds( );
     }
 
     void updateTimeBounds( )
@@ -1066,96 +1273,71 @@ private:
                                            const bool moveInFilteredSet = true,
                                            const bool saveFilteredObservations = true )
     {
-        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
-        std::vector< TimeType > times;
-        std::vector< Eigen::VectorXd > dependentVariables;
-        std::vector< Eigen::Matrix< double, Eigen::Dynamic, 1 > > weights;
-        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > residuals;
-
-        if( moveInFilteredSet )
+        // Retrieve set from which observations are to be moved
+        SingleObservationSet< ObservationScalarType, TimeType >* sourceSet = this;
+        if( !moveInFilteredSet )
         {
-            for( auto index: indices )
+            if( getNumberOfFilteredObservations( ) == 0 && indices.size( ) > 0 )
             {
-                if( index >= numberOfObservations_ )
-                {
-                    throw std::runtime_error(
-                            "Error when moving observation to filtered observation set, index "
-                            "incompatible with number of observations." );
-                }
-
-                observations.push_back( observations_.at( index ) );
-                times.push_back( observationTimes_.at( index ) );
-                weights.push_back( weights_.at( index ) );
-                residuals.push_back( residuals_.at( index ) );
-
-                // If dependent variables not empty
-                if( observationsDependentVariables_.size( ) > 0 )
-                {
-                    dependentVariables.push_back( observationsDependentVariables_.at( index ) );
-                }
+                throw std::runtime_error(
+                        "Error when moving observation back from filtered observation set, "
+                        "filtered observation set is empty." );
             }
+            sourceSet = filteredObservationSet_.get( );
+        }
 
-            if( saveFilteredObservations )
+        std::vector< TimeType > times;
+        for( auto index: indices )
+        {
+            if( index >= sourceSet->numberOfObservations_ )
             {
-                filteredObservationSet_->addObservations( observations, times, dependentVariables, weights, residuals, true );
+                throw std::runtime_error( moveInFilteredSet ? "Error when moving observation to filtered observation set, index "
+                                                              "incompatible with number of observations."
+                                                            : "Error when moving observation back from filtered observation set, "
+                                                              "index incompatible with number of observations." );
             }
-            removeObservations( indices );
+            times.push_back( sourceSet->observationTimes_.at( index ) );
         }
-        else
-        {
-            for( auto index: indices )
-            {
-                if( getNumberOfFilteredObservations( ) == 0 )
-                {
-                    throw std::runtime_error(
-                            "Error when moving observation back from filtered observation set, "
-                            "filtered observation set is empty." );
-                }
-                if( index >= getNumberOfFilteredObservations( ) )
-                {
-                    throw std::runtime_error(
-                            "Error when moving observation back from filtered observation set, "
-                            "index incompatible with number of observations." );
-                }
 
-                observations.push_back( filteredObservationSet_->getObservations( ).at( index ) );
-                times.push_back( filteredObservationSet_->getObservationTimes( ).at( index ) );
-                weights.push_back( filteredObservationSet_->getWeights( ).at( index ) );
-                residuals.push_back( filteredObservationSet_->getResiduals( ).at( index ) );
+        if( moveInFilteredSet && !saveFilteredObservations )
+        {
+            removeObservations( indices );
+            return;
+        }
 
-                // If dependent variables are set
-                if( filteredObservationSet_->getObservationsDependentVariables( ).size( ) > 0 )
-                {
-                    dependentVariables.push_back( filteredObservationSet_->getObservationsDependentVariables( ).at( index ) );
-                }
-            }
-            addObservations( observations, times, dependentVariables, weights, residuals, true );
-            filteredObservationSet_->removeObservations( indices );
+        DoubleObservationMatrix dependentVariables;
+        if( sourceSet->observationsDependentVariables_.rows( ) > 0 )
+        {
+            dependentVariables = extractMatrixRows( sourceSet->observationsDependentVariables_, indices );
         }
+
+        SingleObservationSet< ObservationScalarType, TimeType >* targetSet =
+                ( moveInFilteredSet ? filteredObservationSet_.get( ) : this );
+        targetSet->addObservations( extractMatrixRows( sourceSet->observations_, indices ),
+                                    times,
+                                    dependentVariables,
+                                    extractMatrixRows( sourceSet->weights_, indices ),
+                                    extractMatrixRows( sourceSet->residuals_, indices ),
+                                    true );
+        sourceSet->removeObservations( indices );
     }
 
     //! Function extracting the values of a single dependent variable
     Eigen::MatrixXd getSingleDependentVariable( std::pair< int, int > dependentVariableIndexAndSize ) const
     {
-        Eigen::MatrixXd singleDependentVariable = Eigen::MatrixXd::Zero( numberOfObservations_, dependentVariableIndexAndSize.second );
-        for( unsigned int i = 0; i < observationsDependentVariables_.size( ); i++ )
+        if( observationsDependentVariables_.rows( ) == 0 )
         {
-            if( dependentVariableIndexAndSize.first + dependentVariableIndexAndSize.second >
-                observationsDependentVariables_.at( i ).size( ) )
-            {
-                throw std::runtime_error(
-                        "Error when retrieving single observation dependent variable, required "
-                        "index and size incompatible with "
-                        "dependent variables size." );
-            }
-            else
-            {
-                Eigen::VectorXd singleDependentVariableVector = observationsDependentVariables_.at( i ).segment(
-                        dependentVariableIndexAndSize.first, dependentVariableIndexAndSize.second );
-                singleDependentVariable.block( i, 0, 1, dependentVariableIndexAndSize.second ) = singleDependentVariableVector.transpose( );
-            }
+            return Eigen::MatrixXd::Zero( numberOfObservations_, dependentVariableIndexAndSize.second );
+        }
+        if( dependentVariableIndexAndSize.first + dependentVariableIndexAndSize.second > observationsDependentVariables_.cols( ) )
+        {
+            throw std::runtime_error(
+                    "Error when retrieving single observation dependent variable, required "
+                    "index and size incompatible with "
+                    "dependent variables size." );
         }
-        return singleDependentVariable;
+        return observationsDependentVariables_.block(
+                0, dependentVariableIndexAndSize.first, observationsDependentVariables_.rows( ), dependentVariableIndexAndSize.second );
     }
 
     const ObservableType observableType_;
@@ -1164,13 +1346,15 @@ private:
 
     std::pair< TimeType, TimeType > timeBounds_;
 
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations_;
+    //! Observations, with one row per observation
+    ObservationMatrix observations_;
 
     std::vector< TimeType > observationTimes_;
 
     const LinkEndType referenceLinkEnd_;
 
-    std::vector< Eigen::VectorXd > observationsDependentVariables_;
+    //! Observation dependent variables, with one row per observation (empty if no dependent variables are set)
+    DoubleObservationMatrix observationsDependentVariables_;
 
     std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator_;
 
@@ -1180,11 +1364,11 @@ private:
 
     unsigned int singleObservationSize_;
 
-    std::vector< Eigen::Matrix< double, Eigen::Dynamic, 1 > > weights_;
+    //! Observation weights, with one row per observation
+    DoubleObservationMatrix weights_;
 
-    //    Eigen::VectorXd weightsVector_;
-
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > residuals_;
+    //! Observation residuals, with one row per observation
+    ObservationMatrix residuals_;
 
     std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > filteredObservationSet_;
 };
@@ -1208,15 +1392,14 @@ std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > filte
             std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
                     singleObservationSet->getObservableType( ),
                     singleObservationSet->getLinkEnds( ),
-                    singleObservationSet->getObservationsReference( ),
+                    singleObservationSet->getObservationsMatrix( ),
                     singleObservationSet->getObservationTimesReference( ),
                     singleObservationSet->getReferenceLinkEnd( ),
-                    singleObservationSet->getObservationsDependentVariablesReference( ),
+                    singleObservationSet->getDependentVariablesMatrix( ),
                     singleObservationSet->getDependentVariableCalculator( ),
-                    singleObservationSet->getAncilliarySettings( ) );
-    newObservationSet->setTabulatedWeights( singleObservationSet->getWeightsVector( ) );
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > residuals = singleObservationSet->getResidualsReference( );
-    newObservationSet->setResiduals( singleObservationSet->getResidualsReference( ) /*residuals*/ );
+                    singleObservationSet->getAncilliarySettings( ),
+                    singleObservationSet->getWeightsMatrix( ),
+                    singleObservationSet->getResidualsMatrix( ) );
 
     // Filter observations from new observation set
     newObservationSet->filterObservations( observationFilter, saveFilteredObservations );
@@ -1241,11 +1424,7 @@ std::vector< std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeT
     }
 
     std::vector< int > rawStartIndicesNewSets = { 0 };
-    std::vector< TimeType > observationTimes = observationSet->getObservationTimes( );
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations = observationSet->getObservations( );
-    std::vector< Eigen::VectorXd > dependentVariables = observationSet->getObservationsDependentVariables( );
-    Eigen::Matrix< double, Eigen::Dynamic, 1 > weightsVector = observationSet->getWeightsVector( );
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > residuals = observationSet->getResiduals( );
+    const std::vector< TimeType >& observationTimes = observationSet->getObservationTimesReference( );
 
     switch( observationSetSplitter->getSplitterType( ) )
     {
@@ -1341,31 +1520,24 @@ std::vector< std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeT
         int startIndex = indicesNewSets.at( k ).first;
         int sizeCurrentSet = indicesNewSets.at( k ).second;
 
-        std::vector< Eigen::VectorXd > newDependentVariables;
-        if( !dependentVariables.empty( ) )
+        typename SingleObservationSet< ObservationScalarType, TimeType >::DoubleObservationMatrix newDependentVariables;
+        if( observationSet->getDependentVariablesMatrix( ).rows( ) > 0 )
         {
-            newDependentVariables = utilities::getStlVectorSegment(
-                    observationSet->getObservationsDependentVariablesReference( ), startIndex, sizeCurrentSet );
+            newDependentVariables = observationSet->getDependentVariablesMatrix( ).middleRows( startIndex, sizeCurrentSet );
         }
 
         std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > newSet =
                 std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
                         observationSet->getObservableType( ),
                         observationSet->getLinkEnds( ),
-                        utilities::getStlVectorSegment( observationSet->getObservationsReference( ), startIndex, sizeCurrentSet ),
-                        utilities::getStlVectorSegment( observationSet->getObservationTimesReference( ), startIndex, sizeCurrentSet ),
+                        observationSet->getObservationsMatrix( ).middleRows( startIndex, sizeCurrentSet ),
+                        utilities::getStlVectorSegment( observationTimes, startIndex, sizeCurrentSet ),
                         observationSet->getReferenceLinkEnd( ),
                         newDependentVariables,
                         observationSet->getDependentVariableCalculator( ),
-                        observationSet->getAncilliarySettings( ) );
-
-        Eigen::Matrix< double, Eigen::Dynamic, 1 > newWeightsVector =
-                weightsVector.segment( startIndex, sizeCurrentSet * observationSet->getSingleObservableSize( ) );
-        newSet->setTabulatedWeights( newWeightsVector );
-
-        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > newResiduals =
-                utilities::getStlVectorSegment( observationSet->getResidualsReference( ), startIndex, sizeCurrentSet );
-        newSet->setResiduals( newResiduals );
+                        observationSet->getAncilliarySettings( ),
+                        observationSet->getWeightsMatrix( ).middleRows( startIndex, sizeCurrentSet ),
+                        observationSet->getResidualsMatrix( ).middleRows( startIndex, sizeCurrentSet ) );
 
         newObsSets.push_back( newSet );
     }
@@ -98,6 +98,12 @@ inline std::shared_ptr< AccelerationSettings > einsteinInfledHoffmannGravityAcce
     return std::make_shared< AccelerationSettings >( basic_astrodynamics::einstein_infeld_hoffmann_acceleration );
 }
 
+//! Function to create settings for a point-mass gravity acceleration that is evaluated for a group of bodies at once
+inline std::shared_ptr< AccelerationSettings > mutualPointMassGravityAcceleration( )
+{
+    return std::make_shared< AccelerationSettings >( basic_astrodynamics::mutual_point_mass_gravity );
+}
+
 //! @get_docstring(aerodynamicAcceleration)
 inline std::shared_ptr< AccelerationSettings > aerodynamicAcceleration( )
 {
@@ -26,6 +26,7 @@
 #include "tudat/astro/basic_astro/empiricalAcceleration.h"
 #include "tudat/astro/ephemerides/frameManager.h"
 #include "tudat/astro/gravitation/directTidalDissipationAcceleration.h"
+#include "tudat/astro/gravitation/mutualPointMassGravityModel.h"
 #include "tudat/astro/system_models/rtgAccelerationModel.h"
 #include "tudat/astro/relativity/einsteinInfeldHoffmannEquations.h"
 #include "tudat/astro/relativity/einsteinInfeldHoffmannAcceleration.h"
@@ -558,6 +559,23 @@ void addEihAccelerations( const SystemOfBodies& bodies,
                           const std::map< std::string, std::string >& centralBodies,
                           basic_astrodynamics::AccelerationMap& accelerationMap );
 
+//! Function to create the mutual point-mass gravity accelerations of a group of bodies, and add them to the acceleration map
+/*!
+ * Function to create the mutual point-mass gravity accelerations of a group of bodies, and add them to the acceleration map.
+ * All accelerations are computed by a single MutualPointMassGravity object, and are added with an empty name for the body
+ * exerting the acceleration. Each accelerated body must be attracted by all bodies that exert a mutual point-mass gravity
+ * acceleration on any of the accelerated bodies (other than itself), and must be propagated w.r.t. an inertial central body.
+ * \param bodies List of body objects
+ * \param orderedMutualGravityBodies List of bodies exerting a mutual point-mass gravity acceleration (value), per accelerated
+ * body (key)
+ * \param centralBodies Map of central bodies for each body undergoing acceleration.
+ * \param accelerationMap List of acceleration models, to which the mutual point-mass gravity accelerations are added
+ */
+void addMutualPointMassGravityAccelerations( const SystemOfBodies& bodies,
+                                             const std::map< std::string, std::vector< std::string > > orderedMutualGravityBodies,
+                                             const std::map< std::string, std::string >& centralBodies,
+                                             basic_astrodynamics::AccelerationMap& accelerationMap );
+
 //! Function to create acceleration models from a map of bodies and acceleration model types.
 /*!
  *  Function to create acceleration models from a map of bodies and acceleration model types.
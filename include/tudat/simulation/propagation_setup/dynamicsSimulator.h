@@ -703,6 +703,9 @@ public:
             throw std::runtime_error( "Error when creating environment updater: " + std::string( error.what( ) ) );
         }
 
+        // Skip repeated updates of models that depend only on time, the updater is reset at the start of each propagation
+        environmentUpdater_->setUseIncrementalUpdates( true );
+
         // Create object that calculates the complete state derivatives
         if( predefinedStateDerivativeModels.stateDerivativeModels_.size( ) == 0 )
         {
@@ -1333,6 +1336,10 @@ private:
         dynamicsStateDerivative_->updateStateDerivativeModelSettings(
                 processedInitialState.block( 0, processedInitialState.cols( ) - 1, processedInitialState.rows( ), 1 ) );
 
+        std::shared_ptr< PropagationEventLocator< SimulationResults::number_of_columns > > eventLocator =
+                createIntegrationEventLocator< SimulationResults::number_of_columns >( );
+        std::vector< typename SingleArcSimulationResults< StateScalarType, TimeType >::LocatedEvent > locatedEvents;
+
         if( sequentialPropagation_ )
         {
             integrateEquations< SimulationResults,
@@ -1345,7 +1352,9 @@ private:
                                             propagationResults,
                                             dependentVariablesFunctions_,
                                             statePostProcessingFunction,
-                                            propagatorSettings_->getOutputSettings( ) );
+                                            propagatorSettings_->getOutputSettings( ),
+                                            eventLocator );
+            addLocatedIntegrationEvents( eventLocator, locatedEvents );
         }
         else
         {
@@ -1361,7 +1370,9 @@ private:
                                             propagationResults,
                                             dependentVariablesFunctions_,
                                             statePostProcessingFunction,
-                                            propagatorSettings_->getOutputSettings( ) );
+                                            propagatorSettings_->getOutputSettings( ),
+                                            eventLocator );
+            addLocatedIntegrationEvents( eventLocator, locatedEvents );
 
             integratorSettings_->initialTimeStep_ *= -1.0;
             integrateEquations< SimulationResults,
@@ -1374,18 +1385,86 @@ private:
                                             propagationResults,
                                             dependentVariablesFunctions_,
                                             statePostProcessingFunction,
-                                            propagatorSettings_->getOutputSettings( ) );
+                                            propagatorSettings_->getOutputSettings( ),
+                                            eventLocator );
+            addLocatedIntegrationEvents( eventLocator, locatedEvents );
             integratorSettings_->initialTimeStep_ *= -1.0;
         }
 
+        SingleArcResultsRetriever< SimulationResults, StateScalarType, TimeType >::getSingleArcSimulationResults( propagationResults )
+                ->setLocatedIntegrationEvents( locatedEvents );
+
         simulation_setup::setAreBodiesInPropagation( bodies_, false );
     }
 
+    //! Typedef for the object locating integration events, for a propagated state with a given number of columns.
+    template< int NumberOfColumns >
+    using PropagationEventLocator =
+            numerical_integrators::IntegrationEventLocator< TimeType,
+                                                            Eigen::Matrix< StateScalarType, Eigen::Dynamic, NumberOfColumns >,
+                                                            Eigen::Matrix< StateScalarType, Eigen::Dynamic, NumberOfColumns >,
+                                                            typename scalar_type< TimeType >::value_type >;
+
+    //! Function to create the object locating the integration events defined in the propagator settings.
+    /*
+     *  Function to create the object locating the integration events defined in the propagator settings (nullptr if none are
+     *  defined). The event functions are evaluated using the last column of the integrated state, which contains the propagated
+     *  state (the other columns containing the variational equations, if these are propagated).
+     */
+    template< int NumberOfColumns >
+    std::shared_ptr< PropagationEventLocator< NumberOfColumns > > createIntegrationEventLocator( )
+    {
+        std::vector< std::shared_ptr< typename SingleArcPropagatorSettings< StateScalarType, TimeType >::EventSettings > >
+                eventSettings = propagatorSettings_->getIntegrationEventSettings( );
+        if( eventSettings.size( ) == 0 )
+        {
+            return nullptr;
+        }
+
+        std::vector< std::shared_ptr< typename PropagationEventLocator< NumberOfColumns >::EventSettings > > locatorEventSettings;
+        for( unsigned int i = 0; i < eventSettings.size( ); i++ )
+        {
+            const std::function< double( const TimeType, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& ) >
+                    eventFunction = eventSettings.at( i )->eventFunction_;
+            locatorEventSettings.push_back( std::make_shared< typename PropagationEventLocator< NumberOfColumns >::EventSettings >(
+                    eventSettings.at( i )->eventName_,
+                    [ = ]( const TimeType time, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, NumberOfColumns >& state ) {
+                        return eventFunction( time, state.col( state.cols( ) - 1 ) );
+                    },
+                    eventSettings.at( i )->eventDirection_,
+                    eventSettings.at( i )->isTerminal_ ) );
+        }
+        return std::make_shared< PropagationEventLocator< NumberOfColumns > >( locatorEventSettings );
+    }
+
+    //! Function to add the events located in the last propagation to a list, retaining only the propagated state of each event.
+    template< int NumberOfColumns >
+    void addLocatedIntegrationEvents(
+            const std::shared_ptr< PropagationEventLocator< NumberOfColumns > > eventLocator,
+            std::vector< typename SingleArcSimulationResults< StateScalarType, TimeType >::LocatedEvent >& locatedEvents )
+    {
+        if( eventLocator != nullptr )
+        {
+            for( auto locatorEvent: eventLocator->getLocatedEvents( ) )
+            {
+                typename SingleArcSimulationResults< StateScalarType, TimeType >::LocatedEvent locatedEvent;
+                locatedEvent.eventIndex_ = locatorEvent.eventIndex_;
+                locatedEvent.eventName_ = locatorEvent.eventName_;
+                locatedEvent.independentVariable_ = locatorEvent.independentVariable_;
+                locatedEvent.state_ = locatorEvent.state_.col( locatorEvent.state_.cols( ) - 1 );
+                locatedEvent.isIncreasing_ = locatorEvent.isIncreasing_;
+                locatedEvent.isTerminal_ = locatorEvent.isTerminal_;
+                locatedEvents.push_back( locatedEvent );
+            }
+        }
+    }
+
     //! Function to perform steps necessary to reset all relevant models for the upcoming propagation
     /*
      *  Function to perform steps necessary to reset all relevant models for the upcoming propagation:
      *  - Whether to propagate dynamics and/or vatiational equations
      *  - Reset counter of function evaluations to zero
+     *  - Force update of all environment models at the first function evaluation
      *  - Reset termination conditions
      *  - Empty object holding the numerical simulation results of the previous run
      *  - Print messages to terminal, as requested by user settings
@@ -1397,6 +1476,7 @@ private:
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), true, SimulationResults::is_variational );
         dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
         dynamicsStateDerivative_->resetCumulativeFunctionEvaluationCounter( );
+        environmentUpdater_->resetIncrementalUpdates( );
         resetPropagationTerminationConditions( );
 
         // Empty solution maps
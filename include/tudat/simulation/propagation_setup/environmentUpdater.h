@@ -11,6 +11,8 @@
 #ifndef TUDAT_ENVIRONMENTUPDATER_H
 #define TUDAT_ENVIRONMENTUPDATER_H
 
+#include <algorithm>
+#include <chrono>
 #include <vector>
 #include <string>
 #include <map>
@@ -32,6 +34,20 @@ namespace tudat
 namespace propagators
 {
 
+//! Statistics of the calls to a single environment update function, as recorded by the EnvironmentUpdater
+struct EnvironmentUpdateStatistics {
+    EnvironmentUpdateStatistics( ): numberOfEvaluations( 0 ), numberOfSkippedEvaluations( 0 ), evaluationTime( 0.0 ) { }
+
+    //! Number of times the update function was evaluated
+    long long numberOfEvaluations;
+
+    //! Number of times the update function was skipped, since the model was already updated to the current time
+    long long numberOfSkippedEvaluations;
+
+    //! Total wall-clock time (in seconds) spent in the update function (only recorded if timing is active)
+    double evaluationTime;
+};
+
 //! Class used to update the environment during numerical integration.
 /*!
  *  Class used to update the environment during numerical integration. The class ensures that the
@@ -62,7 +78,9 @@ public:
             const std::map< EnvironmentModelsToUpdate, std::vector< std::string > >& updateSettings,
             const std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > >& integratedStates =
                     ( std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > >( ) ) ):
-        bodyList_( bodyList ), integratedStates_( integratedStates )
+        bodyList_( bodyList ), integratedStates_( integratedStates ), numberOfTimeOnlyUpdates_( 0 ), numberOfTimeOnlyResets_( 0 ),
+        useIncrementalUpdates_( false ), timeOfTimeOnlyUpdates_( TUDAT_NAN ), numberOfSkippedTimeOnlyUpdates_( 0 ),
+        updateTimingIsActive_( false )
     {
         // Set update function to be evaluated as dependent variables of state and time during each
         // integration time step.
@@ -97,7 +115,10 @@ public:
                     std::to_string( setIntegratedStatesFromEnvironment.size( ) ) + " " + std::to_string( integratedStates_.size( ) ) );
         }
 
-        for( unsigned int i = 0; i < resetFunctionVector_.size( ); i++ )
+        // Check if models that depend only on time are already updated to current time (these are at the start of the lists)
+        bool skipTimeOnlyUpdates = useIncrementalUpdates_ && ( currentTime == timeOfTimeOnlyUpdates_ );
+
+        for( unsigned int i = ( skipTimeOnlyUpdates ? numberOfTimeOnlyResets_ : 0 ); i < resetFunctionVector_.size( ); i++ )
         {
             resetFunctionVector_.at( i ).template get< 2 >( )( );
         }
@@ -110,10 +131,100 @@ public:
 
         // Evaluate time-dependent update functions (dependent variables of state and time)
         // determined by setUpdateFunctions
+        if( skipTimeOnlyUpdates )
+        {
+            numberOfSkippedTimeOnlyUpdates_++;
+        }
+        for( unsigned int i = ( skipTimeOnlyUpdates ? numberOfTimeOnlyUpdates_ : 0 ); i < updateFunctionVector_.size( ); i++ )
+        {
+            if( updateTimingIsActive_ )
+            {
+                std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+                updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+                updateStatistics_.at( i ).evaluationTime +=
+                        std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+            }
+            else
+            {
+                updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            }
+            updateStatistics_.at( i ).numberOfEvaluations++;
+        }
+
+        if( useIncrementalUpdates_ )
+        {
+            timeOfTimeOnlyUpdates_ = currentTime;
+        }
+    }
+
+    //! Function to set whether updates of models that depend only on time are skipped if already performed at the current time
+    /*!
+     * Function to set whether updates of models that depend only on time are skipped if already performed at the current
+     * time. Models that depend only on time are ephemeris-based translational states of bodies that are not propagated (and
+     * have no propagated body as ephemeris origin) and rotational states from rotational ephemerides that do not depend on
+     * the state of any body. This option should only be used if the states of these bodies are not modified by any other
+     * object in between calls to updateEnvironment (as is the case during a propagation). When the environment may have
+     * been modified externally, the resetIncrementalUpdates function must be called.
+     * \param useIncrementalUpdates True if repeated updates of models that depend only on time are to be skipped
+     */
+    void setUseIncrementalUpdates( const bool useIncrementalUpdates )
+    {
+        useIncrementalUpdates_ = useIncrementalUpdates;
+        resetIncrementalUpdates( );
+    }
+
+    //! Function to force the update of all models during the next call to updateEnvironment
+    void resetIncrementalUpdates( )
+    {
+        timeOfTimeOnlyUpdates_ = TimeType( TUDAT_NAN );
+    }
+
+    //! Function to set whether the time spent in each update function is to be recorded
+    /*!
+     * Function to set whether the (wall-clock) time spent in each update function is to be recorded, which may be retrieved
+     * from getUpdateStatistics. Note that the timing itself adds an overhead to each update.
+     * \param updateTimingIsActive True if time spent in each update function is to be recorded
+     */
+    void setUpdateTimingIsActive( const bool updateTimingIsActive )
+    {
+        updateTimingIsActive_ = updateTimingIsActive;
+    }
+
+    //! Function to retrieve the statistics of the calls to each update function
+    /*!
+     * Function to retrieve the statistics of the calls to each update function, since object creation/last call to
+     * resetUpdateStatistics. The list is given in the order in which the updates are performed, with the first
+     * getNumberOfTimeOnlyUpdates( ) entries being the models that depend only on time.
+     * \return Statistics of the calls to each update function, with the model type and body name of the update.
+     */
+    std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, EnvironmentUpdateStatistics > > getUpdateStatistics( )
+    {
+        std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, EnvironmentUpdateStatistics > > updateStatistics;
         for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
         {
-            updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            EnvironmentUpdateStatistics currentStatistics = updateStatistics_.at( i );
+            if( i < numberOfTimeOnlyUpdates_ )
+            {
+                currentStatistics.numberOfSkippedEvaluations = numberOfSkippedTimeOnlyUpdates_;
+            }
+            updateStatistics.push_back( boost::make_tuple( updateFunctionVector_.at( i ).template get< 0 >( ),
+                                                           updateFunctionVector_.at( i ).template get< 1 >( ),
+                                                           currentStatistics ) );
         }
+        return updateStatistics;
+    }
+
+    //! Function to reset the statistics of the calls to each update function to zero
+    void resetUpdateStatistics( )
+    {
+        updateStatistics_ = std::vector< EnvironmentUpdateStatistics >( updateFunctionVector_.size( ) );
+        numberOfSkippedTimeOnlyUpdates_ = 0;
+    }
+
+    //! Function to retrieve the number of update functions that depend only on time (and not on any integrated state)
+    unsigned int getNumberOfTimeOnlyUpdates( )
+    {
+        return numberOfTimeOnlyUpdates_;
     }
 
 private:
@@ -781,6 +892,72 @@ private:
 
         // Set update order of functions.
         setUpdateFunctionOrder( );
+
+        // Move updates that depend only on time to the start of the lists, retaining the order set above. These updates only
+        // require ephemerides, so that no update in the list has to precede them. No further reordering (e.g. grouping updates per
+        // body for data locality) is done: the order of the update types in updateTimeFunctionList, corrected by
+        // setUpdateFunctionOrder, encodes the dependencies between updates (e.g. flight conditions on body states and rotations).
+        auto updateDependsOnlyOnTime = [ this ]( const auto& update ) {
+            return !isUpdateDependentOnIntegratedStates( update.template get< 0 >( ), update.template get< 1 >( ) );
+        };
+        numberOfTimeOnlyUpdates_ = std::distance(
+                updateFunctionVector_.begin( ),
+                std::stable_partition( updateFunctionVector_.begin( ), updateFunctionVector_.end( ), updateDependsOnlyOnTime ) );
+        numberOfTimeOnlyResets_ = std::distance(
+                resetFunctionVector_.begin( ),
+                std::stable_partition( resetFunctionVector_.begin( ), resetFunctionVector_.end( ), updateDependsOnlyOnTime ) );
+
+        resetUpdateStatistics( );
+    }
+
+    //! Function to check whether an environment update depends on any of the integrated states
+    /*!
+     * Function to check whether an environment update depends on any of the integrated states, or only on time. Only
+     * translational and rotational state updates from (rotational) ephemerides are identified as depending only on time (for
+     * rotations, see simulation_setup::isRotationalEphemerisDependentOnlyOnTime), all other updates are conservatively assumed
+     * to depend on the integrated states.
+     * \param updateType Type of environment update
+     * \param bodyName Name of body for which the update is performed
+     * \return True if the update depends on the integrated states
+     */
+    bool isUpdateDependentOnIntegratedStates( const EnvironmentModelsToUpdate updateType, const std::string& bodyName )
+    {
+        switch( updateType )
+        {
+            case body_translational_state_update: {
+                std::vector< std::string > integratedTranslationalStates;
+                if( integratedStates_.count( translational_state ) > 0 )
+                {
+                    integratedTranslationalStates = utilities::getFirstTupleEntryVector( integratedStates_.at( translational_state ) );
+                }
+
+                // Check if any body in the chain of ephemeris origins is propagated (with guard against circular definitions).
+                std::string currentBody = bodyName;
+                for( unsigned int i = 0; i <= bodyList_.getMap( ).size( ); i++ )
+                {
+                    if( std::find( integratedTranslationalStates.begin( ), integratedTranslationalStates.end( ), currentBody ) !=
+                        integratedTranslationalStates.end( ) )
+                    {
+                        return true;
+                    }
+                    else if( bodyList_.count( currentBody ) == 0 || bodyList_.at( currentBody )->getIsBodyGlobalFrameOrigin( ) == 1 )
+                    {
+                        return false;
+                    }
+                    else if( bodyList_.at( currentBody )->getEphemeris( ) == nullptr )
+                    {
+                        return true;
+                    }
+                    currentBody = bodyList_.at( currentBody )->getEphemeris( )->getReferenceFrameOrigin( );
+                }
+                return true;
+            }
+            case body_rotational_state_update: {
+                return !simulation_setup::isRotationalEphemerisDependentOnlyOnTime( bodyList_.at( bodyName )->getRotationalEphemeris( ) );
+            }
+            default:
+                return true;
+        }
     }
 
     //! List of body objects, this list encompasses all environment object in the simulation.
@@ -803,6 +980,27 @@ private:
     //! time step).
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( ) > > > resetFunctionVector_;
 
+    //! Number of entries at the start of updateFunctionVector_ that depend only on time
+    unsigned int numberOfTimeOnlyUpdates_;
+
+    //! Number of entries at the start of resetFunctionVector_ that depend only on time
+    unsigned int numberOfTimeOnlyResets_;
+
+    //! Boolean denoting whether updates of models that depend only on time are skipped if already performed at the current time
+    bool useIncrementalUpdates_;
+
+    //! Time to which the models that depend only on time were last updated (NaN if update is to be forced)
+    TimeType timeOfTimeOnlyUpdates_;
+
+    //! Number of calls to updateEnvironment for which the models that depend only on time were not updated
+    long long numberOfSkippedTimeOnlyUpdates_;
+
+    //! Boolean denoting whether the time spent in each update function is to be recorded
+    bool updateTimingIsActive_;
+
+    //! Statistics of the calls to each entry of updateFunctionVector_
+    std::vector< EnvironmentUpdateStatistics > updateStatistics_;
+
     //! Predefined state history iterator for computational efficiency.
     typename std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
             integratedStateIterator_;
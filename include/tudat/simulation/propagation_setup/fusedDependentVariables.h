@@ -0,0 +1,310 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_FUSEDDEPENDENTVARIABLES_H
+#define TUDAT_FUSEDDEPENDENTVARIABLES_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/propagation_setup/propagationOutputSettings.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Types of dependent variable computations that are evaluated directly from the intermediates shared by the fused engine
+enum FusedDependentVariableKernel {
+    relative_position_kernel,
+    relative_velocity_kernel,
+    relative_distance_kernel,
+    relative_speed_kernel,
+    keplerian_state_kernel,
+    modified_equinoctial_state_kernel,
+    tnw_to_inertial_rotation_kernel,
+    rsw_to_inertial_rotation_kernel,
+    inertial_to_body_fixed_rotation_kernel,
+    euler_angles_to_body_fixed_313_kernel,
+    body_fixed_relative_cartesian_position_kernel,
+    body_fixed_relative_spherical_position_kernel
+};
+
+//! Class to evaluate a list of dependent variables, sharing intermediate quantities between the variables
+/*!
+ *  Class to evaluate a list of dependent variables, sharing intermediate quantities between the variables. When adding
+ *  a dependent variable that is supported by this class, it is grouped with the other variables that require the same
+ *  intermediate quantity (relative state of two bodies, or rotation to body-fixed frame of a body). When the variables
+ *  are evaluated, each intermediate is computed once, after which all variables are computed from these intermediates,
+ *  and written directly into the (preallocated) output vector. Dependent variables that are not supported are
+ *  evaluated from their function, as created by getVectorDependentVariableFunction/getDoubleDependentVariableFunction.
+ *  The order of the variables in the output is the order in which they were added to this object.
+ */
+class FusedDependentVariableEngine
+{
+public:
+    //! Constructor
+    FusedDependentVariableEngine( ): totalSize_( 0 ) { }
+
+    //! Function to add a dependent variable that is computed from the intermediates shared in this object, if possible.
+    /*!
+     *  Function to add a dependent variable that is computed from the intermediates shared in this object, if possible.
+     *  \param dependentVariableSettings Settings for the dependent variable
+     *  \param bodies List of bodies to use in simulations (containing full environment).
+     *  \return True if dependent variable is added, false if this type of dependent variable is not supported (in which case
+     *  it should be added through the addDependentVariableFunction function).
+     */
+    bool addFusedDependentVariable( const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
+                                    const simulation_setup::SystemOfBodies& bodies );
+
+    //! Function to add a dependent variable that is computed from its own function
+    /*!
+     *  Function to add a dependent variable that is computed from its own function (not sharing any intermediates)
+     *  \param dependentVariableFunction Function returning the dependent variable
+     *  \param dependentVariableSize Size of the vector returned by dependentVariableFunction
+     */
+    void addDependentVariableFunction( const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+                                       const int dependentVariableSize );
+
+    //! Function to evaluate all dependent variables, and write them into an existing vector (or matrix row)
+    /*!
+     *  Function to evaluate all dependent variables, and write them into an existing vector (or matrix row). NOTE: the
+     *  environment and state derivative models need to be updated to the current state and time before calling this function.
+     *  \param dependentVariables Vector (or transposed row of a column-major matrix) of size getTotalSize( ) in which the
+     *  dependent variables are to be stored
+     */
+    void evaluateDependentVariables( Eigen::Ref< Eigen::VectorXd, 0, Eigen::InnerStride< > > dependentVariables );
+
+    //! Function to evaluate all dependent variables, and return them in a new vector
+    /*!
+     *  Function to evaluate all dependent variables, and return them in a new vector
+     *  \return Vector of concatenated dependent variables
+     */
+    Eigen::VectorXd getDependentVariables( )
+    {
+        Eigen::VectorXd dependentVariables( totalSize_ );
+        evaluateDependentVariables( dependentVariables );
+        return dependentVariables;
+    }
+
+    //! Function to retrieve the total size of the concatenated dependent variables
+    int getTotalSize( )
+    {
+        return totalSize_;
+    }
+
+    //! Function to retrieve the number of dependent variables computed from the shared intermediates
+    int getNumberOfFusedDependentVariables( )
+    {
+        return static_cast< int >( fusedDependentVariables_.size( ) );
+    }
+
+    //! Function to retrieve the number of intermediates (relative states and rotations) computed per evaluation
+    int getNumberOfSharedIntermediates( )
+    {
+        return static_cast< int >( relativeStateBodies_.size( ) + rotationBodies_.size( ) );
+    }
+
+protected:
+    //! Properties of a dependent variable computed from the shared intermediates
+    struct FusedDependentVariable {
+        //! Type of computation for the dependent variable
+        FusedDependentVariableKernel kernel;
+
+        //! Index of the relative state intermediate that is used (-1 if none)
+        int relativeStateIndex;
+
+        //! Index of the rotation intermediate that is used (-1 if none)
+        int rotationIndex;
+
+        //! Index of the component of the variable that is saved (-1 if full variable is saved)
+        int componentIndex;
+
+        //! Start index of the variable in the output vector
+        int outputIndex;
+
+        //! Function returning the gravitational parameter (only used for conversion to orbital elements)
+        std::function< double( ) > gravitationalParameterFunction;
+    };
+
+    //! Function to retrieve the index of a relative state intermediate, creating it if it does not yet exist
+    /*!
+     *  Function to retrieve the index of a relative state intermediate, creating it if it does not yet exist
+     *  \param body Body of which the state is to be computed
+     *  \param centralBody Body w.r.t. which the state is to be computed (nullptr if the state w.r.t. the global frame origin is used)
+     *  \return Index of the relative state intermediate
+     */
+    int getRelativeStateIntermediateIndex( const std::shared_ptr< simulation_setup::Body > body,
+                                           const std::shared_ptr< simulation_setup::Body > centralBody );
+
+    //! Function to retrieve the index of a rotation intermediate, creating it if it does not yet exist
+    /*!
+     *  Function to retrieve the index of a rotation intermediate, creating it if it does not yet exist
+     *  \param body Body of which the rotation from inertial to body-fixed frame is to be computed
+     *  \return Index of the rotation intermediate
+     */
+    int getRotationIntermediateIndex( const std::shared_ptr< simulation_setup::Body > body );
+
+    //! Function to compute a single dependent variable from the current intermediates
+    /*!
+     *  Function to compute a single dependent variable from the current intermediates
+     *  \param dependentVariable Dependent variable that is to be computed
+     *  \param dependentVariableValue Full value of the dependent variable (returned by reference)
+     *  \return Size of the full value of the dependent variable
+     */
+    int computeFusedDependentVariable( const FusedDependentVariable& dependentVariable,
+                                       Eigen::Matrix< double, 9, 1 >& dependentVariableValue );
+
+    //! Pairs of bodies for which relative states are computed (second entry nullptr for state w.r.t. global frame origin)
+    std::vector< std::pair< std::shared_ptr< simulation_setup::Body >, std::shared_ptr< simulation_setup::Body > > >
+            relativeStateBodies_;
+
+    //! Relative states of relativeStateBodies_, as computed during last evaluation
+    std::vector< Eigen::Vector6d > currentRelativeStates_;
+
+    //! Bodies for which the rotation from inertial to body-fixed frame is retrieved
+    std::vector< std::shared_ptr< simulation_setup::Body > > rotationBodies_;
+
+    //! Rotations from inertial to body-fixed frame of rotationBodies_, as retrieved during last evaluation
+    std::vector< Eigen::Quaterniond > currentRotations_;
+
+    //! List of dependent variables computed from the shared intermediates
+    std::vector< FusedDependentVariable > fusedDependentVariables_;
+
+    //! List of dependent variable functions that are evaluated separately (with start index and size in output vector)
+    std::vector< std::pair< std::function< Eigen::VectorXd( ) >, std::pair< int, int > > > dependentVariableFunctions_;
+
+    //! Total size of the concatenated dependent variables
+    int totalSize_;
+};
+
+//! Class to store the history of dependent variables in columnar form, with one row per epoch
+/*!
+ *  Class to store the history of dependent variables in columnar form, with one row per epoch. The storage is preallocated,
+ *  and grows geometrically if its capacity is exceeded, so that adding an epoch requires no memory allocation in general.
+ *  The dependent variables of each epoch are written directly into the row by the FusedDependentVariableEngine, and the full
+ *  history of a single (component of a) dependent variable can be retrieved as a contiguous column.
+ */
+template< typename TimeType = double >
+class ColumnarDependentVariableHistory
+{
+public:
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfVariables Number of (scalar) entries in the concatenated dependent variable vector
+     *  \param initialCapacity Number of epochs for which memory is preallocated
+     */
+    ColumnarDependentVariableHistory( const int numberOfVariables, const int initialCapacity = 1024 ):
+        numberOfEpochs_( 0 ), values_( std::max( initialCapacity, 1 ), numberOfVariables )
+    {
+        times_.reserve( values_.rows( ) );
+    }
+
+    //! Function to add an epoch to the history, and evaluate the dependent variables directly into its row
+    /*!
+     *  Function to add an epoch to the history, and evaluate the dependent variables directly into its row
+     *  \param time Current time
+     *  \param dependentVariableEngine Object used to evaluate the dependent variables (environment must be updated to time)
+     */
+    void addEpoch( const TimeType time, FusedDependentVariableEngine& dependentVariableEngine )
+    {
+        if( dependentVariableEngine.getTotalSize( ) != values_.cols( ) )
+        {
+            throw std::runtime_error( "Error when adding epoch to dependent variable history, size of dependent variables (" +
+                                      std::to_string( dependentVariableEngine.getTotalSize( ) ) + ") is inconsistent with history (" +
+                                      std::to_string( values_.cols( ) ) + ")" );
+        }
+        dependentVariableEngine.evaluateDependentVariables( addEpochRow( time ).transpose( ) );
+    }
+
+    //! Function to add an epoch to the history, and return the (uninitialized) row in which the values are to be stored
+    /*!
+     *  Function to add an epoch to the history, and return the (uninitialized) row in which the values are to be stored
+     *  \param time Current time
+     *  \return Row of the history in which the values at the current epoch are to be stored.
+     */
+    Eigen::Block< Eigen::MatrixXd, 1, Eigen::Dynamic > addEpochRow( const TimeType time )
+    {
+        if( numberOfEpochs_ == values_.rows( ) )
+        {
+            values_.conservativeResize( 2 * values_.rows( ), Eigen::NoChange );
+        }
+        times_.push_back( time );
+        numberOfEpochs_++;
+        return values_.row( numberOfEpochs_ - 1 );
+    }
+
+    //! Function to retrieve the number of epochs in the history
+    int getNumberOfEpochs( ) const
+    {
+        return numberOfEpochs_;
+    }
+
+    //! Function to retrieve the list of epochs in the history
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the dependent variables at all epochs (one row per epoch)
+    Eigen::Block< const Eigen::MatrixXd > getValues( ) const
+    {
+        return values_.topRows( numberOfEpochs_ );
+    }
+
+    //! Function to retrieve the history of a single entry of the dependent variable vector, as a contiguous column
+    Eigen::VectorBlock< const Eigen::MatrixXd::ConstColXpr > getVariableHistory( const int variableIndex ) const
+    {
+        return values_.col( variableIndex ).head( numberOfEpochs_ );
+    }
+
+    //! Function to retrieve the history as a map, in the format used by the single-arc propagation results
+    std::map< TimeType, Eigen::VectorXd > getDependentVariableHistoryMap( ) const
+    {
+        std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
+        for( int i = 0; i < numberOfEpochs_; i++ )
+        {
+            dependentVariableHistory[ times_.at( i ) ] = values_.row( i ).transpose( );
+        }
+        return dependentVariableHistory;
+    }
+
+    //! Function to remove all epochs from the history (keeping the allocated memory)
+    void clear( )
+    {
+        numberOfEpochs_ = 0;
+        times_.clear( );
+    }
+
+private:
+    //! Number of epochs currently stored in the history
+    int numberOfEpochs_;
+
+    //! Epochs stored in the history
+    std::vector< TimeType > times_;
+
+    //! Dependent variable values (one row per epoch, rows beyond numberOfEpochs_ are unused)
+    Eigen::MatrixXd values_;
+};
+
+}  // namespace propagators
+
+}  // namespace tudat
+
+#endif  // TUDAT_FUSEDDEPENDENTVARIABLES_H
@@ -21,6 +21,7 @@
 #include "tudat/astro/propagators/rotationalMotionStateDerivative.h"
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/simulation/environment_setup/createGroundStations.h"
+#include "tudat/simulation/propagation_setup/fusedDependentVariables.h"
 #include "tudat/simulation/propagation_setup/propagationOutputSettings.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
 #include "tudat/simulation/environment_setup/createFlightConditions.h"
@@ -3009,7 +3010,8 @@ Eigen::VectorXd evaluateListOfVectorFunctions(
 /*!
  *  Function to create a function that evaluates a list of dependent variables and concatenates the results.
  *  Dependent variables functions are created inside this function from a list of settings on their required
- *  types/properties.
+ *  types/properties. The variables are evaluated by a FusedDependentVariableEngine, so that relative states and
+ *  rotations shared by several variables are computed only once per evaluation.
  *  \param saveSettings Object containing types and other properties of dependent variables.
  *  \param bodies List of bodies to use in simulations (containing full environment).
  *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key)
@@ -3028,15 +3030,20 @@ std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >,
         const std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >& stateDerivativePartials =
                 std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >( ) )
 {
-    // create list of vector parameters
-    std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList;
+    // Create object to evaluate dependent variables, sharing intermediates where possible
+    std::shared_ptr< FusedDependentVariableEngine > dependentVariableEngine = std::make_shared< FusedDependentVariableEngine >( );
     std::vector< std::pair< std::string, int > > vectorVariableList;
 
     for( std::shared_ptr< SingleDependentVariableSaveSettings > variable: dependentVariables )
     {
         std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction;
+        // Add variable computed from shared intermediates
+        if( dependentVariableEngine->addFusedDependentVariable( variable, bodies ) )
+        {
+            vectorFunction.second = getDependentVariableSaveSize( variable, bodies );
+        }
         // Create double parameter
-        if( isScalarDependentVariable( variable, bodies ) )
+        else if( isScalarDependentVariable( variable, bodies ) )
         {
 #if( TUDAT_BUILD_WITH_ESTIMATION_TOOLS )
             std::function< double( ) > doubleFunction =
@@ -3045,6 +3052,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >,
             std::function< double( ) > doubleFunction = getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels );
 #endif
             vectorFunction = std::make_pair( std::bind( &getVectorFromDoubleFunction, doubleFunction ), 1 );
+            dependentVariableEngine->addDependentVariableFunction( vectorFunction.first, vectorFunction.second );
         }
         // Create vector parameter
         else
@@ -3054,8 +3062,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >,
 #else
             vectorFunction = getVectorDependentVariableFunction( variable, bodies, stateDerivativeModels );
 #endif
+            dependentVariableEngine->addDependentVariableFunction( vectorFunction.first, vectorFunction.second );
         }
-        vectorFunctionList.push_back( vectorFunction );
         vectorVariableList.push_back( std::make_pair( getDependentVariableId( variable ), vectorFunction.second ) );
     }
 
@@ -3072,8 +3080,17 @@ std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >,
         totalVariableSize += vectorVariable.second;
     }
 
-    // Create function conatenating function results.
-    return std::make_pair( std::bind( &evaluateListOfVectorFunctions, vectorFunctionList, totalVariableSize ), dependentVariableIds );
+    // Check consistency of sizes
+    if( totalVariableSize != dependentVariableEngine->getTotalSize( ) )
+    {
+        throw std::runtime_error( "Error when creating dependent variable function, sizes are inconsistent: " +
+                                  std::to_string( totalVariableSize ) + " and " +
+                                  std::to_string( dependentVariableEngine->getTotalSize( ) ) );
+    }
+
+    // Create function concatenating results.
+    return std::make_pair( std::bind( &FusedDependentVariableEngine::getDependentVariables, dependentVariableEngine ),
+                           dependentVariableIds );
 }
 
 }  // namespace propagators
@@ -8,6 +8,7 @@
 #include <map>
 #include <string>
 
+#include "tudat/math/integrators/integrationEventLocator.h"
 #include "tudat/simulation/propagation_setup/propagationProcessingSettings.h"
 #include "tudat/simulation/propagation_setup/propagationTermination.h"
 #include "tudat/simulation/propagation_setup/dependentVariablesInterface.h"
@@ -67,6 +68,9 @@ public:
     static const bool is_variational = false;
     static const int number_of_columns = 1;
 
+    //! Typedef for an event that was located during the propagation.
+    typedef numerical_integrators::LocatedIntegrationEvent< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > LocatedEvent;
+
     SingleArcSimulationResults(
             const std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > >
                     integratedStateAndBodyList,
@@ -105,6 +109,7 @@ public:
         solutionIsCleared_ = false;
         onlyProcessedSolutionSet_ = false;
         propagationTerminationReason_ = std::make_shared< PropagationTerminationDetails >( propagation_never_run );
+        locatedIntegrationEvents_.clear( );
     }
 
     void manuallySetSecondaryData( const std::shared_ptr< SingleArcSimulationResults< StateScalarType, TimeType > > resultsToCopy )
@@ -113,6 +118,7 @@ public:
         cumulativeComputationTimeHistory_ = resultsToCopy->getCumulativeComputationTimeHistoryTimeType( );
         cumulativeNumberOfFunctionEvaluations_ = resultsToCopy->getCumulativeNumberOfFunctionEvaluationsTimeType( );
         propagationTerminationReason_ = resultsToCopy->getPropagationTerminationReason( );
+        locatedIntegrationEvents_ = resultsToCopy->getLocatedIntegrationEvents( );
         propagationIsPerformed_ = true;
     }
 
@@ -307,6 +313,33 @@ public:
         return propagationTerminationReason_;
     }
 
+    //! Function to set the events that were located during the propagation.
+    void setLocatedIntegrationEvents( const std::vector< LocatedEvent >& locatedIntegrationEvents )
+    {
+        locatedIntegrationEvents_ = locatedIntegrationEvents;
+    }
+
+    //! Function to retrieve the events that were located during the propagation (see
+    //! SingleArcPropagatorSettings::setIntegrationEventSettings), in order of occurrence for each propagation direction.
+    const std::vector< LocatedEvent >& getLocatedIntegrationEvents( ) const
+    {
+        return locatedIntegrationEvents_;
+    }
+
+    //! Function to retrieve the events with a given name that were located during the propagation.
+    std::vector< LocatedEvent > getLocatedIntegrationEvents( const std::string& eventName ) const
+    {
+        std::vector< LocatedEvent > locatedIntegrationEvents;
+        for( unsigned int i = 0; i < locatedIntegrationEvents_.size( ); i++ )
+        {
+            if( locatedIntegrationEvents_.at( i ).eventName_ == eventName )
+            {
+                locatedIntegrationEvents.push_back( locatedIntegrationEvents_.at( i ) );
+            }
+        }
+        return locatedIntegrationEvents;
+    }
+
     bool integrationCompletedSuccessfully( ) const
     {
         return ( propagationTerminationReason_->getPropagationTerminationReason( ) == termination_condition_reached );
@@ -476,6 +509,9 @@ private:
     //! Event that triggered the termination of the propagation
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason_;
 
+    //! Events that were located during the propagation, in order of occurrence for each propagation direction.
+    std::vector< LocatedEvent > locatedIntegrationEvents_;
+
     friend class SingleArcDynamicsSimulator< StateScalarType, TimeType >;
 
     //            friend class MultiArcSimulationResults<StateScalarType, TimeType, NumberOfStateColumns >;
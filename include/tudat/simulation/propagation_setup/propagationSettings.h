@@ -28,6 +28,7 @@
 #include "tudat/astro/propagators/nBodyStateDerivative.h"
 #include "tudat/astro/propagators/rotationalMotionStateDerivative.h"
 #include "tudat/math/integrators/createNumericalIntegrator.h"
+#include "tudat/math/integrators/integrationEventLocator.h"
 #include "tudat/simulation/propagation_setup/propagationOutputSettings.h"
 #include "tudat/simulation/propagation_setup/propagationTerminationSettings.h"
 #include "tudat/simulation/propagation_setup/createAccelerationModels.h"
@@ -175,6 +176,9 @@ template< typename StateScalarType = double, typename TimeType = double >
 class SingleArcPropagatorSettings : public PropagatorSettings< StateScalarType >
 {
 public:
+    //! Typedef for settings of an event that is to be located during the propagation.
+    typedef numerical_integrators::IntegrationEventSettings< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > EventSettings;
+
     //! Constructor
     /*!
      * Constructor
@@ -330,6 +334,30 @@ public:
         initialTime_ = initialTime;
     }
 
+    //! Function to retrieve settings for the events that are to be located during the propagation (default none).
+    /*!
+     * Function to retrieve settings for the events that are to be located during the propagation (default none).
+     * \return Settings for the events that are to be located during the propagation.
+     */
+    std::vector< std::shared_ptr< EventSettings > > getIntegrationEventSettings( )
+    {
+        return integrationEventSettings_;
+    }
+
+    //! Function to set settings for the events that are to be located during the propagation.
+    /*!
+     * Function to set settings for the events that are to be located during the propagation. The event functions are evaluated
+     * using the propagated state (e.g. Cartesian elements w.r.t. the central bodies for a Cowell propagator), and located events
+     * are stored in the SingleArcSimulationResults. If an event is terminal, the propagation is terminated at the event. Events
+     * can only be located if the integrator provides dense output (see NumericalIntegrator::getDenseOutputState), and the times
+     * and states of located events have the accuracy of the dense output (see IntegrationEventLocator).
+     * \param integrationEventSettings Settings for the events that are to be located during the propagation.
+     */
+    void setIntegrationEventSettings( const std::vector< std::shared_ptr< EventSettings > >& integrationEventSettings )
+    {
+        integrationEventSettings_ = integrationEventSettings;
+    }
+
 protected:
     //!Type of state being propagated
     IntegratedStateType stateType_;
@@ -350,6 +378,9 @@ protected:
     //! current state and time are to be printed to console (default never).
     double statePrintInterval_;
 
+    //! Settings for the events that are to be located during the propagation (default none).
+    std::vector< std::shared_ptr< EventSettings > > integrationEventSettings_;
+
 private:
     void resetSingleArcOutputSettings( const std::shared_ptr< SingleArcPropagatorProcessingSettings > outputSettings )
     {
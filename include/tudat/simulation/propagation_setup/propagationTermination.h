@@ -225,6 +225,8 @@ public:
      * \param checkTerminationToExactCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
      * \param terminationRootFinderSettings Settings to create root finder used to converge on exact final condition.
+     * \param locateTerminationOnDenseOutput Boolean denoting whether the exact final condition is to be located on the dense
+     * output of the integrator (if available), instead of by repeatedly redoing the last integration step.
      */
     SingleVariableLimitPropagationTerminationCondition(
             const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
@@ -232,11 +234,12 @@ public:
             const double limitingValue,
             const bool useAsLowerBound,
             const bool checkTerminationToExactCondition = false,
-            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr ):
+            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr,
+            const bool locateTerminationOnDenseOutput = false ):
         PropagationTerminationCondition( dependent_variable_stopping_condition, checkTerminationToExactCondition ),
         dependentVariableSettings_( dependentVariableSettings ), variableRetrievalFunction_( variableRetrievalFuntion ),
         limitingValue_( limitingValue ), useAsLowerBound_( useAsLowerBound ),
-        terminationRootFinderSettings_( terminationRootFinderSettings )
+        terminationRootFinderSettings_( terminationRootFinderSettings ), locateTerminationOnDenseOutput_( locateTerminationOnDenseOutput )
     {
         if( ( checkTerminationToExactCondition == false ) && ( terminationRootFinderSettings != nullptr ) )
         {
@@ -285,6 +288,16 @@ public:
         return terminationRootFinderSettings_;
     }
 
+    //! Function to retrieve whether the exact final condition is to be located on the dense output of the integrator.
+    /*!
+     *  Function to retrieve whether the exact final condition is to be located on the dense output of the integrator (if available).
+     *  \return Boolean denoting whether the exact final condition is to be located on the dense output of the integrator.
+     */
+    bool getLocateTerminationOnDenseOutput( )
+    {
+        return locateTerminationOnDenseOutput_;
+    }
+
 private:
     //! Settings for dependent variable that is to be checked
     std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings_;
@@ -301,6 +314,9 @@ private:
 
     //! Settings to create root finder used to converge on exact final condition.
     std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings_;
+
+    //! Boolean denoting whether the exact final condition is to be located on the dense output of the integrator (if available).
+    bool locateTerminationOnDenseOutput_;
 };
 
 //! Class for stopping the propagation with custom stopping function.
@@ -543,7 +559,8 @@ std::shared_ptr< PropagationTerminationCondition > createPropagationTerminationC
                     dependentVariableTerminationSettings->limitValue_,
                     dependentVariableTerminationSettings->useAsLowerLimit_,
                     dependentVariableTerminationSettings->checkTerminationToExactCondition_,
-                    dependentVariableTerminationSettings->terminationRootFinderSettings_ );
+                    dependentVariableTerminationSettings->terminationRootFinderSettings_,
+                    dependentVariableTerminationSettings->locateTerminationOnDenseOutput_ );
             break;
         }
         case custom_stopping_condition: {
@@ -137,16 +137,19 @@ public:
      * \param checkTerminationToExactCondition Boolean to denote whether the propagation is to terminate exactly on the final
      * condition, or whether it is to terminate on the first step where it is violated.
      * \param terminationRootFinderSettings Settings to create root finder used to converge on exact final condition.
+     * \param locateTerminationOnDenseOutput Boolean denoting whether the exact final condition is to be located on the dense
+     * output of the integrator (if available), instead of by repeatedly redoing the last integration step.
      */
     PropagationDependentVariableTerminationSettings(
             const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
             const double limitValue,
             const bool useAsLowerLimit,
             const bool checkTerminationToExactCondition = false,
-            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr ):
+            const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr,
+            const bool locateTerminationOnDenseOutput = false ):
         PropagationTerminationSettings( dependent_variable_stopping_condition, checkTerminationToExactCondition ),
         dependentVariableSettings_( dependentVariableSettings ), limitValue_( limitValue ), useAsLowerLimit_( useAsLowerLimit ),
-        terminationRootFinderSettings_( terminationRootFinderSettings )
+        terminationRootFinderSettings_( terminationRootFinderSettings ), locateTerminationOnDenseOutput_( locateTerminationOnDenseOutput )
     {
         if( checkTerminationToExactCondition_ && ( terminationRootFinderSettings_ == nullptr ) )
         {
@@ -170,6 +173,9 @@ public:
 
     //! Settings to create root finder used to converge on exact final condition.
     std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings_;
+
+    //! Boolean denoting whether the exact final condition is to be located on the dense output of the integrator (if available).
+    bool locateTerminationOnDenseOutput_;
 };
 
 //! Class for propagation stopping conditions settings: stopping the propagation based on custom requirements
@@ -281,10 +287,15 @@ inline std::shared_ptr< PropagationTerminationSettings > propagationDependentVar
         const double limitValue,
         const bool useAsLowerLimit,
         const bool checkTerminationToExactCondition = false,
-        const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr )
+        const std::shared_ptr< root_finders::RootFinderSettings > terminationRootFinderSettings = nullptr,
+        const bool locateTerminationOnDenseOutput = false )
 {
-    return std::make_shared< PropagationDependentVariableTerminationSettings >(
-            dependentVariableSettings, limitValue, useAsLowerLimit, checkTerminationToExactCondition, terminationRootFinderSettings );
+    return std::make_shared< PropagationDependentVariableTerminationSettings >( dependentVariableSettings,
+                                                                                limitValue,
+                                                                                useAsLowerLimit,
+                                                                                checkTerminationToExactCondition,
+                                                                                terminationRootFinderSettings,
+                                                                                locateTerminationOnDenseOutput );
 }
 
 inline std::shared_ptr< PropagationTerminationSettings > propagationTimeTerminationSettings(
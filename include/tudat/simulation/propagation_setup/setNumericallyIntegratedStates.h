@@ -388,6 +388,9 @@ void resetIntegratedEphemerides(
                                              ephemerisUpdateOrder,
                                              equationsOfMotionNumericalSolution,
                                              integrationToEphemerisFrameFunctions );
+
+    // Remove states computed from previous ephemerides from epoch caches
+    bodies.clearEphemerisCaches( );
 }
 
 //! Resets the ephemerides of the integrated bodies from the numerical multi-arc integration results.
@@ -527,6 +530,9 @@ void resetMultiArcIntegratedEphemerides(
         }
     }
 
+    // Remove states computed from previous ephemerides from epoch caches
+    bodies.clearEphemerisCaches( );
+
     // Having set new ephemerides, update body properties depending on ephemerides.
     for( auto bodyIterator: bodies.getMap( ) )
     {
@@ -672,6 +678,9 @@ void resetIntegratedRotationalEphemerides(
     createAndSetInterpolatorsForRotationalEphemerides(
             bodies, bodiesToIntegrate, startIndexAndSize.first, equationsOfMotionNumericalSolution );
 
+    // Remove rotations computed from previous ephemerides from epoch caches
+    bodies.clearEphemerisCaches( );
+
     // Having set new ephemerides, update body properties depending on ephemerides.
     for( auto bodyIterator: bodies.getMap( ) )
     {
@@ -14,6 +14,7 @@
  */
 
 #include <string>
+#include <thread>
 
 #include <functional>
 #include <boost/lambda/lambda.hpp>
@@ -167,7 +168,8 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const double referenceArea,
         const double referenceLength,
         const Eigen::Vector3d& momentReferencePoint,
-        const bool savePressureCoefficients ):
+        const bool savePressureCoefficients,
+        const int numberOfThreads ):
     AerodynamicCoefficientGenerator< 3, 6 >( dataPointsOfIndependentVariables,
                                              referenceLength,
                                              referenceArea,
@@ -175,9 +177,15 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
                                              { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent },
                                              positive_aerodynamic_frame_coefficients,
                                              positive_aerodynamic_frame_coefficients ),
-    stagnationPressureCoefficient( 2.0 ), ratioOfSpecificHeats( 1.4 ), selectedMethods_( selectedMethods ),
+    ratioOfSpecificHeats( 1.4 ), selectedMethods_( selectedMethods ), numberOfThreads_( numberOfThreads ),
     savePressureCoefficients_( savePressureCoefficients )
 {
+    if( numberOfThreads_ < 1 )
+    {
+        throw std::runtime_error( "Error in hypersonic local inclination analysis, number of threads must be at least 1, found " +
+                                  std::to_string( numberOfThreads_ ) );
+    }
+
     // Set geometry if it is a single surface.
     if( std::dynamic_pointer_cast< SingleSurfaceGeometry >( inputVehicleSurface ) != std::shared_ptr< SingleSurfaceGeometry >( ) )
     {
@@ -238,19 +246,7 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
-    inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for( unsigned int i = 0; i < vehicleParts_.size( ); i++ )
-    {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for( int j = 0; j < vehicleParts_[ i ]->getNumberOfLines( ); j++ )
-        {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-        }
-    }
+    setFlattenedPanelProperties( );
 
     boost::array< int, 3 > numberOfPointsPerIndependentVariables;
     for( int i = 0; i < 3; i++ )
@@ -281,23 +277,71 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
+    // Create list of all combinations of angle of attack and sideslip; each is processed for all Mach numbers.
+    std::vector< std::pair< int, int > > attitudeIndices;
+    for( unsigned int j = 0; j < dataPointsOfIndependentVariables_[ 1 ].size( ); j++ )
+    {
+        for( unsigned int k = 0; k < dataPointsOfIndependentVariables_[ 2 ].size( ); k++ )
+        {
+            attitudeIndices.push_back( std::make_pair( j, k ) );
+        }
+    }
 
-    // Iterate over all combinations of independent variables.
-    for( unsigned int i = 0; i < dataPointsOfIndependentVariables_[ 0 ].size( ); i++ )
+    int numberOfThreads = std::min( numberOfThreads_, static_cast< int >( attitudeIndices.size( ) ) );
+    if( numberOfThreads <= 1 )
     {
-        independentVariableIndices[ 0 ] = i;
-        for( unsigned int j = 0; j < dataPointsOfIndependentVariables_[ 1 ].size( ); j++ )
+        generateCoefficientsForAttitudes( attitudeIndices );
+    }
+    else
+    {
+        // Distribute attitudes over threads, each thread computing a contiguous block of attitudes
+        std::vector< std::thread > threads;
+        int numberOfAttitudes = attitudeIndices.size( );
+        for( int i = 0; i < numberOfThreads; i++ )
         {
-            independentVariableIndices[ 1 ] = j;
-            for( unsigned int k = 0; k < dataPointsOfIndependentVariables_[ 2 ].size( ); k++ )
-            {
-                independentVariableIndices[ 2 ] = k;
+            std::vector< std::pair< int, int > > currentAttitudeIndices(
+                    attitudeIndices.begin( ) + ( i * numberOfAttitudes ) / numberOfThreads,
+                    attitudeIndices.begin( ) + ( ( i + 1 ) * numberOfAttitudes ) / numberOfThreads );
+            threads.emplace_back( [ this, currentAttitudeIndices ]( ) { generateCoefficientsForAttitudes( currentAttitudeIndices ); } );
+        }
+        for( auto& thread: threads )
+        {
+            thread.join( );
+        }
+    }
+}
+
+//! Generate aerodynamic coefficients for a list of attitudes, at all Mach numbers.
+void HypersonicLocalInclinationAnalysis::generateCoefficientsForAttitudes( const std::vector< std::pair< int, int > >& attitudeIndices )
+{
+    // Thread-local panel buffers
+    std::vector< Eigen::ArrayXd > panelInclinations( vehicleParts_.size( ) );
+    std::vector< Eigen::ArrayXd > panelPressureCoefficients( vehicleParts_.size( ) );
+
+    boost::array< int, 3 > independentVariableIndices;
+    for( unsigned int i = 0; i < attitudeIndices.size( ); i++ )
+    {
+        independentVariableIndices[ 1 ] = attitudeIndices.at( i ).first;
+        independentVariableIndices[ 2 ] = attitudeIndices.at( i ).second;
+
+        // Panel inclinations are independent of Mach number, and computed once per attitude.
+        determinePanelInclinations( dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                                    dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ],
+                                    panelInclinations );
 
-                determineVehicleCoefficients( independentVariableIndices );
+        for( unsigned int j = 0; j < dataPointsOfIndependentVariables_[ 0 ].size( ); j++ )
+        {
+            independentVariableIndices[ 0 ] = j;
+
+            determinePanelPressureCoefficients(
+                    dataPointsOfIndependentVariables_[ 0 ][ j ], panelInclinations, panelPressureCoefficients );
+            if( savePressureCoefficients_ )
+            {
+                savePanelPressureCoefficients( independentVariableIndices, panelPressureCoefficients );
             }
+
+            aerodynamicCoefficients_( independentVariableIndices ) = calculateCoefficientsFromPressures( panelPressureCoefficients );
+            isCoefficientGenerated_( independentVariableIndices ) = 1;
         }
     }
 }
@@ -305,321 +349,287 @@ void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 //! Generate aerodynamic coefficients at a single set of independent variables.
 void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices )
 {
-    // Declare coefficients vector and initialize to zeros.
-    Vector6d coefficients = Vector6d::Zero( );
+    std::vector< Eigen::ArrayXd > panelInclinations( vehicleParts_.size( ) );
+    std::vector< Eigen::ArrayXd > panelPressureCoefficients( vehicleParts_.size( ) );
 
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
-    for( unsigned int i = 0; i < vehicleParts_.size( ); i++ )
-    {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
-    }
+    determinePanelInclinations( dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                                dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ],
+                                panelInclinations );
+    determinePanelPressureCoefficients( dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                                        panelInclinations,
+                                        panelPressureCoefficients );
 
     if( savePressureCoefficients_ )
     {
-        pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficient_;
+        savePanelPressureCoefficients( independentVariableIndices, panelPressureCoefficients );
     }
 
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
+    aerodynamicCoefficients_( independentVariableIndices ) = calculateCoefficientsFromPressures( panelPressureCoefficients );
     isCoefficientGenerated_( independentVariableIndices ) = 1;
 }
 
-//! Determine aerodynamic coefficients of a single vehicle part.
-Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients( const int partNumber,
-                                                                        const boost::array< int, 3 > independentVariableIndices )
+//! Set the panel properties of all parts in contiguous arrays.
+void HypersonicLocalInclinationAnalysis::setFlattenedPanelProperties( )
 {
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack = dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ];
+    panelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    panelCoefficientContributions_.resize( vehicleParts_.size( ) );
 
-    double angleOfSideslip = dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ];
-
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if( previouslyComputedInclinations_.count( std::pair< double, double >( angleOfAttack, angleOfSideslip ) ) == 0 )
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
+        int numberOfLinePanels = vehicleParts_[ k ]->getNumberOfLines( ) - 1;
+        int numberOfPointPanels = vehicleParts_[ k ]->getNumberOfPoints( ) - 1;
+        int numberOfPanels = std::max( numberOfLinePanels * numberOfPointPanels, 0 );
 
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >( angleOfAttack, angleOfSideslip ) ] = inclination_;
-    }
+        panelSurfaceNormals_[ k ].resize( 3, numberOfPanels );
+        panelCoefficientContributions_[ k ].resize( 6, numberOfPanels );
 
-    else
-    {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >( angleOfAttack, angleOfSideslip ) ];
+        int panelIndex = 0;
+        for( int i = 0; i < numberOfLinePanels; i++ )
+        {
+            for( int j = 0; j < numberOfPointPanels; j++ )
+            {
+                Eigen::Vector3d surfaceNormal = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j );
+                double panelArea = vehicleParts_[ k ]->getPanelArea( i, j );
+                Eigen::Vector3d referenceDistance = vehicleParts_[ k ]->getPanelCentroid( i, j ) - momentReferencePoint_;
+
+                panelSurfaceNormals_[ k ].col( panelIndex ) = surfaceNormal;
+                panelCoefficientContributions_[ k ].block( 0, panelIndex, 3, 1 ) = -panelArea * surfaceNormal / referenceArea_;
+                panelCoefficientContributions_[ k ].block( 3, panelIndex, 3, 1 ) =
+                        -panelArea * referenceDistance.cross( surfaceNormal ) / ( referenceLength_ * referenceArea_ );
+                panelIndex++;
+            }
+        }
     }
-
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
-
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
-
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
-
-    return partCoefficients;
 }
 
-//! Determine the pressure coefficients on a single vehicle part.
-void HypersonicLocalInclinationAnalysis::determinePressureCoefficients( const int partNumber,
-                                                                        const boost::array< int, 3 > independentVariableIndices )
+//! Determine inclination angles of panels on all parts, stored in contiguous arrays.
+void HypersonicLocalInclinationAnalysis::determinePanelInclinations( const double angleOfAttack,
+                                                                     const double angleOfSideslip,
+                                                                     std::vector< Eigen::ArrayXd >& panelInclinations ) const
 {
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ];
-
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure( machNumber, ratioOfSpecificHeats );
+    // Set freestream velocity vector in body frame.
+    Eigen::Vector3d freestreamVelocityDirection;
+    freestreamVelocityDirection( 0 ) = cos( angleOfAttack ) * cos( angleOfSideslip );
+    freestreamVelocityDirection( 1 ) = sin( angleOfSideslip );
+    freestreamVelocityDirection( 2 ) = sin( angleOfAttack ) * cos( angleOfSideslip );
 
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
+    panelInclinations.resize( vehicleParts_.size( ) );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
+    {
+        // Inclination from inner product between surface normal and free-stream direction.
+        panelInclinations[ k ] =
+                PI / 2.0 - ( panelSurfaceNormals_[ k ].transpose( ) * freestreamVelocityDirection ).array( ).acos( );
+    }
 }
 
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients( const int partNumber )
+//! Determine pressure coefficients of panels on all parts, stored in contiguous arrays.
+void HypersonicLocalInclinationAnalysis::determinePanelPressureCoefficients(
+        const double machNumber,
+        const std::vector< Eigen::ArrayXd >& panelInclinations,
+        std::vector< Eigen::ArrayXd >& panelPressureCoefficients ) const
 {
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
-
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
-    for( int i = 0; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    panelPressureCoefficients.resize( vehicleParts_.size( ) );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for( int j = 0; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1; j++ )
-        {
-            forceCoefficients -= pressureCoefficient_[ partNumber ][ i ][ j ] * vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
-        }
+        panelPressureCoefficients[ k ].setZero( panelInclinations[ k ].size( ) );
+        updateCompressionPressures( machNumber, k, panelInclinations[ k ], panelPressureCoefficients[ k ] );
+        updateExpansionPressures( machNumber, k, panelInclinations[ k ], panelPressureCoefficients[ k ] );
     }
-
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
-
-    return forceCoefficients;
 }
 
-//! Determine moment coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients( const int partNumber )
+//! Determine force and moment coefficients from panel pressure coefficients of all parts.
+Vector6d HypersonicLocalInclinationAnalysis::calculateCoefficientsFromPressures(
+        const std::vector< Eigen::ArrayXd >& panelPressureCoefficients ) const
 {
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
-
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance;
+    Vector6d coefficients = Vector6d::Zero( );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
+    {
+        coefficients.noalias( ) += panelCoefficientContributions_[ k ] * panelPressureCoefficients[ k ].matrix( );
+    }
+    return coefficients;
+}
 
-    // Loop over all panels and add moments due pressures.
-    for( int i = 0; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+//! Save panel pressure coefficients for given independent variables (in part-line-point format) to pressureCoefficientList_.
+void HypersonicLocalInclinationAnalysis::savePanelPressureCoefficients( const boost::array< int, 3 > independentVariableIndices,
+                                                                        const std::vector< Eigen::ArrayXd >& panelPressureCoefficients )
+{
+    std::vector< std::vector< std::vector< double > > > pressureCoefficients( vehicleParts_.size( ) );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for( int j = 0; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->getPanelCentroid( i, j ) - momentReferencePoint_ );
+        int numberOfLines = vehicleParts_[ k ]->getNumberOfLines( );
+        int numberOfPoints = vehicleParts_[ k ]->getNumberOfPoints( );
+        pressureCoefficients[ k ].resize( numberOfLines, std::vector< double >( numberOfPoints, 0.0 ) );
 
-            momentCoefficients -= pressureCoefficient_[ partNumber ][ i ][ j ] * vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j ) ) );
+        int panelIndex = 0;
+        for( int i = 0; i < numberOfLines - 1; i++ )
+        {
+            for( int j = 0; j < numberOfPoints - 1; j++ )
+            {
+                pressureCoefficients[ k ][ i ][ j ] = panelPressureCoefficients[ k ]( panelIndex );
+                panelIndex++;
+            }
         }
     }
 
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
-
-    return momentCoefficients;
+    std::lock_guard< std::mutex > lock( pressureCoefficientListMutex_ );
+    pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficients;
 }
 
-//! Determines the inclination angle of panels on a single part.
-void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack, const double angleOfSideslip )
+//! Evaluate a local inclination pressure function for all panels that satisfy the given condition.
+template< typename PressureFunction, typename PanelCondition >
+void evaluatePanelPressureCoefficients( const Eigen::ArrayXd& panelInclinations,
+                                        Eigen::ArrayXd& panelPressureCoefficients,
+                                        const PanelCondition& panelCondition,
+                                        const PressureFunction& pressureFunction )
 {
-    // Declare free-stream velocity vector.
-    Eigen::Vector3d freestreamVelocityDirection;
-
-    // Set freestream velocity vector in body frame.
-    double freestreamVelocityDirectionX = cos( angleOfAttack ) * cos( angleOfSideslip );
-    double freestreamVelocityDirectionY = sin( angleOfSideslip );
-    double freestreamVelocityDirectionZ = sin( angleOfAttack ) * cos( angleOfSideslip );
-    freestreamVelocityDirection( 0 ) = freestreamVelocityDirectionX;
-    freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
-    freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
-
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
-
-    // Loop over all panels of given vehicle part and set inclination angles.
-    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
+    for( int i = 0; i < panelInclinations.size( ); i++ )
     {
-        for( int i = 0; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1; i++ )
+        if( panelCondition( panelInclinations( i ) ) )
         {
-            for( int j = 0; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1; j++ )
-            {
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j ).dot( freestreamVelocityDirection );
-
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
+            panelPressureCoefficients( i ) = pressureFunction( panelInclinations( i ) );
         }
     }
 }
 
 //! Determine compression pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber, const int partNumber )
+void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
+                                                                     const int partNumber,
+                                                                     const Eigen::ArrayXd& panelInclinations,
+                                                                     Eigen::ArrayXd& panelPressureCoefficients ) const
 {
     int method = selectedMethods_[ 0 ][ partNumber ];
 
-    std::function< double( double ) > pressureFunction;
+    auto isCompression = []( const double inclination ) { return inclination > 0; };
 
     // Switch to analyze part using correct method.
     switch( method )
     {
         case 0:
-            pressureFunction = std::bind( aerodynamics::computeNewtonianPressureCoefficient, std::placeholders::_1 );
-            break;
-
-        case 1:
-            pressureFunction = std::bind(
-                    aerodynamics::computeModifiedNewtonianPressureCoefficient, std::placeholders::_1, stagnationPressureCoefficient );
+            // Newtonian method, evaluated for all panels at once.
+            panelPressureCoefficients =
+                    ( panelInclinations > 0 ).select( 2.0 * panelInclinations.sin( ).square( ), panelPressureCoefficients );
             break;
 
-        case 2:
-            // Method currently disabled.
+        case 1: {
+            // Modified Newtonian method, evaluated for all panels at once.
+            double stagnationPressureCoefficient = computeStagnationPressure( machNumber, ratioOfSpecificHeats );
+            panelPressureCoefficients = ( panelInclinations > 0 )
+                                                .select( stagnationPressureCoefficient * panelInclinations.sin( ).square( ),
+                                                         panelPressureCoefficients );
             break;
-
-        case 3:
-            // Method currently disabled.
-            break;
-
+        }
         case 4:
-            pressureFunction =
-                    std::bind( aerodynamics::computeEmpiricalTangentWedgePressureCoefficient, std::placeholders::_1, machNumber );
+            evaluatePanelPressureCoefficients(
+                    panelInclinations, panelPressureCoefficients, isCompression, [ = ]( const double inclination ) {
+                        return aerodynamics::computeEmpiricalTangentWedgePressureCoefficient( inclination, machNumber );
+                    } );
             break;
 
         case 5:
-            pressureFunction = std::bind( aerodynamics::computeEmpiricalTangentConePressureCoefficient, std::placeholders::_1, machNumber );
+            evaluatePanelPressureCoefficients(
+                    panelInclinations, panelPressureCoefficients, isCompression, [ = ]( const double inclination ) {
+                        return aerodynamics::computeEmpiricalTangentConePressureCoefficient( inclination, machNumber );
+                    } );
             break;
 
         case 6:
-            pressureFunction = std::bind( aerodynamics::computeModifiedDahlemBuckPressureCoefficient, std::placeholders::_1, machNumber );
+            evaluatePanelPressureCoefficients(
+                    panelInclinations, panelPressureCoefficients, isCompression, [ = ]( const double inclination ) {
+                        return aerodynamics::computeModifiedDahlemBuckPressureCoefficient( inclination, machNumber );
+                    } );
             break;
 
         case 7:
-            pressureFunction = std::bind(
-                    aerodynamics::computeVanDykeUnifiedPressureCoefficient, std::placeholders::_1, machNumber, ratioOfSpecificHeats, 1 );
+            evaluatePanelPressureCoefficients(
+                    panelInclinations, panelPressureCoefficients, isCompression, [ = ]( const double inclination ) {
+                        return aerodynamics::computeVanDykeUnifiedPressureCoefficient( inclination, machNumber, ratioOfSpecificHeats, 1 );
+                    } );
             break;
 
         case 8:
-            pressureFunction = std::bind( aerodynamics::computeSmythDeltaWingPressureCoefficient, std::placeholders::_1, machNumber );
+            evaluatePanelPressureCoefficients(
+                    panelInclinations, panelPressureCoefficients, isCompression, [ = ]( const double inclination ) {
+                        return aerodynamics::computeSmythDeltaWingPressureCoefficient( inclination, machNumber );
+                    } );
             break;
 
         case 9:
-            pressureFunction = std::bind( aerodynamics::computeHankeyFlatSurfacePressureCoefficient, std::placeholders::_1, machNumber );
+            evaluatePanelPressureCoefficients(
+                    panelInclinations, panelPressureCoefficients, isCompression, [ = ]( const double inclination ) {
+                        return aerodynamics::computeHankeyFlatSurfacePressureCoefficient( inclination, machNumber );
+                    } );
             break;
 
         default:
-            break;
-    }
-
-    for( int i = 0; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
-    {
-        for( int j = 0; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1; j++ )
-        {
-            if( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] = pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
-        }
+            // Methods 2 and 3 are currently disabled.
+            std::string errorMessage = "Error, compression local inclination method number " + std::to_string( method ) + " not recognized";
+            throw std::runtime_error( errorMessage );
     }
 }
 
 //! Determines expansion pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber, const int partNumber )
+void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
+                                                                   const int partNumber,
+                                                                   const Eigen::ArrayXd& panelInclinations,
+                                                                   Eigen::ArrayXd& panelPressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
 
     if( method == 0 || method == 1 || method == 4 )
     {
-        std::function< double( ) > pressureFunction;
+        // Pressure coefficient is independent of inclination, set for all panels at once.
+        double expansionPressureCoefficient = 0.0;
         switch( method )
         {
             case 0:
-                pressureFunction = std::bind( &aerodynamics::computeVacuumPressureCoefficient, machNumber, ratioOfSpecificHeats );
+                expansionPressureCoefficient = aerodynamics::computeVacuumPressureCoefficient( machNumber, ratioOfSpecificHeats );
                 break;
 
             case 1:
-                pressureFunction = []( ) { return 0.0; };
+                expansionPressureCoefficient = 0.0;
                 break;
 
             case 4:
-                pressureFunction = std::bind( &aerodynamics::computeHighMachBasePressure, machNumber );
+                expansionPressureCoefficient = aerodynamics::computeHighMachBasePressure( machNumber );
                 break;
         }
 
-        // Iterate over all panels on part.
-        for( int i = 0; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
-        {
-            for( int j = 0; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1; j++ )
-            {
-                if( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] = pressureFunction( );
-                }
-            }
-        }
+        panelPressureCoefficients = ( panelInclinations <= 0 ).select( expansionPressureCoefficient, panelPressureCoefficients );
     }
 
     else if( method == 3 || method == 5 || method == 6 )
     {
-        std::function< double( double ) > pressureFunction;
-
-        // Declare local variable.
-        double freestreamPrandtlMeyerFunction;
+        auto isExpansion = []( const double inclination ) { return inclination <= 0; };
 
         // Switch to analyze part using correct method.
         switch( method )
         {
-            case 3:
+            case 3: {
                 // Calculate freestream Prandtl-Meyer function.
-                freestreamPrandtlMeyerFunction = aerodynamics::computePrandtlMeyerFunction( machNumber, ratioOfSpecificHeats );
-                pressureFunction = std::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
-                                              std::placeholders::_1,
-                                              machNumber,
-                                              ratioOfSpecificHeats,
-                                              freestreamPrandtlMeyerFunction );
+                double freestreamPrandtlMeyerFunction = aerodynamics::computePrandtlMeyerFunction( machNumber, ratioOfSpecificHeats );
+                evaluatePanelPressureCoefficients(
+                        panelInclinations, panelPressureCoefficients, isExpansion, [ = ]( const double inclination ) {
+                            return aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient(
+                                    inclination, machNumber, ratioOfSpecificHeats, freestreamPrandtlMeyerFunction );
+                        } );
                 break;
-
+            }
             case 5:
-                pressureFunction = std::bind( &aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient,
-                                              std::placeholders::_1,
-                                              machNumber,
-                                              ratioOfSpecificHeats,
-                                              -1 );
+                evaluatePanelPressureCoefficients(
+                        panelInclinations, panelPressureCoefficients, isExpansion, [ = ]( const double inclination ) {
+                            return aerodynamics::computePrandtlMeyerFreestreamPressureCoefficient(
+                                    inclination, machNumber, ratioOfSpecificHeats, -1 );
+                        } );
                 break;
 
             case 6:
-                pressureFunction = std::bind( &aerodynamics::computeAcmEmpiricalPressureCoefficient, std::placeholders::_1, machNumber );
+                evaluatePanelPressureCoefficients(
+                        panelInclinations, panelPressureCoefficients, isExpansion, [ = ]( const double inclination ) {
+                            return aerodynamics::computeAcmEmpiricalPressureCoefficient( inclination, machNumber );
+                        } );
                 break;
         }
-
-        // Iterate over all panels on part.
-        for( int i = 0; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
-        {
-            for( int j = 0; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1; j++ )
-            {
-                if( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] = pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
-            }
-        }
     }
 
     else
@@ -89,6 +89,9 @@ std::string getAccelerationModelName( const AvailableAcceleration accelerationTy
         case custom_acceleration:
             accelerationName = "custom acceleration";
             break;
+        case mutual_point_mass_gravity:
+            accelerationName = "mutual point mass gravity";
+            break;
         default:
             std::string errorMessage =
                     "Error, acceleration type " + std::to_string( accelerationType ) + "not found when retrieving acceleration name ";
@@ -202,6 +205,10 @@ AvailableAcceleration getAccelerationModelType(
     {
         accelerationType = rtg_acceleration;
     }
+    else if( std::dynamic_pointer_cast< gravitation::MutualPointMassGravityAcceleration >( accelerationModel ) != nullptr )
+    {
+        accelerationType = mutual_point_mass_gravity;
+    }
 
     else
     {
@@ -236,6 +243,7 @@ bool isAccelerationModelTypeAreaToMassRatioDependent( const AvailableAcceleratio
         case einstein_infeld_hoffmann_acceleration:
         case yarkovsky_acceleration:
         case rtg_acceleration:
+        case mutual_point_mass_gravity:
             return false;
         case aerodynamic:
         case cannon_ball_radiation_pressure:
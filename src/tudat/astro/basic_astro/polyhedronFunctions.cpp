@@ -12,6 +12,7 @@
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
 #include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/legendrePolynomials.h"
 
 namespace tudat
 {
@@ -186,5 +187,157 @@ Eigen::Matrix3d computePolyhedronInertiaTensor( const Eigen::MatrixXd& verticesC
     return computePolyhedronInertiaTensor( verticesCoordinates, verticesDefiningEachFacet, density );
 }
 
+double computePolyhedronBrillouinSphereRadius( const Eigen::MatrixXd& verticesCoordinates )
+{
+    return verticesCoordinates.rowwise( ).norm( ).maxCoeff( );
+}
+
+//! Function to compute the nodes and weights of a Gauss-Legendre quadrature rule on the interval [0,1]
+void computeUnitIntervalGaussLegendreNodesAndWeights( const int numberOfNodes,
+                                                      std::vector< double >& nodes,
+                                                      std::vector< double >& weights )
+{
+    nodes.resize( numberOfNodes );
+    weights.resize( numberOfNodes );
+    for( int i = 0; i < numberOfNodes; i++ )
+    {
+        // Find root of Legendre polynomial by Newton iteration, from asymptotic initial guess
+        double root = std::cos( mathematical_constants::PI * ( i + 0.75 ) / ( numberOfNodes + 0.5 ) );
+        double derivative = 0.0;
+        for( int iteration = 0; iteration < 100; iteration++ )
+        {
+            double previousPolynomial = 1.0;
+            double polynomial = root;
+            for( int degree = 2; degree <= numberOfNodes; degree++ )
+            {
+                double nextPolynomial = ( ( 2.0 * degree - 1.0 ) * root * polynomial - ( degree - 1.0 ) * previousPolynomial ) / degree;
+                previousPolynomial = polynomial;
+                polynomial = nextPolynomial;
+            }
+            derivative = numberOfNodes * ( root * polynomial - previousPolynomial ) / ( root * root - 1.0 );
+            double correction = polynomial / derivative;
+            root -= correction;
+            if( std::fabs( correction ) < 1.0E-15 )
+            {
+                break;
+            }
+        }
+
+        // Map node and weight from [-1,1] to [0,1]
+        nodes[ i ] = 0.5 * ( 1.0 + root );
+        weights[ i ] = 1.0 / ( ( 1.0 - root * root ) * derivative * derivative );
+    }
+}
+
+std::pair< Eigen::MatrixXd, Eigen::MatrixXd > computePolyhedronSphericalHarmonicCoefficients(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int maximumDegree,
+        const double referenceRadius )
+{
+    // Check if inputs are valid
+    basic_mathematics::checkValidityOfPolyhedronSettings( verticesCoordinates, verticesDefiningEachFacet );
+    if( maximumDegree < 0 )
+    {
+        throw std::runtime_error( "Error when computing polyhedron spherical harmonic coefficients, maximum degree must be non-negative" );
+    }
+    if( !( referenceRadius > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when computing polyhedron spherical harmonic coefficients, reference radius must be positive" );
+    }
+
+    // Create quadrature rule on unit triangle (collapsed Gauss-Legendre rule), exact for polynomials up to maximum degree
+    const int numberOfNodesPerDirection = maximumDegree / 2 + 2;
+    std::vector< double > gaussNodes, gaussWeights;
+    computeUnitIntervalGaussLegendreNodesAndWeights( numberOfNodesPerDirection, gaussNodes, gaussWeights );
+
+    std::vector< double > triangleCoordinate1, triangleCoordinate2, triangleWeights;
+    for( int i = 0; i < numberOfNodesPerDirection; i++ )
+    {
+        for( int j = 0; j < numberOfNodesPerDirection; j++ )
+        {
+            triangleCoordinate1.push_back( gaussNodes[ i ] );
+            triangleCoordinate2.push_back( gaussNodes[ j ] * ( 1.0 - gaussNodes[ i ] ) );
+            triangleWeights.push_back( gaussWeights[ i ] * gaussWeights[ j ] * ( 1.0 - gaussNodes[ i ] ) );
+        }
+    }
+
+    // Integrals of (scaled) solid harmonics over facet cones, per degree and order
+    Eigen::MatrixXd cosineIntegrals = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineIntegrals = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd facetCosineIntegrals = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd facetSineIntegrals = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    std::vector< double > cosineOfOrderTimesLongitude( maximumDegree + 1 ), sineOfOrderTimesLongitude( maximumDegree + 1 );
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumDegree, true );
+
+    double volume = 0.0;
+    const unsigned int numberOfFacets = verticesDefiningEachFacet.rows( );
+    for( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        Eigen::Vector3d vertex0 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 0 ), 0 );
+        Eigen::Vector3d vertex1 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 1 ), 0 );
+        Eigen::Vector3d vertex2 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 2 ), 0 );
+
+        // Signed volume of the tetrahedron spanned by the origin and the facet
+        const double tetrahedronVolume = 1.0 / 6.0 * vertex0.dot( vertex1.cross( vertex2 ) );
+        volume += tetrahedronVolume;
+        if( tetrahedronVolume == 0.0 )
+        {
+            continue;
+        }
+
+        // Integrate solid harmonics over the facet
+        facetCosineIntegrals.setZero( );
+        facetSineIntegrals.setZero( );
+        for( unsigned int point = 0; point < triangleWeights.size( ); point++ )
+        {
+            const Eigen::Vector3d quadraturePoint = vertex0 + triangleCoordinate1[ point ] * ( vertex1 - vertex0 ) +
+                    triangleCoordinate2[ point ] * ( vertex2 - vertex0 );
+            const double radius = quadraturePoint.norm( );
+            const double longitude = std::atan2( quadraturePoint.y( ), quadraturePoint.x( ) );
+            legendreCache.update( quadraturePoint.z( ) / radius );
+
+            for( int order = 0; order <= maximumDegree; order++ )
+            {
+                cosineOfOrderTimesLongitude[ order ] = std::cos( order * longitude );
+                sineOfOrderTimesLongitude[ order ] = std::sin( order * longitude );
+            }
+
+            double scaledRadiusToPowerDegree = triangleWeights[ point ];
+            for( int degree = 0; degree <= maximumDegree; degree++ )
+            {
+                for( int order = 0; order <= degree; order++ )
+                {
+                    const double legendrePolynomial = legendreCache.getLegendrePolynomial( degree, order );
+                    facetCosineIntegrals( degree, order ) +=
+                            scaledRadiusToPowerDegree * legendrePolynomial * cosineOfOrderTimesLongitude[ order ];
+                    facetSineIntegrals( degree, order ) +=
+                            scaledRadiusToPowerDegree * legendrePolynomial * sineOfOrderTimesLongitude[ order ];
+                }
+                scaledRadiusToPowerDegree *= radius / referenceRadius;
+            }
+        }
+
+        // Convert facet surface integrals to cone volume integrals
+        for( int degree = 0; degree <= maximumDegree; degree++ )
+        {
+            const double coneFactor = 6.0 * tetrahedronVolume / ( degree + 3.0 );
+            cosineIntegrals.row( degree ) += coneFactor * facetCosineIntegrals.row( degree );
+            sineIntegrals.row( degree ) += coneFactor * facetSineIntegrals.row( degree );
+        }
+    }
+
+    // Normalize integrals to obtain coefficients
+    for( int degree = 0; degree <= maximumDegree; degree++ )
+    {
+        cosineIntegrals.row( degree ) /= ( ( 2.0 * degree + 1.0 ) * volume );
+        sineIntegrals.row( degree ) /= ( ( 2.0 * degree + 1.0 ) * volume );
+    }
+    sineIntegrals.col( 0 ).setZero( );
+
+    return std::make_pair( cosineIntegrals, sineIntegrals );
+}
+
 }  // namespace basic_astrodynamics
 }  // namespace tudat
\ No newline at end of file
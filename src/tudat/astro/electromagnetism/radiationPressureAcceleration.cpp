@@ -102,6 +102,8 @@ void PaneledSourceRadiationPressureAcceleration::computeAcceleration( )
     // Calculate radiation pressure force due to all sub-sources in target frame
     Eigen::Vector3d totalForceInTargetFrame = Eigen::Vector3d::Zero( );
     targetModel_->resetComputations( sourceName_ );
+    visibleSourcePanelIrradiances_.clear( );
+    visibleSourcePanelDirections_.clear( );
     int counter = 0;
     for( auto sourceIrradianceAndPosition: sourceIrradiancesAndPositions )
     {
@@ -120,8 +122,8 @@ void PaneledSourceRadiationPressureAcceleration::computeAcceleration( )
             Eigen::Vector3d sourceToTargetDirectionInTargetFrame = targetRotationFromGlobalToLocalFrame *
                     ( targetCenterPositionInGlobalFrame_ - sourcePositionInGlobalFrame ).normalized( );
 
-            targetModel_->updateRadiationPressureForcing(
-                    occultedSourceIrradiance, sourceToTargetDirectionInTargetFrame, false, sourceName_ );
+            visibleSourcePanelIrradiances_.push_back( occultedSourceIrradiance );
+            visibleSourcePanelDirections_.push_back( sourceToTargetDirectionInTargetFrame );
 
             totalReceivedIrradiance += occultedSourceIrradiance;
             visibleAndEmittingSourcePanelCounter += 1;
@@ -132,6 +134,10 @@ void PaneledSourceRadiationPressureAcceleration::computeAcceleration( )
         }
         counter++;
     }
+
+    // Evaluate contributions of all visible source panels at once
+    targetModel_->updateRadiationPressureForcingFromMultipleSources(
+            visibleSourcePanelIrradiances_, visibleSourcePanelDirections_, sourceName_ );
     targetModel_->saveLocalComputations( sourceName_, false );
     if( savePanellingGeometry_ )
     {
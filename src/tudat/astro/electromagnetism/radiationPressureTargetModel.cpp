@@ -49,6 +49,53 @@ void CannonballRadiationPressureTargetModel::updateRadiationPressureForcing( dou
     }
 }
 
+//! Compute radiation pressure forces of all panels from a single source, for specular-diffuse-mix reflection laws
+/*!
+ *  Compute radiation pressure forces of all panels from a single source, for panels with a specular-diffuse-mix reflection
+ *  law (Montenbruck, 2014, Eq. 5-6), using the flattened panel store. The instantaneous reradiation setting is a template
+ *  argument, so that the kernel contains no per-panel branches.
+ *  \param radiationPressure Radiation pressure of incoming radiation [N/m²]
+ *  \param sourceToTargetDirection Direction of incoming radiation (in panel frame)
+ *  \param panelNormals Surface normals of all panels (one per column)
+ *  \param panelAreas Areas of all panels
+ *  \param panelIlluminatedFractions Illuminated fraction of all panels
+ *  \param absorptivities Absorptivities of all panels
+ *  \param specularReflectivities Specular reflectivities of all panels
+ *  \param diffuseReflectivities Diffuse reflectivities of all panels
+ *  \param panelCosines Cosines of angle between incoming radiation and panel normals, clipped at zero (returned by reference)
+ *  \param panelForces Radiation pressure force of all panels (one per column; returned by reference)
+ */
+template< bool WithInstantaneousReradiation >
+void computeSpecularDiffuseMixPanelForces( const double radiationPressure,
+                                           const Eigen::Vector3d& sourceToTargetDirection,
+                                           const Eigen::Matrix< double, 3, Eigen::Dynamic >& panelNormals,
+                                           const Eigen::ArrayXd& panelAreas,
+                                           const Eigen::ArrayXd& panelIlluminatedFractions,
+                                           const Eigen::ArrayXd& absorptivities,
+                                           const Eigen::ArrayXd& specularReflectivities,
+                                           const Eigen::ArrayXd& diffuseReflectivities,
+                                           Eigen::ArrayXd& panelCosines,
+                                           Eigen::Matrix< double, 3, Eigen::Dynamic >& panelForces )
+{
+    panelCosines = ( -sourceToTargetDirection.transpose( ) * panelNormals ).transpose( ).array( ).max( 0.0 );
+
+    // Force magnitude scaling of each panel; zero for panels that are not illuminated
+    Eigen::ArrayXd forceScaling = radiationPressure * panelIlluminatedFractions * panelAreas * panelCosines;
+
+    // Montenbruck (2014) Eq. 5: components of reaction vector along incoming direction, and along surface normal
+    Eigen::ArrayXd incomingDirectionCoefficients = forceScaling * ( absorptivities + diffuseReflectivities );
+    Eigen::ArrayXd normalCoefficients = 2.0 / 3.0 * diffuseReflectivities + 2.0 * specularReflectivities * panelCosines;
+    if( WithInstantaneousReradiation )
+    {
+        // Montenbruck (2014) Eq. 6
+        normalCoefficients += 2.0 / 3.0 * absorptivities;
+    }
+    normalCoefficients *= forceScaling;
+
+    panelForces.noalias( ) = sourceToTargetDirection * incomingDirectionCoefficients.matrix( ).transpose( );
+    panelForces.array( ) -= panelNormals.array( ).rowwise( ) * normalCoefficients.transpose( );
+}
+
 void PaneledRadiationPressureTargetModel::updateRadiationPressureForcing( double sourceIrradiance,
                                                                           const Eigen::Vector3d& sourceToTargetDirectionLocalFrame,
                                                                           const bool resetForces,
@@ -61,14 +108,64 @@ void PaneledRadiationPressureTargetModel::updateRadiationPressureForcing( double
         resetComputations( sourceName );
     }
 
+    updatePanelReflectionLaws( );
+    if( useBatchedReflectionKernel_ )
+    {
+        updatePanelStore( );
+        computePanelForcesBatched( radiationPressure, sourceToTargetDirectionLocalFrame, sourceName );
+    }
+    else
+    {
+        Eigen::Vector3d currentCenterOfMass = Eigen::Vector3d::Constant( TUDAT_NAN );
+        if( computeTorques_ )
+        {
+            currentCenterOfMass = centerOfMassFunction_( );
+        }
+        computePanelForcesPerPanel( radiationPressure, sourceToTargetDirectionLocalFrame, currentCenterOfMass, sourceName );
+    }
+}
+
+void PaneledRadiationPressureTargetModel::updateRadiationPressureForcingFromMultipleSources(
+        const std::vector< double >& sourceIrradiances,
+        const std::vector< Eigen::Vector3d >& sourceToTargetDirectionsLocalFrame,
+        const std::string sourceName )
+{
+    if( sourceIrradiances.size( ) != sourceToTargetDirectionsLocalFrame.size( ) )
+    {
+        throw std::runtime_error( "Error when computing paneled radiation pressure from multiple sources, number of irradiances (" +
+                                  std::to_string( sourceIrradiances.size( ) ) + ") and directions (" +
+                                  std::to_string( sourceToTargetDirectionsLocalFrame.size( ) ) + ") is inconsistent." );
+    }
+
+    // Panel properties are identical for all sources, and only retrieved once
+    updatePanelReflectionLaws( );
     Eigen::Vector3d currentCenterOfMass = Eigen::Vector3d::Constant( TUDAT_NAN );
-    if( computeTorques_ )
+    if( useBatchedReflectionKernel_ )
+    {
+        updatePanelStore( );
+    }
+    else if( computeTorques_ )
     {
         currentCenterOfMass = centerOfMassFunction_( );
     }
-    Eigen::Vector3d currentPanelForce = Eigen::Vector3d::Zero( );
-    Eigen::Vector3d currentPanelTorque = Eigen::Vector3d::Zero( );
 
+    for( unsigned int i = 0; i < sourceIrradiances.size( ); i++ )
+    {
+        double radiationPressure = sourceIrradiances.at( i ) / physical_constants::SPEED_OF_LIGHT;
+        if( useBatchedReflectionKernel_ )
+        {
+            computePanelForcesBatched( radiationPressure, sourceToTargetDirectionsLocalFrame.at( i ), sourceName );
+        }
+        else
+        {
+            computePanelForcesPerPanel( radiationPressure, sourceToTargetDirectionsLocalFrame.at( i ), currentCenterOfMass, sourceName );
+        }
+    }
+}
+
+void PaneledRadiationPressureTargetModel::updateIlluminatedPanelFractions( const Eigen::Vector3d& sourceToTargetDirectionLocalFrame,
+                                                                           const std::string& sourceName )
+{
     if( selfShadowingPerSource_.count( sourceName ) == 0 || selfShadowingPerSource_.at( sourceName )->getMaximumNumberOfPixels( ) == 0 )
     {
         // SSH off
@@ -80,6 +177,141 @@ void PaneledRadiationPressureTargetModel::updateRadiationPressureForcing( double
         selfShadowingPerSource_.at( sourceName )->updateIlluminatedPanelFractions( sourceToTargetDirectionLocalFrame );
         illuminatedPanelFractions_ = selfShadowingPerSource_.at( sourceName )->getIlluminatedPanelFractions( );
     }
+}
+
+void PaneledRadiationPressureTargetModel::updatePanelReflectionLaws( )
+{
+    bool reflectionLawsChanged = false;
+    for( int i = 0; i < totalNumberOfPanels_; i++ )
+    {
+        std::shared_ptr< ReflectionLaw > currentReflectionLaw = allPanels_.at( i )->getReflectionLaw( );
+        if( currentReflectionLaw != panelReflectionLaws_.at( i ) )
+        {
+            panelReflectionLaws_[ i ] = currentReflectionLaw;
+            panelSpecularDiffuseReflectionLaws_[ i ] = std::dynamic_pointer_cast< SpecularDiffuseMixReflectionLaw >( currentReflectionLaw );
+            reflectionLawsChanged = true;
+        }
+    }
+
+    if( reflectionLawsChanged )
+    {
+        useBatchedReflectionKernel_ = ( totalNumberOfPanels_ > 0 );
+        for( int i = 0; i < totalNumberOfPanels_; i++ )
+        {
+            if( panelSpecularDiffuseReflectionLaws_.at( i ) == nullptr ||
+                panelSpecularDiffuseReflectionLaws_.at( i )->isWithInstantaneousReradiation( ) !=
+                        panelSpecularDiffuseReflectionLaws_.at( 0 )->isWithInstantaneousReradiation( ) )
+            {
+                useBatchedReflectionKernel_ = false;
+                break;
+            }
+        }
+        if( useBatchedReflectionKernel_ )
+        {
+            batchedKernelWithInstantaneousReradiation_ = panelSpecularDiffuseReflectionLaws_.at( 0 )->isWithInstantaneousReradiation( );
+        }
+    }
+}
+
+void PaneledRadiationPressureTargetModel::updatePanelStore( )
+{
+    Eigen::Vector3d currentCenterOfMass = Eigen::Vector3d::Constant( TUDAT_NAN );
+    if( computeTorques_ )
+    {
+        currentCenterOfMass = centerOfMassFunction_( );
+    }
+
+    for( int i = 0; i < totalNumberOfPanels_; i++ )
+    {
+        const std::shared_ptr< system_models::VehicleExteriorPanel >& currentPanel = allPanels_.at( i );
+        surfaceNormals_[ i ] = currentPanel->getBodyFixedSurfaceNormal( )( );
+        panelNormalsStore_.col( i ) = surfaceNormals_[ i ];
+        panelAreasStore_( i ) = currentPanel->getPanelArea( );
+
+        // Coefficients are retrieved at each evaluation, as they may be modified (e.g. during estimation)
+        const std::shared_ptr< SpecularDiffuseMixReflectionLaw >& currentReflectionLaw = panelSpecularDiffuseReflectionLaws_.at( i );
+        panelAbsorptivitiesStore_( i ) = currentReflectionLaw->getAbsorptivity( );
+        panelSpecularReflectivitiesStore_( i ) = currentReflectionLaw->getSpecularReflectivity( );
+        panelDiffuseReflectivitiesStore_( i ) = currentReflectionLaw->getDiffuseReflectivity( );
+
+        if( computeTorques_ )
+        {
+            panelCentroidMomentArms_[ i ] = currentPanel->getBodyFixedPositionVector( )( ) - currentCenterOfMass;
+            panelMomentArmsStore_.col( i ) = panelCentroidMomentArms_[ i ];
+        }
+    }
+}
+
+void PaneledRadiationPressureTargetModel::computePanelForcesBatched( const double radiationPressure,
+                                                                     const Eigen::Vector3d& sourceToTargetDirectionLocalFrame,
+                                                                     const std::string& sourceName )
+{
+    updateIlluminatedPanelFractions( sourceToTargetDirectionLocalFrame, sourceName );
+    panelIlluminationStore_ = Eigen::Map< const Eigen::ArrayXd >( illuminatedPanelFractions_.data( ), totalNumberOfPanels_ );
+
+    if( batchedKernelWithInstantaneousReradiation_ )
+    {
+        computeSpecularDiffuseMixPanelForces< true >( radiationPressure,
+                                                      sourceToTargetDirectionLocalFrame,
+                                                      panelNormalsStore_,
+                                                      panelAreasStore_,
+                                                      panelIlluminationStore_,
+                                                      panelAbsorptivitiesStore_,
+                                                      panelSpecularReflectivitiesStore_,
+                                                      panelDiffuseReflectivitiesStore_,
+                                                      panelCosinesStore_,
+                                                      panelForcesStore_ );
+    }
+    else
+    {
+        computeSpecularDiffuseMixPanelForces< false >( radiationPressure,
+                                                       sourceToTargetDirectionLocalFrame,
+                                                       panelNormalsStore_,
+                                                       panelAreasStore_,
+                                                       panelIlluminationStore_,
+                                                       panelAbsorptivitiesStore_,
+                                                       panelSpecularReflectivitiesStore_,
+                                                       panelDiffuseReflectivitiesStore_,
+                                                       panelCosinesStore_,
+                                                       panelForcesStore_ );
+    }
+
+    this->currentRadiationPressureForce_[ sourceName ] += panelForcesStore_.rowwise( ).sum( );
+
+    // Copy results to per-panel containers (used for dependent variables)
+    for( int i = 0; i < totalNumberOfPanels_; i++ )
+    {
+        surfacePanelCosines_[ i ] = panelCosinesStore_( i );
+        panelForces_[ i ] += panelForcesStore_.col( i );
+        if( !( panelCosinesStore_( i ) > 0 ) )
+        {
+            illuminatedPanelFractions_[ i ] = 0.0;
+        }
+    }
+
+    if( computeTorques_ )
+    {
+        Eigen::Vector3d currentTorque = Eigen::Vector3d::Zero( );
+        for( int i = 0; i < totalNumberOfPanels_; i++ )
+        {
+            Eigen::Vector3d currentPanelTorque = panelMomentArmsStore_.col( i ).cross( panelForcesStore_.col( i ) );
+            panelTorques_[ i ] += currentPanelTorque;
+            currentTorque += currentPanelTorque;
+        }
+        this->currentRadiationPressureTorque_[ sourceName ] += currentTorque;
+    }
+}
+
+void PaneledRadiationPressureTargetModel::computePanelForcesPerPanel( const double radiationPressure,
+                                                                      const Eigen::Vector3d& sourceToTargetDirectionLocalFrame,
+                                                                      const Eigen::Vector3d& currentCenterOfMass,
+                                                                      const std::string& sourceName )
+{
+    Eigen::Vector3d currentPanelForce = Eigen::Vector3d::Zero( );
+    Eigen::Vector3d currentPanelTorque = Eigen::Vector3d::Zero( );
+
+    updateIlluminatedPanelFractions( sourceToTargetDirectionLocalFrame, sourceName );
+
     // common logic
     double surfacePanelCosine;
     for ( int i = 0; i< totalNumberOfPanels_; i++)
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <algorithm>
 #include <cctype>
+#include <thread>
 
 namespace tudat
 {
@@ -33,9 +34,16 @@ CalcephEphemeris::CalcephEphemeris(
     int targetNaifId,
     int observerNaifId,
     const std::string& referenceFrameOrigin,
-    const std::string& referenceFrameOrientation )
+    const std::string& referenceFrameOrientation,
+    const int maximumNumberOfHandles )
     : Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+      spkFilePath_( spkFilePath ),
       ephemerisHandle_( nullptr ),
+      isHandleThreadSafe_( false ),
+      numberOfOpenHandles_( 0 ),
+      maximumNumberOfHandles_( maximumNumberOfHandles > 0
+                                   ? maximumNumberOfHandles
+                                   : std::max( 1, static_cast< int >( std::thread::hardware_concurrency( ) ) ) ),
       targetNaifId_( targetNaifId ),
       observerNaifId_( observerNaifId ),
       startEpoch_( 0.0 ),
@@ -48,6 +56,8 @@ CalcephEphemeris::CalcephEphemeris(
     {
         throw std::runtime_error( "CalcephEphemeris: Failed to open SPK file: " + spkFilePath );
     }
+    availableHandles_.push_back( ephemerisHandle_ );
+    numberOfOpenHandles_ = 1;
 
     // Get time span covered by the ephemeris
     double firstJD, lastJD;
@@ -76,22 +86,93 @@ CalcephEphemeris::CalcephEphemeris(
     {
         std::cerr << "[CALCEPH] Warning: Prefetch failed for " << spkFilePath << std::endl;
     }
+    else
+    {
+        // After a successful prefetch, CALCEPH reports whether the handle may be used by several threads at once
+        isHandleThreadSafe_ = ( calceph_isthreadsafe( ephemerisHandle_ ) != 0 );
+    }
 }
 
 CalcephEphemeris::~CalcephEphemeris( )
 {
-    std::lock_guard<std::mutex> lock( mutex_ );
-    if ( ephemerisHandle_ != nullptr )
+    // All evaluations have finished at this point, so all handles are back in the pool
+    std::lock_guard<std::mutex> lock( handleMutex_ );
+    for ( t_calcephbin* handle : availableHandles_ )
     {
-        calceph_close( ephemerisHandle_ );
-        ephemerisHandle_ = nullptr;
+        calceph_close( handle );
     }
+    availableHandles_.clear( );
+    numberOfOpenHandles_ = 0;
+    ephemerisHandle_ = nullptr;
 }
 
-Eigen::Vector6d CalcephEphemeris::getCartesianState( double secondsSinceEpoch )
+t_calcephbin* CalcephEphemeris::openHandle( ) const
 {
-    std::lock_guard<std::mutex> lock( mutex_ );
+    t_calcephbin* handle = calceph_open( spkFilePath_.c_str( ) );
+    if ( handle != nullptr && calceph_prefetch( handle ) == 0 )
+    {
+        std::cerr << "[CALCEPH] Warning: Prefetch failed for " << spkFilePath_ << std::endl;
+    }
+    return handle;
+}
+
+t_calcephbin* CalcephEphemeris::acquireHandle( )
+{
+    if ( isHandleThreadSafe_ )
+    {
+        return ephemerisHandle_;
+    }
 
+    {
+        std::unique_lock<std::mutex> lock( handleMutex_ );
+        handleReleasedCondition_.wait(
+            lock, [ this ]( ) { return !availableHandles_.empty( ) || numberOfOpenHandles_ < maximumNumberOfHandles_; } );
+        if ( !availableHandles_.empty( ) )
+        {
+            t_calcephbin* handle = availableHandles_.back( );
+            availableHandles_.pop_back( );
+            return handle;
+        }
+
+        // All handles are in use: reserve a slot for a new one, which is opened outside of the lock
+        numberOfOpenHandles_++;
+    }
+
+    t_calcephbin* handle = openHandle( );
+    if ( handle == nullptr )
+    {
+        {
+            std::lock_guard<std::mutex> lock( handleMutex_ );
+            numberOfOpenHandles_--;
+        }
+        handleReleasedCondition_.notify_one( );
+        throw std::runtime_error( "CalcephEphemeris: Failed to open additional handle to SPK file: " + spkFilePath_ );
+    }
+    return handle;
+}
+
+void CalcephEphemeris::releaseHandle( t_calcephbin* handle )
+{
+    if ( isHandleThreadSafe_ )
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( handleMutex_ );
+        availableHandles_.push_back( handle );
+    }
+    handleReleasedCondition_.notify_one( );
+}
+
+int CalcephEphemeris::getNumberOfOpenHandles( ) const
+{
+    std::lock_guard<std::mutex> lock( handleMutex_ );
+    return numberOfOpenHandles_;
+}
+
+Eigen::Vector6d CalcephEphemeris::getCartesianState( double secondsSinceEpoch )
+{
     if ( ephemerisHandle_ == nullptr )
     {
         throw std::runtime_error( "CalcephEphemeris: Ephemeris file not loaded" );
@@ -115,14 +196,16 @@ Eigen::Vector6d CalcephEphemeris::getCartesianState( double secondsSinceEpoch )
     // Use CALCEPH_USE_NAIFID to use NAIF IDs instead of CALCEPH's internal numbering
     int unit = CALCEPH_UNIT_KM | CALCEPH_UNIT_SEC | CALCEPH_USE_NAIFID;
 
+    t_calcephbin* ephemerisHandle = acquireHandle( );
     int result = calceph_compute_unit(
-        ephemerisHandle_,
+        ephemerisHandle,
         JD0,
         time,
         targetNaifId_,
         observerNaifId_,
         unit,
         PV );
+    releaseHandle( ephemerisHandle );
 
     if ( result == 0 )
     {
@@ -181,10 +264,9 @@ bool CalcephEphemerisManager::loadSpkFileByNaifId(
     int observerNaifId,
     const std::string& frame )
 {
-    std::lock_guard<std::mutex> lock( mutex_ );
-
     try
     {
+        // Open file before locking, so that concurrent lookups are not blocked by file access
         auto ephemeris = std::make_shared<CalcephEphemeris>(
             spkFilePath, targetNaifId, observerNaifId, naifIdToBodyName( observerNaifId ), frame );
 
@@ -198,6 +280,7 @@ bool CalcephEphemerisManager::loadSpkFileByNaifId(
             naifIdToBodyName( observerNaifId ),
             frame );
 
+        std::unique_lock<std::shared_mutex> lock( mutex_ );
         ephemerides_[key] = ephemeris;
         return true;
     }
@@ -213,7 +296,7 @@ bool CalcephEphemerisManager::isAvailable(
     const std::string& observerName,
     const std::string& frame ) const
 {
-    std::lock_guard<std::mutex> lock( mutex_ );
+    std::shared_lock<std::shared_mutex> lock( mutex_ );
     std::string key = makeKey( targetName, observerName, frame );
     return ephemerides_.find( key ) != ephemerides_.end( );
 }
@@ -224,16 +307,21 @@ Eigen::Vector6d CalcephEphemerisManager::getState(
     const std::string& frame,
     double secondsSinceJ2000 ) const
 {
-    std::lock_guard<std::mutex> lock( mutex_ );
     std::string key = makeKey( targetName, observerName, frame );
 
-    auto it = ephemerides_.find( key );
-    if ( it == ephemerides_.end( ) )
+    std::shared_ptr<CalcephEphemeris> ephemeris;
     {
-        throw std::runtime_error( "CalcephEphemerisManager: Ephemeris not loaded for " + key );
+        std::shared_lock<std::shared_mutex> lock( mutex_ );
+        auto it = ephemerides_.find( key );
+        if ( it == ephemerides_.end( ) )
+        {
+            throw std::runtime_error( "CalcephEphemerisManager: Ephemeris not loaded for " + key );
+        }
+        ephemeris = it->second;
     }
 
-    return it->second->getCartesianState( secondsSinceJ2000 );
+    // Evaluate outside of lock; ephemeris object handles concurrent evaluations itself
+    return ephemeris->getCartesianState( secondsSinceJ2000 );
 }
 
 std::pair<double, double> CalcephEphemerisManager::getTimeBounds(
@@ -241,7 +329,7 @@ std::pair<double, double> CalcephEphemerisManager::getTimeBounds(
     const std::string& observerName,
     const std::string& frame ) const
 {
-    std::lock_guard<std::mutex> lock( mutex_ );
+    std::shared_lock<std::shared_mutex> lock( mutex_ );
     std::string key = makeKey( targetName, observerName, frame );
 
     auto it = ephemerides_.find( key );
@@ -255,14 +343,14 @@ std::pair<double, double> CalcephEphemerisManager::getTimeBounds(
 
 void CalcephEphemerisManager::clearAll( )
 {
-    std::lock_guard<std::mutex> lock( mutex_ );
+    std::unique_lock<std::shared_mutex> lock( mutex_ );
     ephemerides_.clear( );
     std::cout << "[CALCEPH] Cleared all loaded ephemeris files" << std::endl;
 }
 
 std::vector<std::string> CalcephEphemerisManager::listLoaded( ) const
 {
-    std::lock_guard<std::mutex> lock( mutex_ );
+    std::shared_lock<std::shared_mutex> lock( mutex_ );
     std::vector<std::string> keys;
     for ( const auto& pair : ephemerides_ )
     {
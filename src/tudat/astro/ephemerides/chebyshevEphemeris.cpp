@@ -0,0 +1,366 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+namespace
+{
+
+// Identifier at start of binary Chebyshev ephemeris file
+const char chebyshevFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'C', 'H', 'E', 'B', '\0' };
+
+// Version of the binary Chebyshev ephemeris file format
+const int32_t chebyshevFileVersion = 1;
+
+// Value used to detect files written with a different byte order
+const int32_t chebyshevFileByteOrderCheck = 0x01020304;
+
+// Number of characters reserved for the frame origin and orientation
+const int chebyshevFileFrameNameLength = 64;
+
+// Header of binary Chebyshev ephemeris file
+struct ChebyshevEphemerisFileHeader {
+    char identifier[ 8 ];
+    int32_t version;
+    int32_t byteOrderCheck;
+    int32_t polynomialDegree;
+    int32_t numberOfSegments;
+    double startTime;
+    double segmentLength;
+    char frameOrigin[ chebyshevFileFrameNameLength ];
+    char frameOrientation[ chebyshevFileFrameNameLength ];
+};
+
+// Function to evaluate a Chebyshev series and its derivative (w.r.t. the normalized time) using the Clenshaw recurrence
+void evaluateChebyshevSeriesAndDerivative(
+        const double* coefficients, const int polynomialDegree, const double normalizedTime, double& value, double& derivative )
+{
+    // Recurrence for sum c_k T_k(x), and for sum (k+1) c_{k+1} U_k(x) = d/dx ( sum c_k T_k(x) )
+    const double twiceNormalizedTime = 2.0 * normalizedTime;
+    double valueTerm = 0.0, previousValueTerm = 0.0;
+    double derivativeTerm = 0.0, previousDerivativeTerm = 0.0;
+    for( int k = polynomialDegree; k >= 1; k-- )
+    {
+        double currentValueTerm = coefficients[ k ] + twiceNormalizedTime * valueTerm - previousValueTerm;
+        previousValueTerm = valueTerm;
+        valueTerm = currentValueTerm;
+
+        double currentDerivativeTerm = k * coefficients[ k ] + twiceNormalizedTime * derivativeTerm - previousDerivativeTerm;
+        previousDerivativeTerm = derivativeTerm;
+        derivativeTerm = currentDerivativeTerm;
+    }
+    value = coefficients[ 0 ] + normalizedTime * valueTerm - previousValueTerm;
+    derivative = derivativeTerm;
+}
+
+// Function to fit Chebyshev coefficients of the position to a state function on a single segment, by interpolation at the
+// Chebyshev nodes (of the first kind)
+void fitChebyshevSegment( const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+                          const double segmentStartTime,
+                          const double segmentLength,
+                          const int polynomialDegree,
+                          const Eigen::MatrixXd& nodeCosines,
+                          double* coefficients )
+{
+    const int numberOfNodes = polynomialDegree + 1;
+    Eigen::Matrix3Xd nodePositions( 3, numberOfNodes );
+    for( int k = 0; k < numberOfNodes; k++ )
+    {
+        double nodeTime = segmentStartTime + 0.5 * segmentLength * ( 1.0 + nodeCosines( 1, k ) );
+        nodePositions.col( k ) = stateFunction( nodeTime ).segment( 0, 3 );
+    }
+
+    for( int component = 0; component < 3; component++ )
+    {
+        for( int j = 0; j < numberOfNodes; j++ )
+        {
+            double coefficient = 0.0;
+            for( int k = 0; k < numberOfNodes; k++ )
+            {
+                coefficient += nodePositions( component, k ) * nodeCosines( j, k );
+            }
+            coefficients[ component * numberOfNodes + j ] = ( j == 0 ? 1.0 : 2.0 ) * coefficient / numberOfNodes;
+        }
+    }
+}
+
+}  // namespace
+
+ChebyshevEphemeris::ChebyshevEphemeris( const double startTime,
+                                        const double segmentLength,
+                                        const int polynomialDegree,
+                                        const std::vector< double >& coefficients,
+                                        const std::string& referenceFrameOrigin,
+                                        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ), startTime_( startTime ), segmentLength_( segmentLength ),
+    polynomialDegree_( polynomialDegree ), coefficients_( coefficients )
+{
+    if( polynomialDegree_ < 0 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, polynomial degree must be non-negative" );
+    }
+    if( !( segmentLength_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, segment length must be positive" );
+    }
+
+    const std::size_t coefficientsPerSegment = 3 * static_cast< std::size_t >( polynomialDegree_ + 1 );
+    if( coefficients_.size( ) == 0 || coefficients_.size( ) % coefficientsPerSegment != 0 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, number of coefficients (" +
+                                  std::to_string( coefficients_.size( ) ) + ") is inconsistent with polynomial degree " +
+                                  std::to_string( polynomialDegree_ ) );
+    }
+    numberOfSegments_ = static_cast< int >( coefficients_.size( ) / coefficientsPerSegment );
+}
+
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    // Retrieve segment index (end time is included in last segment)
+    int segmentIndex = static_cast< int >( std::floor( ( secondsSinceEpoch - startTime_ ) / segmentLength_ ) );
+    if( segmentIndex == numberOfSegments_ && secondsSinceEpoch <= getEndTime( ) )
+    {
+        segmentIndex--;
+    }
+    if( segmentIndex < 0 || segmentIndex >= numberOfSegments_ || secondsSinceEpoch != secondsSinceEpoch )
+    {
+        throw std::runtime_error( "Error when evaluating Chebyshev ephemeris, time " + std::to_string( secondsSinceEpoch ) +
+                                  " is outside of the interval [" + std::to_string( startTime_ ) + ", " +
+                                  std::to_string( getEndTime( ) ) + "]" );
+    }
+
+    // Compute time normalized to [-1, 1] in segment
+    const double segmentStartTime = startTime_ + segmentIndex * segmentLength_;
+    const double normalizedTime = 2.0 * ( secondsSinceEpoch - segmentStartTime ) / segmentLength_ - 1.0;
+
+    // Evaluate position and velocity
+    Eigen::Vector6d cartesianState;
+    const int numberOfCoefficients = polynomialDegree_ + 1;
+    const double* segmentCoefficients = coefficients_.data( ) + static_cast< std::size_t >( segmentIndex ) * 3 * numberOfCoefficients;
+    for( int component = 0; component < 3; component++ )
+    {
+        double normalizedVelocity;
+        evaluateChebyshevSeriesAndDerivative( segmentCoefficients + component * numberOfCoefficients,
+                                              polynomialDegree_,
+                                              normalizedTime,
+                                              cartesianState( component ),
+                                              normalizedVelocity );
+        cartesianState( component + 3 ) = 2.0 * normalizedVelocity / segmentLength_;
+    }
+    return cartesianState;
+}
+
+std::shared_ptr< ChebyshevEphemeris > createChebyshevEphemeris( const std::function< Eigen::Vector6d( const double ) > stateFunction,
+                                                                const double startTime,
+                                                                const double endTime,
+                                                                const int polynomialDegree,
+                                                                const double positionTolerance,
+                                                                const std::string& referenceFrameOrigin,
+                                                                const std::string& referenceFrameOrientation,
+                                                                const double maximumSegmentLength,
+                                                                const double velocityTolerance,
+                                                                const int maximumNumberOfSegments )
+{
+    if( !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, end time must be larger than start time" );
+    }
+    if( polynomialDegree < 1 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, polynomial degree must be at least 1" );
+    }
+    if( !( positionTolerance > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, position tolerance must be positive" );
+    }
+
+    // Pre-compute cos( j * theta_k ) for Chebyshev nodes theta_k = pi ( k + 1/2 ) / ( N + 1 ) of the first kind
+    const int numberOfNodes = polynomialDegree + 1;
+    Eigen::MatrixXd nodeCosines( numberOfNodes, numberOfNodes );
+    for( int j = 0; j < numberOfNodes; j++ )
+    {
+        for( int k = 0; k < numberOfNodes; k++ )
+        {
+            nodeCosines( j, k ) = std::cos( mathematical_constants::PI * j * ( k + 0.5 ) / numberOfNodes );
+        }
+    }
+
+    // Test points: segment boundaries, and points halfway (in angle) between Chebyshev nodes
+    std::vector< double > testPoints;
+    for( int k = 0; k <= numberOfNodes; k++ )
+    {
+        testPoints.push_back( std::cos( mathematical_constants::PI * k / numberOfNodes ) );
+    }
+
+    // Set initial number of segments
+    int numberOfSegments = 1;
+    if( maximumSegmentLength == maximumSegmentLength )
+    {
+        numberOfSegments = static_cast< int >( std::ceil( ( endTime - startTime ) / maximumSegmentLength - 1.0E-12 ) );
+        numberOfSegments = std::max( numberOfSegments, 1 );
+    }
+
+    // Double number of segments until tolerance is met
+    const std::size_t coefficientsPerSegment = 3 * static_cast< std::size_t >( numberOfNodes );
+    std::vector< double > coefficients;
+    while( true )
+    {
+        if( numberOfSegments > maximumNumberOfSegments )
+        {
+            throw std::runtime_error( "Error when creating Chebyshev ephemeris, tolerance could not be met with at most " +
+                                      std::to_string( maximumNumberOfSegments ) + " segments" );
+        }
+
+        const double segmentLength = ( endTime - startTime ) / numberOfSegments;
+        coefficients.resize( coefficientsPerSegment * numberOfSegments );
+        bool toleranceIsMet = true;
+        for( int i = 0; i < numberOfSegments && toleranceIsMet; i++ )
+        {
+            const double segmentStartTime = startTime + i * segmentLength;
+            double* segmentCoefficients = coefficients.data( ) + coefficientsPerSegment * i;
+            fitChebyshevSegment( stateFunction, segmentStartTime, segmentLength, polynomialDegree, nodeCosines, segmentCoefficients );
+
+            // Check error at test points
+            for( unsigned int j = 0; j < testPoints.size( ) && toleranceIsMet; j++ )
+            {
+                Eigen::Vector6d exactState = stateFunction( segmentStartTime + 0.5 * segmentLength * ( 1.0 + testPoints.at( j ) ) );
+                Eigen::Vector6d fittedState;
+                for( int component = 0; component < 3; component++ )
+                {
+                    double normalizedVelocity;
+                    evaluateChebyshevSeriesAndDerivative( segmentCoefficients + component * numberOfNodes,
+                                                          polynomialDegree,
+                                                          testPoints.at( j ),
+                                                          fittedState( component ),
+                                                          normalizedVelocity );
+                    fittedState( component + 3 ) = 2.0 * normalizedVelocity / segmentLength;
+                }
+
+                if( ( exactState - fittedState ).segment( 0, 3 ).norm( ) > positionTolerance )
+                {
+                    toleranceIsMet = false;
+                }
+                else if( velocityTolerance == velocityTolerance &&
+                         ( exactState - fittedState ).segment( 3, 3 ).norm( ) > velocityTolerance )
+                {
+                    toleranceIsMet = false;
+                }
+            }
+        }
+
+        if( toleranceIsMet )
+        {
+            return std::make_shared< ChebyshevEphemeris >(
+                    startTime, segmentLength, polynomialDegree, coefficients, referenceFrameOrigin, referenceFrameOrientation );
+        }
+        numberOfSegments *= 2;
+    }
+}
+
+void writeChebyshevEphemerisFile( const std::shared_ptr< ChebyshevEphemeris > ephemeris, const std::string& fileName )
+{
+    if( static_cast< int >( ephemeris->getReferenceFrameOrigin( ).size( ) ) >= chebyshevFileFrameNameLength ||
+        static_cast< int >( ephemeris->getReferenceFrameOrientation( ).size( ) ) >= chebyshevFileFrameNameLength )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris file, frame names are too long" );
+    }
+
+    // Create header
+    ChebyshevEphemerisFileHeader header;
+    std::memset( &header, 0, sizeof( header ) );
+    std::memcpy( header.identifier, chebyshevFileIdentifier, sizeof( chebyshevFileIdentifier ) );
+    header.version = chebyshevFileVersion;
+    header.byteOrderCheck = chebyshevFileByteOrderCheck;
+    header.polynomialDegree = ephemeris->getPolynomialDegree( );
+    header.numberOfSegments = ephemeris->getNumberOfSegments( );
+    header.startTime = ephemeris->getStartTime( );
+    header.segmentLength = ephemeris->getSegmentLength( );
+    std::memcpy( header.frameOrigin, ephemeris->getReferenceFrameOrigin( ).c_str( ), ephemeris->getReferenceFrameOrigin( ).size( ) );
+    std::memcpy( header.frameOrientation,
+                 ephemeris->getReferenceFrameOrientation( ).c_str( ),
+                 ephemeris->getReferenceFrameOrientation( ).size( ) );
+
+    // Write header, followed by coefficients
+    std::ofstream stream( fileName, std::ios::out | std::ios::binary | std::ios::trunc );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when opening Chebyshev ephemeris file for writing: " + fileName );
+    }
+    stream.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+    stream.write( reinterpret_cast< const char* >( ephemeris->getCoefficients( ).data( ) ),
+                  ephemeris->getCoefficients( ).size( ) * sizeof( double ) );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris file: " + fileName );
+    }
+}
+
+std::shared_ptr< ChebyshevEphemeris > readChebyshevEphemerisFile( const std::string& fileName )
+{
+    std::ifstream stream( fileName, std::ios::in | std::ios::binary );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when opening Chebyshev ephemeris file: " + fileName );
+    }
+
+    // Read and check header
+    ChebyshevEphemerisFileHeader header;
+    stream.read( reinterpret_cast< char* >( &header ), sizeof( header ) );
+    if( !stream.good( ) || std::memcmp( header.identifier, chebyshevFileIdentifier, sizeof( chebyshevFileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + ", file is not a Chebyshev ephemeris" );
+    }
+    if( header.byteOrderCheck != chebyshevFileByteOrderCheck )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + ", byte order is incompatible" );
+    }
+    if( header.version != chebyshevFileVersion )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + ", version " +
+                                  std::to_string( header.version ) + " is not supported" );
+    }
+    if( header.polynomialDegree < 0 || header.numberOfSegments <= 0 )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + ", header is invalid" );
+    }
+    header.frameOrigin[ chebyshevFileFrameNameLength - 1 ] = '\0';
+    header.frameOrientation[ chebyshevFileFrameNameLength - 1 ] = '\0';
+
+    // Read coefficients
+    std::vector< double > coefficients( static_cast< std::size_t >( header.numberOfSegments ) * 3 * ( header.polynomialDegree + 1 ) );
+    stream.read( reinterpret_cast< char* >( coefficients.data( ) ), coefficients.size( ) * sizeof( double ) );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris file " + fileName + ", file is truncated" );
+    }
+
+    return std::make_shared< ChebyshevEphemeris >( header.startTime,
+                                                   header.segmentLength,
+                                                   header.polynomialDegree,
+                                                   coefficients,
+                                                   std::string( header.frameOrigin ),
+                                                   std::string( header.frameOrientation ) );
+}
+
+}  // namespace ephemerides
+
+}  // namespace tudat
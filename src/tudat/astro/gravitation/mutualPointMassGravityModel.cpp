@@ -0,0 +1,178 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "tudat/astro/gravitation/mutualPointMassGravityModel.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Constructor
+MutualPointMassGravity::MutualPointMassGravity( const std::vector< std::string >& acceleratedBodies,
+                                                const std::vector< std::string >& externalBodies,
+                                                const std::vector< std::function< double( ) > >& gravitationalParameterFunctions,
+                                                const std::vector< std::function< Eigen::Vector3d( ) > >& positionFunctions ):
+    currentTime_( TUDAT_NAN )
+{
+    numberOfAcceleratedBodies_ = static_cast< int >( acceleratedBodies.size( ) );
+    numberOfBodies_ = numberOfAcceleratedBodies_ + static_cast< int >( externalBodies.size( ) );
+
+    if( static_cast< int >( gravitationalParameterFunctions.size( ) ) != numberOfBodies_ ||
+        static_cast< int >( positionFunctions.size( ) ) != numberOfBodies_ )
+    {
+        throw std::runtime_error( "Error when creating mutual point-mass gravity, number of bodies is inconsistent with number of "
+                                  "gravitational parameter and/or position functions." );
+    }
+
+    // Sort accelerated bodies such that the attracting bodies come first, followed by the non-attracting ones
+    std::vector< int > bodyOrder;
+    for( int i = 0; i < numberOfAcceleratedBodies_; i++ )
+    {
+        if( gravitationalParameterFunctions.at( i ) != nullptr )
+        {
+            bodyOrder.push_back( i );
+        }
+    }
+    numberOfAttractingAcceleratedBodies_ = static_cast< int >( bodyOrder.size( ) );
+    for( int i = 0; i < numberOfAcceleratedBodies_; i++ )
+    {
+        if( gravitationalParameterFunctions.at( i ) == nullptr )
+        {
+            bodyOrder.push_back( i );
+        }
+    }
+    for( int i = numberOfAcceleratedBodies_; i < numberOfBodies_; i++ )
+    {
+        if( gravitationalParameterFunctions.at( i ) == nullptr )
+        {
+            throw std::runtime_error( "Error when creating mutual point-mass gravity, no gravitational parameter function provided "
+                                      "for external body " + externalBodies.at( i - numberOfAcceleratedBodies_ ) );
+        }
+        bodyOrder.push_back( i );
+    }
+
+    for( int i = 0; i < numberOfBodies_; i++ )
+    {
+        bodyNames_.push_back( bodyOrder.at( i ) < numberOfAcceleratedBodies_ ?
+                                      acceleratedBodies.at( bodyOrder.at( i ) ) :
+                                      externalBodies.at( bodyOrder.at( i ) - numberOfAcceleratedBodies_ ) );
+        gravitationalParameterFunctions_.push_back( gravitationalParameterFunctions.at( bodyOrder.at( i ) ) );
+        positionFunctions_.push_back( positionFunctions.at( bodyOrder.at( i ) ) );
+
+        if( i < numberOfAcceleratedBodies_ )
+        {
+            if( acceleratedBodyMap_.count( bodyNames_.at( i ) ) > 0 )
+            {
+                throw std::runtime_error( "Error when creating mutual point-mass gravity, body " + bodyNames_.at( i ) +
+                                          " is accelerated multiple times." );
+            }
+            acceleratedBodyMap_[ bodyNames_.at( i ) ] = i;
+        }
+    }
+
+    gravitationalParameters_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    positionsX_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    positionsY_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    positionsZ_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+
+    accelerationsX_ = Eigen::ArrayXd::Zero( numberOfAcceleratedBodies_ );
+    accelerationsY_ = Eigen::ArrayXd::Zero( numberOfAcceleratedBodies_ );
+    accelerationsZ_ = Eigen::ArrayXd::Zero( numberOfAcceleratedBodies_ );
+
+    relativePositionsX_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    relativePositionsY_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    relativePositionsZ_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+    inverseCubedDistances_ = Eigen::ArrayXd::Zero( numberOfBodies_ );
+}
+
+//! Function to update the accelerations of all bodies to the current time
+void MutualPointMassGravity::update( const double currentTime )
+{
+    if( !( currentTime_ == currentTime ) )
+    {
+        Eigen::Vector3d currentPosition;
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            currentPosition = positionFunctions_[ i ]( );
+            positionsX_( i ) = currentPosition( 0 );
+            positionsY_( i ) = currentPosition( 1 );
+            positionsZ_( i ) = currentPosition( 2 );
+            if( gravitationalParameterFunctions_[ i ] != nullptr )
+            {
+                gravitationalParameters_( i ) = gravitationalParameterFunctions_[ i ]( );
+            }
+        }
+
+        computeAccelerations( );
+        currentTime_ = currentTime;
+    }
+}
+
+//! Function to compute the accelerations from the current positions and gravitational parameters
+void MutualPointMassGravity::computeAccelerations( )
+{
+    accelerationsX_.setZero( );
+    accelerationsY_.setZero( );
+    accelerationsZ_.setZero( );
+
+    for( int i = 0; i < numberOfAcceleratedBodies_; i++ )
+    {
+        // Attracting bodies interact with all subsequent bodies; non-attracting bodies only with the external bodies
+        const bool bodyIsAttracting = ( i < numberOfAttractingAcceleratedBodies_ );
+        const int firstInteractingBody = bodyIsAttracting ? ( i + 1 ) : numberOfAcceleratedBodies_;
+        const int numberOfInteractingBodies = numberOfBodies_ - firstInteractingBody;
+        if( numberOfInteractingBodies == 0 )
+        {
+            continue;
+        }
+
+        // Compute r_{ij} / |r_{ij}|^3 for all interacting bodies j
+        auto relativePositionsX = relativePositionsX_.head( numberOfInteractingBodies );
+        auto relativePositionsY = relativePositionsY_.head( numberOfInteractingBodies );
+        auto relativePositionsZ = relativePositionsZ_.head( numberOfInteractingBodies );
+        auto inverseCubedDistances = inverseCubedDistances_.head( numberOfInteractingBodies );
+
+        relativePositionsX = positionsX_.segment( firstInteractingBody, numberOfInteractingBodies ) - positionsX_( i );
+        relativePositionsY = positionsY_.segment( firstInteractingBody, numberOfInteractingBodies ) - positionsY_( i );
+        relativePositionsZ = positionsZ_.segment( firstInteractingBody, numberOfInteractingBodies ) - positionsZ_( i );
+        inverseCubedDistances = relativePositionsX.square( ) + relativePositionsY.square( ) + relativePositionsZ.square( );
+        inverseCubedDistances = ( inverseCubedDistances * inverseCubedDistances.sqrt( ) ).inverse( );
+
+        relativePositionsX *= inverseCubedDistances;
+        relativePositionsY *= inverseCubedDistances;
+        relativePositionsZ *= inverseCubedDistances;
+
+        // Add accelerations exerted on body i
+        auto interactingGravitationalParameters = gravitationalParameters_.segment( firstInteractingBody, numberOfInteractingBodies );
+        accelerationsX_( i ) += ( interactingGravitationalParameters * relativePositionsX ).sum( );
+        accelerationsY_( i ) += ( interactingGravitationalParameters * relativePositionsY ).sum( );
+        accelerationsZ_( i ) += ( interactingGravitationalParameters * relativePositionsZ ).sum( );
+
+        // Add opposite accelerations exerted by body i on accelerated bodies j
+        const int numberOfInteractingAcceleratedBodies = numberOfAcceleratedBodies_ - firstInteractingBody;
+        if( bodyIsAttracting && numberOfInteractingAcceleratedBodies > 0 )
+        {
+            const double gravitationalParameter = gravitationalParameters_( i );
+            accelerationsX_.segment( firstInteractingBody, numberOfInteractingAcceleratedBodies ) -=
+                    gravitationalParameter * relativePositionsX.head( numberOfInteractingAcceleratedBodies );
+            accelerationsY_.segment( firstInteractingBody, numberOfInteractingAcceleratedBodies ) -=
+                    gravitationalParameter * relativePositionsY.head( numberOfInteractingAcceleratedBodies );
+            accelerationsZ_.segment( firstInteractingBody, numberOfInteractingAcceleratedBodies ) -=
+                    gravitationalParameter * relativePositionsZ.head( numberOfInteractingAcceleratedBodies );
+        }
+    }
+}
+
+}  // namespace gravitation
+
+}  // namespace tudat
@@ -17,15 +17,17 @@ namespace tudat
 namespace gravitation
 {
 
-void PolyhedronGravityCache::update( const Eigen::Vector3d& currentBodyFixedPosition )
+void PolyhedronGravityCache::update( const Eigen::Vector3d& currentBodyFixedPosition, const bool useFarFieldExpansion )
 {
-    //    if ( currentBodyFixedPosition_.hasNaN( ) || currentBodyFixedPosition != currentBodyFixedPosition_ )
-    {
-        currentBodyFixedPosition_ = currentBodyFixedPosition;
+    currentBodyFixedPosition_ = currentBodyFixedPosition;
+    farFieldPotentialIsCurrent_ = false;
 
+    if( polyhedronKernel_ == nullptr )
+    {
         // Compute coordinates of vertices with respect to field point
         basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
                 currentVerticesCoordinatesRelativeToFieldPoint_, currentBodyFixedPosition_, verticesCoordinates_ );
+        relativeCoordinatesAreCurrent_ = true;
 
         // Compute per-facet factor
         basic_mathematics::calculatePolyhedronPerFacetFactor(
@@ -35,6 +37,140 @@ void PolyhedronGravityCache::update( const Eigen::Vector3d& currentBodyFixedPosi
         basic_mathematics::calculatePolyhedronPerEdgeFactor(
                 currentPerEdgeFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachEdge_ );
     }
+    else if( useFarFieldExpansion && currentBodyFixedPosition_.norm( ) > farFieldSwitchRadius_ )
+    {
+        // Compute gradient from far-field expansion (potential is computed when requested)
+        std::map< std::pair< int, int >, Eigen::Vector3d > dummyMap;
+        currentGradientPerUnitDensity_ = computeGeodesyNormalizedGravitationalAccelerationSum( currentBodyFixedPosition_,
+                                                                                               farFieldVolume_,
+                                                                                               farFieldReferenceRadius_,
+                                                                                               farFieldCosineCoefficients_,
+                                                                                               farFieldSineCoefficients_,
+                                                                                               sphericalHarmonicsCache_,
+                                                                                               dummyMap );
+        isFarFieldExpansionUsed_ = true;
+    }
+    else
+    {
+        // Compute per-facet and per-edge factors, potential and gradient in single pass
+        polyhedronKernel_->evaluate( currentBodyFixedPosition_,
+                                     currentPerFacetFactor_,
+                                     currentPerEdgeFactor_,
+                                     currentPotentialPerUnitDensity_,
+                                     currentGradientPerUnitDensity_ );
+        relativeCoordinatesAreCurrent_ = false;
+        isFarFieldExpansionUsed_ = false;
+    }
+}
+
+Eigen::MatrixXd& PolyhedronGravityCache::getVerticesCoordinatesRelativeToFieldPoint( )
+{
+    if( !relativeCoordinatesAreCurrent_ )
+    {
+        basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
+                currentVerticesCoordinatesRelativeToFieldPoint_, currentBodyFixedPosition_, verticesCoordinates_ );
+        relativeCoordinatesAreCurrent_ = true;
+    }
+    return currentVerticesCoordinatesRelativeToFieldPoint_;
+}
+
+double PolyhedronGravityCache::getPotentialPerUnitDensity( )
+{
+    if( polyhedronKernel_ == nullptr )
+    {
+        throw std::runtime_error( "Error when retrieving potential from polyhedron gravity cache, cache was created without dyads" );
+    }
+
+    if( isFarFieldExpansionUsed_ && !farFieldPotentialIsCurrent_ )
+    {
+        currentPotentialPerUnitDensity_ = calculateSphericalHarmonicGravitationalPotential( currentBodyFixedPosition_,
+                                                                                           farFieldVolume_,
+                                                                                           farFieldReferenceRadius_,
+                                                                                           farFieldCosineCoefficients_,
+                                                                                           farFieldSineCoefficients_,
+                                                                                           sphericalHarmonicsCache_ );
+        farFieldPotentialIsCurrent_ = true;
+    }
+    return currentPotentialPerUnitDensity_;
+}
+
+const Eigen::Vector3d& PolyhedronGravityCache::getGradientOfPotentialPerUnitDensity( )
+{
+    if( polyhedronKernel_ == nullptr )
+    {
+        throw std::runtime_error(
+                "Error when retrieving potential gradient from polyhedron gravity cache, cache was created without dyads" );
+    }
+    return currentGradientPerUnitDensity_;
+}
+
+void PolyhedronGravityCache::setFarFieldExpansion( const Eigen::MatrixXd& cosineCoefficients,
+                                                   const Eigen::MatrixXd& sineCoefficients,
+                                                   const double referenceRadius,
+                                                   const double switchRadius,
+                                                   const double volume )
+{
+    if( polyhedronKernel_ == nullptr )
+    {
+        throw std::runtime_error(
+                "Error when setting far-field expansion in polyhedron gravity cache, cache was created without dyads" );
+    }
+    if( cosineCoefficients.rows( ) != sineCoefficients.rows( ) || cosineCoefficients.cols( ) != sineCoefficients.cols( ) )
+    {
+        throw std::runtime_error(
+                "Error when setting far-field expansion in polyhedron gravity cache, coefficient sizes are inconsistent" );
+    }
+
+    farFieldCosineCoefficients_ = cosineCoefficients;
+    farFieldSineCoefficients_ = sineCoefficients;
+    farFieldReferenceRadius_ = referenceRadius;
+    farFieldSwitchRadius_ = switchRadius;
+    farFieldVolume_ = volume;
+    sphericalHarmonicsCache_.resetMaximumDegreeAndOrder( cosineCoefficients.rows( ) + 1, cosineCoefficients.cols( ) + 1 );
+
+    currentBodyFixedPosition_.setConstant( TUDAT_NAN );
+    isFarFieldExpansionUsed_ = false;
+}
+
+void PolyhedronGravityCache::setNumberOfThreads( const int numberOfThreads )
+{
+    if( polyhedronKernel_ == nullptr )
+    {
+        throw std::runtime_error( "Error when setting number of threads in polyhedron gravity cache, cache was created without dyads" );
+    }
+    polyhedronKernel_->setNumberOfThreads( numberOfThreads );
+}
+
+void PolyhedronGravityField::setFarFieldSphericalHarmonicExpansion( const int maximumDegree, const double brillouinSphereMarginFactor )
+{
+    if( !( brillouinSphereMarginFactor >= 1.0 ) )
+    {
+        throw std::runtime_error( "Error when setting far-field expansion of polyhedron gravity field, Brillouin sphere margin factor (" +
+                                  std::to_string( brillouinSphereMarginFactor ) + ") must be at least 1" );
+    }
+
+    brillouinSphereRadius_ = basic_astrodynamics::computePolyhedronBrillouinSphereRadius( verticesCoordinates_ );
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients = basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+            verticesCoordinates_, verticesDefiningEachFacet_, maximumDegree, brillouinSphereRadius_ );
+    farFieldCosineCoefficients_ = coefficients.first;
+    farFieldSineCoefficients_ = coefficients.second;
+    farFieldMaximumDegree_ = maximumDegree;
+    farFieldBrillouinSphereMarginFactor_ = brillouinSphereMarginFactor;
+
+    configurePolyhedronGravityCache( polyhedronGravityCache_ );
+}
+
+void PolyhedronGravityField::configurePolyhedronGravityCache( const std::shared_ptr< PolyhedronGravityCache > polyhedronCache )
+{
+    polyhedronCache->setNumberOfThreads( numberOfThreads_ );
+    if( isFarFieldExpansionSet( ) )
+    {
+        polyhedronCache->setFarFieldExpansion( farFieldCosineCoefficients_,
+                                               farFieldSineCoefficients_,
+                                               brillouinSphereRadius_,
+                                               farFieldBrillouinSphereMarginFactor_ * brillouinSphereRadius_,
+                                               volume_ );
+    }
 }
 
 void PolyhedronGravityField::computeVerticesAndFacetsDefiningEachEdge( )
@@ -363,7 +363,7 @@ MappedTroposphericCorrection::MappedTroposphericCorrection( const LightTimeCorre
                                                             std::function< double( double time ) > wetZenithRangeCorrectionFunction ):
     LightTimeCorrection( lightTimeCorrectionType ), dryZenithRangeCorrectionFunction_( dryZenithRangeCorrectionFunction ),
     wetZenithRangeCorrectionFunction_( wetZenithRangeCorrectionFunction ), elevationMapping_( elevationMapping ),
-    isUplinkCorrection_( isUplinkCorrection )
+    isUplinkCorrection_( isUplinkCorrection ), stationCache_( nullptr ), stationCacheTermIndex_( -1 )
 { }
 
 double MappedTroposphericCorrection::calculateLightTimeCorrectionWithMultiLegLinkEndStates(
@@ -393,11 +393,14 @@ double MappedTroposphericCorrection::calculateLightTimeCorrectionWithMultiLegLin
         stationTime = receptionTime;
     }
 
+    // Retrieve dry and wet zenith corrections (shared between observation models through station cache, if set)
+    const Eigen::VectorXd& zenithRangeCorrections = getStationTerms( stationTime );
+
     // Moyer (2000), eq. 10-1
     double delay =
-            ( dryZenithRangeCorrectionFunction_( stationTime ) *
+            ( zenithRangeCorrections( 0 ) *
                       elevationMapping_->computeDryTroposphericMapping( transmitterState, receiverState, transmissionTime, receptionTime ) +
-              wetZenithRangeCorrectionFunction_( stationTime ) *
+              zenithRangeCorrections( 1 ) *
                       elevationMapping_->computeWetTroposphericMapping(
                               transmitterState, receiverState, transmissionTime, receptionTime ) ) /
             physical_constants::getSpeedOfLight< double >( );
@@ -493,25 +496,24 @@ double VMF3TroposphericCorrection::calculateLightTimeCorrectionWithMultiLegLinkE
     // Get station time (uplink or downlink)
     double stationTime = ( isUplinkCorrection_ ? transmissionTime : receptionTime );
 
-    // Extract mapping coefficients from station data
-    Eigen::Vector2d mappingCoefficients = troposphereData_->getMappingFunction( stationTime );
-
-    // Downcast to VMF3MappingModel and update coefficients
-    std::shared_ptr< VMF3MappingModel > vmf3Mapping = std::dynamic_pointer_cast< VMF3MappingModel >( elevationMapping_ );
-    if( vmf3Mapping == nullptr )
+    if( vmf3Mapping_ == nullptr )
     {
         throw std::runtime_error( "Error: VMF3MappingModel dynamic cast failed in calculateLightTimeCorrectionWithMultiLegLinkEndStates." );
     }
-    vmf3Mapping->updateMappingCoefficients( mappingCoefficients );
 
-    // Compute mapping contributions
-    double dryMapping = vmf3Mapping->computeDryTroposphericMapping( transmitterState, receiverState, transmissionTime, receptionTime );
+    // Retrieve zenith delays, mapping coefficients and seasonal coefficients (shared through station cache, if set)
+    const Eigen::VectorXd& stationTerms = getStationTerms( stationTime );
+    vmf3Mapping_->updateMappingCoefficients( stationTerms.segment< 2 >( 2 ) );
+    vmf3Mapping_->updateSeasonalMappingCoefficients( stationTerms.segment< 4 >( 4 ), stationTime );
 
-    double wetMapping = vmf3Mapping->computeWetTroposphericMapping( transmitterState, receiverState, transmissionTime, receptionTime );
+    // Compute mapping contributions
+    vmf3Mapping_->computeCurrentVMFdata( transmitterState, receiverState, transmissionTime, receptionTime );
+    double dryMapping = vmf3Mapping_->computeMappingFunction( stationTerms( 2 ), true );
+    double wetMapping = vmf3Mapping_->computeMappingFunction( stationTerms( 3 ), false );
 
     // Get zenith delays
-    double dryZenith = computeDryZenithRangeCorrection( stationTime );
-    double wetZenith = computeWetZenithRangeCorrection( stationTime );
+    double dryZenith = stationTerms( 0 );
+    double wetZenith = stationTerms( 1 );
 
     // Base correction
     double correction = dryZenith * dryMapping + wetZenith * wetMapping;
@@ -522,9 +524,8 @@ double VMF3TroposphericCorrection::calculateLightTimeCorrectionWithMultiLegLinkE
         try
         {
             Eigen::Vector4d gradients = troposphereData_->getGradient( stationTime );
-            double gradientContribution =
-                    std::dynamic_pointer_cast< VMF3MappingModel >( elevationMapping_ )
-                            ->computeGradientContribution( transmitterState, receiverState, transmissionTime, receptionTime, gradients );
+            double gradientContribution = vmf3Mapping_->computeGradientContribution(
+                    transmitterState, receiverState, transmissionTime, receptionTime, gradients );
             correction += gradientContribution;
         }
         catch( const std::exception& )
@@ -536,6 +537,15 @@ double VMF3TroposphericCorrection::calculateLightTimeCorrectionWithMultiLegLinkE
     return correction / physical_constants::getSpeedOfLight< double >( );
 }
 
+Eigen::VectorXd VMF3TroposphericCorrection::computeStationTerms( const double stationTime )
+{
+    Eigen::VectorXd stationTerms = Eigen::VectorXd( 8 );
+    stationTerms.segment< 2 >( 0 ) = troposphereData_->getZenithDelay( stationTime );
+    stationTerms.segment< 2 >( 2 ) = troposphereData_->getMappingFunction( stationTime );
+    stationTerms.segment< 4 >( 4 ) = vmf3Mapping_->computeSeasonalMappingCoefficients( stationTime );
+    return stationTerms;
+}
+
 double VMF3MappingModel::computeDryTroposphericMapping( const Eigen::Vector6d& transmitterState,
                                                         const Eigen::Vector6d& receiverState,
                                                         const double transmissionTime,
@@ -578,37 +588,44 @@ void VMF3MappingModel::computeCurrentVMFdata( const Eigen::Vector6d& transmitter
     Eigen::Vector3d relativeVector = spacecraftState.segment( 0, 3 ) - groundStationState.segment( 0, 3 );
     currentElevation_ = elevationFunction_( relativeVector, groundStationTime );
     currentAzimuth_ = azimuthFunction_( relativeVector, groundStationTime );
+    currentGroundStationTime_ = groundStationTime;
+
+    // Seasonal coefficients depend only on station and epoch, recompute only if not yet set for current time
+    if( !( seasonalMappingCoefficientsTime_ == groundStationTime ) )
+    {
+        updateSeasonalMappingCoefficients( computeSeasonalMappingCoefficients( groundStationTime ), groundStationTime );
+    }
+}
 
+Eigen::Vector4d VMF3MappingModel::computeSeasonalMappingCoefficients( const double groundStationTime )
+{
     Eigen::Vector3d geodetic = groundStationGeodeticPositionFunction_( groundStationTime );
-    currentStationLatitude_ = geodetic( 1 );
-    currentStationLongitude_ = geodetic( 2 );
 
     // Seasonal variation: F2
     double utcTime =
             timeScaleConverter_->getCurrentTime( basic_astrodynamics::tdb_scale, basic_astrodynamics::utc_scale, groundStationTime );
-    currentDayOfYear_ = sofa_interface::convertSecondsSinceEpochToSecondsOfYear( utcTime ) / physical_constants::JULIAN_DAY;
+    double dayOfYear = sofa_interface::convertSecondsSinceEpochToSecondsOfYear( utcTime ) / physical_constants::JULIAN_DAY;
+
+    // Spherical harmonic basis functions are identical for all coefficients
+    VnmWnmMatrix basisFunctions = computeVnmWnmMatrix( 12, geodetic( 1 ), geodetic( 2 ) );
+
+    Eigen::Vector4d seasonalMappingCoefficients;
+    seasonalMappingCoefficients( 0 ) = evaluateSeasonalCoefficient(
+            anm_bh_.A0, anm_bh_.A1, anm_bh_.B1, anm_bh_.A2, anm_bh_.B2, basisFunctions.V, basisFunctions.W, dayOfYear );
+    seasonalMappingCoefficients( 1 ) = evaluateSeasonalCoefficient(
+            anm_ch_.A0, anm_ch_.A1, anm_ch_.B1, anm_ch_.A2, anm_ch_.B2, basisFunctions.V, basisFunctions.W, dayOfYear );
+    seasonalMappingCoefficients( 2 ) = evaluateSeasonalCoefficient(
+            anm_bw_.A0, anm_bw_.A1, anm_bw_.B1, anm_bw_.A2, anm_bw_.B2, basisFunctions.V, basisFunctions.W, dayOfYear );
+    seasonalMappingCoefficients( 3 ) = evaluateSeasonalCoefficient(
+            anm_cw_.A0, anm_cw_.A1, anm_cw_.B1, anm_cw_.A2, anm_cw_.B2, basisFunctions.V, basisFunctions.W, dayOfYear );
+    return seasonalMappingCoefficients;
 }
 
 double VMF3MappingModel::computeMappingFunction( const double mappingCoefficient, const bool isHydrostatic ) const
 {
     const double a = mappingCoefficient;
-    const double bh = evaluateSeasonalCoefficient( isHydrostatic ? anm_bh_.A0 : anm_bw_.A0,
-                                                   isHydrostatic ? anm_bh_.A1 : anm_bw_.A1,
-                                                   isHydrostatic ? anm_bh_.B1 : anm_bw_.B1,
-                                                   isHydrostatic ? anm_bh_.A2 : anm_bw_.A2,
-                                                   isHydrostatic ? anm_bh_.B2 : anm_bw_.B2,
-                                                   computeVnmWnmMatrix( 12, currentStationLatitude_, currentStationLongitude_ ).V,
-                                                   computeVnmWnmMatrix( 12, currentStationLatitude_, currentStationLongitude_ ).W,
-                                                   currentDayOfYear_ );
-
-    const double ch = evaluateSeasonalCoefficient( isHydrostatic ? anm_ch_.A0 : anm_cw_.A0,
-                                                   isHydrostatic ? anm_ch_.A1 : anm_cw_.A1,
-                                                   isHydrostatic ? anm_ch_.B1 : anm_cw_.B1,
-                                                   isHydrostatic ? anm_ch_.A2 : anm_cw_.A2,
-                                                   isHydrostatic ? anm_ch_.B2 : anm_cw_.B2,
-                                                   computeVnmWnmMatrix( 12, currentStationLatitude_, currentStationLongitude_ ).V,
-                                                   computeVnmWnmMatrix( 12, currentStationLatitude_, currentStationLongitude_ ).W,
-                                                   currentDayOfYear_ );
+    const double bh = currentSeasonalMappingCoefficients_( isHydrostatic ? 0 : 2 );
+    const double ch = currentSeasonalMappingCoefficients_( isHydrostatic ? 1 : 3 );
 
     return ( 1.0 + a / ( 1.0 + bh / ( 1.0 + ch ) ) ) /
             ( std::sin( currentElevation_ ) + a / ( std::sin( currentElevation_ ) + bh / ( std::sin( currentElevation_ ) + ch ) ) );
@@ -767,7 +784,8 @@ TabulatedIonosphericCorrection::TabulatedIonosphericCorrection(
         bool isUplinkCorrection,
         double referenceFrequency ):
     LightTimeCorrection( tabulated_ionospheric ), referenceCorrectionCalculator_( referenceCorrectionCalculator ),
-    referenceFrequency_( referenceFrequency ), isUplinkCorrection_( isUplinkCorrection )
+    referenceFrequency_( referenceFrequency ), isUplinkCorrection_( isUplinkCorrection ), stationCache_( nullptr ),
+    stationCacheTermIndex_( -1 )
 {
     if( isRadiometricObservableType( baseObservableType ) )
     {
@@ -827,12 +845,24 @@ double TabulatedIonosphericCorrection::calculateLightTimeCorrectionWithMultiLegL
         stationTime = legReceptionTime;
         currentFrequency = ancillarySettings->getIntermediateDoubleData( received_frequency_intermediate, true );
     }
-    double stationTimeUtc = sofa_interface::convertTTtoUTC( stationTime );
 
     if( !std::isnan( currentFrequency ) )
     {
-        lightTimeCorrection = ( sign_ * referenceCorrectionCalculator_->computeMediaCorrection( stationTimeUtc ) *
-                                std::pow( referenceFrequency_ / currentFrequency, 2.0 ) ) /
+        // Retrieve reference correction (shared between observation models through station cache, if set)
+        double referenceRangeCorrection;
+        if( stationCache_ != nullptr )
+        {
+            referenceRangeCorrection = stationCache_->getTerm( stationCacheTermIndex_, stationTime, [ this ]( const double time ) {
+                return Eigen::VectorXd::Constant( 1, computeReferenceRangeCorrection( time ) );
+            } )( 0 );
+        }
+        else
+        {
+            referenceRangeCorrection = computeReferenceRangeCorrection( stationTime );
+        }
+
+        lightTimeCorrection =
+                ( sign_ * referenceRangeCorrection * std::pow( referenceFrequency_ / currentFrequency, 2.0 ) ) /
                 physical_constants::getSpeedOfLight< double >( );
     }
 
@@ -840,6 +870,11 @@ double TabulatedIonosphericCorrection::calculateLightTimeCorrectionWithMultiLegL
     return lightTimeCorrection;
 }
 
+double TabulatedIonosphericCorrection::computeReferenceRangeCorrection( const double stationTime )
+{
+    return referenceCorrectionCalculator_->computeMediaCorrection( sofa_interface::convertTTtoUTC( stationTime ) );
+}
+
 double JakowskiVtecCalculator::calculateVtec( const double time, const Eigen::Vector3d subIonosphericPointGeodeticPosition )
 {
     const double subIonosphericLatitude = subIonosphericPointGeodeticPosition( 1 );
@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <cmath>
+#include <limits>
+
 #include "tudat/astro/observation_models/observationViabilityCalculator.h"
 
 namespace tudat
@@ -16,6 +19,39 @@ namespace tudat
 namespace observation_models
 {
 
+//! Function to retrieve the number of epochs in a grid of link end times/states
+int getNumberOfViabilityGridEpochs( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                    const std::vector< Eigen::VectorXd >& linkEndTimeGrids )
+{
+    if( linkEndTimeGrids.size( ) > 0 )
+    {
+        return linkEndTimeGrids.at( 0 ).rows( );
+    }
+    else if( linkEndStateGrids.size( ) > 0 )
+    {
+        return linkEndStateGrids.at( 0 ).cols( );
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+//! Function to compute the cosine of the angles between the columns of two matrices
+Eigen::ArrayXd computeCosineOfAnglesBetweenColumns( const Eigen::Matrix3Xd& vectors0, const Eigen::Matrix3Xd& vectors1 )
+{
+    Eigen::ArrayXd cosines = vectors0.cwiseProduct( vectors1 ).colwise( ).sum( ).transpose( ).array( ) /
+            ( vectors0.colwise( ).norm( ).transpose( ).array( ) * vectors1.colwise( ).norm( ).transpose( ).array( ) );
+    return cosines.max( -1.0 ).min( 1.0 );
+}
+
+//! Function to compute the margin w.r.t. the viability criterion, for a full grid of observation epochs.
+Eigen::VectorXd ObservationViabilityCalculator::computeViabilityMargins( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                                                         const std::vector< Eigen::VectorXd >& linkEndTimeGrids )
+{
+    return Eigen::VectorXd::Constant( getNumberOfViabilityGridEpochs( linkEndStateGrids, linkEndTimeGrids ), TUDAT_NAN );
+}
+
 double getEvaluationEpochOfViabilityBody( const std::vector< Eigen::Vector6d >& linkEndStates,
                                           const std::vector< double >& linkEndTimes,
                                           const std::pair< int, int > linkEndIndexPair,
@@ -40,6 +76,51 @@ double getEvaluationEpochOfViabilityBody( const std::vector< Eigen::Vector6d >&
             secondEndEpoch * ( distanceToFirstEnd / ( distanceToFirstEnd + distanceToSecondEnd ) );
 }
 
+//! Function to compute the positions of a viability body (occulting/avoided body), for a grid of observation epochs.
+Eigen::Matrix3Xd getViabilityBodyPositionGrid( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                               const std::vector< Eigen::VectorXd >& linkEndTimeGrids,
+                                               const std::pair< int, int > linkEndIndexPair,
+                                               const std::function< Eigen::Vector6d( const double ) > viabilityBodyStateFunction )
+{
+    const Eigen::VectorXd& firstEndEpochs = linkEndTimeGrids.at( linkEndIndexPair.first );
+    const Eigen::VectorXd& secondEndEpochs = linkEndTimeGrids.at( linkEndIndexPair.second );
+    int numberOfEpochs = firstEndEpochs.rows( );
+
+    // Get position of viability body at first link end times
+    Eigen::Matrix3Xd positionsAtFirstInstant = Eigen::Matrix3Xd::Zero( 3, numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        positionsAtFirstInstant.col( i ) = viabilityBodyStateFunction( firstEndEpochs( i ) ).segment( 0, 3 );
+    }
+
+    // If link ends are evaluated simultaneously, no interpolation between the two epochs is needed
+    if( firstEndEpochs == secondEndEpochs )
+    {
+        return positionsAtFirstInstant;
+    }
+
+    Eigen::Matrix3Xd positionsAtSecondInstant = Eigen::Matrix3Xd::Zero( 3, numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        positionsAtSecondInstant.col( i ) = viabilityBodyStateFunction( secondEndEpochs( i ) ).segment( 0, 3 );
+    }
+
+    // Compute evaluation epochs, weighted by distance to link ends (see getEvaluationEpochOfViabilityBody)
+    Eigen::ArrayXd distancesToFirstEnd =
+            ( positionsAtFirstInstant - linkEndStateGrids.at( linkEndIndexPair.first ).topRows( 3 ) ).colwise( ).norm( ).transpose( );
+    Eigen::ArrayXd distancesToSecondEnd =
+            ( positionsAtSecondInstant - linkEndStateGrids.at( linkEndIndexPair.second ).topRows( 3 ) ).colwise( ).norm( ).transpose( );
+    Eigen::ArrayXd evaluationEpochs = ( firstEndEpochs.array( ) * distancesToSecondEnd + secondEndEpochs.array( ) * distancesToFirstEnd ) /
+            ( distancesToFirstEnd + distancesToSecondEnd );
+
+    Eigen::Matrix3Xd positionsAtEvaluationEpochs = Eigen::Matrix3Xd::Zero( 3, numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        positionsAtEvaluationEpochs.col( i ) = viabilityBodyStateFunction( evaluationEpochs( i ) ).segment( 0, 3 );
+    }
+    return positionsAtEvaluationEpochs;
+}
+
 //! Function to check whether an observation is viable
 bool isObservationViable(
         const std::vector< Eigen::Vector6d >& states,
@@ -76,6 +157,129 @@ bool isObservationViable( const std::vector< Eigen::Vector6d >& states,
     return isObservationFeasible;
 }
 
+//! Function to compute the combined viability margin of a list of viability calculators, for a grid of observation epochs
+Eigen::VectorXd computeObservationViabilityMargins(
+        const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+        const std::vector< Eigen::VectorXd >& linkEndTimeGrids,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators )
+{
+    Eigen::VectorXd viabilityMargins = Eigen::VectorXd::Constant( getNumberOfViabilityGridEpochs( linkEndStateGrids, linkEndTimeGrids ),
+                                                                  std::numeric_limits< double >::infinity( ) );
+
+    for( unsigned int i = 0; i < viabilityCalculators.size( ); i++ )
+    {
+        Eigen::VectorXd currentMargins = viabilityCalculators.at( i )->computeViabilityMargins( linkEndStateGrids, linkEndTimeGrids );
+        if( currentMargins.rows( ) != viabilityMargins.rows( ) )
+        {
+            throw std::runtime_error( "Error when computing observation viability margins, number of margins (" +
+                                      std::to_string( currentMargins.rows( ) ) + ") is inconsistent with number of epochs (" +
+                                      std::to_string( viabilityMargins.rows( ) ) + ")" );
+        }
+
+        // Take minimum margin, propagating NaN margins of calculators that don't support screening
+        for( int j = 0; j < viabilityMargins.rows( ); j++ )
+        {
+            if( !std::isnan( viabilityMargins( j ) ) && !( currentMargins( j ) >= viabilityMargins( j ) ) )
+            {
+                viabilityMargins( j ) = currentMargins( j );
+            }
+        }
+    }
+
+    return viabilityMargins;
+}
+
+//! Function to screen a grid of candidate observation epochs for viability
+std::vector< ObservationViabilityScreeningResult > screenObservationViability(
+        const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+        const std::vector< Eigen::VectorXd >& linkEndTimeGrids,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators,
+        const double screeningTolerance )
+{
+    Eigen::VectorXd viabilityMargins = computeObservationViabilityMargins( linkEndStateGrids, linkEndTimeGrids, viabilityCalculators );
+
+    std::vector< ObservationViabilityScreeningResult > screeningResults;
+    screeningResults.reserve( viabilityMargins.rows( ) );
+    for( int i = 0; i < viabilityMargins.rows( ); i++ )
+    {
+        if( viabilityMargins( i ) > screeningTolerance )
+        {
+            screeningResults.push_back( screened_viable_observation );
+        }
+        else if( viabilityMargins( i ) < -screeningTolerance )
+        {
+            screeningResults.push_back( screened_non_viable_observation );
+        }
+        else
+        {
+            screeningResults.push_back( undetermined_observation_viability );
+        }
+    }
+    return screeningResults;
+}
+
+//! Function to compute the epoch at which a viability margin changes sign, by linear interpolation between two epochs
+double interpolateViabilityBoundary( const double previousEpoch,
+                                     const double currentEpoch,
+                                     const double previousMargin,
+                                     const double currentMargin,
+                                     const double defaultEpoch )
+{
+    if( std::isfinite( previousMargin ) && std::isfinite( currentMargin ) && ( currentMargin != previousMargin ) )
+    {
+        return previousEpoch + ( currentEpoch - previousEpoch ) * ( -previousMargin / ( currentMargin - previousMargin ) );
+    }
+    else
+    {
+        return defaultEpoch;
+    }
+}
+
+//! Function to compute the windows (rise/set times) in which observations are viable, from the viability margins on an epoch grid
+std::vector< std::pair< double, double > > getObservationViabilityWindows( const Eigen::VectorXd& epochs,
+                                                                           const Eigen::VectorXd& viabilityMargins )
+{
+    if( epochs.rows( ) != viabilityMargins.rows( ) )
+    {
+        throw std::runtime_error( "Error when computing observation viability windows, number of epochs (" +
+                                  std::to_string( epochs.rows( ) ) + ") is inconsistent with number of margins (" +
+                                  std::to_string( viabilityMargins.rows( ) ) + ")" );
+    }
+
+    std::vector< std::pair< double, double > > viabilityWindows;
+    bool isWindowOpen = false;
+    double currentRiseTime = TUDAT_NAN;
+    for( int i = 0; i < epochs.rows( ); i++ )
+    {
+        bool isCurrentEpochViable = ( viabilityMargins( i ) >= 0.0 );
+        if( isCurrentEpochViable && !isWindowOpen )
+        {
+            currentRiseTime = ( i == 0 ) ? epochs( 0 )
+                                         : interpolateViabilityBoundary( epochs( i - 1 ),
+                                                                         epochs( i ),
+                                                                         viabilityMargins( i - 1 ),
+                                                                         viabilityMargins( i ),
+                                                                         epochs( i ) );
+            isWindowOpen = true;
+        }
+        else if( !isCurrentEpochViable && isWindowOpen )
+        {
+            viabilityWindows.push_back( std::make_pair(
+                    currentRiseTime,
+                    interpolateViabilityBoundary(
+                            epochs( i - 1 ), epochs( i ), viabilityMargins( i - 1 ), viabilityMargins( i ), epochs( i - 1 ) ) ) );
+            isWindowOpen = false;
+        }
+    }
+
+    if( isWindowOpen )
+    {
+        viabilityWindows.push_back( std::make_pair( currentRiseTime, epochs( epochs.rows( ) - 1 ) ) );
+    }
+
+    return viabilityWindows;
+}
+
 //! Function for determining whether the elevation angle at station is sufficient to allow observation
 bool MinimumElevationAngleCalculator::isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                                                            const std::vector< double >& linkEndTimes )
@@ -97,6 +301,42 @@ bool MinimumElevationAngleCalculator::isObservationViable( const std::vector< Ei
     return isObservationPossible;
 }
 
+//! Function to compute the elevation angle margin (elevation angle minus minimum elevation angle) for a grid of epochs
+Eigen::VectorXd MinimumElevationAngleCalculator::computeViabilityMargins( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                                                          const std::vector< Eigen::VectorXd >& linkEndTimeGrids )
+{
+    int numberOfEpochs = getNumberOfViabilityGridEpochs( linkEndStateGrids, linkEndTimeGrids );
+    Eigen::ArrayXd viabilityMargins = Eigen::ArrayXd::Constant( numberOfEpochs, std::numeric_limits< double >::infinity( ) );
+
+    std::function< Eigen::Quaterniond( const double ) > rotationToBodyFixedFrame =
+            pointingAngleCalculator_->getRotsationFromInertialToBodyFixedFrame( );
+    std::function< Eigen::Quaterniond( const double ) > rotationToTopocentricFrame =
+            pointingAngleCalculator_->getRotationFromBodyFixedToTopoCentricFrame( );
+
+    // Iterate over all sets of entries of input vector for which elvation angle is to be checked.
+    Eigen::Matrix3Xd localZenithDirections = Eigen::Matrix3Xd::Zero( 3, numberOfEpochs );
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        // Compute inertial direction of local zenith at station
+        const Eigen::VectorXd& stationTimes = linkEndTimeGrids.at( linkEndIndices_.at( i ).first );
+        for( int j = 0; j < numberOfEpochs; j++ )
+        {
+            localZenithDirections.col( j ) =
+                    ( rotationToTopocentricFrame( stationTimes( j ) ) * rotationToBodyFixedFrame( stationTimes( j ) ) ).inverse( ) *
+                    Eigen::Vector3d::UnitZ( );
+        }
+
+        // Compute elevation angles for all epochs at once
+        Eigen::Matrix3Xd targetRelativePositions =
+                linkEndStateGrids.at( linkEndIndices_.at( i ).second ).topRows( 3 ) -
+                linkEndStateGrids.at( linkEndIndices_.at( i ).first ).topRows( 3 );
+        Eigen::ArrayXd elevationAngles = computeCosineOfAnglesBetweenColumns( localZenithDirections, targetRelativePositions ).asin( );
+        viabilityMargins = viabilityMargins.min( elevationAngles - minimumElevationAngle_ );
+    }
+
+    return viabilityMargins.matrix( );
+}
+
 double computeMinimumLinkDistanceToPoint( const Eigen::Vector3d& observingBody,
                                           const Eigen::Vector3d& transmittingBody,
                                           const Eigen::Vector3d& relativePoint )
@@ -181,6 +421,31 @@ bool BodyAvoidanceAngleCalculator::isObservationViable( const std::vector< Eigen
     return isObservationPossible;
 }
 
+//! Function to compute the avoidance angle margin (avoidance angle minus minimum avoidance angle) for a grid of epochs
+Eigen::VectorXd BodyAvoidanceAngleCalculator::computeViabilityMargins( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                                                       const std::vector< Eigen::VectorXd >& linkEndTimeGrids )
+{
+    int numberOfEpochs = getNumberOfViabilityGridEpochs( linkEndStateGrids, linkEndTimeGrids );
+    Eigen::ArrayXd viabilityMargins = Eigen::ArrayXd::Constant( numberOfEpochs, std::numeric_limits< double >::infinity( ) );
+
+    // Iterate over all sets of entries of input vector for which avoidance angle is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        Eigen::Matrix3Xd positionsOfBodyToAvoid =
+                getViabilityBodyPositionGrid( linkEndStateGrids, linkEndTimeGrids, linkEndIndices_.at( i ), stateFunctionOfBodyToAvoid_ );
+        const LinkEndStateGrid& observingStates = linkEndStateGrids.at( linkEndIndices_.at( i ).first );
+        const LinkEndStateGrid& transmittingStates = linkEndStateGrids.at( linkEndIndices_.at( i ).second );
+
+        // Compute avoidance angles for all epochs at once
+        Eigen::Matrix3Xd vectorsToBodyToAvoid = positionsOfBodyToAvoid - observingStates.topRows( 3 );
+        Eigen::Matrix3Xd lineOfSightVectors = transmittingStates.topRows( 3 ) - observingStates.topRows( 3 );
+        Eigen::ArrayXd avoidanceAngles = computeCosineOfAnglesBetweenColumns( vectorsToBodyToAvoid, lineOfSightVectors ).acos( );
+        viabilityMargins = viabilityMargins.min( avoidanceAngles - bodyAvoidanceAngle_ );
+    }
+
+    return viabilityMargins.matrix( );
+}
+
 bool computeOccultation( const Eigen::Vector3d observer1Position,
                          const Eigen::Vector3d observer2Position,
                          const Eigen::Vector3d occulterPosition,
@@ -252,6 +517,36 @@ bool OccultationCalculator::isObservationViable( const std::vector< Eigen::Vecto
     return isObservationPossible;
 }
 
+//! Function to compute the occultation margin for a grid of epochs
+Eigen::VectorXd OccultationCalculator::computeViabilityMargins( const std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                                                const std::vector< Eigen::VectorXd >& linkEndTimeGrids )
+{
+    int numberOfEpochs = getNumberOfViabilityGridEpochs( linkEndStateGrids, linkEndTimeGrids );
+    Eigen::ArrayXd viabilityMargins = Eigen::ArrayXd::Constant( numberOfEpochs, std::numeric_limits< double >::infinity( ) );
+
+    // Iterate over all sets of entries of input vector for which occultation is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        Eigen::Matrix3Xd occulterPositions = getViabilityBodyPositionGrid(
+                linkEndStateGrids, linkEndTimeGrids, linkEndIndices_.at( i ), stateFunctionOfOccultingBody_ );
+        Eigen::Matrix3Xd firstEndPositions = linkEndStateGrids.at( linkEndIndices_.at( i ).first ).topRows( 3 );
+        Eigen::Matrix3Xd linkVectors = linkEndStateGrids.at( linkEndIndices_.at( i ).second ).topRows( 3 ) - firstEndPositions;
+        Eigen::Matrix3Xd firstEndToOcculter = occulterPositions - firstEndPositions;
+
+        // Find point on link closest to occulting body, and compute distance of occulting body to link
+        Eigen::ArrayXd closestPointFractions = ( firstEndToOcculter.cwiseProduct( linkVectors ).colwise( ).sum( ).transpose( ).array( ) /
+                                                 linkVectors.colwise( ).squaredNorm( ).transpose( ).array( ) )
+                                                       .max( 0.0 )
+                                                       .min( 1.0 );
+        Eigen::ArrayXd distancesToLink =
+                ( firstEndToOcculter - linkVectors * closestPointFractions.matrix( ).asDiagonal( ) ).colwise( ).norm( ).transpose( );
+        viabilityMargins = viabilityMargins.min( ( distancesToLink - radiusOfOccultingBody_ ) /
+                                                 firstEndToOcculter.colwise( ).norm( ).transpose( ).array( ) );
+    }
+
+    return viabilityMargins.matrix( );
+}
+
 }  // namespace observation_models
 
 }  // namespace tudat
@@ -54,6 +54,12 @@ void PolyhedronGravityPartial::update( const double currentTime )
         // Calculate Cartesian position in frame fixed to body exerting acceleration
         Eigen::Matrix3d currentRotationToBodyFixedFrame_ = fromBodyFixedToIntegrationFrameRotation_( ).inverse( );
 
+        // Per-facet and per-edge factors are not computed when far-field expansion is used, so evaluate exact polyhedron
+        if( polyhedronCache_->isFarFieldExpansionUsed( ) )
+        {
+            polyhedronCache_->update( polyhedronCache_->getCurrentBodyFixedPosition( ), false );
+        }
+
         // Calculate partial of acceleration wrt position of body undergoing acceleration.
         currentBodyFixedPartialWrtPosition_ = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
                 gravitationalParameterFunction_( ) / volumeFunction_( ),
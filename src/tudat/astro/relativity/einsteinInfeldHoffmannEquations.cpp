@@ -1,3 +1,4 @@
+#include <cmath>
 #include <iostream>
 #include <iomanip>
 
@@ -34,68 +35,59 @@ EinsteinInfeldHoffmannEquations::EinsteinInfeldHoffmannEquations(
     //        }
     //    }
 
-    scalarEihCorrections_.resize( 7 );
-    vectorEihCorrections_.resize( 3 );
+    numberOfAcceleratedBodies_ = static_cast< int >( acceleratedBodies_.size( ) );
+    numberOfAcceleratingBodies_ = static_cast< int >( acceleratingBodies_.size( ) );
+    numberOfBodyPairs_ = numberOfAcceleratingBodies_ * ( numberOfAcceleratingBodies_ - 1 ) / 2;
+
+    // Set indices of body pairs in upper-triangular buffers (diagonal points to zero column at the end)
+    pairIndices_.resize( numberOfAcceleratingBodies_, numberOfAcceleratingBodies_ );
+    int currentPairIndex = 0;
+    for( int i = 0; i < numberOfAcceleratingBodies_; i++ )
+    {
+        pairIndices_( i, i ) = numberOfBodyPairs_;
+        for( int j = i + 1; j < numberOfAcceleratingBodies_; j++ )
+        {
+            pairIndices_( i, j ) = currentPairIndex;
+            pairIndices_( j, i ) = currentPairIndex;
+            currentPairIndex++;
+        }
+    }
 
-    currentGravitationalParameters_.resize( acceleratingBodies_.size( ) );
-    currentPositions_.resize( acceleratingBodies_.size( ) );
-    currentVelocities_.resize( acceleratingBodies_.size( ) );
-    currentSquareSpeeds_.resize( acceleratingBodies_.size( ) );
-    currentLocalPotentials_.resize( acceleratingBodies_.size( ) );
-    totalPointMassAccelerations_.resize( acceleratingBodies_.size( ) );
+    currentGravitationalParameters_ = Eigen::VectorXd::Zero( numberOfAcceleratingBodies_ );
+    currentPositions_ = Eigen::Matrix3Xd::Zero( 3, numberOfAcceleratingBodies_ );
+    currentVelocities_ = Eigen::Matrix3Xd::Zero( 3, numberOfAcceleratingBodies_ );
+    currentSquareSpeeds_ = Eigen::VectorXd::Zero( numberOfAcceleratingBodies_ );
+    currentLocalPotentials_ = Eigen::VectorXd::Zero( numberOfAcceleratingBodies_ );
+    totalPointMassAccelerations_ = Eigen::Matrix3Xd::Zero( 3, numberOfAcceleratingBodies_ );
+    exertingBodyScalarTerms_ = Eigen::VectorXd::Zero( numberOfAcceleratingBodies_ );
 
-    currentRelativePositions_.resize( acceleratingBodies_.size( ) );
-    currentInverseSquareDistances_.resize( acceleratingBodies_.size( ) );
-    currentRelativeDistances_.resize( acceleratingBodies_.size( ) );
-    currentRelativeVelocities_.resize( acceleratingBodies_.size( ) );
+    pairRelativePositions_ = Eigen::Matrix3Xd::Zero( 3, numberOfBodyPairs_ + 1 );
+    pairRelativeVelocities_ = Eigen::Matrix3Xd::Zero( 3, numberOfBodyPairs_ + 1 );
+    pairDistances_ = Eigen::VectorXd::Zero( numberOfBodyPairs_ + 1 );
+    pairInverseDistances_ = Eigen::VectorXd::Zero( numberOfBodyPairs_ + 1 );
+    pairInverseSquareDistances_ = Eigen::VectorXd::Zero( numberOfBodyPairs_ + 1 );
+    pairScaledRelativePositions_ = Eigen::Matrix3Xd::Zero( 3, numberOfBodyPairs_ + 1 );
 
-    lineOfSightSpeed_.resize( acceleratingBodies_.size( ) );
-    velocityInnerProducts_.resize( acceleratingBodies_.size( ) );
-    currentSingleSourceLocalPotential_.resize( acceleratingBodies_.size( ) );
-    singlePointMassAccelerations_.resize( acceleratingBodies_.size( ) );
-    currentSingleAccelerations_.resize( acceleratingBodies_.size( ) );
+    lineOfSightSpeed_ = Eigen::MatrixXd::Zero( numberOfAcceleratingBodies_, numberOfAcceleratingBodies_ );
+    velocityInnerProducts_ = Eigen::MatrixXd::Zero( numberOfAcceleratingBodies_, numberOfAcceleratingBodies_ );
+    totalScalarTermCorrections_ = Eigen::MatrixXd::Zero( numberOfAcceleratingBodies_, numberOfAcceleratingBodies_ );
+    totalVectorTermCorrections_ = Eigen::Matrix3Xd::Zero( 3, numberOfAcceleratingBodies_ * numberOfAcceleratingBodies_ );
 
-    totalScalarTermCorrection.resize( acceleratingBodies_.size( ) );
-    totalVectorTermCorrection_.resize( acceleratingBodies_.size( ) );
+    currentAccelerations_ = Eigen::Matrix3Xd::Zero( 3, numberOfAcceleratedBodies_ );
 
+    scalarEihCorrections_.resize( 7 );
+    vectorEihCorrections_.resize( 3 );
     for( int k = 0; k < 7; k++ )
     {
-        scalarEihCorrections_[ k ].resize( acceleratingBodies_.size( ) );
+        scalarEihCorrections_[ k ].resize( acceleratingBodies_.size( ), std::vector< double >( acceleratingBodies_.size( ), 0.0 ) );
     }
 
     for( int k = 0; k < 3; k++ )
     {
-        vectorEihCorrections_[ k ].resize( acceleratingBodies_.size( ) );
+        vectorEihCorrections_[ k ].resize( acceleratingBodies_.size( ),
+                                           std::vector< Eigen::Vector3d >( acceleratingBodies_.size( ), Eigen::Vector3d::Zero( ) ) );
     }
 
-    for( unsigned int i = 0; i < acceleratingBodies_.size( ); i++ )
-    {
-        currentRelativePositions_[ i ].resize( acceleratingBodies_.size( ) );
-        currentInverseSquareDistances_[ i ].resize( acceleratingBodies_.size( ) );
-        currentRelativeDistances_[ i ].resize( acceleratingBodies_.size( ) );
-        currentRelativeVelocities_[ i ].resize( acceleratingBodies_.size( ) );
-
-        lineOfSightSpeed_[ i ].resize( acceleratingBodies_.size( ) );
-        velocityInnerProducts_[ i ].resize( acceleratingBodies_.size( ) );
-        currentSingleSourceLocalPotential_[ i ].resize( acceleratingBodies_.size( ) );
-        singlePointMassAccelerations_[ i ].resize( acceleratingBodies_.size( ) );
-        currentSingleAccelerations_[ i ].resize( acceleratingBodies_.size( ) );
-        totalScalarTermCorrection[ i ].resize( acceleratingBodies_.size( ) );
-        totalVectorTermCorrection_[ i ].resize( acceleratingBodies_.size( ) );
-
-        for( int k = 0; k < 7; k++ )
-        {
-            scalarEihCorrections_[ k ][ i ].resize( acceleratingBodies_.size( ) );
-        }
-
-        for( int k = 0; k < 3; k++ )
-        {
-            vectorEihCorrections_[ k ][ i ].resize( acceleratingBodies_.size( ) );
-        }
-    }
-
-    currentAccelerations_.resize( acceleratedBodies_.size( ) );
-
     for( unsigned int i = 0; i < acceleratedBodies.size( ); i++ )
     {
         acceleratedBodyMap_[ acceleratedBodies.at( i ) ] = i;
@@ -127,6 +119,8 @@ void EinsteinInfeldHoffmannEquations::recomputeExpansionMultipliers( )
     vectorTermMultipliers_[ 0 ] = 2.0 * ( 1.0 + currentPpnGamma_ );
     vectorTermMultipliers_[ 1 ] = -1.0 + 2.0 * currentPpnGamma_;
     vectorTermMultipliers_[ 2 ] = ( 3.0 + 4.0 * currentPpnGamma_ ) / 2.0;
+
+    expansionTermsAreComputed_ = false;
 }
 
 void EinsteinInfeldHoffmannEquations::update( const double currentTime )
@@ -135,84 +129,63 @@ void EinsteinInfeldHoffmannEquations::update( const double currentTime )
     {
         currentTime_ = currentTime;
         Eigen::Matrix< double, 6, 1 > currentBodyState;
-        for( unsigned int i = 0; i < acceleratingBodies_.size( ); i++ )
+        for( int i = 0; i < numberOfAcceleratingBodies_; i++ )
         {
             // Extract data from environment
             currentBodyState = bodyStateFunctions_[ i ]( );
-            currentGravitationalParameters_[ i ] = gravitationalParameterFunction_[ i ]( );
+            currentGravitationalParameters_( i ) = gravitationalParameterFunction_[ i ]( );
 
             // Set local variables
-            currentPositions_[ i ] = currentBodyState.segment( 0, 3 );
-            currentVelocities_[ i ] = currentBodyState.segment( 3, 3 );
-            currentSquareSpeeds_[ i ] = currentVelocities_[ i ].dot( currentVelocities_[ i ] );
+            currentPositions_.col( i ) = currentBodyState.segment( 0, 3 );
+            currentVelocities_.col( i ) = currentBodyState.segment( 3, 3 );
         }
 
-        for( unsigned int i = 0; i < acceleratingBodies_.size( ); i++ )
-        {
-            // Reset value
-            currentLocalPotentials_[ i ] = 0.0;
-            totalPointMassAccelerations_[ i ].setZero( );
-
-            for( unsigned int j = 0; j < acceleratingBodies_.size( ); j++ )
-            {
-                // v_{i} * v_{j}
-                velocityInnerProducts_[ i ][ j ] = currentVelocities_[ i ].dot( currentVelocities_[ j ] );
-
-                if( i != j )
-                {
-                    // r_{ij} = r_{j} - r_{i}
-                    currentRelativePositions_[ i ][ j ] = currentPositions_[ j ] - currentPositions_[ i ];
-                    currentRelativeDistances_[ i ][ j ] = currentRelativePositions_[ i ][ j ].norm( );
-                    currentInverseSquareDistances_[ i ][ j ] =
-                            1.0 / ( currentRelativeDistances_[ i ][ j ] * currentRelativeDistances_[ i ][ j ] );
-
-                    currentRelativeVelocities_[ i ][ j ] = currentVelocities_[ j ] - currentVelocities_[ i ];
+        // v_{i} * v_{j}
+        velocityInnerProducts_.noalias( ) = currentVelocities_.transpose( ) * currentVelocities_;
+        currentSquareSpeeds_ = velocityInnerProducts_.diagonal( );
 
-                    // r_{ij} * v_{j}
-                    lineOfSightSpeed_[ i ][ j ] = currentRelativePositions_[ i ][ j ].dot( currentVelocities_[ j ] );
+        currentLocalPotentials_.setZero( );
+        totalPointMassAccelerations_.setZero( );
 
-                    // mu_j / ||r_{ij}||
-                    currentSingleSourceLocalPotential_[ i ][ j ] =
-                            currentGravitationalParameters_[ j ] / currentRelativeDistances_[ i ][ j ];
-
-                    // mu_{j} * r_{ij} / ||r_{ij}||^3
-                    singlePointMassAccelerations_[ i ][ j ] = currentGravitationalParameters_[ j ] * currentRelativePositions_[ i ][ j ] *
-                            currentInverseSquareDistances_[ i ][ j ] / currentRelativeDistances_[ i ][ j ];
-
-                    currentLocalPotentials_[ i ] += currentSingleSourceLocalPotential_[ i ][ j ];
-                    totalPointMassAccelerations_[ i ] += singlePointMassAccelerations_[ i ][ j ];
-                }
-            }
-        }
-
-        for( unsigned int i = 0; i < acceleratedBodies_.size( ); i++ )
+        // Compute pairwise geometry once for each pair (i < j); the (j,i) quantities follow from symmetry
+        Eigen::Vector3d relativePosition;
+        Eigen::Vector3d scaledRelativePosition;
+        for( int i = 0; i < numberOfAcceleratingBodies_; i++ )
         {
-            for( unsigned int j = 0; j < acceleratingBodies_.size( ); j++ )
+            for( int j = i + 1; j < numberOfAcceleratingBodies_; j++ )
             {
-                if( i != j )
-                {
-                    scalarEihCorrections_[ 0 ][ i ][ j ] = scalarTermMultipliers_[ 0 ] * currentLocalPotentials_[ i ];
-                    scalarEihCorrections_[ 1 ][ i ][ j ] = scalarTermMultipliers_[ 1 ] * currentLocalPotentials_[ j ];
-                    scalarEihCorrections_[ 2 ][ i ][ j ] = scalarTermMultipliers_[ 2 ] * velocityInnerProducts_[ i ][ i ];
-
-                    scalarEihCorrections_[ 3 ][ i ][ j ] =
-                            scalarTermMultipliers_[ 3 ] * currentVelocities_[ j ].dot( currentVelocities_[ j ] );
-                    scalarEihCorrections_[ 4 ][ i ][ j ] = scalarTermMultipliers_[ 4 ] * velocityInnerProducts_[ i ][ j ];
-                    scalarEihCorrections_[ 5 ][ i ][ j ] = scalarTermMultipliers_[ 5 ] * lineOfSightSpeed_[ i ][ j ] *
-                            lineOfSightSpeed_[ i ][ j ] / ( currentRelativeDistances_[ i ][ j ] * currentRelativeDistances_[ i ][ j ] );
-                    scalarEihCorrections_[ 6 ][ i ][ j ] =
-                            scalarTermMultipliers_[ 6 ] * currentRelativePositions_[ i ][ j ].dot( totalPointMassAccelerations_[ j ] );
-
-                    vectorEihCorrections_[ 0 ][ i ][ j ] = vectorTermMultipliers_[ 0 ] *
-                            currentRelativePositions_[ i ][ j ].dot( currentVelocities_[ i ] ) * currentInverseSquareDistances_[ i ][ j ] *
-                            currentRelativeVelocities_[ i ][ j ];
-                    vectorEihCorrections_[ 1 ][ i ][ j ] = vectorTermMultipliers_[ 1 ] * lineOfSightSpeed_[ i ][ j ] *
-                            currentInverseSquareDistances_[ i ][ j ] * currentRelativeVelocities_[ i ][ j ];
-                    vectorEihCorrections_[ 2 ][ i ][ j ] = vectorTermMultipliers_[ 2 ] * totalPointMassAccelerations_[ j ];
-                }
+                const int pairIndex = pairIndices_( i, j );
+
+                // r_{ij} = r_{j} - r_{i}
+                relativePosition = currentPositions_.col( j ) - currentPositions_.col( i );
+                pairRelativePositions_.col( pairIndex ) = relativePosition;
+                pairRelativeVelocities_.col( pairIndex ) = currentVelocities_.col( j ) - currentVelocities_.col( i );
+
+                const double squareDistance = relativePosition.squaredNorm( );
+                const double distance = std::sqrt( squareDistance );
+                const double inverseDistance = 1.0 / distance;
+                const double inverseSquareDistance = 1.0 / squareDistance;
+                pairDistances_( pairIndex ) = distance;
+                pairInverseDistances_( pairIndex ) = inverseDistance;
+                pairInverseSquareDistances_( pairIndex ) = inverseSquareDistance;
+
+                // r_{ij} / ||r_{ij}||^3
+                scaledRelativePosition = relativePosition * ( inverseSquareDistance * inverseDistance );
+                pairScaledRelativePositions_.col( pairIndex ) = scaledRelativePosition;
+
+                // r_{ij} * v_{j} and r_{ji} * v_{i}
+                lineOfSightSpeed_( i, j ) = relativePosition.dot( currentVelocities_.col( j ) );
+                lineOfSightSpeed_( j, i ) = -relativePosition.dot( currentVelocities_.col( i ) );
+
+                // Add mu_j / ||r_{ij}|| and mu_{j} * r_{ij} / ||r_{ij}||^3 to both bodies
+                currentLocalPotentials_( i ) += currentGravitationalParameters_( j ) * inverseDistance;
+                currentLocalPotentials_( j ) += currentGravitationalParameters_( i ) * inverseDistance;
+                totalPointMassAccelerations_.col( i ) += currentGravitationalParameters_( j ) * scaledRelativePosition;
+                totalPointMassAccelerations_.col( j ) -= currentGravitationalParameters_( i ) * scaledRelativePosition;
             }
         }
 
+        expansionTermsAreComputed_ = false;
         calculateAccelerations( );
     }
     else
@@ -225,37 +198,87 @@ void EinsteinInfeldHoffmannEquations::calculateAccelerations( )
 {
     using namespace tudat::physical_constants;
 
-    double summedTerm1, summedTerm2;
-    Eigen::Vector3d singleTerm;
+    // Scalar terms that depend only on exerting body j
+    exertingBodyScalarTerms_ = scalarTermMultipliers_[ 1 ] * currentLocalPotentials_ + scalarTermMultipliers_[ 3 ] * currentSquareSpeeds_;
 
-    for( unsigned int i = 0; i < acceleratedBodies_.size( ); i++ )
+    Eigen::Vector3d relativePosition;
+    Eigen::Vector3d relativeVelocity;
+    Eigen::Vector3d vectorTerm;
+    Eigen::Vector3d currentAcceleration;
+    for( int i = 0; i < numberOfAcceleratedBodies_; i++ )
     {
-        currentAccelerations_[ i ].setZero( );
+        // Scalar terms that depend only on undergoing body i
+        const double undergoingBodyScalarTerm =
+                scalarTermMultipliers_[ 0 ] * currentLocalPotentials_( i ) + scalarTermMultipliers_[ 2 ] * currentSquareSpeeds_( i );
 
-        for( unsigned int j = 0; j < acceleratingBodies_.size( ); j++ )
+        currentAcceleration.setZero( );
+        for( int j = 0; j < numberOfAcceleratingBodies_; j++ )
         {
-            currentSingleAccelerations_[ i ][ j ].setZero( );
-
             if( i != j )
             {
-                totalScalarTermCorrection[ i ][ j ] = 0;
-                totalVectorTermCorrection_[ i ][ j ].setZero( );
-                for( int k = 0; k < 7; k++ )
-                {
-                    totalScalarTermCorrection[ i ][ j ] += scalarEihCorrections_[ k ][ i ][ j ];
-                }
-                currentSingleAccelerations_[ i ][ j ] = singlePointMassAccelerations_[ i ][ j ] *
-                        ( 1.0 + totalScalarTermCorrection[ i ][ j ] * physical_constants::INVERSE_SQUARE_SPEED_OF_LIGHT );
+                const int pairIndex = pairIndices_( i, j );
+                const double pairSign = getPairSign( i, j );
+                const double inverseSquareDistance = pairInverseSquareDistances_( pairIndex );
+                const double lineOfSightSpeed = lineOfSightSpeed_( i, j );
+                relativePosition = pairSign * pairRelativePositions_.col( pairIndex );
+                relativeVelocity = pairSign * pairRelativeVelocities_.col( pairIndex );
+
+                const double scalarTerm = undergoingBodyScalarTerm + exertingBodyScalarTerms_( j ) +
+                        scalarTermMultipliers_[ 4 ] * velocityInnerProducts_( i, j ) +
+                        scalarTermMultipliers_[ 5 ] * lineOfSightSpeed * lineOfSightSpeed * inverseSquareDistance +
+                        scalarTermMultipliers_[ 6 ] * relativePosition.dot( totalPointMassAccelerations_.col( j ) );
+                vectorTerm = ( vectorTermMultipliers_[ 0 ] * relativePosition.dot( currentVelocities_.col( i ) ) +
+                               vectorTermMultipliers_[ 1 ] * lineOfSightSpeed ) *
+                                inverseSquareDistance * relativeVelocity +
+                        vectorTermMultipliers_[ 2 ] * totalPointMassAccelerations_.col( j );
+
+                totalScalarTermCorrections_( i, j ) = scalarTerm;
+                totalVectorTermCorrections_.col( i * numberOfAcceleratingBodies_ + j ) = vectorTerm;
+
+                currentAcceleration += ( pairSign * currentGravitationalParameters_( j ) ) *
+                                pairScaledRelativePositions_.col( pairIndex ) *
+                                ( 1.0 + scalarTerm * physical_constants::INVERSE_SQUARE_SPEED_OF_LIGHT ) +
+                        ( currentGravitationalParameters_( j ) * pairInverseDistances_( pairIndex ) *
+                          physical_constants::INVERSE_SQUARE_SPEED_OF_LIGHT ) *
+                                vectorTerm;
+            }
+        }
+        currentAccelerations_.col( i ) = currentAcceleration;
+    }
+}
 
-                for( int k = 0; k < 3; k++ )
+void EinsteinInfeldHoffmannEquations::computeExpansionTerms( )
+{
+    if( !expansionTermsAreComputed_ )
+    {
+        for( int i = 0; i < numberOfAcceleratedBodies_; i++ )
+        {
+            for( int j = 0; j < numberOfAcceleratingBodies_; j++ )
+            {
+                if( i != j )
                 {
-                    totalVectorTermCorrection_[ i ][ j ] += vectorEihCorrections_[ k ][ i ][ j ];
+                    Eigen::Vector3d relativePosition = getRelativePositions( i, j );
+                    double inverseSquareDistance = getInverseSquareDistance( i, j );
+
+                    scalarEihCorrections_[ 0 ][ i ][ j ] = scalarTermMultipliers_[ 0 ] * currentLocalPotentials_( i );
+                    scalarEihCorrections_[ 1 ][ i ][ j ] = scalarTermMultipliers_[ 1 ] * currentLocalPotentials_( j );
+                    scalarEihCorrections_[ 2 ][ i ][ j ] = scalarTermMultipliers_[ 2 ] * currentSquareSpeeds_( i );
+                    scalarEihCorrections_[ 3 ][ i ][ j ] = scalarTermMultipliers_[ 3 ] * currentSquareSpeeds_( j );
+                    scalarEihCorrections_[ 4 ][ i ][ j ] = scalarTermMultipliers_[ 4 ] * velocityInnerProducts_( i, j );
+                    scalarEihCorrections_[ 5 ][ i ][ j ] =
+                            scalarTermMultipliers_[ 5 ] * lineOfSightSpeed_( i, j ) * lineOfSightSpeed_( i, j ) * inverseSquareDistance;
+                    scalarEihCorrections_[ 6 ][ i ][ j ] =
+                            scalarTermMultipliers_[ 6 ] * relativePosition.dot( totalPointMassAccelerations_.col( j ) );
+
+                    vectorEihCorrections_[ 0 ][ i ][ j ] = vectorTermMultipliers_[ 0 ] *
+                            relativePosition.dot( currentVelocities_.col( i ) ) * inverseSquareDistance * getRelativeVelocity( i, j );
+                    vectorEihCorrections_[ 1 ][ i ][ j ] =
+                            vectorTermMultipliers_[ 1 ] * lineOfSightSpeed_( i, j ) * inverseSquareDistance * getRelativeVelocity( i, j );
+                    vectorEihCorrections_[ 2 ][ i ][ j ] = vectorTermMultipliers_[ 2 ] * totalPointMassAccelerations_.col( j );
                 }
-                currentSingleAccelerations_[ i ][ j ] += currentSingleSourceLocalPotential_[ i ][ j ] *
-                        totalVectorTermCorrection_[ i ][ j ] * physical_constants::INVERSE_SQUARE_SPEED_OF_LIGHT;
             }
-            currentAccelerations_[ i ] += currentSingleAccelerations_[ i ][ j ];
         }
+        expansionTermsAreComputed_ = true;
     }
 }
 
@@ -0,0 +1,88 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/basics/fixedPointTime.h"
+
+namespace tudat
+{
+
+//! Function to convert a list of times in seconds since epoch to FixedPointTime objects
+std::vector< FixedPointTime > convertSecondsToFixedPointTimes( const std::vector< double >& secondsSinceEpoch )
+{
+    std::vector< FixedPointTime > times( secondsSinceEpoch.size( ) );
+    const double* secondsData = secondsSinceEpoch.data( );
+    FixedPointTime* timesData = times.data( );
+    for( std::size_t i = 0; i < secondsSinceEpoch.size( ); i++ )
+    {
+        timesData[ i ] = FixedPointTime( secondsData[ i ] );
+    }
+    return times;
+}
+
+//! Function to convert a list of FixedPointTime objects to seconds since epoch (in double precision)
+std::vector< double > convertFixedPointTimesToSeconds( const std::vector< FixedPointTime >& times )
+{
+    std::vector< double > secondsSinceEpoch( times.size( ) );
+    const FixedPointTime* timesData = times.data( );
+    double* secondsData = secondsSinceEpoch.data( );
+    for( std::size_t i = 0; i < times.size( ); i++ )
+    {
+        secondsData[ i ] = timesData[ i ].getSeconds< double >( );
+    }
+    return secondsSinceEpoch;
+}
+
+//! Function to compute the seconds (in double precision) of a list of FixedPointTime objects since a reference time
+std::vector< double > computeSecondsSinceReferenceTime( const std::vector< FixedPointTime >& times, const FixedPointTime& referenceTime )
+{
+    const int64_t referencePeriods = referenceTime.getFullPeriods( );
+    const int64_t referenceTicks = referenceTime.getTicksIntoFullPeriod( );
+
+    std::vector< double > secondsSinceReference( times.size( ) );
+    const FixedPointTime* timesData = times.data( );
+    double* secondsData = secondsSinceReference.data( );
+    for( std::size_t i = 0; i < times.size( ); i++ )
+    {
+        // Compute exact difference in periods and ticks (latter smaller than one period in magnitude, no normalization needed)
+        const int64_t periodDifference = static_cast< int64_t >( timesData[ i ].getFullPeriods( ) ) - referencePeriods;
+        const int64_t tickDifference = timesData[ i ].getTicksIntoFullPeriod( ) - referenceTicks;
+
+        // Split tick difference into whole seconds and (exactly representable) remainder
+        const int64_t wholeSecondDifference = tickDifference / FIXED_POINT_TIME_TICKS_PER_SECOND;
+        secondsData[ i ] = static_cast< double >( periodDifference * TIME_NORMALIZATION_INTEGER_TERM + wholeSecondDifference ) +
+                static_cast< double >( tickDifference - wholeSecondDifference * FIXED_POINT_TIME_TICKS_PER_SECOND ) /
+                        static_cast< double >( FIXED_POINT_TIME_TICKS_PER_SECOND );
+    }
+    return secondsSinceReference;
+}
+
+//! Function to convert a list of Time objects to FixedPointTime objects
+std::vector< FixedPointTime > convertTimesToFixedPointTimes( const std::vector< Time >& times )
+{
+    std::vector< FixedPointTime > fixedPointTimes( times.size( ) );
+    for( std::size_t i = 0; i < times.size( ); i++ )
+    {
+        fixedPointTimes[ i ] = FixedPointTime( times[ i ] );
+    }
+    return fixedPointTimes;
+}
+
+//! Function to convert a list of FixedPointTime objects to Time objects
+std::vector< Time > convertFixedPointTimesToTimes( const std::vector< FixedPointTime >& fixedPointTimes )
+{
+    std::vector< Time > times( fixedPointTimes.size( ) );
+    for( std::size_t i = 0; i < fixedPointTimes.size( ); i++ )
+    {
+        times[ i ] = fixedPointTimes[ i ].getTime( );
+    }
+    return times;
+}
+
+}  // namespace tudat
@@ -34,6 +34,8 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< ExportSettings
     jsonObject[ K::onlyFinalStep ] = exportSettings->onlyFinalStep_;
     jsonObject[ K::numericalPrecision ] = exportSettings->numericalPrecision_;
     jsonObject[ K::printVariableIndicesToTerminal ] = exportSettings->printVariableIndicesToTerminal_;
+    jsonObject[ K::binary ] = exportSettings->binary_;
+    jsonObject[ K::compressBinary ] = exportSettings->compressBinary_;
 }
 
 //! Create a shared pointer to a `ExportSettings` object from a `json` object.
@@ -51,6 +53,8 @@ void from_json( const nlohmann::json& jsonObject, std::shared_ptr< ExportSetting
     updateFromJSONIfDefined( exportSettings->onlyFinalStep_, jsonObject, K::onlyFinalStep );
     updateFromJSONIfDefined( exportSettings->numericalPrecision_, jsonObject, K::numericalPrecision );
     updateFromJSONIfDefined( exportSettings->printVariableIndicesToTerminal_, jsonObject, K::printVariableIndicesToTerminal );
+    updateFromJSONIfDefined( exportSettings->binary_, jsonObject, K::binary );
+    updateFromJSONIfDefined( exportSettings->compressBinary_, jsonObject, K::compressBinary );
 }
 
 }  // namespace json_interface
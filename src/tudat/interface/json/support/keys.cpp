@@ -456,6 +456,8 @@ const std::string Keys::Export::onlyInitialStep = "onlyInitialStep";
 const std::string Keys::Export::onlyFinalStep = "onlyFinalStep";
 const std::string Keys::Export::numericalPrecision = "numericalPrecision";
 const std::string Keys::Export::printVariableIndicesToTerminal = "printVariableIndicesToTerminal";
+const std::string Keys::Export::binary = "binary";
+const std::string Keys::Export::compressBinary = "compressBinary";
 
 //  Options
 const std::string Keys::options = "options";
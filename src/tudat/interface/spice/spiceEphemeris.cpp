@@ -75,6 +75,14 @@ Eigen::Vector6d SpiceEphemeris::getCartesianState( const double secondsSinceEpoc
     // Retrieve body state at given ephemeris time, using settings passed to constructor of this
     // object.
 
+    // Use precomputed segments, if available for current time
+    std::shared_ptr< ChebyshevEphemeris > precomputedSegments = std::atomic_load( &precomputedSegments_ );
+    if( precomputedSegments != nullptr && secondsSinceEpoch >= precomputedSegments->getStartTime( ) &&
+        secondsSinceEpoch <= precomputedSegments->getEndTime( ) )
+    {
+        return precomputedSegments->getCartesianState( secondsSinceEpoch );
+    }
+
     // Calculate ephemeris time at which cartesian state is to be determined.
     const double ephemerisTime = secondsSinceEpoch;
 
@@ -88,5 +96,24 @@ Eigen::Vector6d SpiceEphemeris::getCartesianState( const double secondsSinceEpoc
     return cartesianStateAtEpoch;
 }
 
+//! Function to precompute Chebyshev segments of this ephemeris in a given time interval
+void SpiceEphemeris::precomputeSegments( const double startTime,
+                                         const double endTime,
+                                         const int polynomialDegree,
+                                         const double positionTolerance )
+{
+    // Fit segments to CSPICE states (existing segments are not used for the fit)
+    clearPrecomputedSegments( );
+    std::shared_ptr< ChebyshevEphemeris > precomputedSegments = createChebyshevEphemeris(
+            [ = ]( const double time ) { return this->getCartesianState( time ); },
+            startTime,
+            endTime,
+            polynomialDegree,
+            positionTolerance,
+            referenceFrameOrigin_,
+            referenceFrameOrientation_ );
+    std::atomic_store( &precomputedSegments_, precomputedSegments );
+}
+
 }  // namespace ephemerides
 }  // namespace tudat
@@ -20,6 +20,7 @@
 #include <vector>
 #include <algorithm>
 #include <cstring>
+#include <mutex>
 
 namespace tudat
 {
@@ -43,9 +44,18 @@ std::string getCorrectedTargetBodyName( const std::string &targetBodyName )
     return correctedTargetBodyName;
 }
 
+//! Retrieve the mutex through which all calls to CSPICE are serialized.
+std::recursive_mutex& getSpiceMutex( )
+{
+    static std::recursive_mutex spiceMutex;
+    return spiceMutex;
+}
+
 //! Convert a Julian date to ephemeris time (equivalent to TDB in Spice).
 double convertJulianDateToEphemerisTime( const double julianDate )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     double ephemerisTime = ( julianDate - j2000_c( ) ) * spd_c( );
@@ -60,6 +70,8 @@ double convertJulianDateToEphemerisTime( const double julianDate )
 
 double getApproximateUtcFromTdb( const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     double timeOffset = TUDAT_NAN;
@@ -76,6 +88,8 @@ double getApproximateUtcFromTdb( const double ephemerisTime )
 //! Convert ephemeris time (equivalent to TDB) to a Julian date.
 double convertEphemerisTimeToJulianDate( const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     double julianDate = j2000_c( ) + ( ephemerisTime ) / spd_c( );
@@ -91,6 +105,8 @@ double convertEphemerisTimeToJulianDate( const double ephemerisTime )
 //! Converts a date string to ephemeris time.
 double convertDateStringToEphemerisTime( const std::string &dateString )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     double ephemerisTime = 0.0;
@@ -111,6 +127,8 @@ Eigen::Vector6d getBodyCartesianStateAtEpoch( const std::string &targetBodyName,
                                               const std::string &aberrationCorrections,
                                               const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     if( !( ephemerisTime == ephemerisTime ) )
@@ -156,6 +174,8 @@ Eigen::Vector3d getBodyCartesianPositionAtEpoch( const std::string &targetBodyNa
                                                  const std::string &aberrationCorrections,
                                                  const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     if( !( ephemerisTime == ephemerisTime ) )
@@ -199,6 +219,8 @@ Eigen::Vector3d getBodyCartesianPositionAtEpoch( const std::string &targetBodyNa
 //! Get Cartesian state of a satellite from its two-line element set at a specified epoch.
 Eigen::Vector6d getCartesianStateFromTleAtEpoch( double epoch, std::shared_ptr< ephemerides::Tle > tle )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     if( !( epoch == epoch ) )
@@ -252,6 +274,8 @@ Eigen::Quaterniond computeRotationQuaternionBetweenFrames( const std::string &or
                                                            const std::string &newFrame,
                                                            const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     if( !( ephemerisTime == ephemerisTime ) )
@@ -300,6 +324,8 @@ Eigen::Matrix6d computeStateRotationMatrixBetweenFrames( const std::string &orig
                                                          const std::string &newFrame,
                                                          const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     if( !( ephemerisTime == ephemerisTime ) )
@@ -339,6 +365,8 @@ Eigen::Matrix3d computeRotationMatrixDerivativeBetweenFrames( const std::string
                                                               const std::string &newFrame,
                                                               const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     if( !( ephemerisTime == ephemerisTime ) )
@@ -378,6 +406,8 @@ Eigen::Vector3d getAngularVelocityVectorOfFrameInOriginalFrame( const std::strin
                                                                 const std::string &newFrame,
                                                                 const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     if( !( ephemerisTime == ephemerisTime ) )
@@ -413,6 +443,8 @@ std::pair< Eigen::Quaterniond, Eigen::Matrix3d > computeRotationQuaternionAndRot
         const std::string &newFrame,
         const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     double stateTransition[ 6 ][ 6 ];
@@ -451,6 +483,8 @@ std::pair< Eigen::Quaterniond, Eigen::Matrix3d > computeRotationQuaternionAndRot
 //! Get property of a body from Spice.
 std::vector< double > getBodyProperties( const std::string &body, const std::string &property, const int maximumNumberOfValues )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     // Delcare variable in which raw result is to be put by Spice function.
@@ -480,6 +514,8 @@ std::vector< double > getBodyProperties( const std::string &body, const std::str
 //! Get gravitational parameter of a body.
 double getBodyGravitationalParameter( const std::string &body )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     // Delcare variable in which raw result is to be put by Spice function.
@@ -502,6 +538,8 @@ double getBodyGravitationalParameter( const std::string &body )
 //! Get the (arithmetic) mean of the three principal axes of the tri-axial ellipsoid shape.
 double getAverageRadius( const std::string &body )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     // Delcare variable in which raw result is to be put by Spice function.
@@ -523,6 +561,8 @@ double getAverageRadius( const std::string &body )
 //! Get the (arithmetic) mean of the two equatorial axes of the tri-axial ellipsoid shape.
 double getAverageEquatorialRadius( const std::string &body )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     // Declare variable in which raw result is to be put by Spice function.
@@ -544,6 +584,8 @@ double getAverageEquatorialRadius( const std::string &body )
 //! Get the polar radius of the tri-axial ellipsoid shape.
 double getPolarRadius( const std::string &body )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     // Declare variable in which raw result is to be put by Spice function.
@@ -565,6 +607,8 @@ double getPolarRadius( const std::string &body )
 //! Convert a body name to its NAIF identification number.
 int convertBodyNameToNaifId( const std::string &bodyName )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     // Convert body name to NAIF ID number.
@@ -584,6 +628,8 @@ int convertBodyNameToNaifId( const std::string &bodyName )
 //! Convert a NAIF identification number to its body name.
 std::string convertNaifIdToBodyName( int bodyNaifId )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     // Maximum SPICE name length is 32. Therefore, a name length of 33 is used (+1 for null terminator)
@@ -603,6 +649,8 @@ std::string convertNaifIdToBodyName( int bodyNaifId )
 //! Check if a certain property of a body is in the kernel pool.
 bool checkBodyPropertyInKernelPool( const std::string &bodyName, const std::string &bodyProperty )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     // Convert body name to NAIF ID.
@@ -622,6 +670,8 @@ bool checkBodyPropertyInKernelPool( const std::string &bodyName, const std::stri
 //! Load a Spice kernel.
 void loadSpiceKernelInTudat( const std::string &fileName )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
 #ifdef __EMSCRIPTEN__
@@ -739,6 +789,8 @@ void loadSpiceKernelInTudat( const std::string &fileName )
 //! Get the amount of loaded Spice kernels.
 int getTotalCountOfKernelsLoaded( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     SpiceInt count;
@@ -755,6 +807,8 @@ int getTotalCountOfKernelsLoaded( )
 //! Clear all Spice kernels.
 void clearSpiceKernels( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     setSpiceErrorHandling( );
 
     kclear_c( );
@@ -850,6 +904,8 @@ Eigen::Matrix3d getRotationFromEclipJ2000ToJ2000( )
 
 void toggleErrorReturn( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
 #ifdef __EMSCRIPTEN__
     // In WASM, erract_c crashes due to f2c string handling issues.
     // SPICE defaults to "abort" mode which prints errors and continues.
@@ -867,6 +923,8 @@ void toggleErrorReturn( )
 
 void toggleErrorAbort( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
 #ifdef __EMSCRIPTEN__
     // In WASM, errdev_c crashes. Skip - SPICE is already in default abort mode.
 #else
@@ -882,6 +940,8 @@ void toggleErrorAbort( )
 
 void suppressErrorOutput( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
 #ifdef __EMSCRIPTEN__
     // In WASM, errdev_c crashes. Skip - error output will go to default destination.
 #else
@@ -897,6 +957,8 @@ void suppressErrorOutput( )
 
 std::string getErrorMessage( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
 #ifdef __EMSCRIPTEN__
     // In WASM, getmsg_c may crash. Since we can't change error mode reliably,
     // and failed_c works, we return empty string to avoid crashes.
@@ -922,6 +984,8 @@ std::string getErrorMessage( )
 
 bool checkFailure( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
 #ifdef __EMSCRIPTEN__
     // In WASM, failed_c works but reset_c may not.
     // Just check failure status without reset.
@@ -946,6 +1010,8 @@ bool checkFailure( )
 
 void setSpiceErrorHandling( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
 #ifdef __EMSCRIPTEN__
     // In WASM, erract_c and errdev_c crash due to f2c string handling issues.
     // Skip error handling setup - SPICE will use defaults.
@@ -959,6 +1025,8 @@ void setSpiceErrorHandling( )
 
 void handleSpiceException( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // error message lengths are defined in cspice/SpiceErr.h
     SpiceChar shortMessage[ SPICE_ERROR_SMSGLN ];
     SpiceChar explanation[ SPICE_ERROR_XMSGLN ];
@@ -0,0 +1,664 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/io/columnarBinaryFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include <boost/filesystem.hpp>
+
+#if !( defined( _WIN64 ) || defined( _WIN32 ) )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+namespace
+{
+
+// Identifier at start of binary columnar file
+const char columnarFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'C', 'O', 'L', 'S', '\0' };
+
+// Identifier at start of each chunk in binary columnar file
+const char columnarChunkIdentifier[ 8 ] = { 'T', 'U', 'D', 'C', 'H', 'N', 'K', '\0' };
+
+// Version of the binary columnar file format
+const int32_t columnarFileVersion = 1;
+
+// Value used to detect files written with a different byte order
+const int32_t columnarFileByteOrderCheck = 0x01020304;
+
+// Header of binary columnar file, stored at the start of the file. It is followed by a description block (zero-terminated
+// column names, followed by the zero-terminated metadata string), padded to a multiple of 8 bytes.
+struct ColumnarBinaryFileHeader {
+    char identifier[ 8 ];
+    int32_t version;
+    int32_t byteOrderCheck;
+    int32_t contentType;
+    int32_t compression;
+    int32_t chunkSize;
+    int32_t numberOfColumns;
+    int32_t entryRows;
+    int32_t entryColumns;
+    uint64_t descriptionBlockSize;
+};
+
+// Header of a single chunk. It is followed by the (unpadded) size in bytes of each column (as uint64_t), and the column data,
+// with each column padded to a multiple of 8 bytes.
+struct ColumnarBinaryChunkHeader {
+    char identifier[ 8 ];
+    uint64_t numberOfRows;
+    int32_t compression;
+    int32_t numberOfColumns;
+};
+
+static_assert( sizeof( ColumnarBinaryFileHeader ) % sizeof( double ) == 0, "Columnar file header must be aligned to doubles" );
+static_assert( sizeof( ColumnarBinaryChunkHeader ) % sizeof( double ) == 0, "Columnar chunk header must be aligned to doubles" );
+
+std::size_t getPaddedSize( const std::size_t size )
+{
+    return ( ( size + 7 ) / 8 ) * 8;
+}
+
+// Run-length encode a byte array (PackBits scheme: a control byte c in [0, 127] is followed by c + 1 literal bytes, a control
+// byte c in [-127, -1] is followed by a single byte that is repeated 1 - c times)
+void runLengthEncode( const unsigned char* input, const std::size_t size, std::vector< unsigned char >& output )
+{
+    std::size_t i = 0;
+    while( i < size )
+    {
+        // Determine length of run starting at current byte
+        std::size_t runLength = 1;
+        while( i + runLength < size && runLength < 128 && input[ i + runLength ] == input[ i ] )
+        {
+            runLength++;
+        }
+
+        if( runLength >= 3 )
+        {
+            output.push_back( static_cast< unsigned char >( static_cast< int8_t >( 1 - static_cast< int >( runLength ) ) ) );
+            output.push_back( input[ i ] );
+            i += runLength;
+        }
+        else
+        {
+            // Collect literal bytes, until a run of at least three equal bytes starts
+            std::size_t literalEnd = i;
+            while( literalEnd < size && literalEnd - i < 128 )
+            {
+                if( literalEnd + 2 < size && input[ literalEnd ] == input[ literalEnd + 1 ] &&
+                    input[ literalEnd ] == input[ literalEnd + 2 ] )
+                {
+                    break;
+                }
+                literalEnd++;
+            }
+            output.push_back( static_cast< unsigned char >( literalEnd - i - 1 ) );
+            output.insert( output.end( ), input + i, input + literalEnd );
+            i = literalEnd;
+        }
+    }
+}
+
+// Decode a run-length encoded byte array (see runLengthEncode), returning false if the input is inconsistent with the output size
+bool runLengthDecode( const unsigned char* input, const std::size_t inputSize, unsigned char* output, const std::size_t outputSize )
+{
+    std::size_t inputIndex = 0;
+    std::size_t outputIndex = 0;
+    while( inputIndex < inputSize )
+    {
+        const int control = static_cast< int8_t >( input[ inputIndex++ ] );
+        if( control >= 0 )
+        {
+            const std::size_t literalLength = static_cast< std::size_t >( control ) + 1;
+            if( inputIndex + literalLength > inputSize || outputIndex + literalLength > outputSize )
+            {
+                return false;
+            }
+            std::memcpy( output + outputIndex, input + inputIndex, literalLength );
+            inputIndex += literalLength;
+            outputIndex += literalLength;
+        }
+        else if( control != -128 )
+        {
+            const std::size_t runLength = static_cast< std::size_t >( 1 - control );
+            if( inputIndex >= inputSize || outputIndex + runLength > outputSize )
+            {
+                return false;
+            }
+            std::memset( output + outputIndex, input[ inputIndex++ ], runLength );
+            outputIndex += runLength;
+        }
+    }
+    return outputIndex == outputSize;
+}
+
+// Compress a column of values: XOR each value with its predecessor, shuffle bytes into planes of equal significance (most
+// significant first), and run-length encode the result
+void compressColumn( const double* values, const std::size_t numberOfValues, std::vector< unsigned char >& output )
+{
+    std::vector< unsigned char > bytePlanes( numberOfValues * sizeof( double ) );
+    uint64_t previousWord = 0;
+    for( std::size_t i = 0; i < numberOfValues; i++ )
+    {
+        uint64_t currentWord;
+        std::memcpy( &currentWord, values + i, sizeof( double ) );
+        const uint64_t deltaWord = currentWord ^ previousWord;
+        previousWord = currentWord;
+        for( unsigned int j = 0; j < sizeof( double ); j++ )
+        {
+            bytePlanes[ j * numberOfValues + i ] = static_cast< unsigned char >( deltaWord >> ( 8 * ( 7 - j ) ) );
+        }
+    }
+    runLengthEncode( bytePlanes.data( ), bytePlanes.size( ), output );
+}
+
+// Decompress a column of values (see compressColumn), returning false if the compressed data is inconsistent
+bool decompressColumn( const unsigned char* input, const std::size_t inputSize, double* values, const std::size_t numberOfValues )
+{
+    std::vector< unsigned char > bytePlanes( numberOfValues * sizeof( double ) );
+    if( !runLengthDecode( input, inputSize, bytePlanes.data( ), bytePlanes.size( ) ) )
+    {
+        return false;
+    }
+
+    uint64_t previousWord = 0;
+    for( std::size_t i = 0; i < numberOfValues; i++ )
+    {
+        uint64_t deltaWord = 0;
+        for( unsigned int j = 0; j < sizeof( double ); j++ )
+        {
+            deltaWord |= static_cast< uint64_t >( bytePlanes[ j * numberOfValues + i ] ) << ( 8 * ( 7 - j ) );
+        }
+        previousWord ^= deltaWord;
+        std::memcpy( values + i, &previousWord, sizeof( double ) );
+    }
+    return true;
+}
+
+}  // namespace
+
+ColumnarBinaryFileWriter::ColumnarBinaryFileWriter( const std::string& fileName,
+                                                    const ColumnarBinaryFileDescription& description,
+                                                    const bool appendToExistingFile ):
+    fileName_( fileName ), description_( description ), numberOfColumns_( static_cast< int >( description.columnNames.size( ) ) ),
+    numberOfBufferedRows_( 0 ), numberOfWrittenRows_( 0 )
+{
+    if( numberOfColumns_ == 0 )
+    {
+        throw std::runtime_error( "Error when creating columnar binary file " + fileName + ", no columns provided." );
+    }
+
+    if( appendToExistingFile && boost::filesystem::exists( fileName ) )
+    {
+        // Retrieve settings and valid size of existing file
+        std::size_t validFileSize = 0;
+        {
+            ColumnarBinaryFileReader existingFile( fileName );
+            if( existingFile.getColumnNames( ) != description.columnNames )
+            {
+                throw std::runtime_error( "Error when appending to columnar binary file " + fileName +
+                                          ", column names are inconsistent with existing file." );
+            }
+            description_ = existingFile.getDescription( );
+            numberOfWrittenRows_ = existingFile.getNumberOfRows( );
+            validFileSize = existingFile.getValidFileSize( );
+        }
+
+        // Remove incomplete trailing chunk (if any), and open file for appending
+        boost::filesystem::resize_file( fileName, validFileSize );
+        stream_.open( fileName, std::ios::out | std::ios::binary | std::ios::app );
+        if( !stream_.good( ) )
+        {
+            throw std::runtime_error( "Error when opening columnar binary file for appending: " + fileName );
+        }
+    }
+    else
+    {
+        if( description_.chunkSize <= 0 )
+        {
+            throw std::runtime_error( "Error when creating columnar binary file " + fileName + ", chunk size must be positive." );
+        }
+        for( unsigned int i = 0; i < description_.columnNames.size( ); i++ )
+        {
+            if( description_.columnNames.at( i ).find( '\0' ) != std::string::npos )
+            {
+                throw std::runtime_error( "Error when creating columnar binary file " + fileName +
+                                          ", column names may not contain null characters." );
+            }
+        }
+
+        stream_.open( fileName, std::ios::out | std::ios::binary | std::ios::trunc );
+        if( !stream_.good( ) )
+        {
+            throw std::runtime_error( "Error when opening columnar binary file for writing: " + fileName );
+        }
+        writeHeader( );
+    }
+
+    buffer_.resize( static_cast< std::size_t >( description_.chunkSize ) * numberOfColumns_ );
+}
+
+ColumnarBinaryFileWriter::~ColumnarBinaryFileWriter( )
+{
+    try
+    {
+        close( );
+    }
+    catch( const std::runtime_error& error )
+    {
+        std::cerr << "Error when closing columnar binary file " << fileName_ << ": " << error.what( ) << std::endl;
+    }
+}
+
+void ColumnarBinaryFileWriter::writeHeader( )
+{
+    // Create description block
+    std::string descriptionBlock;
+    for( unsigned int i = 0; i < description_.columnNames.size( ); i++ )
+    {
+        descriptionBlock += description_.columnNames.at( i );
+        descriptionBlock.push_back( '\0' );
+    }
+    descriptionBlock += description_.metadata;
+    descriptionBlock.push_back( '\0' );
+    descriptionBlock.resize( getPaddedSize( descriptionBlock.size( ) ), '\0' );
+
+    // Create header
+    ColumnarBinaryFileHeader header;
+    std::memset( &header, 0, sizeof( header ) );
+    std::memcpy( header.identifier, columnarFileIdentifier, sizeof( columnarFileIdentifier ) );
+    header.version = columnarFileVersion;
+    header.byteOrderCheck = columnarFileByteOrderCheck;
+    header.contentType = static_cast< int32_t >( description_.contentType );
+    header.compression = static_cast< int32_t >( description_.compression );
+    header.chunkSize = description_.chunkSize;
+    header.numberOfColumns = numberOfColumns_;
+    header.entryRows = description_.entryRows;
+    header.entryColumns = description_.entryColumns;
+    header.descriptionBlockSize = descriptionBlock.size( );
+
+    stream_.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+    stream_.write( descriptionBlock.data( ), descriptionBlock.size( ) );
+    stream_.flush( );
+    if( !stream_.good( ) )
+    {
+        throw std::runtime_error( "Error when writing header of columnar binary file: " + fileName_ );
+    }
+}
+
+void ColumnarBinaryFileWriter::appendRow( const Eigen::Ref< const Eigen::VectorXd >& row )
+{
+    if( row.rows( ) != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when appending row to columnar binary file " + fileName_ + ", expected " +
+                                  std::to_string( numberOfColumns_ ) + " values, but found " + std::to_string( row.rows( ) ) );
+    }
+
+    const std::size_t chunkSize = static_cast< std::size_t >( description_.chunkSize );
+    for( int i = 0; i < numberOfColumns_; i++ )
+    {
+        buffer_[ i * chunkSize + numberOfBufferedRows_ ] = row( i );
+    }
+    numberOfBufferedRows_++;
+
+    if( numberOfBufferedRows_ == description_.chunkSize )
+    {
+        flush( );
+    }
+}
+
+void ColumnarBinaryFileWriter::appendRow( const double epoch, const Eigen::Ref< const Eigen::VectorXd >& values )
+{
+    Eigen::VectorXd row( values.rows( ) + 1 );
+    row( 0 ) = epoch;
+    row.segment( 1, values.rows( ) ) = values;
+    appendRow( row );
+}
+
+void ColumnarBinaryFileWriter::appendRows( const Eigen::Ref< const Eigen::MatrixXd >& rows )
+{
+    for( int i = 0; i < rows.rows( ); i++ )
+    {
+        appendRow( rows.row( i ).transpose( ) );
+    }
+}
+
+void ColumnarBinaryFileWriter::flush( )
+{
+    if( !stream_.is_open( ) )
+    {
+        return;
+    }
+
+    if( numberOfBufferedRows_ > 0 )
+    {
+        const std::size_t chunkSize = static_cast< std::size_t >( description_.chunkSize );
+        const std::size_t numberOfRows = static_cast< std::size_t >( numberOfBufferedRows_ );
+
+        // Determine (compressed) column data and sizes
+        std::vector< uint64_t > columnSizes( numberOfColumns_ );
+        compressionBuffer_.clear( );
+        for( int i = 0; i < numberOfColumns_; i++ )
+        {
+            const double* columnData = buffer_.data( ) + i * chunkSize;
+            if( description_.compression == xor_delta_run_length_compression )
+            {
+                const std::size_t startSize = compressionBuffer_.size( );
+                compressColumn( columnData, numberOfRows, compressionBuffer_ );
+                columnSizes[ i ] = compressionBuffer_.size( ) - startSize;
+            }
+            else
+            {
+                const unsigned char* columnBytes = reinterpret_cast< const unsigned char* >( columnData );
+                compressionBuffer_.insert( compressionBuffer_.end( ), columnBytes, columnBytes + numberOfRows * sizeof( double ) );
+                columnSizes[ i ] = numberOfRows * sizeof( double );
+            }
+            compressionBuffer_.resize( getPaddedSize( compressionBuffer_.size( ) ), 0 );
+        }
+
+        // Write chunk header, column sizes and column data
+        ColumnarBinaryChunkHeader chunkHeader;
+        std::memset( &chunkHeader, 0, sizeof( chunkHeader ) );
+        std::memcpy( chunkHeader.identifier, columnarChunkIdentifier, sizeof( columnarChunkIdentifier ) );
+        chunkHeader.numberOfRows = numberOfRows;
+        chunkHeader.compression = static_cast< int32_t >( description_.compression );
+        chunkHeader.numberOfColumns = numberOfColumns_;
+
+        stream_.write( reinterpret_cast< const char* >( &chunkHeader ), sizeof( chunkHeader ) );
+        stream_.write( reinterpret_cast< const char* >( columnSizes.data( ) ), columnSizes.size( ) * sizeof( uint64_t ) );
+        stream_.write( reinterpret_cast< const char* >( compressionBuffer_.data( ) ), compressionBuffer_.size( ) );
+
+        numberOfWrittenRows_ += numberOfRows;
+        numberOfBufferedRows_ = 0;
+    }
+
+    stream_.flush( );
+    if( !stream_.good( ) )
+    {
+        throw std::runtime_error( "Error when writing columnar binary file: " + fileName_ );
+    }
+}
+
+void ColumnarBinaryFileWriter::close( )
+{
+    if( stream_.is_open( ) )
+    {
+        flush( );
+        stream_.close( );
+    }
+}
+
+ColumnarBinaryFileReader::ColumnarBinaryFileReader( const std::string& fileName ):
+    fileName_( fileName ), numberOfRows_( 0 ), validFileSize_( 0 ), fileData_( nullptr ), fileSize_( 0 ), isFileMapped_( false )
+{
+    // Map file into memory, if supported
+#if !( defined( _WIN64 ) || defined( _WIN32 ) )
+    int fileDescriptor = open( fileName.c_str( ), O_RDONLY );
+    if( fileDescriptor < 0 )
+    {
+        throw std::runtime_error( "Error when opening columnar binary file: " + fileName );
+    }
+
+    struct stat fileStatus;
+    if( fstat( fileDescriptor, &fileStatus ) == 0 && fileStatus.st_size > 0 )
+    {
+        void* mapping = mmap( nullptr, static_cast< std::size_t >( fileStatus.st_size ), PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+        if( mapping != MAP_FAILED )
+        {
+            fileData_ = static_cast< const char* >( mapping );
+            fileSize_ = static_cast< std::size_t >( fileStatus.st_size );
+            isFileMapped_ = true;
+        }
+    }
+    close( fileDescriptor );
+#endif
+
+    // Otherwise, read file into memory
+    if( !isFileMapped_ )
+    {
+        std::ifstream fileStream( fileName, std::ios::in | std::ios::binary );
+        if( !fileStream.good( ) )
+        {
+            throw std::runtime_error( "Error when opening columnar binary file: " + fileName );
+        }
+        fileStream.seekg( 0, std::ios::end );
+        fileSize_ = static_cast< std::size_t >( fileStream.tellg( ) );
+        fileStream.seekg( 0, std::ios::beg );
+        fileContents_.resize( fileSize_ );
+        fileStream.read( fileContents_.data( ), fileSize_ );
+        fileData_ = fileContents_.data( );
+    }
+
+    // Read header and locate chunks, releasing the mapped file if the header is invalid
+    try
+    {
+        readHeaderAndChunks( );
+    }
+    catch( const std::runtime_error& )
+    {
+        unmapFile( );
+        throw;
+    }
+}
+
+ColumnarBinaryFileReader::~ColumnarBinaryFileReader( )
+{
+    unmapFile( );
+}
+
+void ColumnarBinaryFileReader::unmapFile( )
+{
+#if !( defined( _WIN64 ) || defined( _WIN32 ) )
+    if( isFileMapped_ )
+    {
+        munmap( const_cast< char* >( fileData_ ), fileSize_ );
+    }
+#endif
+    isFileMapped_ = false;
+    fileData_ = nullptr;
+}
+
+void ColumnarBinaryFileReader::readHeaderAndChunks( )
+{
+    // Read and check header
+    ColumnarBinaryFileHeader header;
+    if( fileSize_ < sizeof( header ) )
+    {
+        throw std::runtime_error( "Error when reading columnar binary file " + fileName_ + ", file is too small." );
+    }
+    std::memcpy( &header, fileData_, sizeof( header ) );
+
+    if( std::memcmp( header.identifier, columnarFileIdentifier, sizeof( columnarFileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading columnar binary file " + fileName_ + ", file identifier not recognized." );
+    }
+    if( header.byteOrderCheck != columnarFileByteOrderCheck )
+    {
+        throw std::runtime_error( "Error when reading columnar binary file " + fileName_ +
+                                  ", file was written with different byte order." );
+    }
+    if( header.version != columnarFileVersion )
+    {
+        throw std::runtime_error( "Error when reading columnar binary file " + fileName_ + ", file version " +
+                                  std::to_string( header.version ) + " not supported." );
+    }
+    if( header.numberOfColumns <= 0 || header.descriptionBlockSize > fileSize_ - sizeof( header ) )
+    {
+        throw std::runtime_error( "Error when reading columnar binary file " + fileName_ + ", header is inconsistent." );
+    }
+
+    description_.contentType = static_cast< ColumnarBinaryContentType >( header.contentType );
+    description_.compression = static_cast< ColumnarBinaryCompression >( header.compression );
+    description_.chunkSize = header.chunkSize;
+    description_.entryRows = header.entryRows;
+    description_.entryColumns = header.entryColumns;
+
+    // Parse column names and metadata from description block
+    const char* descriptionBlock = fileData_ + sizeof( header );
+    const std::size_t descriptionBlockSize = static_cast< std::size_t >( header.descriptionBlockSize );
+    std::vector< std::string > descriptionEntries;
+    std::size_t entryStart = 0;
+    for( std::size_t i = 0; i < descriptionBlockSize && static_cast< int >( descriptionEntries.size( ) ) <= header.numberOfColumns; i++ )
+    {
+        if( descriptionBlock[ i ] == '\0' )
+        {
+            descriptionEntries.push_back( std::string( descriptionBlock + entryStart, i - entryStart ) );
+            entryStart = i + 1;
+        }
+    }
+    if( static_cast< int >( descriptionEntries.size( ) ) != header.numberOfColumns + 1 )
+    {
+        throw std::runtime_error( "Error when reading columnar binary file " + fileName_ + ", column names are inconsistent." );
+    }
+    description_.metadata = descriptionEntries.back( );
+    descriptionEntries.pop_back( );
+    description_.columnNames = descriptionEntries;
+
+    // Locate complete chunks, stopping at the first incomplete or invalid chunk
+    const std::size_t numberOfColumns = static_cast< std::size_t >( header.numberOfColumns );
+    std::size_t currentOffset = sizeof( header ) + descriptionBlockSize;
+    validFileSize_ = currentOffset;
+    while( currentOffset + sizeof( ColumnarBinaryChunkHeader ) + numberOfColumns * sizeof( uint64_t ) <= fileSize_ )
+    {
+        ColumnarBinaryChunkHeader chunkHeader;
+        std::memcpy( &chunkHeader, fileData_ + currentOffset, sizeof( chunkHeader ) );
+        if( std::memcmp( chunkHeader.identifier, columnarChunkIdentifier, sizeof( columnarChunkIdentifier ) ) != 0 ||
+            chunkHeader.numberOfColumns != header.numberOfColumns || chunkHeader.numberOfRows == 0 )
+        {
+            break;
+        }
+
+        std::vector< uint64_t > columnSizes( numberOfColumns );
+        std::memcpy( columnSizes.data( ),
+                     fileData_ + currentOffset + sizeof( ColumnarBinaryChunkHeader ),
+                     numberOfColumns * sizeof( uint64_t ) );
+
+        ChunkEntry chunk;
+        chunk.numberOfRows = static_cast< std::size_t >( chunkHeader.numberOfRows );
+        chunk.compression = chunkHeader.compression;
+        std::size_t columnOffset = currentOffset + sizeof( ColumnarBinaryChunkHeader ) + numberOfColumns * sizeof( uint64_t );
+        bool isChunkComplete = true;
+        for( std::size_t i = 0; i < numberOfColumns; i++ )
+        {
+            const std::size_t columnSize = static_cast< std::size_t >( columnSizes.at( i ) );
+            if( ( chunk.compression == no_columnar_compression && columnSize != chunk.numberOfRows * sizeof( double ) ) ||
+                columnSize > fileSize_ || columnOffset + getPaddedSize( columnSize ) > fileSize_ )
+            {
+                isChunkComplete = false;
+                break;
+            }
+            chunk.columnOffsets.push_back( columnOffset );
+            chunk.columnSizes.push_back( columnSize );
+            columnOffset += getPaddedSize( columnSize );
+        }
+
+        if( !isChunkComplete )
+        {
+            break;
+        }
+        chunks_.push_back( chunk );
+        numberOfRows_ += chunk.numberOfRows;
+        currentOffset = columnOffset;
+        validFileSize_ = currentOffset;
+    }
+}
+
+int ColumnarBinaryFileReader::getColumnIndex( const std::string& columnName ) const
+{
+    auto columnIterator = std::find( description_.columnNames.begin( ), description_.columnNames.end( ), columnName );
+    if( columnIterator == description_.columnNames.end( ) )
+    {
+        throw std::runtime_error( "Error, column " + columnName + " not found in columnar binary file " + fileName_ );
+    }
+    return static_cast< int >( columnIterator - description_.columnNames.begin( ) );
+}
+
+const double* ColumnarBinaryFileReader::getChunkColumnData( const int chunkIndex, const int columnIndex ) const
+{
+    const ChunkEntry& chunk = chunks_.at( chunkIndex );
+    if( chunk.compression != no_columnar_compression )
+    {
+        return nullptr;
+    }
+    return reinterpret_cast< const double* >( fileData_ + chunk.columnOffsets.at( columnIndex ) );
+}
+
+void ColumnarBinaryFileReader::readChunkColumn( const int chunkIndex, const int columnIndex, double* values ) const
+{
+    const ChunkEntry& chunk = chunks_.at( chunkIndex );
+    const char* columnData = fileData_ + chunk.columnOffsets.at( columnIndex );
+    if( chunk.compression == no_columnar_compression )
+    {
+        std::memcpy( values, columnData, chunk.numberOfRows * sizeof( double ) );
+    }
+    else if( chunk.compression == xor_delta_run_length_compression )
+    {
+        if( !decompressColumn( reinterpret_cast< const unsigned char* >( columnData ),
+                               chunk.columnSizes.at( columnIndex ),
+                               values,
+                               chunk.numberOfRows ) )
+        {
+            throw std::runtime_error( "Error when reading columnar binary file " + fileName_ + ", compressed data is corrupt." );
+        }
+    }
+    else
+    {
+        throw std::runtime_error( "Error when reading columnar binary file " + fileName_ + ", compression type " +
+                                  std::to_string( chunk.compression ) + " not supported." );
+    }
+}
+
+Eigen::VectorXd ColumnarBinaryFileReader::readColumn( const int columnIndex ) const
+{
+    if( columnIndex < 0 || columnIndex >= getNumberOfColumns( ) )
+    {
+        throw std::runtime_error( "Error when reading column " + std::to_string( columnIndex ) + " of columnar binary file " + fileName_ +
+                                  ", index out of range." );
+    }
+
+    Eigen::VectorXd column( numberOfRows_ );
+    std::size_t currentRow = 0;
+    for( unsigned int i = 0; i < chunks_.size( ); i++ )
+    {
+        readChunkColumn( i, columnIndex, column.data( ) + currentRow );
+        currentRow += chunks_.at( i ).numberOfRows;
+    }
+    return column;
+}
+
+Eigen::MatrixXd ColumnarBinaryFileReader::readAll( ) const
+{
+    // Column-major storage allows each column of each chunk to be read directly into the table
+    Eigen::MatrixXd table( numberOfRows_, getNumberOfColumns( ) );
+    for( int j = 0; j < getNumberOfColumns( ); j++ )
+    {
+        std::size_t currentRow = 0;
+        for( unsigned int i = 0; i < chunks_.size( ); i++ )
+        {
+            readChunkColumn( i, j, table.col( j ).data( ) + currentRow );
+            currentRow += chunks_.at( i ).numberOfRows;
+        }
+    }
+    return table;
+}
+
+}  // namespace input_output
+
+}  // namespace tudat
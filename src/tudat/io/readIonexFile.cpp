@@ -9,6 +9,7 @@
  */
 
 #include "tudat/io/readIonexFile.h"
+#include "tudat/io/timeIndexedGridFile.h"
 #include "tudat/astro/basic_astro/timeConversions.h"
 #include <fstream>
 #include <sstream>
@@ -223,5 +224,35 @@ void readIonexFiles( const std::vector< std::string >& filePaths, IonexTecMap& d
     }
 }
 
+void convertIonexFilesToTimeIndexedGridFile( const std::vector< std::string >& filePaths, const std::string& gridFilePath )
+{
+    IonexTecMap tecData;
+    readIonexFiles( filePaths, tecData );
+    tecData.validate( );
+
+    // Copy TEC maps to contiguous [epoch][latitude][longitude] array
+    TimeIndexedGridData gridData;
+    gridData.contentType = ionex_tec_grid_content;
+    gridData.numberOfFields = 1;
+    gridData.referenceHeight = tecData.referenceIonosphereHeight_;
+    gridData.epochs = tecData.epochs;
+    gridData.latitudes = tecData.latitudes;
+    gridData.longitudes = tecData.longitudes;
+    gridData.data.resize( gridData.epochs.size( ) * gridData.latitudes.size( ) * gridData.longitudes.size( ) );
+    for( std::size_t t = 0; t < gridData.epochs.size( ); ++t )
+    {
+        const Eigen::MatrixXd& tecMap = tecData.tecMaps.at( gridData.epochs.at( t ) );
+        for( std::size_t i = 0; i < gridData.latitudes.size( ); ++i )
+        {
+            for( std::size_t j = 0; j < gridData.longitudes.size( ); ++j )
+            {
+                gridData.data[ gridData.getDataIndex( t, 0, i, j ) ] = tecMap( i, j );
+            }
+        }
+    }
+
+    writeTimeIndexedGridFile( gridData, gridFilePath );
+}
+
 }  // namespace input_output
 }  // namespace tudat
@@ -9,6 +9,7 @@
  */
 
 #include "tudat/io/readViennaMappingFunctionData.h"
+#include "tudat/io/timeIndexedGridFile.h"
 #include "tudat/astro/basic_astro/timeConversions.h"
 #include "tudat/interface/sofa/sofaTimeConversions.h"
 #include "tudat/math/basic/mathematicalConstants.h"
@@ -190,6 +191,57 @@ void readVMFFiles( const std::vector< std::string >& fileName,
     }
 }
 
+std::vector< std::string > convertVMFFilesToTimeIndexedGridFiles( const std::vector< std::string >& fileNames,
+                                                                  const bool fileHasMeteo,
+                                                                  const bool fileHasGradient,
+                                                                  const std::string& outputFilePrefix )
+{
+    std::map< std::string, VMFData > vmfData;
+    readVMFFiles( fileNames, vmfData, fileHasMeteo, fileHasGradient );
+
+    std::vector< std::string > gridFileNames;
+    for( auto it: vmfData )
+    {
+        std::map< double, Eigen::VectorXd > processedTroposphereData;
+        std::map< double, Eigen::VectorXd > processedMeteoData;
+        it.second.getFullDataSet( processedTroposphereData, processedMeteoData );
+        if( processedTroposphereData.empty( ) || ( fileHasMeteo && processedMeteoData.empty( ) ) )
+        {
+            throw std::runtime_error( "Error when converting VMF files to grid files, no " +
+                                      std::string( processedTroposphereData.empty( ) ? "troposphere" : "meteo" ) +
+                                      " data found for station " + it.first );
+        }
+
+        // Store troposphere data, followed by meteo data, as time series on 1x1 grid
+        TimeIndexedGridData gridData;
+        gridData.contentType = vmf_station_data_content;
+        gridData.contentFlags = ( fileHasMeteo ? vmfMeteoDataFlag : 0 ) | ( fileHasGradient ? vmfGradientDataFlag : 0 );
+        gridData.name = it.first;
+        gridData.latitudes = { 0.0 };
+        gridData.longitudes = { 0.0 };
+
+        int numberOfTroposphereFields = processedTroposphereData.begin( )->second.rows( );
+        int numberOfMeteoFields = fileHasMeteo ? processedMeteoData.begin( )->second.rows( ) : 0;
+        gridData.numberOfFields = numberOfTroposphereFields + numberOfMeteoFields;
+        for( auto dataIterator: processedTroposphereData )
+        {
+            gridData.epochs.push_back( dataIterator.first );
+            for( int i = 0; i < numberOfTroposphereFields; i++ )
+            {
+                gridData.data.push_back( dataIterator.second( i ) );
+            }
+            for( int i = 0; i < numberOfMeteoFields; i++ )
+            {
+                gridData.data.push_back( processedMeteoData.at( dataIterator.first )( i ) );
+            }
+        }
+
+        gridFileNames.push_back( outputFilePrefix + it.first + ".bin" );
+        writeTimeIndexedGridFile( gridData, gridFileNames.back( ) );
+    }
+    return gridFileNames;
+}
+
 }  // namespace input_output
 
 }  // namespace tudat
\ No newline at end of file
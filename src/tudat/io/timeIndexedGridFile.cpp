@@ -0,0 +1,441 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/io/timeIndexedGridFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if !( defined( _WIN64 ) || defined( _WIN32 ) )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+namespace
+{
+
+// Identifier at start of binary grid file
+const char gridFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'G', 'R', 'I', 'D', '\0' };
+
+// Version of the binary grid file format
+const int32_t gridFileVersion = 1;
+
+// Value used to detect files written with a different byte order
+const int32_t gridFileByteOrderCheck = 0x01020304;
+
+// Number of characters reserved for the name of the data set
+const int gridFileNameLength = 64;
+
+// Header of binary grid file, stored at the start of the file (size is a multiple of 8 bytes, so that the arrays that follow
+// are aligned)
+struct TimeIndexedGridFileHeader {
+    char identifier[ 8 ];
+    int32_t version;
+    int32_t byteOrderCheck;
+    int32_t contentType;
+    int32_t contentFlags;
+    int32_t numberOfEpochs;
+    int32_t numberOfLatitudes;
+    int32_t numberOfLongitudes;
+    int32_t numberOfFields;
+    double referenceHeight;
+    char name[ gridFileNameLength ];
+};
+
+static_assert( sizeof( TimeIndexedGridFileHeader ) % sizeof( double ) == 0, "Grid file header must be aligned to doubles" );
+
+void checkIncreasingGrid( const std::vector< double >& grid, const std::string& gridName )
+{
+    if( grid.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error in time-indexed grid data, no " + gridName + " provided." );
+    }
+
+    for( unsigned int i = 1; i < grid.size( ); i++ )
+    {
+        if( !( grid.at( i ) > grid.at( i - 1 ) ) )
+        {
+            throw std::runtime_error( "Error in time-indexed grid data, " + gridName + " are not strictly increasing." );
+        }
+    }
+}
+
+}  // namespace
+
+void writeTimeIndexedGridFile( const TimeIndexedGridData& gridData, const std::string& fileName )
+{
+    // Check input consistency
+    checkIncreasingGrid( gridData.epochs, "epochs" );
+    checkIncreasingGrid( gridData.latitudes, "latitudes" );
+    checkIncreasingGrid( gridData.longitudes, "longitudes" );
+    if( gridData.numberOfFields <= 0 )
+    {
+        throw std::runtime_error( "Error when writing time-indexed grid file, number of fields must be positive." );
+    }
+    if( gridData.data.size( ) !=
+        gridData.epochs.size( ) * gridData.numberOfFields * gridData.latitudes.size( ) * gridData.longitudes.size( ) )
+    {
+        throw std::runtime_error( "Error when writing time-indexed grid file, data size is inconsistent with grid size." );
+    }
+    if( static_cast< int >( gridData.name.size( ) ) >= gridFileNameLength )
+    {
+        throw std::runtime_error( "Error when writing time-indexed grid file, name " + gridData.name + " is too long." );
+    }
+
+    // Create header
+    TimeIndexedGridFileHeader header;
+    std::memset( &header, 0, sizeof( header ) );
+    std::memcpy( header.identifier, gridFileIdentifier, sizeof( gridFileIdentifier ) );
+    header.version = gridFileVersion;
+    header.byteOrderCheck = gridFileByteOrderCheck;
+    header.contentType = static_cast< int32_t >( gridData.contentType );
+    header.contentFlags = gridData.contentFlags;
+    header.numberOfEpochs = static_cast< int32_t >( gridData.epochs.size( ) );
+    header.numberOfLatitudes = static_cast< int32_t >( gridData.latitudes.size( ) );
+    header.numberOfLongitudes = static_cast< int32_t >( gridData.longitudes.size( ) );
+    header.numberOfFields = gridData.numberOfFields;
+    header.referenceHeight = gridData.referenceHeight;
+    std::memcpy( header.name, gridData.name.c_str( ), gridData.name.size( ) );
+
+    // Write header, followed by grid and data
+    std::ofstream stream( fileName, std::ios::out | std::ios::binary | std::ios::trunc );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when opening time-indexed grid file for writing: " + fileName );
+    }
+    stream.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+    stream.write( reinterpret_cast< const char* >( gridData.epochs.data( ) ), gridData.epochs.size( ) * sizeof( double ) );
+    stream.write( reinterpret_cast< const char* >( gridData.latitudes.data( ) ), gridData.latitudes.size( ) * sizeof( double ) );
+    stream.write( reinterpret_cast< const char* >( gridData.longitudes.data( ) ), gridData.longitudes.size( ) * sizeof( double ) );
+    stream.write( reinterpret_cast< const char* >( gridData.data.data( ) ), gridData.data.size( ) * sizeof( double ) );
+    if( !stream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing time-indexed grid file: " + fileName );
+    }
+}
+
+TimeIndexedGridFile::TimeIndexedGridFile( const std::string& fileName ):
+    fileName_( fileName ), currentEpochIntervalIndex_( 0 ), mappedFile_( nullptr ), mappedFileSize_( 0 ), nextBufferIndex_( 0 )
+{
+    bufferedEpochIndices_[ 0 ] = -1;
+    bufferedEpochIndices_[ 1 ] = -1;
+
+    // Map file into memory, if supported
+    std::size_t fileSize = 0;
+#if !( defined( _WIN64 ) || defined( _WIN32 ) )
+    int fileDescriptor = open( fileName.c_str( ), O_RDONLY );
+    if( fileDescriptor < 0 )
+    {
+        throw std::runtime_error( "Error when opening time-indexed grid file: " + fileName );
+    }
+
+    struct stat fileStatus;
+    if( fstat( fileDescriptor, &fileStatus ) == 0 && fileStatus.st_size > 0 )
+    {
+        fileSize = static_cast< std::size_t >( fileStatus.st_size );
+        void* mapping = mmap( nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+        if( mapping != MAP_FAILED )
+        {
+            mappedFile_ = static_cast< const char* >( mapping );
+            mappedFileSize_ = fileSize;
+        }
+    }
+    close( fileDescriptor );
+#endif
+
+    // Otherwise, open file for reading on demand
+    if( mappedFile_ == nullptr )
+    {
+        fileStream_.open( fileName, std::ios::in | std::ios::binary );
+        if( !fileStream_.good( ) )
+        {
+            throw std::runtime_error( "Error when opening time-indexed grid file: " + fileName );
+        }
+        fileStream_.seekg( 0, std::ios::end );
+        fileSize = static_cast< std::size_t >( fileStream_.tellg( ) );
+        fileStream_.seekg( 0, std::ios::beg );
+    }
+
+    // Read header and grid definition, releasing the mapped file if these are invalid
+    try
+    {
+        readHeaderAndGrid( fileSize );
+    }
+    catch( const std::runtime_error& )
+    {
+        unmapFile( );
+        throw;
+    }
+
+    isEpochAccessed_.resize( epochs_.size( ), false );
+}
+
+void TimeIndexedGridFile::readHeaderAndGrid( const std::size_t fileSize )
+{
+    // Read and check header
+    TimeIndexedGridFileHeader header;
+    if( fileSize < sizeof( header ) )
+    {
+        throw std::runtime_error( "Error when reading time-indexed grid file " + fileName_ + ", file is too small." );
+    }
+
+    if( mappedFile_ != nullptr )
+    {
+        std::memcpy( &header, mappedFile_, sizeof( header ) );
+    }
+    else
+    {
+        fileStream_.read( reinterpret_cast< char* >( &header ), sizeof( header ) );
+    }
+
+    if( std::memcmp( header.identifier, gridFileIdentifier, sizeof( gridFileIdentifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading time-indexed grid file " + fileName_ +
+                                  ", file is not a time-indexed grid file." );
+    }
+    if( header.byteOrderCheck != gridFileByteOrderCheck )
+    {
+        throw std::runtime_error( "Error when reading time-indexed grid file " + fileName_ +
+                                  ", file was written with different byte order." );
+    }
+    if( header.version != gridFileVersion )
+    {
+        throw std::runtime_error( "Error when reading time-indexed grid file " + fileName_ + ", file version " +
+                                  std::to_string( header.version ) + " is not supported." );
+    }
+    if( header.numberOfEpochs <= 0 || header.numberOfLatitudes <= 0 || header.numberOfLongitudes <= 0 || header.numberOfFields <= 0 )
+    {
+        throw std::runtime_error( "Error when reading time-indexed grid file " + fileName_ + ", grid size is invalid." );
+    }
+
+    contentType_ = static_cast< TimeIndexedGridContentType >( header.contentType );
+    contentFlags_ = header.contentFlags;
+    numberOfFields_ = header.numberOfFields;
+    referenceHeight_ = header.referenceHeight;
+    header.name[ gridFileNameLength - 1 ] = '\0';
+    name_ = std::string( header.name );
+
+    epochBlockSize_ = static_cast< std::size_t >( numberOfFields_ ) * header.numberOfLatitudes * header.numberOfLongitudes;
+    dataOffset_ = sizeof( header ) + sizeof( double ) * ( static_cast< std::size_t >( header.numberOfEpochs ) +
+                                                          header.numberOfLatitudes + header.numberOfLongitudes );
+    if( fileSize != dataOffset_ + sizeof( double ) * epochBlockSize_ * header.numberOfEpochs )
+    {
+        throw std::runtime_error( "Error when reading time-indexed grid file " + fileName_ +
+                                  ", file size is inconsistent with grid size." );
+    }
+
+    // Read grid definition
+    epochs_.resize( header.numberOfEpochs );
+    latitudes_.resize( header.numberOfLatitudes );
+    longitudes_.resize( header.numberOfLongitudes );
+    if( mappedFile_ != nullptr )
+    {
+        const char* currentPosition = mappedFile_ + sizeof( header );
+        std::memcpy( epochs_.data( ), currentPosition, epochs_.size( ) * sizeof( double ) );
+        currentPosition += epochs_.size( ) * sizeof( double );
+        std::memcpy( latitudes_.data( ), currentPosition, latitudes_.size( ) * sizeof( double ) );
+        currentPosition += latitudes_.size( ) * sizeof( double );
+        std::memcpy( longitudes_.data( ), currentPosition, longitudes_.size( ) * sizeof( double ) );
+    }
+    else
+    {
+        fileStream_.read( reinterpret_cast< char* >( epochs_.data( ) ), epochs_.size( ) * sizeof( double ) );
+        fileStream_.read( reinterpret_cast< char* >( latitudes_.data( ) ), latitudes_.size( ) * sizeof( double ) );
+        fileStream_.read( reinterpret_cast< char* >( longitudes_.data( ) ), longitudes_.size( ) * sizeof( double ) );
+    }
+
+}
+
+void TimeIndexedGridFile::unmapFile( )
+{
+#if !( defined( _WIN64 ) || defined( _WIN32 ) )
+    if( mappedFile_ != nullptr )
+    {
+        munmap( const_cast< char* >( mappedFile_ ), mappedFileSize_ );
+        mappedFile_ = nullptr;
+    }
+#endif
+}
+
+TimeIndexedGridFile::~TimeIndexedGridFile( )
+{
+    unmapFile( );
+}
+
+int TimeIndexedGridFile::getEpochIntervalIndex( const double time )
+{
+    const int numberOfEpochs = static_cast< int >( epochs_.size( ) );
+    if( numberOfEpochs < 2 || time <= epochs_.front( ) )
+    {
+        currentEpochIntervalIndex_ = 0;
+    }
+    else if( time >= epochs_.back( ) )
+    {
+        currentEpochIntervalIndex_ = numberOfEpochs - 2;
+    }
+    // Check current and next interval first, since consecutive calls are typically close in time
+    else if( !( time >= epochs_[ currentEpochIntervalIndex_ ] && time < epochs_[ currentEpochIntervalIndex_ + 1 ] ) )
+    {
+        if( currentEpochIntervalIndex_ + 2 < numberOfEpochs && time >= epochs_[ currentEpochIntervalIndex_ + 1 ] &&
+            time < epochs_[ currentEpochIntervalIndex_ + 2 ] )
+        {
+            currentEpochIntervalIndex_++;
+        }
+        else
+        {
+            currentEpochIntervalIndex_ =
+                    static_cast< int >( std::upper_bound( epochs_.begin( ), epochs_.end( ), time ) - epochs_.begin( ) ) - 1;
+        }
+    }
+    return currentEpochIntervalIndex_;
+}
+
+void TimeIndexedGridFile::getGridInterval( const std::vector< double >& grid, const double value, int& lowerIndex, double& fraction )
+{
+    const int gridSize = static_cast< int >( grid.size( ) );
+    if( gridSize < 2 || value <= grid.front( ) )
+    {
+        lowerIndex = 0;
+        fraction = 0.0;
+    }
+    else if( value >= grid.back( ) )
+    {
+        lowerIndex = gridSize - 2;
+        fraction = 1.0;
+    }
+    else
+    {
+        lowerIndex = static_cast< int >( std::upper_bound( grid.begin( ), grid.end( ), value ) - grid.begin( ) ) - 1;
+        fraction = ( value - grid[ lowerIndex ] ) / ( grid[ lowerIndex + 1 ] - grid[ lowerIndex ] );
+    }
+}
+
+const double* TimeIndexedGridFile::getEpochData( const int epochIndex )
+{
+    isEpochAccessed_[ epochIndex ] = true;
+    if( mappedFile_ != nullptr )
+    {
+        return reinterpret_cast< const double* >( mappedFile_ + dataOffset_ ) + epochBlockSize_ * epochIndex;
+    }
+
+    // Read data from file, if not yet buffered
+    for( int i = 0; i < 2; i++ )
+    {
+        if( bufferedEpochIndices_[ i ] == epochIndex )
+        {
+            nextBufferIndex_ = 1 - i;
+            return epochDataBuffer_[ i ].data( );
+        }
+    }
+
+    const int bufferIndex = nextBufferIndex_;
+    epochDataBuffer_[ bufferIndex ].resize( epochBlockSize_ );
+    fileStream_.clear( );
+    fileStream_.seekg( dataOffset_ + sizeof( double ) * epochBlockSize_ * epochIndex, std::ios::beg );
+    fileStream_.read( reinterpret_cast< char* >( epochDataBuffer_[ bufferIndex ].data( ) ), sizeof( double ) * epochBlockSize_ );
+    if( !fileStream_.good( ) )
+    {
+        throw std::runtime_error( "Error when reading data from time-indexed grid file " + fileName_ );
+    }
+    bufferedEpochIndices_[ bufferIndex ] = epochIndex;
+    nextBufferIndex_ = 1 - bufferIndex;
+    return epochDataBuffer_[ bufferIndex ].data( );
+}
+
+double TimeIndexedGridFile::interpolateField( const int fieldIndex, const double time, const double latitude, const double longitude )
+{
+    if( fieldIndex < 0 || fieldIndex >= numberOfFields_ )
+    {
+        throw std::runtime_error( "Error when interpolating time-indexed grid file, field index " + std::to_string( fieldIndex ) +
+                                  " is invalid." );
+    }
+
+    // Retrieve interpolation indices and fractions
+    int latitudeIndex, longitudeIndex;
+    double latitudeFraction, longitudeFraction;
+    getGridInterval( latitudes_, latitude, latitudeIndex, latitudeFraction );
+    getGridInterval( longitudes_, longitude, longitudeIndex, longitudeFraction );
+
+    const int numberOfLongitudes = static_cast< int >( longitudes_.size( ) );
+    const int nextLatitudeOffset = latitudes_.size( ) > 1 ? numberOfLongitudes : 0;
+    const int nextLongitudeOffset = longitudes_.size( ) > 1 ? 1 : 0;
+    const std::size_t pointOffset =
+            ( static_cast< std::size_t >( fieldIndex ) * latitudes_.size( ) + latitudeIndex ) * numberOfLongitudes + longitudeIndex;
+
+    // Interpolate bilinearly in space at bracketing epochs
+    const int epochIndex = getEpochIntervalIndex( time );
+    const int numberOfEpochsToInterpolate = epochs_.size( ) > 1 ? 2 : 1;
+    double valuesAtEpochs[ 2 ] = { 0.0, 0.0 };
+    for( int i = 0; i < numberOfEpochsToInterpolate; i++ )
+    {
+        const double* cornerData = getEpochData( epochIndex + i ) + pointOffset;
+        valuesAtEpochs[ i ] = ( 1.0 - latitudeFraction ) *
+                        ( ( 1.0 - longitudeFraction ) * cornerData[ 0 ] + longitudeFraction * cornerData[ nextLongitudeOffset ] ) +
+                latitudeFraction *
+                        ( ( 1.0 - longitudeFraction ) * cornerData[ nextLatitudeOffset ] +
+                          longitudeFraction * cornerData[ nextLatitudeOffset + nextLongitudeOffset ] );
+    }
+
+    // Interpolate linearly in time
+    if( numberOfEpochsToInterpolate == 1 )
+    {
+        return valuesAtEpochs[ 0 ];
+    }
+    double timeFraction = ( time - epochs_[ epochIndex ] ) / ( epochs_[ epochIndex + 1 ] - epochs_[ epochIndex ] );
+    timeFraction = std::min( std::max( timeFraction, 0.0 ), 1.0 );
+    return ( 1.0 - timeFraction ) * valuesAtEpochs[ 0 ] + timeFraction * valuesAtEpochs[ 1 ];
+}
+
+Eigen::VectorXd TimeIndexedGridFile::interpolateFields( const double time, const double latitude, const double longitude )
+{
+    Eigen::VectorXd interpolatedFields = Eigen::VectorXd::Zero( numberOfFields_ );
+    for( int i = 0; i < numberOfFields_; i++ )
+    {
+        interpolatedFields( i ) = interpolateField( i, time, latitude, longitude );
+    }
+    return interpolatedFields;
+}
+
+Eigen::VectorXd TimeIndexedGridFile::getFieldsAtGridPoint( const int epochIndex, const int latitudeIndex, const int longitudeIndex )
+{
+    if( epochIndex < 0 || epochIndex >= static_cast< int >( epochs_.size( ) ) || latitudeIndex < 0 ||
+        latitudeIndex >= static_cast< int >( latitudes_.size( ) ) || longitudeIndex < 0 ||
+        longitudeIndex >= static_cast< int >( longitudes_.size( ) ) )
+    {
+        throw std::runtime_error( "Error when retrieving data from time-indexed grid file, index out of range." );
+    }
+
+    const double* epochData = getEpochData( epochIndex );
+    Eigen::VectorXd fields = Eigen::VectorXd::Zero( numberOfFields_ );
+    for( int i = 0; i < numberOfFields_; i++ )
+    {
+        fields( i ) = epochData[ ( static_cast< std::size_t >( i ) * latitudes_.size( ) + latitudeIndex ) * longitudes_.size( ) +
+                                 longitudeIndex ];
+    }
+    return fields;
+}
+
+int TimeIndexedGridFile::getNumberOfAccessedEpochs( ) const
+{
+    return static_cast< int >( std::count( isEpochAccessed_.begin( ), isEpochAccessed_.end( ), true ) );
+}
+
+}  // namespace input_output
+
+}  // namespace tudat
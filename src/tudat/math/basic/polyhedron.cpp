@@ -9,6 +9,10 @@
  *
  */
 
+#include <stdexcept>
+#include <string>
+#include <thread>
+
 #include "tudat/math/basic/polyhedron.h"
 
 namespace tudat
@@ -99,10 +103,13 @@ void calculatePolyhedronPerFacetFactor( Eigen::VectorXd& perFacetFactor,
         }
         else
         {
+            const double normI = relPosI.norm( );
+            const double normJ = relPosJ.norm( );
+            const double normK = relPosK.norm( );
             perFacetFactor( facet ) = 2.0 *
                     atan2( numerator,
-                           ( relPosI.norm( ) * relPosJ.norm( ) * relPosK.norm( ) + relPosI.norm( ) * relPosJ.dot( relPosK ) +
-                             relPosJ.norm( ) * relPosK.dot( relPosI ) + relPosK.norm( ) * relPosI.dot( relPosJ ) ) );
+                           ( normI * normJ * normK + normI * relPosJ.dot( relPosK ) + normJ * relPosK.dot( relPosI ) +
+                             normK * relPosI.dot( relPosJ ) ) );
         }
     }
 }
@@ -126,14 +133,16 @@ void calculatePolyhedronPerEdgeFactor( Eigen::VectorXd& perEdgeFactor,
         // Selection of the edgeFactor to be 0 is only valid when computing the potential and the derivative of the
         // potential, not when computing the 2nd derivative! See "The solid angle hidden in polyhedron gravitation
         // formulations", Werner (2017), appendix C1
-        const double denominator = relPosI.norm( ) + relPosJ.norm( ) - eIJ.norm( );
+        const double normSum = relPosI.norm( ) + relPosJ.norm( );
+        const double edgeLength = eIJ.norm( );
+        const double denominator = normSum - edgeLength;
         if( std::abs( denominator ) < 1e-18 )
         {
             perEdgeFactor( edge ) = 0;
         }
         else
         {
-            perEdgeFactor( edge ) = log( ( relPosI.norm( ) + relPosJ.norm( ) + eIJ.norm( ) ) / denominator );
+            perEdgeFactor( edge ) = log( ( normSum + edgeLength ) / denominator );
         }
     }
 }
@@ -157,7 +166,8 @@ double calculatePolyhedronGravitationalPotential( const double gravitationalCons
         const Eigen::Vector3d toEdgeVector =
                 verticesCoordinatesRelativeToFieldPoint.block< 1, 3 >( verticesDefiningEachEdge( edge, 0 ), 0 );
 
-        perEdgeSum += ( toEdgeVector.transpose( ) * edgeDyads.at( edge ) * toEdgeVector * perEdgeFactor( edge ) )( 0, 0 );
+        perEdgeSum += toEdgeVector.dot( Eigen::Map< const Eigen::Matrix3d >( edgeDyads.at( edge ).data( ) ) * toEdgeVector ) *
+                perEdgeFactor( edge );
     }
 
     // Loop over facets
@@ -166,7 +176,8 @@ double calculatePolyhedronGravitationalPotential( const double gravitationalCons
         const Eigen::Vector3d toFacetVector =
                 verticesCoordinatesRelativeToFieldPoint.block< 1, 3 >( verticesDefiningEachFacet( facet, 0 ), 0 );
 
-        perFacetSum += ( toFacetVector.transpose( ) * facetDyads.at( facet ) * toFacetVector * perFacetFactor( facet ) )( 0, 0 );
+        perFacetSum += toFacetVector.dot( Eigen::Map< const Eigen::Matrix3d >( facetDyads.at( facet ).data( ) ) * toFacetVector ) *
+                perFacetFactor( facet );
     }
 
     return 0.5 * gravitationalConstantTimesDensity * ( perEdgeSum - perFacetSum );
@@ -195,7 +206,7 @@ Eigen::Vector3d calculatePolyhedronGradientOfGravitationalPotential( const doubl
                   verticesCoordinatesRelativeToFieldPoint.block< 1, 3 >( verticesDefiningEachEdge( edge, 1 ), 0 ) ) /
                 2;
 
-        perEdgeSum += edgeDyads.at( edge ) * toEdgeVector * perEdgeFactor( edge );
+        perEdgeSum += Eigen::Map< const Eigen::Matrix3d >( edgeDyads.at( edge ).data( ) ) * toEdgeVector * perEdgeFactor( edge );
     }
 
     // Loop over facets
@@ -207,7 +218,7 @@ Eigen::Vector3d calculatePolyhedronGradientOfGravitationalPotential( const doubl
                   verticesCoordinatesRelativeToFieldPoint.block< 1, 3 >( verticesDefiningEachFacet( facet, 2 ), 0 ) ) /
                 3.0;
 
-        perFacetSum += facetDyads.at( facet ) * toFacetVector * perFacetFactor( facet );
+        perFacetSum += Eigen::Map< const Eigen::Matrix3d >( facetDyads.at( facet ).data( ) ) * toFacetVector * perFacetFactor( facet );
     }
 
     return -gravitationalConstantTimesDensity * ( perEdgeSum - perFacetSum );
@@ -234,13 +245,13 @@ Eigen::Matrix3d calculatePolyhedronHessianOfGravitationalPotential( const double
             // calculatePolyhedronPerEdgeFactor, and reference within). This is not valid when computing the hessian matrix!
             throw std::runtime_error( "Computation of hessian matrix has a singularity for points at edges." );
         }
-        perEdgeSum += edgeDyads.at( edge ) * perEdgeFactor( edge );
+        perEdgeSum += Eigen::Map< const Eigen::Matrix3d >( edgeDyads.at( edge ).data( ) ) * perEdgeFactor( edge );
     }
 
     // Loop over facets
     for( unsigned int facet = 0; facet < numberOfFacets; ++facet )
     {
-        perFacetSum += facetDyads.at( facet ) * perFacetFactor( facet );
+        perFacetSum += Eigen::Map< const Eigen::Matrix3d >( facetDyads.at( facet ).data( ) ) * perFacetFactor( facet );
     }
 
     return gravitationalConstantTimesDensity * ( perEdgeSum - perFacetSum );
@@ -260,5 +271,280 @@ double calculatePolyhedronLaplacianOfGravitationalPotential( const double gravit
     return -gravitationalConstantTimesDensity * perEdgeFactorSum;
 }
 
+PolyhedronGravityKernel::PolyhedronGravityKernel( const Eigen::MatrixXd& verticesCoordinates,
+                                                  const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                                  const Eigen::MatrixXi& verticesDefiningEachEdge,
+                                                  const std::vector< Eigen::MatrixXd >& facetDyads,
+                                                  const std::vector< Eigen::MatrixXd >& edgeDyads,
+                                                  const int numberOfThreads ):
+    numberOfVertices_( verticesCoordinates.rows( ) ), numberOfFacets_( verticesDefiningEachFacet.rows( ) ),
+    numberOfEdges_( verticesDefiningEachEdge.rows( ) ), numberOfThreads_( 1 )
+{
+    if( static_cast< int >( facetDyads.size( ) ) != numberOfFacets_ || static_cast< int >( edgeDyads.size( ) ) != numberOfEdges_ )
+    {
+        throw std::runtime_error( "Error when creating polyhedron gravity kernel: number of dyads (" +
+                                  std::to_string( facetDyads.size( ) ) + ", " + std::to_string( edgeDyads.size( ) ) +
+                                  ") inconsistent with number of facets and edges (" + std::to_string( numberOfFacets_ ) + ", " +
+                                  std::to_string( numberOfEdges_ ) + ")." );
+    }
+    setNumberOfThreads( numberOfThreads );
+
+    // Store vertices
+    vertexX_.resize( numberOfVertices_ );
+    vertexY_.resize( numberOfVertices_ );
+    vertexZ_.resize( numberOfVertices_ );
+    for( int vertex = 0; vertex < numberOfVertices_; ++vertex )
+    {
+        vertexX_[ vertex ] = verticesCoordinates( vertex, 0 );
+        vertexY_[ vertex ] = verticesCoordinates( vertex, 1 );
+        vertexZ_[ vertex ] = verticesCoordinates( vertex, 2 );
+    }
+    relativeX_.resize( numberOfVertices_ );
+    relativeY_.resize( numberOfVertices_ );
+    relativeZ_.resize( numberOfVertices_ );
+    relativeNorm_.resize( numberOfVertices_ );
+
+    // Store facet vertices and (unique entries of) facet dyads
+    facetVertex0_.resize( numberOfFacets_ );
+    facetVertex1_.resize( numberOfFacets_ );
+    facetVertex2_.resize( numberOfFacets_ );
+    facetDyadXX_.resize( numberOfFacets_ );
+    facetDyadXY_.resize( numberOfFacets_ );
+    facetDyadXZ_.resize( numberOfFacets_ );
+    facetDyadYY_.resize( numberOfFacets_ );
+    facetDyadYZ_.resize( numberOfFacets_ );
+    facetDyadZZ_.resize( numberOfFacets_ );
+    for( int facet = 0; facet < numberOfFacets_; ++facet )
+    {
+        facetVertex0_[ facet ] = verticesDefiningEachFacet( facet, 0 );
+        facetVertex1_[ facet ] = verticesDefiningEachFacet( facet, 1 );
+        facetVertex2_[ facet ] = verticesDefiningEachFacet( facet, 2 );
+
+        const Eigen::MatrixXd& currentDyad = facetDyads.at( facet );
+        facetDyadXX_[ facet ] = currentDyad( 0, 0 );
+        facetDyadXY_[ facet ] = currentDyad( 0, 1 );
+        facetDyadXZ_[ facet ] = currentDyad( 0, 2 );
+        facetDyadYY_[ facet ] = currentDyad( 1, 1 );
+        facetDyadYZ_[ facet ] = currentDyad( 1, 2 );
+        facetDyadZZ_[ facet ] = currentDyad( 2, 2 );
+    }
+
+    // Store edge vertices, edge lengths and (unique entries of) edge dyads
+    edgeVertex0_.resize( numberOfEdges_ );
+    edgeVertex1_.resize( numberOfEdges_ );
+    edgeLength_.resize( numberOfEdges_ );
+    edgeDyadXX_.resize( numberOfEdges_ );
+    edgeDyadXY_.resize( numberOfEdges_ );
+    edgeDyadXZ_.resize( numberOfEdges_ );
+    edgeDyadYY_.resize( numberOfEdges_ );
+    edgeDyadYZ_.resize( numberOfEdges_ );
+    edgeDyadZZ_.resize( numberOfEdges_ );
+    for( int edge = 0; edge < numberOfEdges_; ++edge )
+    {
+        edgeVertex0_[ edge ] = verticesDefiningEachEdge( edge, 0 );
+        edgeVertex1_[ edge ] = verticesDefiningEachEdge( edge, 1 );
+        edgeLength_[ edge ] = ( verticesCoordinates.block< 1, 3 >( edgeVertex0_[ edge ], 0 ) -
+                                verticesCoordinates.block< 1, 3 >( edgeVertex1_[ edge ], 0 ) )
+                                      .norm( );
+
+        const Eigen::MatrixXd& currentDyad = edgeDyads.at( edge );
+        edgeDyadXX_[ edge ] = currentDyad( 0, 0 );
+        edgeDyadXY_[ edge ] = currentDyad( 0, 1 );
+        edgeDyadXZ_[ edge ] = currentDyad( 0, 2 );
+        edgeDyadYY_[ edge ] = currentDyad( 1, 1 );
+        edgeDyadYZ_[ edge ] = currentDyad( 1, 2 );
+        edgeDyadZZ_[ edge ] = currentDyad( 2, 2 );
+    }
+}
+
+void PolyhedronGravityKernel::setNumberOfThreads( const int numberOfThreads )
+{
+    if( numberOfThreads < 1 )
+    {
+        throw std::runtime_error( "Error when setting number of threads for polyhedron gravity kernel, number must be positive, found " +
+                                  std::to_string( numberOfThreads ) );
+    }
+    numberOfThreads_ = numberOfThreads;
+}
+
+void PolyhedronGravityKernel::evaluate( const Eigen::Vector3d& bodyFixedPosition,
+                                        Eigen::VectorXd& perFacetFactor,
+                                        Eigen::VectorXd& perEdgeFactor,
+                                        double& potentialPerUnitDensity,
+                                        Eigen::Vector3d& gradientPerUnitDensity )
+{
+    perFacetFactor.resize( numberOfFacets_ );
+    perEdgeFactor.resize( numberOfEdges_ );
+
+    // Compute coordinates of vertices with respect to field point, and their norms, on contiguous arrays
+    const double fieldPointX = bodyFixedPosition.x( );
+    const double fieldPointY = bodyFixedPosition.y( );
+    const double fieldPointZ = bodyFixedPosition.z( );
+    for( int vertex = 0; vertex < numberOfVertices_; ++vertex )
+    {
+        relativeX_[ vertex ] = vertexX_[ vertex ] - fieldPointX;
+        relativeY_[ vertex ] = vertexY_[ vertex ] - fieldPointY;
+        relativeZ_[ vertex ] = vertexZ_[ vertex ] - fieldPointZ;
+    }
+    for( int vertex = 0; vertex < numberOfVertices_; ++vertex )
+    {
+        relativeNorm_[ vertex ] = std::sqrt( relativeX_[ vertex ] * relativeX_[ vertex ] + relativeY_[ vertex ] * relativeY_[ vertex ] +
+                                             relativeZ_[ vertex ] * relativeZ_[ vertex ] );
+    }
+
+    // Compute factors and sums, distributing contiguous blocks of facets and edges over threads if requested
+    PolyhedronTermSums termSums;
+    if( numberOfThreads_ == 1 )
+    {
+        evaluateBlock( 0, numberOfFacets_, 0, numberOfEdges_, perFacetFactor.data( ), perEdgeFactor.data( ), termSums );
+    }
+    else
+    {
+        std::vector< PolyhedronTermSums > threadTermSums( numberOfThreads_ );
+        std::vector< std::thread > threads;
+        for( int i = 0; i < numberOfThreads_; i++ )
+        {
+            const int firstFacet = ( i * numberOfFacets_ ) / numberOfThreads_;
+            const int endFacet = ( ( i + 1 ) * numberOfFacets_ ) / numberOfThreads_;
+            const int firstEdge = ( i * numberOfEdges_ ) / numberOfThreads_;
+            const int endEdge = ( ( i + 1 ) * numberOfEdges_ ) / numberOfThreads_;
+            threads.emplace_back( [ =, &perFacetFactor, &perEdgeFactor, &threadTermSums ]( ) {
+                evaluateBlock(
+                        firstFacet, endFacet, firstEdge, endEdge, perFacetFactor.data( ), perEdgeFactor.data( ), threadTermSums[ i ] );
+            } );
+        }
+        for( auto& thread: threads )
+        {
+            thread.join( );
+        }
+
+        // Combine partial sums in fixed order, so that results do not depend on thread scheduling
+        for( int i = 0; i < numberOfThreads_; i++ )
+        {
+            termSums.edgePotentialSum += threadTermSums[ i ].edgePotentialSum;
+            termSums.facetPotentialSum += threadTermSums[ i ].facetPotentialSum;
+            termSums.edgeGradientSum += threadTermSums[ i ].edgeGradientSum;
+            termSums.facetGradientSum += threadTermSums[ i ].facetGradientSum;
+        }
+    }
+
+    potentialPerUnitDensity = 0.5 * ( termSums.edgePotentialSum - termSums.facetPotentialSum );
+    gradientPerUnitDensity = -( termSums.edgeGradientSum - termSums.facetGradientSum );
+}
+
+void PolyhedronGravityKernel::evaluateBlock( const int firstFacet,
+                                             const int endFacet,
+                                             const int firstEdge,
+                                             const int endEdge,
+                                             double* perFacetFactor,
+                                             double* perEdgeFactor,
+                                             PolyhedronTermSums& termSums ) const
+{
+    const double* relativeX = relativeX_.data( );
+    const double* relativeY = relativeY_.data( );
+    const double* relativeZ = relativeZ_.data( );
+    const double* relativeNorm = relativeNorm_.data( );
+
+    double edgePotentialSum = 0.0;
+    double edgeGradientSumX = 0.0, edgeGradientSumY = 0.0, edgeGradientSumZ = 0.0;
+    for( int edge = firstEdge; edge < endEdge; ++edge )
+    {
+        const int i = edgeVertex0_[ edge ];
+        const int j = edgeVertex1_[ edge ];
+
+        // Per-edge factor; see calculatePolyhedronPerEdgeFactor
+        const double normSum = relativeNorm[ i ] + relativeNorm[ j ];
+        const double denominator = normSum - edgeLength_[ edge ];
+        const double edgeFactor = ( std::abs( denominator ) < 1e-18 ) ? 0.0 : std::log( ( normSum + edgeLength_[ edge ] ) / denominator );
+        perEdgeFactor[ edge ] = edgeFactor;
+
+        // Potential term, evaluated using first vertex of edge
+        const double dyadTimesVertexX =
+                edgeDyadXX_[ edge ] * relativeX[ i ] + edgeDyadXY_[ edge ] * relativeY[ i ] + edgeDyadXZ_[ edge ] * relativeZ[ i ];
+        const double dyadTimesVertexY =
+                edgeDyadXY_[ edge ] * relativeX[ i ] + edgeDyadYY_[ edge ] * relativeY[ i ] + edgeDyadYZ_[ edge ] * relativeZ[ i ];
+        const double dyadTimesVertexZ =
+                edgeDyadXZ_[ edge ] * relativeX[ i ] + edgeDyadYZ_[ edge ] * relativeY[ i ] + edgeDyadZZ_[ edge ] * relativeZ[ i ];
+        edgePotentialSum +=
+                ( relativeX[ i ] * dyadTimesVertexX + relativeY[ i ] * dyadTimesVertexY + relativeZ[ i ] * dyadTimesVertexZ ) * edgeFactor;
+
+        // Gradient term, evaluated using midpoint of edge
+        const double midpointX = ( relativeX[ i ] + relativeX[ j ] ) / 2.0;
+        const double midpointY = ( relativeY[ i ] + relativeY[ j ] ) / 2.0;
+        const double midpointZ = ( relativeZ[ i ] + relativeZ[ j ] ) / 2.0;
+        edgeGradientSumX += ( edgeDyadXX_[ edge ] * midpointX + edgeDyadXY_[ edge ] * midpointY + edgeDyadXZ_[ edge ] * midpointZ ) *
+                edgeFactor;
+        edgeGradientSumY += ( edgeDyadXY_[ edge ] * midpointX + edgeDyadYY_[ edge ] * midpointY + edgeDyadYZ_[ edge ] * midpointZ ) *
+                edgeFactor;
+        edgeGradientSumZ += ( edgeDyadXZ_[ edge ] * midpointX + edgeDyadYZ_[ edge ] * midpointY + edgeDyadZZ_[ edge ] * midpointZ ) *
+                edgeFactor;
+    }
+
+    double facetPotentialSum = 0.0;
+    double facetGradientSumX = 0.0, facetGradientSumY = 0.0, facetGradientSumZ = 0.0;
+    for( int facet = firstFacet; facet < endFacet; ++facet )
+    {
+        const int i = facetVertex0_[ facet ];
+        const int j = facetVertex1_[ facet ];
+        const int k = facetVertex2_[ facet ];
+
+        // Per-facet factor; see calculatePolyhedronPerFacetFactor
+        const double crossJKX = relativeY[ j ] * relativeZ[ k ] - relativeZ[ j ] * relativeY[ k ];
+        const double crossJKY = relativeZ[ j ] * relativeX[ k ] - relativeX[ j ] * relativeZ[ k ];
+        const double crossJKZ = relativeX[ j ] * relativeY[ k ] - relativeY[ j ] * relativeX[ k ];
+        const double numerator = relativeX[ i ] * crossJKX + relativeY[ i ] * crossJKY + relativeZ[ i ] * crossJKZ;
+
+        double facetFactor = 0.0;
+        if( numerator != 0.0 )
+        {
+            const double dotJK = relativeX[ j ] * relativeX[ k ] + relativeY[ j ] * relativeY[ k ] + relativeZ[ j ] * relativeZ[ k ];
+            const double dotKI = relativeX[ k ] * relativeX[ i ] + relativeY[ k ] * relativeY[ i ] + relativeZ[ k ] * relativeZ[ i ];
+            const double dotIJ = relativeX[ i ] * relativeX[ j ] + relativeY[ i ] * relativeY[ j ] + relativeZ[ i ] * relativeZ[ j ];
+            facetFactor = 2.0 *
+                    std::atan2( numerator,
+                                relativeNorm[ i ] * relativeNorm[ j ] * relativeNorm[ k ] + relativeNorm[ i ] * dotJK +
+                                        relativeNorm[ j ] * dotKI + relativeNorm[ k ] * dotIJ );
+        }
+        perFacetFactor[ facet ] = facetFactor;
+
+        // Potential term, evaluated using first vertex of facet
+        const double dyadTimesVertexX =
+                facetDyadXX_[ facet ] * relativeX[ i ] + facetDyadXY_[ facet ] * relativeY[ i ] + facetDyadXZ_[ facet ] * relativeZ[ i ];
+        const double dyadTimesVertexY =
+                facetDyadXY_[ facet ] * relativeX[ i ] + facetDyadYY_[ facet ] * relativeY[ i ] + facetDyadYZ_[ facet ] * relativeZ[ i ];
+        const double dyadTimesVertexZ =
+                facetDyadXZ_[ facet ] * relativeX[ i ] + facetDyadYZ_[ facet ] * relativeY[ i ] + facetDyadZZ_[ facet ] * relativeZ[ i ];
+        facetPotentialSum +=
+                ( relativeX[ i ] * dyadTimesVertexX + relativeY[ i ] * dyadTimesVertexY + relativeZ[ i ] * dyadTimesVertexZ ) * facetFactor;
+
+        // Gradient term, evaluated using centroid of facet
+        const double centroidX = ( relativeX[ i ] + relativeX[ j ] + relativeX[ k ] ) / 3.0;
+        const double centroidY = ( relativeY[ i ] + relativeY[ j ] + relativeY[ k ] ) / 3.0;
+        const double centroidZ = ( relativeZ[ i ] + relativeZ[ j ] + relativeZ[ k ] ) / 3.0;
+        facetGradientSumX += ( facetDyadXX_[ facet ] * centroidX + facetDyadXY_[ facet ] * centroidY + facetDyadXZ_[ facet ] * centroidZ ) *
+                facetFactor;
+        facetGradientSumY += ( facetDyadXY_[ facet ] * centroidX + facetDyadYY_[ facet ] * centroidY + facetDyadYZ_[ facet ] * centroidZ ) *
+                facetFactor;
+        facetGradientSumZ += ( facetDyadXZ_[ facet ] * centroidX + facetDyadYZ_[ facet ] * centroidY + facetDyadZZ_[ facet ] * centroidZ ) *
+                facetFactor;
+    }
+
+    termSums.edgePotentialSum = edgePotentialSum;
+    termSums.facetPotentialSum = facetPotentialSum;
+    termSums.edgeGradientSum << edgeGradientSumX, edgeGradientSumY, edgeGradientSumZ;
+    termSums.facetGradientSum << facetGradientSumX, facetGradientSumY, facetGradientSumZ;
+}
+
+void PolyhedronGravityKernel::getVerticesCoordinatesRelativeToFieldPoint( Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint ) const
+{
+    verticesCoordinatesRelativeToFieldPoint.resize( numberOfVertices_, 3 );
+    for( int vertex = 0; vertex < numberOfVertices_; ++vertex )
+    {
+        verticesCoordinatesRelativeToFieldPoint( vertex, 0 ) = relativeX_[ vertex ];
+        verticesCoordinatesRelativeToFieldPoint( vertex, 1 ) = relativeY_[ vertex ];
+        verticesCoordinatesRelativeToFieldPoint( vertex, 2 ) = relativeZ_[ vertex ];
+    }
+}
+
 }  // namespace basic_mathematics
 }  // namespace tudat
@@ -1,4 +1,9 @@
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
 
 #include "tudat/math/statistics/fastFourierTransform.h"
 
@@ -8,104 +13,372 @@ namespace tudat
 namespace fftw_interface
 {
 
-std::vector< std::complex< double > > performFftOfRealData( const std::vector< double >& realTimeDomainData )
+namespace
+{
+
+//! FFTW plan for (a batch of) in-place real-to-complex or complex-to-real transforms, with the aligned buffer it operates on.
+/*!
+ *  FFTW plan for (a batch of) in-place real-to-complex or complex-to-real transforms, with the aligned buffer it operates on.
+ *  Each series occupies numberOfDataPoints / 2 + 1 complex entries in the buffer, so that the real data (with padding) and
+ *  the non-redundant half of the spectrum share the same memory.
+ */
+class CachedFftPlan
 {
-    // Convert input data to raw array.
-    double* rawArrayTimeDomainData = new double[ realTimeDomainData.size( ) ];
-    for( unsigned int i = 0; i < realTimeDomainData.size( ); i++ )
+public:
+    CachedFftPlan( const int numberOfDataPoints, const int numberOfSeries, const bool isForwardTransform, const unsigned int planFlags ):
+        numberOfComplexEntriesPerSeries_( numberOfDataPoints / 2 + 1 )
+    {
+        buffer_ = fftw_alloc_complex( static_cast< size_t >( numberOfComplexEntriesPerSeries_ ) * numberOfSeries );
+        if( buffer_ == nullptr )
+        {
+            throw std::runtime_error( "Error when creating FFTW plan, could not allocate buffer for " +
+                                      std::to_string( numberOfSeries ) + " series of size " + std::to_string( numberOfDataPoints ) );
+        }
+
+        // Create plan; the buffer is overwritten during planning when using FFTW_MEASURE, so it is only filled afterwards.
+        const int numberOfRealEntriesPerSeries = 2 * numberOfComplexEntriesPerSeries_;
+        if( isForwardTransform )
+        {
+            plan_ = fftw_plan_many_dft_r2c( 1,
+                                            &numberOfDataPoints,
+                                            numberOfSeries,
+                                            getRealBuffer( ),
+                                            nullptr,
+                                            1,
+                                            numberOfRealEntriesPerSeries,
+                                            buffer_,
+                                            nullptr,
+                                            1,
+                                            numberOfComplexEntriesPerSeries_,
+                                            planFlags );
+        }
+        else
+        {
+            plan_ = fftw_plan_many_dft_c2r( 1,
+                                            &numberOfDataPoints,
+                                            numberOfSeries,
+                                            buffer_,
+                                            nullptr,
+                                            1,
+                                            numberOfComplexEntriesPerSeries_,
+                                            getRealBuffer( ),
+                                            nullptr,
+                                            1,
+                                            numberOfRealEntriesPerSeries,
+                                            planFlags );
+        }
+
+        if( plan_ == nullptr )
+        {
+            fftw_free( buffer_ );
+            throw std::runtime_error( "Error when creating FFTW plan for " + std::to_string( numberOfSeries ) + " series of size " +
+                                      std::to_string( numberOfDataPoints ) );
+        }
+    }
+
+    ~CachedFftPlan( )
     {
-        rawArrayTimeDomainData[ i ] = realTimeDomainData[ i ];
+        fftw_destroy_plan( plan_ );
+        fftw_free( buffer_ );
     }
 
-    // Perform fft of real data using raw array.
-    fftw_complex* rawArrayFrequencyDomainData = performRawFftOfRealData( rawArrayTimeDomainData, realTimeDomainData.size( ) );
+    CachedFftPlan( const CachedFftPlan& ) = delete;
+
+    CachedFftPlan& operator=( const CachedFftPlan& ) = delete;
+
+    //! Function to perform the transform on the current contents of the buffer
+    void execute( )
+    {
+        fftw_execute( plan_ );
+    }
+
+    //! Function to retrieve the start of the real data of a given series in the buffer
+    double* getRealBuffer( const int seriesIndex = 0 )
+    {
+        return reinterpret_cast< double* >( buffer_ + static_cast< size_t >( seriesIndex ) * numberOfComplexEntriesPerSeries_ );
+    }
+
+    //! Function to retrieve the start of the complex data of a given series in the buffer (std::complex is layout-compatible with
+    //! fftw_complex)
+    std::complex< double >* getComplexBuffer( const int seriesIndex = 0 )
+    {
+        return reinterpret_cast< std::complex< double >* >( buffer_ +
+                                                            static_cast< size_t >( seriesIndex ) * numberOfComplexEntriesPerSeries_ );
+    }
+
+private:
+    int numberOfComplexEntriesPerSeries_;
+
+    fftw_complex* buffer_;
+
+    fftw_plan plan_;
+};
+
+//! Cache of FFTW plans, keyed by transform size, number of series and direction.
+/*!
+ *  Cache of FFTW plans, keyed by transform size, number of series and direction. As the FFTW planner is not thread-safe, and the
+ *  cached buffers are shared, all access to the cache (including execution of the plans) is serialized by the mutex.
+ */
+struct FftPlanCache
+{
+    std::mutex mutex;
+
+    std::map< std::tuple< int, int, bool >, std::unique_ptr< CachedFftPlan > > plans;
+
+    bool useMeasuredPlans = true;
+
+    int maximumMeasuredPlanSize = 1048576;
+};
+
+FftPlanCache& getFftPlanCache( )
+{
+    static FftPlanCache planCache;
+    return planCache;
+}
+
+//! Function to retrieve (and create if needed) a cached plan; mutex of plan cache must be locked by caller.
+CachedFftPlan& getCachedFftPlan( FftPlanCache& planCache,
+                                 const int numberOfDataPoints,
+                                 const int numberOfSeries,
+                                 const bool isForwardTransform )
+{
+    if( numberOfDataPoints < 1 )
+    {
+        throw std::runtime_error( "Error when performing FFT, number of data points must be positive, is " +
+                                  std::to_string( numberOfDataPoints ) );
+    }
 
-    // Copy raw array to vector of complex doubles.
-    std::vector< std::complex< double > > frequencyDomainData;
-    frequencyDomainData.resize( realTimeDomainData.size( ) / 2 + 1 );
-    for( unsigned int i = 0; i < realTimeDomainData.size( ) / 2 + 1; i++ )
+    std::unique_ptr< CachedFftPlan >& cachedPlan =
+            planCache.plans[ std::make_tuple( numberOfDataPoints, numberOfSeries, isForwardTransform ) ];
+    if( cachedPlan == nullptr )
     {
-        frequencyDomainData[ i ] = std::complex< double >( rawArrayFrequencyDomainData[ i ][ 0 ], rawArrayFrequencyDomainData[ i ][ 1 ] );
+        // Measure plan if requested and affordable; otherwise use wisdom (if available) or an estimated plan.
+        if( planCache.useMeasuredPlans &&
+            static_cast< long long >( numberOfDataPoints ) * numberOfSeries <= planCache.maximumMeasuredPlanSize )
+        {
+            cachedPlan = std::make_unique< CachedFftPlan >( numberOfDataPoints, numberOfSeries, isForwardTransform, FFTW_MEASURE );
+        }
+        else
+        {
+            try
+            {
+                cachedPlan = std::make_unique< CachedFftPlan >(
+                        numberOfDataPoints, numberOfSeries, isForwardTransform, FFTW_MEASURE | FFTW_WISDOM_ONLY );
+            }
+            catch( const std::runtime_error& )
+            {
+                cachedPlan = std::make_unique< CachedFftPlan >( numberOfDataPoints, numberOfSeries, isForwardTransform, FFTW_ESTIMATE );
+            }
+        }
     }
+    return *cachedPlan;
+}
 
-    // Deallocate raw arrays.
-    fftw_free( rawArrayFrequencyDomainData );
-    delete[] rawArrayTimeDomainData;
+}  // namespace
+
+std::vector< std::complex< double > > performFftOfRealData( const std::vector< double >& realTimeDomainData )
+{
+    const int numberOfDataPoints = static_cast< int >( realTimeDomainData.size( ) );
+
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    CachedFftPlan& cachedPlan = getCachedFftPlan( planCache, numberOfDataPoints, 1, true );
+
+    // Perform in-place fft of real data.
+    std::copy( realTimeDomainData.begin( ), realTimeDomainData.end( ), cachedPlan.getRealBuffer( ) );
+    cachedPlan.execute( );
 
     // Return Fourier transform of real data.
-    return frequencyDomainData;
+    return std::vector< std::complex< double > >( cachedPlan.getComplexBuffer( ),
+                                                  cachedPlan.getComplexBuffer( ) + numberOfDataPoints / 2 + 1 );
 }
 
 fftw_complex* performRawFftOfRealData( double* realTimeDomainData, const int numberOfDataPoints )
 {
-    // Create and allocate raw array for fourier transform return data.
-    fftw_complex* complexFrequencyDomainData;
-    complexFrequencyDomainData = (fftw_complex*)fftw_malloc( sizeof( fftw_complex ) * ( std::ceil( numberOfDataPoints ) ) );
-
-    // Create fftw plan for transform of real data.
-    fftw_plan p;
-    p = fftw_plan_dft_r2c_1d( numberOfDataPoints, realTimeDomainData, complexFrequencyDomainData, FFTW_ESTIMATE );
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    CachedFftPlan& cachedPlan = getCachedFftPlan( planCache, numberOfDataPoints, 1, true );
 
-    // Perform Fourier transform;
-    fftw_execute( p );
+    // Perform in-place fft of real data.
+    std::copy( realTimeDomainData, realTimeDomainData + numberOfDataPoints, cachedPlan.getRealBuffer( ) );
+    cachedPlan.execute( );
 
-    // De-allocate plan.
-    fftw_destroy_plan( p );
+    // Create and allocate raw array for fourier transform return data, with conjugate terms set to zero.
+    fftw_complex* complexFrequencyDomainData = fftw_alloc_complex( numberOfDataPoints );
+    std::complex< double >* complexFrequencyDomainDataStart = reinterpret_cast< std::complex< double >* >( complexFrequencyDomainData );
+    std::copy( cachedPlan.getComplexBuffer( ),
+               cachedPlan.getComplexBuffer( ) + numberOfDataPoints / 2 + 1,
+               complexFrequencyDomainDataStart );
+    std::fill( complexFrequencyDomainDataStart + numberOfDataPoints / 2 + 1,
+               complexFrequencyDomainDataStart + numberOfDataPoints,
+               std::complex< double >( 0.0, 0.0 ) );
 
     return complexFrequencyDomainData;
 }
 
 std::vector< double > performInverseFftToRealData( const std::vector< std::complex< double > >& frequencyDomainData )
 {
-    // Allocate raw complex data type.
-    fftw_complex* rawArrayFrequencyDomainData;
-    rawArrayFrequencyDomainData = (fftw_complex*)fftw_malloc( sizeof( fftw_complex ) * frequencyDomainData.size( ) );
+    const int timeDomainDataSize = 2 * static_cast< int >( frequencyDomainData.size( ) ) - 2;
 
-    // Fill values of raw frequency domain array.
-    for( unsigned int i = 0; i < frequencyDomainData.size( ); i++ )
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    CachedFftPlan& cachedPlan = getCachedFftPlan( planCache, timeDomainDataSize, 1, false );
+
+    // Perform in-place fft to obtain real data
+    std::copy( frequencyDomainData.begin( ), frequencyDomainData.end( ), cachedPlan.getComplexBuffer( ) );
+    cachedPlan.execute( );
+
+    // Copy normalized buffer data into vector.
+    std::vector< double > timeDomainData( timeDomainDataSize );
+    const double* realBuffer = cachedPlan.getRealBuffer( );
+    for( int i = 0; i < timeDomainDataSize; i++ )
     {
-        rawArrayFrequencyDomainData[ i ][ 0 ] = frequencyDomainData[ i ].real( );
-        rawArrayFrequencyDomainData[ i ][ 1 ] = frequencyDomainData[ i ].imag( );
+        timeDomainData[ i ] = realBuffer[ i ] / static_cast< double >( timeDomainDataSize );
     }
 
-    int timeDomainDataSize = 2 * frequencyDomainData.size( ) - 2;
+    return timeDomainData;
+}
 
-    // Perform fft to obtain real data
-    double* rawArrayTimeDomainData = performRawInverseFFtToRealData( rawArrayFrequencyDomainData, timeDomainDataSize );
+double* performRawInverseFFtToRealData( fftw_complex* frequencyDomainData, const int numberOfDataPoints )
+{
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    CachedFftPlan& cachedPlan = getCachedFftPlan( planCache, numberOfDataPoints, 1, false );
 
-    // Copy raw array data into vector.
-    std::vector< double > timeDomainData;
-    timeDomainData.resize( timeDomainDataSize );
-    for( int i = 0; i < timeDomainDataSize; i++ )
+    // Perform in-place fourier transform, using only the non-conjugate terms.
+    const std::complex< double >* frequencyDomainDataStart = reinterpret_cast< std::complex< double >* >( frequencyDomainData );
+    std::copy( frequencyDomainDataStart, frequencyDomainDataStart + numberOfDataPoints / 2 + 1, cachedPlan.getComplexBuffer( ) );
+    cachedPlan.execute( );
+
+    // Create, allocate and fill real time domain output data.
+    double* realTimeDomainData = new double[ numberOfDataPoints ];
+    std::copy( cachedPlan.getRealBuffer( ), cachedPlan.getRealBuffer( ) + numberOfDataPoints, realTimeDomainData );
+
+    // Return time domain data.
+    return realTimeDomainData;
+}
+
+std::vector< std::vector< std::complex< double > > > performFftOfMultipleRealDataSeries(
+        const std::vector< std::vector< double > >& realTimeDomainData )
+{
+    std::vector< std::vector< std::complex< double > > > frequencyDomainData;
+    if( realTimeDomainData.size( ) == 0 )
     {
-        timeDomainData[ i ] = rawArrayTimeDomainData[ i ] / static_cast< double >( timeDomainDataSize );
+        return frequencyDomainData;
     }
 
-    // Deallocate raw arrays.
-    fftw_free( rawArrayFrequencyDomainData );
-    delete[] rawArrayTimeDomainData;
+    const int numberOfSeries = static_cast< int >( realTimeDomainData.size( ) );
+    const int numberOfDataPoints = static_cast< int >( realTimeDomainData.at( 0 ).size( ) );
+    for( int i = 1; i < numberOfSeries; i++ )
+    {
+        if( static_cast< int >( realTimeDomainData.at( i ).size( ) ) != numberOfDataPoints )
+        {
+            throw std::runtime_error( "Error when performing batched FFT, series " + std::to_string( i ) + " has size " +
+                                      std::to_string( realTimeDomainData.at( i ).size( ) ) + ", expected " +
+                                      std::to_string( numberOfDataPoints ) );
+        }
+    }
 
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    CachedFftPlan& cachedPlan = getCachedFftPlan( planCache, numberOfDataPoints, numberOfSeries, true );
+
+    // Perform in-place fft of all series with a single plan.
+    for( int i = 0; i < numberOfSeries; i++ )
+    {
+        std::copy( realTimeDomainData.at( i ).begin( ), realTimeDomainData.at( i ).end( ), cachedPlan.getRealBuffer( i ) );
+    }
+    cachedPlan.execute( );
+
+    frequencyDomainData.reserve( numberOfSeries );
+    for( int i = 0; i < numberOfSeries; i++ )
+    {
+        frequencyDomainData.emplace_back( cachedPlan.getComplexBuffer( i ), cachedPlan.getComplexBuffer( i ) + numberOfDataPoints / 2 + 1 );
+    }
+    return frequencyDomainData;
+}
+
+std::vector< std::vector< double > > performInverseFftToMultipleRealDataSeries(
+        const std::vector< std::vector< std::complex< double > > >& frequencyDomainData )
+{
+    std::vector< std::vector< double > > timeDomainData;
+    if( frequencyDomainData.size( ) == 0 )
+    {
+        return timeDomainData;
+    }
+
+    const int numberOfSeries = static_cast< int >( frequencyDomainData.size( ) );
+    const int numberOfFrequencies = static_cast< int >( frequencyDomainData.at( 0 ).size( ) );
+    for( int i = 1; i < numberOfSeries; i++ )
+    {
+        if( static_cast< int >( frequencyDomainData.at( i ).size( ) ) != numberOfFrequencies )
+        {
+            throw std::runtime_error( "Error when performing batched inverse FFT, series " + std::to_string( i ) + " has size " +
+                                      std::to_string( frequencyDomainData.at( i ).size( ) ) + ", expected " +
+                                      std::to_string( numberOfFrequencies ) );
+        }
+    }
+    const int timeDomainDataSize = 2 * numberOfFrequencies - 2;
+
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    CachedFftPlan& cachedPlan = getCachedFftPlan( planCache, timeDomainDataSize, numberOfSeries, false );
+
+    // Perform in-place inverse fft of all series with a single plan.
+    for( int i = 0; i < numberOfSeries; i++ )
+    {
+        std::copy( frequencyDomainData.at( i ).begin( ), frequencyDomainData.at( i ).end( ), cachedPlan.getComplexBuffer( i ) );
+    }
+    cachedPlan.execute( );
+
+    timeDomainData.resize( numberOfSeries );
+    for( int i = 0; i < numberOfSeries; i++ )
+    {
+        const double* realBuffer = cachedPlan.getRealBuffer( i );
+        timeDomainData[ i ].resize( timeDomainDataSize );
+        for( int j = 0; j < timeDomainDataSize; j++ )
+        {
+            timeDomainData[ i ][ j ] = realBuffer[ j ] / static_cast< double >( timeDomainDataSize );
+        }
+    }
     return timeDomainData;
 }
 
-double* performRawInverseFFtToRealData( fftw_complex* frequencyDomainData, const int numberOfDataPoints )
+void setUseMeasuredFftPlans( const bool useMeasuredPlans, const int maximumMeasuredPlanSize )
 {
-    // Create and allocate real time doman output data.
-    double* realTimeDomainData;
-    realTimeDomainData = new double[ numberOfDataPoints ];
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    planCache.useMeasuredPlans = useMeasuredPlans;
+    planCache.maximumMeasuredPlanSize = maximumMeasuredPlanSize;
+    planCache.plans.clear( );
+}
 
-    // Create fourier transform plan.
-    fftw_plan p;
-    p = fftw_plan_dft_c2r_1d( numberOfDataPoints, frequencyDomainData, realTimeDomainData, FFTW_ESTIMATE );
+void clearFftPlanCache( )
+{
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    planCache.plans.clear( );
+}
 
-    // Perform fourier transform
-    fftw_execute( p );
+int getNumberOfCachedFftPlans( )
+{
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    return static_cast< int >( planCache.plans.size( ) );
+}
 
-    // Delete plan.
-    fftw_destroy_plan( p );
+bool importFftwWisdomFromFile( const std::string& fileName )
+{
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    return ( fftw_import_wisdom_from_filename( fileName.c_str( ) ) != 0 );
+}
 
-    // Return time domain data.
-    return realTimeDomainData;
+bool exportFftwWisdomToFile( const std::string& fileName )
+{
+    FftPlanCache& planCache = getFftPlanCache( );
+    std::lock_guard< std::mutex > lock( planCache.mutex );
+    return ( fftw_export_wisdom_to_filename( fileName.c_str( ) ) != 0 );
 }
 
 }  // namespace fftw_interface
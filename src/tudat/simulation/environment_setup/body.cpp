@@ -8,7 +8,14 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "tudat/astro/ephemerides/constantRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/fullPlanetaryRotationModel.h"
+#include "tudat/astro/ephemerides/iauRotationModel.h"
+#include "tudat/astro/ephemerides/itrsToGcrsRotationModel.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/synchronousRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
+#include "tudat/interface/spice/spiceRotationalEphemeris.h"
 #include "tudat/simulation/environment_setup/body.h"
 
 namespace tudat
@@ -17,6 +24,18 @@ namespace tudat
 namespace simulation_setup
 {
 
+//! Function to check whether a rotational ephemeris depends only on time
+bool isRotationalEphemerisDependentOnlyOnTime( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris )
+{
+    return std::dynamic_pointer_cast< ephemerides::SimpleRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+            std::dynamic_pointer_cast< ephemerides::ConstantRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+            std::dynamic_pointer_cast< ephemerides::SpiceRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+            std::dynamic_pointer_cast< ephemerides::GcrsToItrsRotationModel >( rotationalEphemeris ) != nullptr ||
+            std::dynamic_pointer_cast< ephemerides::PlanetaryRotationModel >( rotationalEphemeris ) != nullptr ||
+            std::dynamic_pointer_cast< ephemerides::IauRotationModel >( rotationalEphemeris ) != nullptr ||
+            ephemerides::isTabulatedRotationalEphemeris( rotationalEphemeris );
+}
+
 void Body::getPositionByReference( Eigen::Vector3d& position )
 {
     position = currentState_.segment( 0, 3 );
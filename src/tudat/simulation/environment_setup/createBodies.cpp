@@ -8,9 +8,12 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <atomic>
 #include <iostream>
 #include <cmath>
+#include <exception>
 #include <memory>
+#include <thread>
 
 #include <boost/lambda/lambda.hpp>
 
@@ -168,6 +171,177 @@ std::vector< std::pair< std::string, std::shared_ptr< BodySettings > > > determi
     return outputVector;
 }
 
+//! Function to determine whether an ephemeris created from given settings may be shared between systems of bodies
+bool isEphemerisModelShareable( const std::shared_ptr< EphemerisSettings > ephemerisSettings )
+{
+    bool isShareable = false;
+    if( ephemerisSettings != nullptr && !ephemerisSettings->getMakeMultiArcEphemeris( ) )
+    {
+        switch( ephemerisSettings->getEphemerisType( ) )
+        {
+            // Tabulated (e.g. interpolated_spice) ephemerides are not shared, since their interpolator modifies its
+            // internal cache on each evaluation
+            case direct_spice_ephemeris:
+            case constant_ephemeris:
+            case chebyshev_ephemeris:
+                isShareable = true;
+                break;
+            default:
+                isShareable = false;
+                break;
+        }
+    }
+    return isShareable;
+}
+
+//! Function to determine whether a gravity field created from given settings may be shared between systems of bodies
+bool isGravityFieldModelShareable(
+        const std::shared_ptr< GravityFieldSettings > gravityFieldSettings,
+        const std::vector< std::shared_ptr< GravityFieldVariationSettings > >& gravityFieldVariationSettings )
+{
+    bool isShareable = false;
+    if( gravityFieldSettings != nullptr && gravityFieldVariationSettings.size( ) == 0 )
+    {
+        switch( gravityFieldSettings->getGravityFieldType( ) )
+        {
+            // Spherical harmonic gravity fields are not shared, since they modify their internal cache on each evaluation
+            case central:
+            case central_spice:
+                isShareable = true;
+                break;
+            default:
+                isShareable = false;
+                break;
+        }
+    }
+    return isShareable;
+}
+
+//! Function to determine whether an atmosphere created from given settings may be shared between systems of bodies
+bool isAtmosphereModelShareable( const std::shared_ptr< AtmosphereSettings > atmosphereSettings )
+{
+    return ( atmosphereSettings != nullptr && atmosphereSettings->getAtmosphereType( ) == exponential_atmosphere );
+}
+
+//! Function to determine whether a shape model created from given settings may be shared between systems of bodies
+bool isBodyShapeModelShareable( const std::shared_ptr< BodyShapeSettings > shapeModelSettings )
+{
+    bool isShareable = false;
+    if( shapeModelSettings != nullptr )
+    {
+        switch( shapeModelSettings->getBodyShapeType( ) )
+        {
+            case spherical:
+            case spherical_spice:
+            case oblate_spheroid:
+            case oblate_spice:
+                isShareable = true;
+                break;
+            default:
+                isShareable = false;
+                break;
+        }
+    }
+    return isShareable;
+}
+
+//! Function to determine whether a rotation model created from given settings may be shared between systems of bodies
+bool isRotationModelShareable( const std::shared_ptr< RotationModelSettings > rotationModelSettings )
+{
+    bool isShareable = false;
+    if( rotationModelSettings != nullptr )
+    {
+        switch( rotationModelSettings->getRotationType( ) )
+        {
+            case simple_rotation_model:
+            case spice_rotation_model:
+                isShareable = true;
+                break;
+            default:
+                isShareable = false;
+                break;
+        }
+    }
+    return isShareable;
+}
+
+//! Function to determine whether the creation of a rotation model requires other environment models to be created first
+bool isRotationModelDependentOnOtherModels( const std::shared_ptr< RotationModelSettings > rotationModelSettings )
+{
+    bool isDependent = true;
+    switch( rotationModelSettings->getRotationType( ) )
+    {
+        case simple_rotation_model:
+        case spice_rotation_model:
+        case gcrs_to_itrs_rotation_model:
+        case planetary_rotation_model:
+        case tabulated_rotation_model:
+        case iau_rotation_model:
+            isDependent = false;
+            break;
+        default:
+            isDependent = true;
+            break;
+    }
+    return isDependent;
+}
+
+//! Function to execute a list of mutually independent environment model creation tasks
+void executeEnvironmentModelCreationTasks( const std::vector< std::function< void( ) > >& creationTasks, const int numberOfThreads )
+{
+    const int numberOfTasks = static_cast< int >( creationTasks.size( ) );
+    const int numberOfUsedThreads = std::min( numberOfThreads, numberOfTasks );
+    if( numberOfUsedThreads <= 1 )
+    {
+        for( int i = 0; i < numberOfTasks; i++ )
+        {
+            creationTasks.at( i )( );
+        }
+    }
+    else
+    {
+        std::atomic< int > nextTaskIndex( 0 );
+        std::atomic< bool > isTaskFailed( false );
+        std::vector< std::exception_ptr > taskExceptions( numberOfTasks );
+
+        // Each thread retrieves the next unexecuted task, until all tasks are done (or one has failed)
+        auto executeTasks = [ & ]( ) {
+            int currentTaskIndex = nextTaskIndex++;
+            while( currentTaskIndex < numberOfTasks && !isTaskFailed )
+            {
+                try
+                {
+                    creationTasks.at( currentTaskIndex )( );
+                }
+                catch( ... )
+                {
+                    taskExceptions.at( currentTaskIndex ) = std::current_exception( );
+                    isTaskFailed = true;
+                }
+                currentTaskIndex = nextTaskIndex++;
+            }
+        };
+
+        std::vector< std::thread > threads;
+        for( int i = 0; i < numberOfUsedThreads; i++ )
+        {
+            threads.push_back( std::thread( executeTasks ) );
+        }
+        for( unsigned int i = 0; i < threads.size( ); i++ )
+        {
+            threads.at( i ).join( );
+        }
+
+        for( int i = 0; i < numberOfTasks; i++ )
+        {
+            if( taskExceptions.at( i ) != nullptr )
+            {
+                std::rethrow_exception( taskExceptions.at( i ) );
+            }
+        }
+    }
+}
+
 //! Function to create a simplified system of bodies
 simulation_setup::SystemOfBodies createSimplifiedSystemOfBodies( const double secondsSinceJ2000 )
 {
@@ -452,6 +452,17 @@ std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
                                                                                 polyhedronFieldSettings->getVerticesDefiningEachFacet( ),
                                                                                 associatedReferenceFrame,
                                                                                 inertiaTensorUpdateFunction );
+
+                // Set numerical settings of polyhedron evaluation
+                std::shared_ptr< PolyhedronGravityField > polyhedronGravityField =
+                        std::dynamic_pointer_cast< PolyhedronGravityField >( gravityFieldModel );
+                polyhedronGravityField->setNumberOfThreads( polyhedronFieldSettings->getNumberOfThreads( ) );
+                if( polyhedronFieldSettings->getFarFieldMaximumDegree( ) >= 0 )
+                {
+                    polyhedronGravityField->setFarFieldSphericalHarmonicExpansion(
+                            polyhedronFieldSettings->getFarFieldMaximumDegree( ),
+                            polyhedronFieldSettings->getFarFieldBrillouinSphereMarginFactor( ) );
+                }
             }
             break;
         }
@@ -10,6 +10,7 @@
 
 #include "tudat/io/readViennaMappingFunctionData.h"
 #include "tudat/io/readIonexFile.h"
+#include "tudat/io/timeIndexedGridFile.h"
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/simulation/estimation_setup/createLightTimeCorrection.h"
 #include "tudat/astro/observation_models/corrections/firstOrderRelativisticCorrection.h"
@@ -25,6 +26,14 @@ namespace tudat
 namespace observation_models
 {
 
+//! Function to retrieve the cache of station- and epoch-dependent media-correction terms of a ground station
+std::shared_ptr< ground_stations::StationMediaCorrectionCache > getStationMediaCorrectionCache(
+        const simulation_setup::SystemOfBodies& bodies,
+        const LinkEndId& groundStation )
+{
+    return bodies.getBody( groundStation.bodyName_ )->getGroundStation( groundStation.stationName_ )->getMediaCorrectionCache( );
+}
+
 //! Function to create object that computes a single (type of) correction to the light-time
 std::shared_ptr< LightTimeCorrection > createLightTimeCorrections( const std::shared_ptr< LightTimeCorrectionSettings > correctionSettings,
                                                                    const simulation_setup::SystemOfBodies& bodies,
@@ -158,21 +167,31 @@ std::shared_ptr< LightTimeCorrection > createLightTimeCorrections( const std::sh
                             .at( stationSpacecraftPair )
                             .count( baseObservableType ) )
                 {
-                    lightTimeCorrection = std::make_shared< TabulatedTroposphericCorrection >(
-                            troposphericCorrectionSettings->getTroposphericDryCorrection( )
-                                    .at( stationSpacecraftPair )
-                                    .at( baseObservableType ),
-                            troposphericCorrectionSettings->getTroposphericWetCorrection( )
-                                    .at( stationSpacecraftPair )
-                                    .at( baseObservableType ),
-                            troposphericCorrectionSettings->getTroposphericDryCorrectionAdjustment( )
-                                    .at( stationSpacecraftPair )
-                                    .at( baseObservableType ),
-                            troposphericCorrectionSettings->getTroposphericWetCorrectionAdjustment( )
-                                    .at( stationSpacecraftPair )
-                                    .at( baseObservableType ),
-                            troposphericElevationMapping,
-                            isUplinkCorrection );
+                    std::shared_ptr< TabulatedTroposphericCorrection > tabulatedTroposphericCorrection =
+                            std::make_shared< TabulatedTroposphericCorrection >(
+                                    troposphericCorrectionSettings->getTroposphericDryCorrection( )
+                                            .at( stationSpacecraftPair )
+                                            .at( baseObservableType ),
+                                    troposphericCorrectionSettings->getTroposphericWetCorrection( )
+                                            .at( stationSpacecraftPair )
+                                            .at( baseObservableType ),
+                                    troposphericCorrectionSettings->getTroposphericDryCorrectionAdjustment( )
+                                            .at( stationSpacecraftPair )
+                                            .at( baseObservableType ),
+                                    troposphericCorrectionSettings->getTroposphericWetCorrectionAdjustment( )
+                                            .at( stationSpacecraftPair )
+                                            .at( baseObservableType ),
+                                    troposphericElevationMapping,
+                                    isUplinkCorrection );
+
+                    // Share zenith corrections between observation models using this station (tabulated data is per observable)
+                    std::shared_ptr< ground_stations::StationMediaCorrectionCache > stationCache =
+                            getStationMediaCorrectionCache( bodies, groundStation );
+                    tabulatedTroposphericCorrection->setStationMediaCorrectionCache(
+                            stationCache,
+                            stationCache->getTermIndex( "tabulated_tropospheric_" + getObservableName( baseObservableType ),
+                                                        correctionSettings ) );
+                    lightTimeCorrection = tabulatedTroposphericCorrection;
                 }
                 else
                 {
@@ -259,15 +278,25 @@ std::shared_ptr< LightTimeCorrection > createLightTimeCorrections( const std::sh
                             "pressure model type not recognized." );
                 }
 
-                lightTimeCorrection = std::make_shared< SaastamoinenTroposphericCorrection >(
-                        groundStationGeodeticPositionFunction,
-                        bodies.getBody( groundStation.bodyName_ )->getGroundStation( groundStation.stationName_ )->getPressureFunction( ),
-                        bodies.getBody( groundStation.bodyName_ )
-                                ->getGroundStation( groundStation.stationName_ )
-                                ->getTemperatureFunction( ),
-                        waterVaporPartialPressureFunction,
-                        troposphericElevationMapping,
-                        isUplinkCorrection );
+                std::shared_ptr< SaastamoinenTroposphericCorrection > saastamoinenCorrection =
+                        std::make_shared< SaastamoinenTroposphericCorrection >(
+                                groundStationGeodeticPositionFunction,
+                                bodies.getBody( groundStation.bodyName_ )
+                                        ->getGroundStation( groundStation.stationName_ )
+                                        ->getPressureFunction( ),
+                                bodies.getBody( groundStation.bodyName_ )
+                                        ->getGroundStation( groundStation.stationName_ )
+                                        ->getTemperatureFunction( ),
+                                waterVaporPartialPressureFunction,
+                                troposphericElevationMapping,
+                                isUplinkCorrection );
+
+                // Share zenith corrections between observation models using this station
+                std::shared_ptr< ground_stations::StationMediaCorrectionCache > stationCache =
+                        getStationMediaCorrectionCache( bodies, groundStation );
+                saastamoinenCorrection->setStationMediaCorrectionCache(
+                        stationCache, stationCache->getTermIndex( "saastamoinen_tropospheric", correctionSettings ) );
+                lightTimeCorrection = saastamoinenCorrection;
             }
             // Set correction to nullptr if correction isn't valid for selected link ends
             else
@@ -346,8 +375,19 @@ std::shared_ptr< LightTimeCorrection > createLightTimeCorrections( const std::sh
                 }
 
                 // Create the light-time correction object
-                lightTimeCorrection = std::make_shared< VMF3TroposphericCorrection >(
+                std::shared_ptr< VMF3TroposphericCorrection > vmf3Correction = std::make_shared< VMF3TroposphericCorrection >(
                         troposphericElevationMapping, isUplinkCorrection, troposphereData, useGradientCorrection );
+
+                // Share zenith delays and mapping coefficients between observation models using this station (only for VMF3 mapping,
+                // for which the seasonal coefficients are included in the station terms)
+                if( std::dynamic_pointer_cast< VMF3MappingModel >( troposphericElevationMapping ) != nullptr )
+                {
+                    std::shared_ptr< ground_stations::StationMediaCorrectionCache > stationCache =
+                            getStationMediaCorrectionCache( bodies, groundStation );
+                    vmf3Correction->setStationMediaCorrectionCache( stationCache,
+                                                                    stationCache->getTermIndex( "vmf3_tropospheric", correctionSettings ) );
+                }
+                lightTimeCorrection = vmf3Correction;
             }
             else
             {
@@ -393,13 +433,25 @@ std::shared_ptr< LightTimeCorrection > createLightTimeCorrections( const std::sh
                 if( ionosphericCorrectionSettings->getReferenceRangeCorrection( ).count( stationSpacecraftPair ) &&
                     ionosphericCorrectionSettings->getReferenceRangeCorrection( ).at( stationSpacecraftPair ).count( baseObservableType ) )
                 {
-                    lightTimeCorrection = std::make_shared< TabulatedIonosphericCorrection >(
-                            ionosphericCorrectionSettings->getReferenceRangeCorrection( )
-                                    .at( stationSpacecraftPair )
-                                    .at( baseObservableType ),
-                            baseObservableType,
-                            isUplinkCorrection,
-                            ionosphericCorrectionSettings->getReferenceFrequency( ) );
+                    std::shared_ptr< TabulatedIonosphericCorrection > tabulatedIonosphericCorrection =
+                            std::make_shared< TabulatedIonosphericCorrection >(
+                                    ionosphericCorrectionSettings->getReferenceRangeCorrection( )
+                                            .at( stationSpacecraftPair )
+                                            .at( baseObservableType ),
+                                    baseObservableType,
+                                    isUplinkCorrection,
+                                    ionosphericCorrectionSettings->getReferenceFrequency( ) );
+
+                    // Share reference correction between observation models using this station (tabulated data is per spacecraft
+                    // and observable)
+                    std::shared_ptr< ground_stations::StationMediaCorrectionCache > stationCache =
+                            getStationMediaCorrectionCache( bodies, groundStation );
+                    tabulatedIonosphericCorrection->setStationMediaCorrectionCache(
+                            stationCache,
+                            stationCache->getTermIndex( "tabulated_ionospheric_" + spacecraft.bodyName_ + "_" +
+                                                                getObservableName( baseObservableType ),
+                                                        correctionSettings ) );
+                    lightTimeCorrection = tabulatedIonosphericCorrection;
                 }
                 else
                 {
@@ -773,6 +825,38 @@ std::shared_ptr< TroposhericElevationMapping > createTroposphericElevationMappin
     return troposphericMappingModel;
 }
 
+//! Function to set VMF troposphere and/or meteo data of a single ground station
+void setVmfStationData( const std::shared_ptr< ground_stations::GroundStation > currentStation,
+                        const std::map< double, Eigen::VectorXd >& processedTroposphereData,
+                        const std::map< double, Eigen::VectorXd >& processedMeteoData,
+                        const bool fileHasMeteo,
+                        const bool fileHasGradient,
+                        const bool setTropospherData,
+                        const bool setMeteoData,
+                        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+{
+    if( setMeteoData )
+    {
+        std::map< ground_stations::MeteoDataEntries, int > vmfMeteoEntries = { { ground_stations::temperature_meteo_data, 1 },
+                                                                               { ground_stations::pressure_meteo_data, 0 },
+                                                                               { ground_stations::water_vapor_pressure_meteo_data, 2 } };
+
+        std::shared_ptr< ground_stations::StationMeteoData > meteoData =
+                std::make_shared< ground_stations::ContinuousInterpolatedMeteoData >(
+                        interpolators::createOneDimensionalInterpolator( processedMeteoData, interpolatorSettings ), vmfMeteoEntries );
+
+        currentStation->setMeteoData( meteoData );
+    }
+
+    if( setTropospherData )
+    {
+        currentStation->setTroposphereData( std::make_shared< ground_stations::InterpolatedStationTroposphereData >(
+                interpolators::createOneDimensionalInterpolator( processedTroposphereData, interpolatorSettings ),
+                fileHasMeteo,
+                fileHasGradient ) );
+    }
+}
+
 void setVmfTroposphereCorrections( const std::vector< std::string >& dataFiles,
                                    const bool fileHasMeteo,
                                    const bool fileHasGradient,
@@ -796,28 +880,79 @@ void setVmfTroposphereCorrections( const std::vector< std::string >& dataFiles,
             std::map< double, Eigen::VectorXd > processedMeteoData;
             it.second.getFullDataSet( processedTroposphereData, processedMeteoData );
 
-            if( setMeteoData )
-            {
-                std::map< ground_stations::MeteoDataEntries, int > vmfMeteoEntries = { { ground_stations::temperature_meteo_data, 1 },
-                                                                                       { ground_stations::pressure_meteo_data, 0 },
-                                                                                       { ground_stations::water_vapor_pressure_meteo_data,
-                                                                                         2 } };
+            setVmfStationData( currentStation,
+                               processedTroposphereData,
+                               processedMeteoData,
+                               fileHasMeteo,
+                               fileHasGradient,
+                               setTropospherData,
+                               setMeteoData,
+                               interpolatorSettings );
+        }
+    }
+}
 
-                std::shared_ptr< ground_stations::StationMeteoData > meteoData =
-                        std::make_shared< ground_stations::ContinuousInterpolatedMeteoData >(
-                                interpolators::createOneDimensionalInterpolator( processedMeteoData, interpolatorSettings ),
-                                vmfMeteoEntries );
+void setVmfTroposphereCorrectionsFromTimeIndexedGridFiles(
+        const std::vector< std::string >& gridFiles,
+        const simulation_setup::SystemOfBodies& bodies,
+        const bool setTropospherData,
+        const bool setMeteoData,
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings,
+        const double startTime,
+        const double endTime )
+{
+    // Number of epochs outside requested time range that are loaded, to limit interpolation boundary effects
+    const int numberOfPaddingEpochs = 4;
+
+    for( unsigned int i = 0; i < gridFiles.size( ); i++ )
+    {
+        input_output::TimeIndexedGridFile gridFile( gridFiles.at( i ) );
+        if( gridFile.getContentType( ) != input_output::vmf_station_data_content )
+        {
+            throw std::runtime_error( "Error when setting VMF troposphere data, file " + gridFiles.at( i ) +
+                                      " does not contain VMF station data." );
+        }
 
-                currentStation->setMeteoData( meteoData );
+        std::string currentStationName = gridFile.getName( );
+        if( bodies.at( "Earth" )->getGroundStationMap( ).count( currentStationName ) > 0 )
+        {
+            bool fileHasMeteo = ( gridFile.getContentFlags( ) & input_output::vmfMeteoDataFlag ) != 0;
+            bool fileHasGradient = ( gridFile.getContentFlags( ) & input_output::vmfGradientDataFlag ) != 0;
+            int numberOfTroposphereFields = 4 + ( fileHasGradient ? 4 : 0 );
+
+            // Retrieve range of epochs that is to be loaded
+            const std::vector< double >& epochs = gridFile.getEpochs( );
+            int numberOfEpochs = static_cast< int >( epochs.size( ) );
+            int firstEpochIndex = 0, lastEpochIndex = numberOfEpochs - 1;
+            if( startTime == startTime )
+            {
+                firstEpochIndex = std::max( gridFile.getEpochIntervalIndex( startTime ) - numberOfPaddingEpochs, 0 );
+            }
+            if( endTime == endTime )
+            {
+                lastEpochIndex = std::min( gridFile.getEpochIntervalIndex( endTime ) + 1 + numberOfPaddingEpochs, numberOfEpochs - 1 );
             }
 
-            if( setTropospherData )
+            std::map< double, Eigen::VectorXd > processedTroposphereData;
+            std::map< double, Eigen::VectorXd > processedMeteoData;
+            for( int j = firstEpochIndex; j <= lastEpochIndex; j++ )
             {
-                currentStation->setTroposphereData( std::make_shared< ground_stations::InterpolatedStationTroposphereData >(
-                        interpolators::createOneDimensionalInterpolator( processedTroposphereData, interpolatorSettings ),
-                        fileHasMeteo,
-                        fileHasGradient ) );
+                Eigen::VectorXd currentData = gridFile.getFieldsAtGridPoint( j, 0, 0 );
+                processedTroposphereData[ epochs.at( j ) ] = currentData.segment( 0, numberOfTroposphereFields );
+                if( fileHasMeteo )
+                {
+                    processedMeteoData[ epochs.at( j ) ] = currentData.segment( numberOfTroposphereFields, 3 );
+                }
             }
+
+            setVmfStationData( bodies.at( "Earth" )->getGroundStationMap( ).at( currentStationName ),
+                               processedTroposphereData,
+                               processedMeteoData,
+                               fileHasMeteo,
+                               fileHasGradient,
+                               setTropospherData,
+                               setMeteoData && fileHasMeteo,
+                               interpolatorSettings );
         }
     }
 }
@@ -871,6 +1006,17 @@ void setIonosphereModelFromIonex( const std::vector< std::string >& dataFiles,
     bodies.at( "Earth" )->setIonosphereModel( ionosphereModel );
 }
 
+void setIonosphereModelFromTimeIndexedGridFile( const std::string& gridFile, const simulation_setup::SystemOfBodies& bodies )
+{
+    std::shared_ptr< input_output::TimeIndexedGridFile > tecGridFile = std::make_shared< input_output::TimeIndexedGridFile >( gridFile );
+    if( tecGridFile->getContentType( ) != input_output::ionex_tec_grid_content )
+    {
+        throw std::runtime_error( "Error when setting ionosphere model, file " + gridFile + " does not contain IONEX TEC maps." );
+    }
+
+    bodies.at( "Earth" )->setIonosphereModel( std::make_shared< environment::TimeIndexedGridIonosphereModel >( tecGridFile ) );
+}
+
 std::function< double( std::vector< FrequencyBands >, double ) > createLinkFrequencyFunction(
         const simulation_setup::SystemOfBodies& bodies,
         const LinkEnds& linkEnds,
@@ -246,6 +246,66 @@ std::map< LinkEnds, std::vector< std::shared_ptr< ObservationViabilityCalculator
     return viabilityCalculators;
 }
 
+//! Function to compute the instantaneous link end states for a grid of epochs, for use in viability screening
+bool getInstantaneousLinkEndStateGrids( const simulation_setup::SystemOfBodies& bodies,
+                                        const LinkEnds& linkEnds,
+                                        const ObservableType observationType,
+                                        const std::vector< double >& epochs,
+                                        std::vector< LinkEndStateGrid >& linkEndStateGrids,
+                                        std::vector< Eigen::VectorXd >& linkEndTimeGrids )
+{
+    // Retrieve link end associated with each entry of the link end state vector
+    std::map< int, LinkEndId > linkEndsPerStateIndex;
+    for( auto linkEndIterator: linkEnds )
+    {
+        std::vector< int > currentIndices;
+        try
+        {
+            currentIndices = getLinkEndIndicesForLinkEndTypeAtObservable( observationType, linkEndIterator.first, linkEnds.size( ) );
+        }
+        catch( const std::runtime_error& )
+        {
+            return false;
+        }
+
+        for( unsigned int i = 0; i < currentIndices.size( ); i++ )
+        {
+            linkEndsPerStateIndex[ currentIndices.at( i ) ] = linkEndIterator.second;
+        }
+    }
+
+    // Check if all entries of the link end state vector are defined
+    if( linkEndsPerStateIndex.size( ) == 0 ||
+        linkEndsPerStateIndex.rbegin( )->first != static_cast< int >( linkEndsPerStateIndex.size( ) ) - 1 )
+    {
+        return false;
+    }
+
+    // Evaluate each link end once, and copy to all entries at which it is used
+    Eigen::VectorXd epochGrid = Eigen::Map< const Eigen::VectorXd >( epochs.data( ), epochs.size( ) );
+    std::map< LinkEndId, LinkEndStateGrid > stateGridPerLinkEnd;
+    linkEndStateGrids.clear( );
+    linkEndTimeGrids.clear( );
+    for( auto indexIterator: linkEndsPerStateIndex )
+    {
+        if( stateGridPerLinkEnd.count( indexIterator.second ) == 0 )
+        {
+            std::function< Eigen::Vector6d( const double ) > linkEndStateFunction =
+                    simulation_setup::getLinkEndCompleteEphemerisFunction< double, double >( indexIterator.second, bodies );
+            LinkEndStateGrid currentStateGrid = LinkEndStateGrid::Zero( 6, epochs.size( ) );
+            for( unsigned int i = 0; i < epochs.size( ); i++ )
+            {
+                currentStateGrid.col( i ) = linkEndStateFunction( epochs.at( i ) );
+            }
+            stateGridPerLinkEnd[ indexIterator.second ] = currentStateGrid;
+        }
+        linkEndStateGrids.push_back( stateGridPerLinkEnd.at( indexIterator.second ) );
+        linkEndTimeGrids.push_back( epochGrid );
+    }
+
+    return true;
+}
+
 }  // namespace observation_models
 
 }  // namespace tudat
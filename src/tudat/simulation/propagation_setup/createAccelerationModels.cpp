@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <set>
 
 #include "tudat/astro/aerodynamics/flightConditions.h"
 #include "tudat/astro/ephemerides/frameManager.h"
@@ -637,6 +638,9 @@ std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel > createP
                 std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
                 std::bind( &Body::getCurrentRotationToGlobalFrame, bodyExertingAcceleration ),
                 useCentralBodyFixedFrame );
+
+        // Apply number of threads and far-field expansion of gravity field to acceleration
+        polyhedronGravityField->configurePolyhedronGravityCache( accelerationModel->getPolyhedronCache( ) );
     }
     return accelerationModel;
 }
@@ -1983,6 +1987,93 @@ void addEihAccelerations( const SystemOfBodies& bodies,
     }
 }
 
+//! Function to create the mutual point-mass gravity accelerations of a group of bodies, and add them to the acceleration map
+void addMutualPointMassGravityAccelerations( const SystemOfBodies& bodies,
+                                             const std::map< std::string, std::vector< std::string > > orderedMutualGravityBodies,
+                                             const std::map< std::string, std::string >& centralBodies,
+                                             basic_astrodynamics::AccelerationMap& accelerationMap )
+{
+    std::vector< std::string > acceleratedBodies;
+    for( auto it: orderedMutualGravityBodies )
+    {
+        if( !ephemerides::isFrameInertial( centralBodies.at( it.first ) ) )
+        {
+            throw std::runtime_error( "Error when creating mutual point-mass gravity accelerations, central body of " + it.first +
+                                      " is " + centralBodies.at( it.first ) + ", but an inertial central body is required" );
+        }
+        if( std::find( it.second.begin( ), it.second.end( ), it.first ) != it.second.end( ) )
+        {
+            throw std::runtime_error( "Error when creating mutual point-mass gravity accelerations, body " + it.first +
+                                      " cannot exert an acceleration on itself" );
+        }
+        acceleratedBodies.push_back( it.first );
+    }
+
+    // Determine which accelerated bodies attract other accelerated bodies, and which bodies are external to the group
+    std::set< std::string > attractingAcceleratedBodies;
+    std::vector< std::string > externalBodies;
+    for( auto it: orderedMutualGravityBodies )
+    {
+        for( unsigned int i = 0; i < it.second.size( ); i++ )
+        {
+            if( orderedMutualGravityBodies.count( it.second.at( i ) ) > 0 )
+            {
+                attractingAcceleratedBodies.insert( it.second.at( i ) );
+            }
+            else if( std::find( externalBodies.begin( ), externalBodies.end( ), it.second.at( i ) ) == externalBodies.end( ) )
+            {
+                externalBodies.push_back( it.second.at( i ) );
+            }
+        }
+    }
+
+    // Check if each accelerated body is attracted by all attracting accelerated bodies and all external bodies
+    for( auto it: orderedMutualGravityBodies )
+    {
+        unsigned int numberOfExpectedExertingBodies = externalBodies.size( ) + attractingAcceleratedBodies.size( ) -
+                ( attractingAcceleratedBodies.count( it.first ) > 0 ? 1 : 0 );
+        if( it.second.size( ) != numberOfExpectedExertingBodies )
+        {
+            throw std::runtime_error(
+                    "Error when creating mutual point-mass gravity accelerations, acceleration settings for " + it.first +
+                    " are incompatible with those of the other bodies in the group. Each body in the group must be attracted by all "
+                    "bodies exerting a mutual point-mass gravity acceleration on any body in the group." );
+        }
+    }
+
+    std::vector< std::function< double( ) > > gravitationalParameterFunctions;
+    std::vector< std::function< Eigen::Vector3d( ) > > positionFunctions;
+    std::vector< std::string > involvedBodies = acceleratedBodies;
+    involvedBodies.insert( involvedBodies.end( ), externalBodies.begin( ), externalBodies.end( ) );
+    for( unsigned int i = 0; i < involvedBodies.size( ); i++ )
+    {
+        std::shared_ptr< Body > currentBody = bodies.at( involvedBodies.at( i ) );
+        if( i >= acceleratedBodies.size( ) || attractingAcceleratedBodies.count( involvedBodies.at( i ) ) > 0 )
+        {
+            if( currentBody->getGravityFieldModel( ) == nullptr )
+            {
+                throw std::runtime_error( "Error when creating mutual point-mass gravity accelerations, body " + involvedBodies.at( i ) +
+                                          " exerts an acceleration, but has no gravity field model" );
+            }
+            gravitationalParameterFunctions.push_back( std::bind( &Body::getGravitationalParameter, currentBody ) );
+        }
+        else
+        {
+            gravitationalParameterFunctions.push_back( nullptr );
+        }
+        positionFunctions.push_back( std::bind( &Body::getPosition, currentBody ) );
+    }
+
+    std::shared_ptr< gravitation::MutualPointMassGravity > mutualGravity = std::make_shared< gravitation::MutualPointMassGravity >(
+            acceleratedBodies, externalBodies, gravitationalParameterFunctions, positionFunctions );
+
+    for( unsigned int i = 0; i < acceleratedBodies.size( ); i++ )
+    {
+        accelerationMap[ acceleratedBodies.at( i ) ][ "" ].push_back(
+                std::make_shared< gravitation::MutualPointMassGravityAcceleration >( mutualGravity, acceleratedBodies.at( i ) ) );
+    }
+}
+
 //! Function to put SelectedAccelerationMap in correct order, to ensure correct model creation
 SelectedAccelerationList orderSelectedAccelerationMap( const SelectedAccelerationMap& selectedAccelerationsPerBody )
 {
@@ -2084,6 +2175,7 @@ inline basic_astrodynamics::AccelerationMap createAccelerationModelsMap( const S
     // Declare return map.
     basic_astrodynamics::AccelerationMap accelerationModelMap;
     std::map< std::string, std::vector< std::string > > orderedEihBodies;
+    std::map< std::string, std::vector< std::string > > orderedMutualGravityBodies;
 
     // Put selectedAccelerationPerBody in correct order
     SelectedAccelerationList orderedAccelerationPerBody = orderSelectedAccelerationMap( selectedAccelerationPerBody );
@@ -2165,6 +2257,22 @@ inline basic_astrodynamics::AccelerationMap createAccelerationModelsMap( const S
 
                 orderedEihBodies[ bodyUndergoingAcceleration ].push_back( bodyExertingAcceleration );
             }
+            else if( accelerationsForBody.at( i ).second->accelerationType_ == basic_astrodynamics::mutual_point_mass_gravity )
+            {
+                if( orderedMutualGravityBodies.count( bodyUndergoingAcceleration ) > 0 )
+                {
+                    if( std::find( orderedMutualGravityBodies.at( bodyUndergoingAcceleration ).begin( ),
+                                   orderedMutualGravityBodies.at( bodyUndergoingAcceleration ).end( ),
+                                   bodyExertingAcceleration ) != orderedMutualGravityBodies.at( bodyUndergoingAcceleration ).end( ) )
+                    {
+                        throw std::runtime_error( "Error when parsing mutual point-mass gravity acceleration settings, found "
+                                                  "combination of bodies " + bodyUndergoingAcceleration + ", " +
+                                                  bodyExertingAcceleration + " multiple times." );
+                    }
+                }
+
+                orderedMutualGravityBodies[ bodyUndergoingAcceleration ].push_back( bodyExertingAcceleration );
+            }
             else
             {
                 currentAcceleration = createAccelerationModel( bodies.at( bodyUndergoingAcceleration ),
@@ -2205,6 +2313,11 @@ inline basic_astrodynamics::AccelerationMap createAccelerationModelsMap( const S
         addEihAccelerations( bodies, orderedEihBodies, centralBodies, accelerationModelMap );
     }
 
+    if( orderedMutualGravityBodies.size( ) > 0 )
+    {
+        addMutualPointMassGravityAccelerations( bodies, orderedMutualGravityBodies, centralBodies, accelerationModelMap );
+    }
+
     return accelerationModelMap;
 }
 
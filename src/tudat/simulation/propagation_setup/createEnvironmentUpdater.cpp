@@ -652,6 +652,22 @@ createTranslationalEquationsOfMotionEnvironmentUpdaterSettings( const basic_astr
                         }
                         break;
                     }
+                    case mutual_point_mass_gravity: {
+                        std::shared_ptr< gravitation::MutualPointMassGravityAcceleration > mutualGravityAcceleration =
+                                std::dynamic_pointer_cast< gravitation::MutualPointMassGravityAcceleration >(
+                                        accelerationModelIterator->second.at( i ) );
+                        if( mutualGravityAcceleration == nullptr )
+                        {
+                            throw std::runtime_error( "Error when getting environment updates for mutual point-mass gravity acceleration, "
+                                                      "acceleration object is incompatible" );
+                        }
+                        std::vector< std::string > bodiesInMutualGravity = mutualGravityAcceleration->getBodiesExertingAcceleration( );
+                        for( unsigned int j = 0; j < bodiesInMutualGravity.size( ); j++ )
+                        {
+                            singleAccelerationUpdateNeeds[ body_translational_state_update ].push_back( bodiesInMutualGravity.at( j ) );
+                        }
+                        break;
+                    }
                     default:
                         throw std::runtime_error(
                                 std::string( "Error when setting acceleration model update needs, model type not recognized: " ) +
@@ -0,0 +1,372 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/astro/basic_astro/modifiedEquinoctialElementConversions.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/ephemerides/frameManager.h"
+#include "tudat/astro/reference_frames/referenceFrameTransformations.h"
+#include "tudat/basics/utilities.h"
+#include "tudat/math/basic/coordinateConversions.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/rotationRepresentations.h"
+#include "tudat/simulation/propagation_setup/fusedDependentVariables.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to get the size of the full value of a dependent variable computed by a given kernel
+int getFusedDependentVariableKernelSize( const FusedDependentVariableKernel kernel )
+{
+    int kernelSize = 0;
+    switch( kernel )
+    {
+        case relative_distance_kernel:
+        case relative_speed_kernel:
+            kernelSize = 1;
+            break;
+        case relative_position_kernel:
+        case relative_velocity_kernel:
+        case euler_angles_to_body_fixed_313_kernel:
+        case body_fixed_relative_cartesian_position_kernel:
+        case body_fixed_relative_spherical_position_kernel:
+            kernelSize = 3;
+            break;
+        case keplerian_state_kernel:
+        case modified_equinoctial_state_kernel:
+            kernelSize = 6;
+            break;
+        case tnw_to_inertial_rotation_kernel:
+        case rsw_to_inertial_rotation_kernel:
+        case inertial_to_body_fixed_rotation_kernel:
+            kernelSize = 9;
+            break;
+    }
+    return kernelSize;
+}
+
+//! Function to write a rotation matrix in the vector representation used for dependent variables
+void setVectorRepresentationForRotationMatrix( const Eigen::Matrix3d& rotationMatrix,
+                                               Eigen::Matrix< double, 9, 1 >& vectorRepresentation )
+{
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            vectorRepresentation( i * 3 + j ) = rotationMatrix( i, j );
+        }
+    }
+}
+
+//! Function to add a dependent variable that is computed from the intermediates shared in this object, if possible.
+bool FusedDependentVariableEngine::addFusedDependentVariable(
+        const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
+        const simulation_setup::SystemOfBodies& bodies )
+{
+    const std::string& bodyWithProperty = dependentVariableSettings->associatedBody_;
+    const std::string& secondaryBody = dependentVariableSettings->secondaryBody_;
+
+    // Unsupported variables, and variables with invalid input, are handled by the regular dependent variable functions
+    if( bodies.count( bodyWithProperty ) == 0 )
+    {
+        return false;
+    }
+
+    FusedDependentVariable dependentVariable;
+    dependentVariable.relativeStateIndex = -1;
+    dependentVariable.rotationIndex = -1;
+    dependentVariable.componentIndex = dependentVariableSettings->componentIndex_;
+
+    switch( dependentVariableSettings->dependentVariableType_ )
+    {
+        case relative_position_dependent_variable:
+        case relative_velocity_dependent_variable:
+        case relative_distance_dependent_variable:
+        case relative_speed_dependent_variable: {
+            std::shared_ptr< simulation_setup::Body > centralBody;
+            if( secondaryBody != "SSB" )
+            {
+                if( bodies.count( secondaryBody ) == 0 )
+                {
+                    return false;
+                }
+                centralBody = bodies.at( secondaryBody );
+            }
+            else if( simulation_setup::getGlobalFrameOrigin( bodies ) != "SSB" )
+            {
+                return false;
+            }
+
+            switch( dependentVariableSettings->dependentVariableType_ )
+            {
+                case relative_position_dependent_variable:
+                    dependentVariable.kernel = relative_position_kernel;
+                    break;
+                case relative_velocity_dependent_variable:
+                    dependentVariable.kernel = relative_velocity_kernel;
+                    break;
+                case relative_distance_dependent_variable:
+                    dependentVariable.kernel = relative_distance_kernel;
+                    break;
+                default:
+                    dependentVariable.kernel = relative_speed_kernel;
+                    break;
+            }
+            dependentVariable.relativeStateIndex = getRelativeStateIntermediateIndex( bodies.at( bodyWithProperty ), centralBody );
+            break;
+        }
+        case keplerian_state_dependent_variable:
+        case modified_equinocial_state_dependent_variable: {
+            if( bodies.count( secondaryBody ) == 0 || bodies.at( secondaryBody )->getGravityFieldModel( ) == nullptr )
+            {
+                return false;
+            }
+
+            // Create gravitational parameter function in the same manner as for the regular dependent variable functions
+            std::function< double( ) > centralBodyGravitationalParameter = std::bind(
+                    &gravitation::GravityFieldModel::getGravitationalParameter, bodies.at( secondaryBody )->getGravityFieldModel( ) );
+            if( bodies.at( bodyWithProperty )->getGravityFieldModel( ) != nullptr )
+            {
+                std::function< double( ) > orbitingBodyGravitationalParameter =
+                        std::bind( &gravitation::GravityFieldModel::getGravitationalParameter,
+                                   bodies.at( bodyWithProperty )->getGravityFieldModel( ) );
+                dependentVariable.gravitationalParameterFunction = std::bind(
+                        &utilities::sumFunctionReturn< double >, orbitingBodyGravitationalParameter, centralBodyGravitationalParameter );
+            }
+            else
+            {
+                dependentVariable.gravitationalParameterFunction = centralBodyGravitationalParameter;
+            }
+
+            dependentVariable.kernel = ( dependentVariableSettings->dependentVariableType_ == keplerian_state_dependent_variable )
+                    ? keplerian_state_kernel
+                    : modified_equinoctial_state_kernel;
+            dependentVariable.relativeStateIndex =
+                    getRelativeStateIntermediateIndex( bodies.at( bodyWithProperty ), bodies.at( secondaryBody ) );
+            break;
+        }
+        case tnw_to_inertial_frame_rotation_dependent_variable:
+        case rsw_to_inertial_frame_rotation_dependent_variable: {
+            std::shared_ptr< simulation_setup::Body > centralBody;
+            if( !ephemerides::isFrameInertial( secondaryBody ) )
+            {
+                if( bodies.count( secondaryBody ) == 0 )
+                {
+                    return false;
+                }
+                centralBody = bodies.at( secondaryBody );
+            }
+
+            dependentVariable.kernel =
+                    ( dependentVariableSettings->dependentVariableType_ == tnw_to_inertial_frame_rotation_dependent_variable )
+                    ? tnw_to_inertial_rotation_kernel
+                    : rsw_to_inertial_rotation_kernel;
+            dependentVariable.relativeStateIndex = getRelativeStateIntermediateIndex( bodies.at( bodyWithProperty ), centralBody );
+            break;
+        }
+        case inertial_to_body_fixed_rotation_matrix_variable:
+        case euler_angles_to_body_fixed_313: {
+            dependentVariable.kernel =
+                    ( dependentVariableSettings->dependentVariableType_ == inertial_to_body_fixed_rotation_matrix_variable )
+                    ? inertial_to_body_fixed_rotation_kernel
+                    : euler_angles_to_body_fixed_313_kernel;
+            dependentVariable.rotationIndex = getRotationIntermediateIndex( bodies.at( bodyWithProperty ) );
+            break;
+        }
+        case body_fixed_relative_cartesian_position:
+        case body_fixed_relative_spherical_position: {
+            if( bodies.count( secondaryBody ) == 0 )
+            {
+                return false;
+            }
+
+            dependentVariable.kernel = ( dependentVariableSettings->dependentVariableType_ == body_fixed_relative_cartesian_position )
+                    ? body_fixed_relative_cartesian_position_kernel
+                    : body_fixed_relative_spherical_position_kernel;
+            dependentVariable.relativeStateIndex =
+                    getRelativeStateIntermediateIndex( bodies.at( bodyWithProperty ), bodies.at( secondaryBody ) );
+            dependentVariable.rotationIndex = getRotationIntermediateIndex( bodies.at( secondaryBody ) );
+            break;
+        }
+        default:
+            return false;
+    }
+
+    // Check if requested component exists (invalid input is handled by regular dependent variable functions)
+    const int kernelSize = getFusedDependentVariableKernelSize( dependentVariable.kernel );
+    if( dependentVariable.componentIndex >= kernelSize )
+    {
+        return false;
+    }
+
+    dependentVariable.outputIndex = totalSize_;
+    fusedDependentVariables_.push_back( dependentVariable );
+    totalSize_ += ( dependentVariable.componentIndex >= 0 ) ? 1 : kernelSize;
+    return true;
+}
+
+//! Function to add a dependent variable that is computed from its own function
+void FusedDependentVariableEngine::addDependentVariableFunction( const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+                                                                 const int dependentVariableSize )
+{
+    dependentVariableFunctions_.push_back(
+            std::make_pair( dependentVariableFunction, std::make_pair( totalSize_, dependentVariableSize ) ) );
+    totalSize_ += dependentVariableSize;
+}
+
+//! Function to evaluate all dependent variables, and write them into an existing vector (or matrix row)
+void FusedDependentVariableEngine::evaluateDependentVariables(
+        Eigen::Ref< Eigen::VectorXd, 0, Eigen::InnerStride< > > dependentVariables )
+{
+    if( dependentVariables.rows( ) != totalSize_ )
+    {
+        throw std::runtime_error( "Error when evaluating fused dependent variables, output size is " +
+                                  std::to_string( dependentVariables.rows( ) ) + ", but expected " + std::to_string( totalSize_ ) );
+    }
+
+    // Compute shared intermediates once
+    for( unsigned int i = 0; i < relativeStateBodies_.size( ); i++ )
+    {
+        if( relativeStateBodies_[ i ].second == nullptr )
+        {
+            currentRelativeStates_[ i ] = relativeStateBodies_[ i ].first->getState( );
+        }
+        else
+        {
+            currentRelativeStates_[ i ] = relativeStateBodies_[ i ].first->getState( ) - relativeStateBodies_[ i ].second->getState( );
+        }
+    }
+
+    for( unsigned int i = 0; i < rotationBodies_.size( ); i++ )
+    {
+        currentRotations_[ i ] = rotationBodies_[ i ]->getCurrentRotationToLocalFrame( );
+    }
+
+    // Compute dependent variables from intermediates, and write directly to output
+    Eigen::Matrix< double, 9, 1 > dependentVariableValue;
+    for( const FusedDependentVariable& dependentVariable: fusedDependentVariables_ )
+    {
+        const int dependentVariableSize = computeFusedDependentVariable( dependentVariable, dependentVariableValue );
+        if( dependentVariable.componentIndex >= 0 )
+        {
+            dependentVariables( dependentVariable.outputIndex ) = dependentVariableValue( dependentVariable.componentIndex );
+        }
+        else
+        {
+            dependentVariables.segment( dependentVariable.outputIndex, dependentVariableSize ) =
+                    dependentVariableValue.segment( 0, dependentVariableSize );
+        }
+    }
+
+    // Evaluate remaining dependent variables
+    for( const std::pair< std::function< Eigen::VectorXd( ) >, std::pair< int, int > >& dependentVariableFunction:
+         dependentVariableFunctions_ )
+    {
+        dependentVariables.segment( dependentVariableFunction.second.first, dependentVariableFunction.second.second ) =
+                dependentVariableFunction.first( );
+    }
+}
+
+//! Function to retrieve the index of a relative state intermediate, creating it if it does not yet exist
+int FusedDependentVariableEngine::getRelativeStateIntermediateIndex( const std::shared_ptr< simulation_setup::Body > body,
+                                                                     const std::shared_ptr< simulation_setup::Body > centralBody )
+{
+    for( unsigned int i = 0; i < relativeStateBodies_.size( ); i++ )
+    {
+        if( relativeStateBodies_[ i ].first == body && relativeStateBodies_[ i ].second == centralBody )
+        {
+            return static_cast< int >( i );
+        }
+    }
+    relativeStateBodies_.push_back( std::make_pair( body, centralBody ) );
+    currentRelativeStates_.push_back( Eigen::Vector6d::Constant( TUDAT_NAN ) );
+    return static_cast< int >( relativeStateBodies_.size( ) ) - 1;
+}
+
+//! Function to retrieve the index of a rotation intermediate, creating it if it does not yet exist
+int FusedDependentVariableEngine::getRotationIntermediateIndex( const std::shared_ptr< simulation_setup::Body > body )
+{
+    for( unsigned int i = 0; i < rotationBodies_.size( ); i++ )
+    {
+        if( rotationBodies_[ i ] == body )
+        {
+            return static_cast< int >( i );
+        }
+    }
+    rotationBodies_.push_back( body );
+    currentRotations_.push_back( Eigen::Quaterniond::Identity( ) );
+    return static_cast< int >( rotationBodies_.size( ) ) - 1;
+}
+
+//! Function to compute a single dependent variable from the current intermediates
+int FusedDependentVariableEngine::computeFusedDependentVariable( const FusedDependentVariable& dependentVariable,
+                                                                 Eigen::Matrix< double, 9, 1 >& dependentVariableValue )
+{
+    switch( dependentVariable.kernel )
+    {
+        case relative_position_kernel:
+            dependentVariableValue.segment( 0, 3 ) = currentRelativeStates_[ dependentVariable.relativeStateIndex ].segment( 0, 3 );
+            break;
+        case relative_velocity_kernel:
+            dependentVariableValue.segment( 0, 3 ) = currentRelativeStates_[ dependentVariable.relativeStateIndex ].segment( 3, 3 );
+            break;
+        case relative_distance_kernel:
+            dependentVariableValue( 0 ) = currentRelativeStates_[ dependentVariable.relativeStateIndex ].segment( 0, 3 ).norm( );
+            break;
+        case relative_speed_kernel:
+            dependentVariableValue( 0 ) = currentRelativeStates_[ dependentVariable.relativeStateIndex ].segment( 3, 3 ).norm( );
+            break;
+        case keplerian_state_kernel:
+            dependentVariableValue.segment( 0, 6 ) = orbital_element_conversions::convertCartesianToKeplerianElements(
+                    currentRelativeStates_[ dependentVariable.relativeStateIndex ], dependentVariable.gravitationalParameterFunction( ) );
+            break;
+        case modified_equinoctial_state_kernel:
+            dependentVariableValue.segment( 0, 6 ) = orbital_element_conversions::convertCartesianToModifiedEquinoctialElements(
+                    currentRelativeStates_[ dependentVariable.relativeStateIndex ], dependentVariable.gravitationalParameterFunction( ) );
+            break;
+        case tnw_to_inertial_rotation_kernel:
+            setVectorRepresentationForRotationMatrix(
+                    reference_frames::getTnwToInertialRotation( currentRelativeStates_[ dependentVariable.relativeStateIndex ], true ),
+                    dependentVariableValue );
+            break;
+        case rsw_to_inertial_rotation_kernel:
+            setVectorRepresentationForRotationMatrix( reference_frames::getRswSatelliteCenteredToInertialFrameRotationMatrix(
+                                                              currentRelativeStates_[ dependentVariable.relativeStateIndex ] ),
+                                                      dependentVariableValue );
+            break;
+        case inertial_to_body_fixed_rotation_kernel:
+            setVectorRepresentationForRotationMatrix( currentRotations_[ dependentVariable.rotationIndex ].toRotationMatrix( ),
+                                                      dependentVariableValue );
+            break;
+        case euler_angles_to_body_fixed_313_kernel:
+            dependentVariableValue.segment( 0, 3 ) =
+                    basic_mathematics::get313EulerAnglesFromQuaternion( currentRotations_[ dependentVariable.rotationIndex ] );
+            break;
+        case body_fixed_relative_cartesian_position_kernel:
+            dependentVariableValue.segment( 0, 3 ) = currentRotations_[ dependentVariable.rotationIndex ] *
+                    Eigen::Vector3d( currentRelativeStates_[ dependentVariable.relativeStateIndex ].segment( 0, 3 ) );
+            break;
+        case body_fixed_relative_spherical_position_kernel: {
+            const Eigen::Vector3d bodyFixedPosition = currentRotations_[ dependentVariable.rotationIndex ] *
+                    Eigen::Vector3d( currentRelativeStates_[ dependentVariable.relativeStateIndex ].segment( 0, 3 ) );
+            Eigen::Vector3d sphericalPosition = coordinate_conversions::convertCartesianToSpherical( bodyFixedPosition );
+            sphericalPosition( 1 ) = mathematical_constants::PI / 2.0 - sphericalPosition( 1 );
+            dependentVariableValue.segment( 0, 3 ) = sphericalPosition;
+            break;
+        }
+    }
+    return getFusedDependentVariableKernelSize( dependentVariable.kernel );
+}
+
+}  // namespace propagators
+
+}  // namespace tudat
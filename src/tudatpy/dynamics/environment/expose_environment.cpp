@@ -739,7 +739,8 @@ inside a `Body` instance and used in observation corrections or environmental qu
                             const double,
                             const double,
                             const Eigen::Vector3d&,
-                            const bool >( ),
+                            const bool,
+                            const int >( ),
                   py::arg( "independent_variable_points" ),
                   py::arg( "body_shape" ),
                   py::arg( "number_of_lines" ),
@@ -750,6 +751,7 @@ inside a `Body` instance and used in observation corrections or environmental qu
                   py::arg( "reference_length" ),
                   py::arg( "moment_reference_point" ),
                   py::arg( "save_pressure_coefficients" ) = false,
+                  py::arg( "number_of_threads" ) = 1,
                   R"doc(
 
          Class constructor, taking the shape of the vehicle, and various analysis options as input.
@@ -813,6 +815,10 @@ inside a `Body` instance and used in observation corrections or environmental qu
          save_pressure_coefficients : bool
              Boolean denoting whether to save the pressure coefficients that are computed to files
 
+         number_of_threads : int, default = 1
+             Number of threads over which the (independent) combinations of angle of attack and sideslip are
+             distributed when generating the aerodynamic coefficients
+
 
 
 
@@ -2658,6 +2664,17 @@ inside a `Body` instance and used in observation corrections or environmental qu
          :type: dict[str,GroundStation]
       )doc" );
 
+    py::class_< tss::EphemerisCacheStatistics >( m, "EphemerisCacheStatistics", R"doc(
+
+         Number of hits and misses of the epoch caches of states and rotations retrieved from body ephemerides,
+         as retrieved by :py:meth:`~SystemOfBodies.ephemeris_cache_statistics`.
+
+      )doc" )
+            .def_readonly( "state_hits", &tss::EphemerisCacheStatistics::stateHits )
+            .def_readonly( "state_misses", &tss::EphemerisCacheStatistics::stateMisses )
+            .def_readonly( "rotation_hits", &tss::EphemerisCacheStatistics::rotationHits )
+            .def_readonly( "rotation_misses", &tss::EphemerisCacheStatistics::rotationMisses );
+
     py::class_< tss::SystemOfBodies, std::shared_ptr< tss::SystemOfBodies > >( m, "SystemOfBodies", R"doc(
 
          Object that contains a set of Body objects and associated frame
@@ -2799,6 +2816,55 @@ inside a `Body` instance and used in observation corrections or environmental qu
                   R"doc(
 
          List of names of bodies that are stored in this SystemOfBodies
+     )doc" )
+            .def( "set_ephemeris_cache_size",
+                  &tss::SystemOfBodies::setEphemerisCacheSize,
+                  py::arg( "cache_size" ),
+                  R"doc(
+
+         Function to set the size of the epoch caches of the states and rotations of all bodies.
+
+         When the size is larger than 0, the states and rotations that each body computes from its (rotational) ephemeris
+         are stored for the most recent ``cache_size`` epochs, and are reused when they are requested again at exactly the
+         same epoch (for instance in iterated light-time computations of observation models). The caches are cleared
+         when an ephemeris is reset through the body, or when an integrated ephemeris is reset. If an ephemeris is
+         modified in any other way, the caches must be cleared manually using :py:meth:`~clear_ephemeris_caches`.
+         Rotations are only cached for rotation models that depend only on time (simple, constant, SPICE, GCRS-ITRS,
+         planetary, IAU and tabulated models), and not for models that depend on the state of the environment, such as
+         aerodynamic angle-based, direction-based and synchronous rotation models.
+
+
+         Parameters
+         ----------
+         cache_size : int
+             Number of epochs that are stored in the cache of each body (0 to deactivate the caches, which is the default)
+
+     )doc" )
+            .def( "clear_ephemeris_caches",
+                  &tss::SystemOfBodies::clearEphemerisCaches,
+                  R"doc(
+
+         Function to clear the epoch caches of the states and rotations of all bodies.
+
+     )doc" )
+            .def( "ephemeris_cache_statistics",
+                  &tss::SystemOfBodies::getEphemerisCacheStatistics,
+                  R"doc(
+
+         Function to retrieve the total number of hits and misses of the epoch caches of all bodies.
+
+         Returns
+         -------
+         EphemerisCacheStatistics
+             Total number of hits and misses of the epoch caches
+
+     )doc" )
+            .def( "reset_ephemeris_cache_statistics",
+                  &tss::SystemOfBodies::resetEphemerisCacheStatistics,
+                  R"doc(
+
+         Function to reset the number of hits and misses of the epoch caches of all bodies to zero.
+
      )doc" )
             //            .def("get_body_dict",
             //            &tss::SystemOfBodies::getMap,
@@ -85,7 +85,8 @@ void expose_ephemeris_setup( py::module& m )
             .value( "custom_ephemeris", tss::EphemerisType::custom_ephemeris )
             .value( "direct_tle_ephemeris", tss::EphemerisType::direct_tle_ephemeris )
             .value( "interpolated_tle_ephemeris", tss::EphemerisType::interpolated_tle_ephemeris )
-            .value( "scaled_ephemeris", tss::EphemerisType::scaled_ephemeris );
+            .value( "scaled_ephemeris", tss::EphemerisType::scaled_ephemeris )
+            .value( "chebyshev_ephemeris", tss::EphemerisType::chebyshev_ephemeris );
 
     /////////////////////////////////////////////////////////////////////////////
     // createEphemeris.h (complete, unverified)
@@ -852,6 +853,110 @@ void expose_ephemeris_setup( py::module& m )
      time_step )
 
 
+     )doc" );
+
+    py::class_< tss::ChebyshevEphemerisSettings, std::shared_ptr< tss::ChebyshevEphemerisSettings >, tss::EphemerisSettings >(
+            m,
+            "ChebyshevEphemerisSettings",
+            R"doc(
+
+         Class for defining settings of an ephemeris defined by piecewise Chebyshev polynomials.
+
+         `EphemerisSettings` derived class for an ephemeris defined by piecewise Chebyshev polynomials of the position, either fitted
+         to an existing ephemeris, or read from a binary coefficient file.
+
+      )doc" )
+            .def_property_readonly( "polynomial_degree",
+                                    &tss::ChebyshevEphemerisSettings::getPolynomialDegree,
+                                    R"doc(
+
+         **read-only**
+
+         Degree of the Chebyshev polynomials (-1 if coefficients are read from file).
+
+         :type: int
+      )doc" )
+            .def_property_readonly( "position_tolerance",
+                                    &tss::ChebyshevEphemerisSettings::getPositionTolerance,
+                                    R"doc(
+
+         **read-only**
+
+         Maximum position error of the fit, from which the segment length is determined.
+
+         :type: float
+      )doc" );
+
+    m.def( "chebyshev_from_existing",
+           &tss::chebyshevEphemerisSettings,
+           py::arg( "ephemeris_settings" ),
+           py::arg( "start_time" ),
+           py::arg( "end_time" ),
+           py::arg( "polynomial_degree" ),
+           py::arg( "position_tolerance" ),
+           py::arg( "maximum_segment_length" ) = TUDAT_NAN,
+           py::arg( "output_file_name" ) = "",
+           R"doc(
+
+ Function for creating Chebyshev ephemeris model settings from existing ephemeris.
+
+ Function for creating settings of an ephemeris defined by piecewise Chebyshev polynomials of the position, fitted to an
+ existing ephemeris (e.g. SPICE, or a propagated trajectory). The interval is divided into segments of equal length, which are
+ halved until the position error of the fit is below the tolerance. The state is evaluated without searching for the
+ segment, and the velocity is obtained from the derivative of the polynomials. Compared to a tabulated ephemeris
+ (e.g. :func:`~tudatpy.dynamics.environment_setup.ephemeris.interpolated_spice`), this typically requires much less memory.
+
+
+ Parameters
+ ----------
+ ephemeris_settings : tudatpy.dynamics.environment_setup.ephemeris.EphemerisSettings
+     Existing ephemeris settings to which the polynomials are to be fitted.
+ start_time : float
+     Start time of the ephemeris.
+ end_time : float
+     End time of the ephemeris.
+ polynomial_degree : int
+     Degree of the Chebyshev polynomials.
+ position_tolerance : float
+     Maximum position error of the fit.
+ maximum_segment_length : float, default=NaN
+     Maximum length of a segment (no maximum if NaN).
+ output_file_name : str, default=""
+     Name of the binary file to which the coefficients are written after creation (not written if empty).
+ Returns
+ -------
+ ChebyshevEphemerisSettings
+     Instance of the :class:`~tudatpy.dynamics.environment_setup.ephemeris.EphemerisSettings` derived :class:`~tudatpy.dynamics.environment_setup.ephemeris.ChebyshevEphemerisSettings` class
+
+     )doc" );
+
+    m.def( "chebyshev_from_file",
+           &tss::chebyshevEphemerisFromFileSettings,
+           py::arg( "file_name" ),
+           py::arg( "frame_origin" ) = "SSB",
+           py::arg( "frame_orientation" ) = "ECLIPJ2000",
+           R"doc(
+
+ Function for creating Chebyshev ephemeris model settings from a binary coefficient file.
+
+ Function for creating settings of an ephemeris defined by piecewise Chebyshev polynomials, read from a binary coefficient
+ file (as written using the ``output_file_name`` input of
+ :func:`~tudatpy.dynamics.environment_setup.ephemeris.chebyshev_from_existing`).
+
+
+ Parameters
+ ----------
+ file_name : str
+     Name of the binary coefficient file.
+ frame_origin : str, default="SSB"
+     Origin of frame in which ephemeris data is defined (must be consistent with file).
+ frame_orientation : str, default="ECLIPJ2000"
+     Orientation of frame in which ephemeris data is defined (must be consistent with file).
+ Returns
+ -------
+ ChebyshevEphemerisSettings
+     Instance of the :class:`~tudatpy.dynamics.environment_setup.ephemeris.EphemerisSettings` derived :class:`~tudatpy.dynamics.environment_setup.ephemeris.ChebyshevEphemerisSettings` class
+
      )doc" );
 
     m.def( "sgp4",
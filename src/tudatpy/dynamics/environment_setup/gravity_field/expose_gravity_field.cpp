@@ -416,6 +416,37 @@ Coefficients for the SHGJ180U Moon gravity field up to degree and order 180, (se
 
 
          :type: numpy.ndarray
+      )doc" )
+            .def_property( "number_of_threads",
+                           &tss::PolyhedronGravityFieldSettings::getNumberOfThreads,
+                           &tss::PolyhedronGravityFieldSettings::setNumberOfThreads,
+                           R"doc(
+
+         Number of threads over which the facets and edges are distributed when evaluating the polyhedron gravity field.
+         Using more than one thread is only beneficial for polyhedra with a large number of facets.
+
+         :type: int
+      )doc" )
+            .def( "set_far_field_spherical_harmonic_expansion",
+                  &tss::PolyhedronGravityFieldSettings::setFarFieldSphericalHarmonicExpansion,
+                  py::arg( "maximum_degree" ),
+                  py::arg( "brillouin_sphere_margin_factor" ) = 2.0,
+                  R"doc(
+
+         Function to use a spherical harmonic expansion of the polyhedron far from the body.
+
+         Function to derive an exterior spherical harmonic expansion (with the radius of the Brillouin sphere as reference
+         radius) from the polyhedron, which is used instead of the polyhedron to compute the potential and acceleration at
+         distances larger than the radius of the Brillouin sphere times the margin factor. The Hessian and Laplacian of the
+         potential are always computed from the polyhedron.
+
+
+         Parameters
+         ----------
+         maximum_degree : int
+             Maximum degree (and order) of the spherical harmonic expansion.
+         brillouin_sphere_margin_factor : float, default = 2.0
+             Ratio of the switch radius and the radius of the Brillouin sphere (must be at least 1).
       )doc" );
 
     m.def( "central",
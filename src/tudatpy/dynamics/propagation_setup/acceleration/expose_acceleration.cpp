@@ -210,6 +210,10 @@ void expose_acceleration_setup( py::module &m )
         .value( "yarkovsky_acceleration_type",
                 tba::AvailableAcceleration::yarkovsky_acceleration,
                 R"doc(
+      )doc" )
+        .value( "mutual_point_mass_gravity_type",
+                tba::AvailableAcceleration::mutual_point_mass_gravity,
+                R"doc(
       )doc" )
             .export_values( );
 
@@ -502,6 +506,44 @@ AccelerationSettings
 
      )doc" );
 
+    m.def( "mutual_point_mass_gravity",
+           &tss::mutualPointMassGravityAcceleration,
+           R"doc(
+
+Creates settings for the point-mass gravity acceleration, evaluated concurrently for a group of bodies.
+
+Creates settings for the point-mass gravity acceleration, with the same formulation as :func:`point_mass_gravity`,
+but evaluated concurrently for all bodies that undergo a mutual point-mass gravity acceleration. All pairwise
+interactions are computed in a single vectorized evaluation, in which the interaction between two propagated bodies
+is computed once and applied to both bodies. This makes the model suitable for the propagation of large numbers of
+mutually attracting bodies (e.g. asteroids, debris or satellite systems).
+
+Each body undergoing this acceleration must be attracted by *all* bodies that exert this acceleration on any body in
+the group (other than itself). Propagated bodies that do not exert the acceleration on any other body (e.g. debris
+objects) are not required to have a gravity field, and their mutual interactions are not evaluated. The central body
+of all accelerated bodies must be inertial (e.g. "SSB"). Acceleration partials are not available for this model.
+
+Returns
+-------
+AccelerationSettings
+    Acceleration settings object.
+
+Examples
+--------
+In this example, we define the mutual point mass gravity between a list of asteroids, and from the Sun and Jupiter on each
+asteroid:
+
+.. code-block:: python
+
+    for asteroid in asteroid_names:
+        accelerations_acting_on_asteroid = dict()
+        for exerting_body in asteroid_names + ["Sun", "Jupiter"]:
+            if exerting_body != asteroid:
+                accelerations_acting_on_asteroid[exerting_body] = [propagation_setup.acceleration.mutual_point_mass_gravity()]
+        acceleration_settings[asteroid] = accelerations_acting_on_asteroid
+
+     )doc" );
+
     m.def( "aerodynamic",
            &tss::aerodynamicAcceleration,
            R"doc(
@@ -1152,6 +1152,7 @@ Sequence for which :math:`n_{j}=2(j+1)` (2, 4, 6, 8, 10, 12, 14, ....)
            py::arg( "step_size_control_settings" ),
            py::arg( "step_size_validation_settings" ),
            py::arg( "assess_termination_on_minor_steps" ) = false,
+           py::arg( "use_adaptive_order" ) = false,
            R"doc(
 
  Creates the settings for the variable time-step Bulirsch-Stoer integrator.
@@ -1189,6 +1190,9 @@ Sequence for which :math:`n_{j}=2(j+1)` (2, 4, 6, 8, 10, 12, 14, ....)
 
  assess_termination_on_minor_steps : bool, default=false
      Whether the propagation termination conditions should be evaluated during the intermediate sub-steps of the integrator (true) or only at the end of each integration step (false).
+ use_adaptive_order : bool, default=false
+     Whether the number of iterations used for a single step is adapted during the propagation (true), in addition to the time step,
+     with ``maximum_number_of_steps`` as upper limit (requires at least 3). If false, all ``maximum_number_of_steps`` iterations are used for each step.
  Returns
  -------
  IntegratorSettings
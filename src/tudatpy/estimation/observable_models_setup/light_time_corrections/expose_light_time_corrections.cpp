@@ -12,6 +12,8 @@
 #include <pybind11/functional.h>
 #include "scalarTypes.h"
 #include "tudat/simulation/estimation_setup/createObservationModel.h"
+#include "tudat/io/readIonexFile.h"
+#include "tudat/io/readViennaMappingFunctionData.h"
 // #include <pybind11/native_enum.h>
 
 namespace tom = tudat::observation_models;
@@ -426,6 +428,33 @@ Examples
            py::arg( "data_files" ),
            py::arg( "bodies" ),
            py::arg( "interpolator_settings" ) = std::shared_ptr< ti::InterpolatorSettings >( ) );
+
+    m.def( "convert_vmf_files_to_grid_files",
+           &tudat::input_output::convertVMFFilesToTimeIndexedGridFiles,
+           py::arg( "data_files" ),
+           py::arg( "file_has_meteo" ),
+           py::arg( "file_has_gradient" ),
+           py::arg( "output_file_prefix" ) );
+
+    m.def( "set_vmf_troposphere_data_from_grid_files",
+           &tom::setVmfTroposphereCorrectionsFromTimeIndexedGridFiles,
+           py::arg( "grid_files" ),
+           py::arg( "bodies" ),
+           py::arg( "set_troposphere_data" ) = true,
+           py::arg( "set_meteo_data" ) = true,
+           py::arg( "interpolator_settings" ) = ti::cubicSplineInterpolation( ),
+           py::arg( "start_time" ) = TUDAT_NAN,
+           py::arg( "end_time" ) = TUDAT_NAN );
+
+    m.def( "convert_ionex_files_to_grid_file",
+           &tudat::input_output::convertIonexFilesToTimeIndexedGridFile,
+           py::arg( "data_files" ),
+           py::arg( "grid_file" ) );
+
+    m.def( "set_ionosphere_model_from_grid_file",
+           &tom::setIonosphereModelFromTimeIndexedGridFile,
+           py::arg( "grid_file" ),
+           py::arg( "bodies" ) );
 }
 
 }  // namespace light_time_corrections
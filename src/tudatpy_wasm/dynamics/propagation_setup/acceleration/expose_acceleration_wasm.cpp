@@ -49,7 +49,8 @@ EMSCRIPTEN_BINDINGS(tudatpy_dynamics_propagation_setup_acceleration) {
         .value("custom_acceleration_type", tba::custom_acceleration)
         .value("radiation_pressure_type", tba::radiation_pressure)
         .value("einstein_infeld_hoffmann_acceleration_type", tba::einstein_infeld_hoffmann_acceleration)
-        .value("yarkovsky_acceleration_type", tba::yarkovsky_acceleration);
+        .value("yarkovsky_acceleration_type", tba::yarkovsky_acceleration)
+        .value("mutual_point_mass_gravity_type", tba::mutual_point_mass_gravity);
 
     // ========================================================================
     // AccelerationSettings base class and derived classes
@@ -166,6 +167,10 @@ EMSCRIPTEN_BINDINGS(tudatpy_dynamics_propagation_setup_acceleration) {
     function("dynamics_propagation_setup_acceleration_einstein_infeld_hofmann",
         &tss::einsteinInfledHoffmannGravityAcceleration);
 
+    // Mutual point mass gravity (evaluated for a group of bodies at once)
+    function("dynamics_propagation_setup_acceleration_mutual_point_mass_gravity",
+        &tss::mutualPointMassGravityAcceleration);
+
     // Aerodynamic
     function("dynamics_propagation_setup_acceleration_aerodynamic",
         &tss::aerodynamicAcceleration);
@@ -0,0 +1,174 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_ACCELERATION_PIPELINE_TEST_MODELS_H
+#define TUDAT_ACCELERATION_PIPELINE_TEST_MODELS_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/basic_astro/accelerationModel.h"
+#include "tudat/astro/basic_astro/customAccelerationModel.h"
+#include "tudat/astro/gravitation/centralGravityModel.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityModel.h"
+#include "tudat/astro/gravitation/thirdBodyPerturbation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::gravitation;
+
+//! Function to create a function returning a constant position (in the form used by the gravitational acceleration models)
+inline std::function< void( Eigen::Vector3d& ) > getConstantPositionFunction( const Eigen::Vector3d position )
+{
+    return [ = ]( Eigen::Vector3d& output ) { output = position; };
+}
+
+//! Function to create a typical model set for a vehicle in LEO: Earth spherical harmonics, Sun/Moon third-body and an empirical
+//! acceleration. The spherical harmonic coefficients are returned by reference, as the acceleration model does not copy them.
+inline AccelerationMap getLeoAccelerationModelSet( std::vector< std::string >& propagatedBodies,
+                                            Eigen::VectorXd& propagatedStates,
+                                            Eigen::MatrixXd& cosineCoefficients,
+                                            Eigen::MatrixXd& sineCoefficients )
+{
+    propagatedBodies = { "Vehicle" };
+    propagatedStates = Eigen::VectorXd( 6 );
+    propagatedStates << 6.8E6, 1.0E5, -2.0E5, 10.0, 7.5E3, 1.0E2;
+
+    const int maximumDegree = 20;
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-6 * std::cos( static_cast< double >( degree * order + 1 ) ) / degree;
+            sineCoefficients( degree, order ) =
+                    ( order == 0 ) ? 0.0 : 1.0E-6 * std::sin( static_cast< double >( degree + order ) ) / degree;
+        }
+    }
+    cosineCoefficients( 2, 0 ) = -4.84E-4;
+
+    std::function< void( Eigen::Vector3d& ) > vehiclePositionFunction = getConstantPositionFunction( propagatedStates.segment( 0, 3 ) );
+    std::function< void( Eigen::Vector3d& ) > earthPositionFunction = getConstantPositionFunction( Eigen::Vector3d::Zero( ) );
+
+    AccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+            vehiclePositionFunction, 3.986004418E14, 6378137.0, cosineCoefficients, sineCoefficients, earthPositionFunction ) );
+
+    std::vector< std::string > perturbingBodies = { "Sun", "Moon" };
+    std::vector< double > perturbingGravitationalParameters = { 1.32712440018E20, 4.9048695E12 };
+    std::vector< Eigen::Vector3d > perturbingPositions = { Eigen::Vector3d( 1.4E11, -5.0E10, 2.0E7 ),
+                                                           Eigen::Vector3d( 3.0E8, 2.2E8, 3.0E7 ) };
+    for( unsigned int i = 0; i < perturbingBodies.size( ); i++ )
+    {
+        std::function< void( Eigen::Vector3d& ) > perturbingBodyPositionFunction =
+                getConstantPositionFunction( perturbingPositions.at( i ) );
+        accelerationMap[ "Vehicle" ][ perturbingBodies.at( i ) ].push_back( std::make_shared< ThirdBodyCentralGravityAcceleration >(
+                std::make_shared< CentralGravitationalAccelerationModel3d >(
+                        vehiclePositionFunction, perturbingGravitationalParameters.at( i ), perturbingBodyPositionFunction ),
+                std::make_shared< CentralGravitationalAccelerationModel3d >(
+                        earthPositionFunction, perturbingGravitationalParameters.at( i ), perturbingBodyPositionFunction ),
+                "Earth" ) );
+    }
+
+    accelerationMap[ "Vehicle" ][ "Vehicle" ].push_back( std::make_shared< CustomAccelerationModel >(
+            []( const double time ) { return Eigen::Vector3d( 1.0E-7 * std::sin( 1.0E-3 * time ), 2.0E-8, -1.0E-8 ); } ) );
+    return accelerationMap;
+}
+
+//! Function to create a typical model set for interplanetary propagation: a number of small bodies, each accelerated by the
+//! point-mass gravity of the Sun and planets, and an empirical acceleration
+inline AccelerationMap getInterplanetaryAccelerationModelSet( std::vector< std::string >& propagatedBodies,
+                                                       Eigen::VectorXd& propagatedStates )
+{
+    std::vector< std::string > perturbingBodies = { "Sun",     "Mercury", "Venus",  "Earth",  "Mars",
+                                                    "Jupiter", "Saturn",  "Uranus", "Neptune" };
+    std::vector< double > perturbingGravitationalParameters = { 1.32712440018E20, 2.2032E13, 3.24859E14, 4.0350323E14, 4.282837E13,
+                                                                1.26686534E17,    3.7931187E16, 5.793939E15, 6.836529E15 };
+    std::vector< double > perturbingDistances = { 0.0, 5.8E10, 1.08E11, 1.5E11, 2.28E11, 7.78E11, 1.43E12, 2.87E12, 4.5E12 };
+
+    propagatedBodies = { "Asteroid1", "Asteroid2", "Asteroid3", "Asteroid4" };
+    propagatedStates = Eigen::VectorXd( 6 * propagatedBodies.size( ) );
+
+    AccelerationMap accelerationMap;
+    for( unsigned int i = 0; i < propagatedBodies.size( ); i++ )
+    {
+        propagatedStates.segment( 6 * i, 6 ) << 4.0E11 * std::cos( 1.3 * i ), 4.0E11 * std::sin( 1.3 * i ), 1.0E9 * i,
+                -1.8E4 * std::sin( 1.3 * i ), 1.8E4 * std::cos( 1.3 * i ), 10.0 * i;
+        std::function< void( Eigen::Vector3d& ) > bodyPositionFunction =
+                getConstantPositionFunction( propagatedStates.segment( 6 * i, 3 ) );
+
+        for( unsigned int j = 0; j < perturbingBodies.size( ); j++ )
+        {
+            Eigen::Vector3d perturbingBodyPosition =
+                    perturbingDistances.at( j ) * Eigen::Vector3d( std::cos( 0.7 * j ), std::sin( 0.7 * j ), 0.01 * j );
+            accelerationMap[ propagatedBodies.at( i ) ][ perturbingBodies.at( j ) ].push_back(
+                    std::make_shared< CentralGravitationalAccelerationModel3d >( bodyPositionFunction,
+                                                                                 perturbingGravitationalParameters.at( j ),
+                                                                                 getConstantPositionFunction( perturbingBodyPosition ) ) );
+        }
+
+        accelerationMap[ propagatedBodies.at( i ) ][ propagatedBodies.at( i ) ].push_back( std::make_shared< CustomAccelerationModel >(
+                [ = ]( const double time ) { return Eigen::Vector3d( 1.0E-10 * i, 2.0E-11 * std::cos( 1.0E-6 * time ), 0.0 ); } ) );
+    }
+    return accelerationMap;
+}
+
+//! Function to update all acceleration models by traversing the nested acceleration map
+inline void updateAccelerationMapModels( const AccelerationMap& accelerationMap, const double time )
+{
+    for( const auto& outerIterator: accelerationMap )
+    {
+        for( const auto& innerIterator: outerIterator.second )
+        {
+            for( unsigned int i = 0; i < innerIterator.second.size( ); i++ )
+            {
+                innerIterator.second.at( i )->updateMembers( time );
+            }
+        }
+    }
+}
+
+//! Function to compute the Cartesian state derivative by traversing the nested acceleration map
+inline void sumAccelerationMapContributions( const AccelerationMap& accelerationMap,
+                                      const std::vector< std::string >& propagatedBodies,
+                                      const Eigen::VectorXd& propagatedStates,
+                                      Eigen::VectorXd& stateDerivative )
+{
+    stateDerivative.setZero( propagatedStates.rows( ) );
+    for( unsigned int i = 0; i < propagatedBodies.size( ); i++ )
+    {
+        for( const auto& innerIterator: accelerationMap.at( propagatedBodies.at( i ) ) )
+        {
+            for( unsigned int j = 0; j < innerIterator.second.size( ); j++ )
+            {
+                stateDerivative.segment( 6 * i + 3, 3 ) += innerIterator.second.at( j )->getAccelerationScalingFactor( ) *
+                        innerIterator.second.at( j )->getUnscaledAccelerationReference( );
+            }
+        }
+        stateDerivative.segment( 6 * i, 3 ) = propagatedStates.segment( 6 * i + 3, 3 );
+    }
+}
+
+}  // namespace unit_tests
+
+}  // namespace tudat
+
+#endif  // TUDAT_ACCELERATION_PIPELINE_TEST_MODELS_H
@@ -193,6 +193,31 @@ static inline Eigen::VectorXd computeSecondNonAutonomousModelStateDerivative( co
     return Eigen::VectorXd::Constant( 1, stateDerivative );
 }
 
+//! Compute analytical state of two-body orbit.
+/*!
+ * Computes the state on a two-body orbit with unit semi-major axis and gravitational parameter, starting at pericenter (at
+ * t = 0) in the xy-plane, by solving Kepler's equation with a Newton-Raphson iteration.
+ * \param time Time at which the state needs to be evaluated.
+ * \param eccentricity Eccentricity of the orbit.
+ * \return Cartesian state at the given time.
+ */
+static inline Eigen::VectorXd computeAnalyticalEccentricOrbitState( const double time, const double eccentricity )
+{
+    double eccentricAnomaly = time;
+    for( unsigned int i = 0; i < 50; i++ )
+    {
+        eccentricAnomaly -= ( eccentricAnomaly - eccentricity * std::sin( eccentricAnomaly ) - time ) /
+                ( 1.0 - eccentricity * std::cos( eccentricAnomaly ) );
+    }
+    const double radius = 1.0 - eccentricity * std::cos( eccentricAnomaly );
+    const double semiMinorAxis = std::sqrt( 1.0 - eccentricity * eccentricity );
+
+    Eigen::VectorXd state( 6 );
+    state << std::cos( eccentricAnomaly ) - eccentricity, semiMinorAxis * std::sin( eccentricAnomaly ), 0.0,
+            -std::sin( eccentricAnomaly ) / radius, semiMinorAxis * std::cos( eccentricAnomaly ) / radius, 0.0;
+    return state;
+}
+
 }  // namespace numerical_integrator_test_functions
 }  // namespace unit_tests
 }  // namespace tudat
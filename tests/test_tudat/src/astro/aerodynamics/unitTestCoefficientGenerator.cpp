@@ -214,7 +214,8 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGeneratorHypersonicLocalInclinat
     }
 }
 
-std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( const bool savePressureCoefficients = false,
+                                                                                      const int numberOfThreads = 1 )
 {
     // Create test capsule.
     std::shared_ptr< geometric_shapes::Capsule > capsule =
@@ -274,7 +275,9 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
                                                                    selectedMethods,
                                                                    PI * pow( capsule->getMiddleRadius( ), 2.0 ),
                                                                    3.9116,
-                                                                   momentReference );
+                                                                   momentReference,
+                                                                   savePressureCoefficients,
+                                                                   numberOfThreads );
 }
 
 //! Apollo capsule test case.
@@ -342,6 +345,42 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
     BOOST_CHECK_SMALL( aerodynamicCoefficients_( 5 ), toleranceAerodynamicCoefficients5 );
 }
 
+//! Test that multi-threaded coefficient generation reproduces single-threaded results.
+BOOST_AUTO_TEST_CASE( testMultiThreadedCoefficientGeneration )
+{
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > serialCoefficientInterface = getApolloCoefficientInterface( true, 1 );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > parallelCoefficientInterface = getApolloCoefficientInterface( true, 4 );
+
+    boost::array< int, 3 > independentVariables;
+    for( int i = 0; i < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 0 ); i++ )
+    {
+        independentVariables[ 0 ] = i;
+        for( int j = 0; j < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 1 ); j++ )
+        {
+            independentVariables[ 1 ] = j;
+            for( int k = 0; k < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 2 ); k++ )
+            {
+                independentVariables[ 2 ] = k;
+
+                // Each grid point is computed by identical operations, so results should be equal to machine precision
+                Vector6d serialCoefficients = serialCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Vector6d parallelCoefficients = parallelCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                for( int l = 0; l < 6; l++ )
+                {
+                    BOOST_CHECK_EQUAL( serialCoefficients( l ), parallelCoefficients( l ) );
+                }
+
+                std::vector< std::vector< std::vector< double > > > serialPressureCoefficients =
+                        serialCoefficientInterface->getPressureCoefficientList( independentVariables );
+                std::vector< std::vector< std::vector< double > > > parallelPressureCoefficients =
+                        parallelCoefficientInterface->getPressureCoefficientList( independentVariables );
+                BOOST_CHECK_EQUAL( serialPressureCoefficients.size( ), 4 );
+                BOOST_CHECK( serialPressureCoefficients == parallelPressureCoefficients );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -21,6 +21,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/basics/testMacros.h"
+#include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/electromagnetism/radiationPressureTargetModel.h"
 #include "tudat/astro/electromagnetism/radiationSourceModel.h"
 #include "tudat/math/basic/coordinateConversions.h"
@@ -244,6 +245,98 @@ BOOST_AUTO_TEST_CASE( testRadiationPressureTargetModel_EquivalentSphere )
     }
 }
 
+//! Check if batched panel kernel agrees with per-panel evaluation of reflection laws, for single and multiple sources
+BOOST_AUTO_TEST_CASE( testPaneledRadiationPressureTargetModel_BatchedKernel )
+{
+    const std::vector< Eigen::Vector3d > panelNormals = { Eigen::Vector3d( 1, 0, 1 ).normalized( ),
+                                                          Eigen::Vector3d( -1, 2, 1 ).normalized( ),
+                                                          Eigen::Vector3d( 0, 1, -3 ).normalized( ),
+                                                          Eigen::Vector3d( 3, -1, 1 ).normalized( ),
+                                                          Eigen::Vector3d( 0, 0, 1 ) };
+    const std::vector< double > panelAreas = { 1.0, 2.5, 0.3, 4.0, 1.7 };
+    const std::vector< Eigen::Vector3d > panelPositions = { Eigen::Vector3d( 1, 0, 0 ),
+                                                            Eigen::Vector3d( 0, 2, 0 ),
+                                                            Eigen::Vector3d( 0, 0, -1 ),
+                                                            Eigen::Vector3d( 1, -1, 1 ),
+                                                            Eigen::Vector3d( -2, 1, 0.5 ) };
+
+    const std::vector< double > sourceIrradiances = { 1000.0, 400.0, 250.0 };
+    const std::vector< Eigen::Vector3d > sourceToTargetDirections = { Eigen::Vector3d( 0, 0, -1 ),
+                                                                      Eigen::Vector3d( -1, -1, -2 ).normalized( ),
+                                                                      Eigen::Vector3d( 2, -1, -0.5 ).normalized( ) };
+    const Eigen::Vector3d centerOfMass = Eigen::Vector3d( 0.1, -0.2, 0.3 );
+
+    // Test without reradiation, with reradiation, and with mixed reradiation settings (per-panel fallback)
+    for( unsigned int test = 0; test < 3; test++ )
+    {
+        std::vector< std::shared_ptr< system_models::VehicleExteriorPanel > > allPanels;
+        for( unsigned int i = 0; i < panelNormals.size( ); i++ )
+        {
+            bool withReradiation = ( test == 1 ) || ( test == 2 && i == 3 );
+            allPanels.push_back( std::make_shared< system_models::VehicleExteriorPanel >(
+                    panelNormals.at( i ),
+                    panelAreas.at( i ),
+                    "",
+                    std::make_shared< SpecularDiffuseMixReflectionLaw >( 0.1 + 0.1 * i, 0.5 - 0.1 * i, 0.4, withReradiation ),
+                    panelPositions.at( i ) ) );
+            allPanels.at( i )->updatePanel( Eigen::Quaterniond::Identity( ) );
+        }
+
+        PaneledRadiationPressureTargetModel targetModel( allPanels, allPanels );
+        targetModel.enableTorqueComputation( [ = ]( ) { return centerOfMass; } );
+        targetModel.updateMembers( TUDAT_NAN );
+        BOOST_CHECK_EQUAL( targetModel.isBatchedReflectionKernelUsed( ), test < 2 );
+
+        // Compute expected force and torque by directly evaluating the reflection laws
+        Eigen::Vector3d expectedForce = Eigen::Vector3d::Zero( );
+        Eigen::Vector3d expectedTorque = Eigen::Vector3d::Zero( );
+        for( unsigned int j = 0; j < sourceIrradiances.size( ); j++ )
+        {
+            Eigen::Vector3d currentExpectedForce = Eigen::Vector3d::Zero( );
+            Eigen::Vector3d currentExpectedTorque = Eigen::Vector3d::Zero( );
+            for( unsigned int i = 0; i < allPanels.size( ); i++ )
+            {
+                double panelCosine = -sourceToTargetDirections.at( j ).dot( panelNormals.at( i ) );
+                if( panelCosine > 0 )
+                {
+                    Eigen::Vector3d panelForce = sourceIrradiances.at( j ) / physical_constants::SPEED_OF_LIGHT * panelAreas.at( i ) *
+                            panelCosine *
+                            allPanels.at( i )->getReflectionLaw( )->evaluateReactionVector( panelNormals.at( i ),
+                                                                                            sourceToTargetDirections.at( j ) );
+                    currentExpectedForce += panelForce;
+                    currentExpectedTorque += ( panelPositions.at( i ) - centerOfMass ).cross( panelForce );
+                }
+            }
+
+            // Check single-source evaluation
+            const Eigen::Vector3d actualForce = targetModel.updateAndGetRadiationPressureForce(
+                    sourceIrradiances.at( j ), sourceToTargetDirections.at( j ), true );
+            const Eigen::Vector3d actualTorque = targetModel.getCurrentRadiationPressureTorque( );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( actualForce, currentExpectedForce, 1e-12 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( actualTorque, currentExpectedTorque, 1e-12 );
+
+            expectedForce += currentExpectedForce;
+            expectedTorque += currentExpectedTorque;
+        }
+
+        // Check multi-source evaluation
+        targetModel.resetComputations( "" );
+        targetModel.updateRadiationPressureForcingFromMultipleSources( sourceIrradiances, sourceToTargetDirections );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( targetModel.getCurrentRadiationPressureForce( ), expectedForce, 1e-12 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( targetModel.getCurrentRadiationPressureTorque( ), expectedTorque, 1e-12 );
+
+        // Check that modified reflection law coefficients are used in subsequent evaluations
+        std::dynamic_pointer_cast< SpecularDiffuseMixReflectionLaw >( allPanels.at( 0 )->getReflectionLaw( ) )
+                ->setSpecularReflectivity( 0.0, true );
+        Eigen::Vector3d expectedModifiedForce = sourceIrradiances.at( 0 ) / physical_constants::SPEED_OF_LIGHT * panelAreas.at( 0 ) *
+                -sourceToTargetDirections.at( 0 ).dot( panelNormals.at( 0 ) ) *
+                allPanels.at( 0 )->getReflectionLaw( )->evaluateReactionVector( panelNormals.at( 0 ), sourceToTargetDirections.at( 0 ) );
+        targetModel.updateRadiationPressureForcing( sourceIrradiances.at( 0 ), sourceToTargetDirections.at( 0 ), true );
+        targetModel.saveLocalComputations( "", false );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( targetModel.getPanelForces( "" ).at( 0 ), expectedModifiedForce, 1e-12 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
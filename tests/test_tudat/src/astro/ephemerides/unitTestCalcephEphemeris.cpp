@@ -0,0 +1,109 @@
+/*    Copyright (c) 2010-2024, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      This test is only built if Tudat is built with CALCEPH, and reads the
+ *      inpop19a_TDB_m100_p100_spice.bsp kernel from the Spice kernel folder.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/ephemerides/calcephEphemeris.h"
+#include "tudat/io/basicInputOutput.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::ephemerides;
+
+BOOST_AUTO_TEST_SUITE( test_calceph_ephemeris )
+
+//! Test concurrent evaluation of a CALCEPH ephemeris, and check that the number of open file handles remains bounded
+BOOST_AUTO_TEST_CASE( testCalcephEphemerisConcurrentEvaluation )
+{
+    const std::string kernelFile = paths::getSpiceKernelPath( ) + "/inpop19a_TDB_m100_p100_spice.bsp";
+    const int maximumNumberOfHandles = 2;
+    CalcephEphemeris calcephEphemeris( kernelFile, 301, 399, "Earth", "J2000", maximumNumberOfHandles );
+    BOOST_CHECK( calcephEphemeris.isLoaded( ) );
+    BOOST_CHECK_EQUAL( calcephEphemeris.getMaximumNumberOfHandles( ), maximumNumberOfHandles );
+
+    // Compute states serially
+    const int numberOfThreads = 8;
+    const int numberOfEvaluationsPerThread = 200;
+    const double timeStep = 3600.0;
+    std::vector< std::vector< Eigen::Vector6d > > serialStates( numberOfThreads );
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        for( int j = 0; j < numberOfEvaluationsPerThread; j++ )
+        {
+            serialStates[ i ].push_back(
+                    calcephEphemeris.getCartesianState( ( i * numberOfEvaluationsPerThread + j ) * timeStep ) );
+        }
+    }
+
+    // Check Moon distance w.r.t. Earth, to ensure that the kernel has been read correctly
+    BOOST_CHECK( serialStates[ 0 ][ 0 ].segment( 0, 3 ).norm( ) > 3.5E8 );
+    BOOST_CHECK( serialStates[ 0 ][ 0 ].segment( 0, 3 ).norm( ) < 4.1E8 );
+
+    // Compute same states concurrently, in a number of batches of short-lived threads, and check that results are identical
+    const int numberOfBatches = 5;
+    for( int batch = 0; batch < numberOfBatches; batch++ )
+    {
+        std::vector< std::vector< Eigen::Vector6d > > concurrentStates( numberOfThreads );
+        std::vector< std::thread > threads;
+        for( int i = 0; i < numberOfThreads; i++ )
+        {
+            threads.push_back( std::thread( [ &calcephEphemeris, &concurrentStates, i, numberOfEvaluationsPerThread, timeStep ]( ) {
+                for( int j = 0; j < numberOfEvaluationsPerThread; j++ )
+                {
+                    concurrentStates[ i ].push_back(
+                            calcephEphemeris.getCartesianState( ( i * numberOfEvaluationsPerThread + j ) * timeStep ) );
+                }
+            } ) );
+        }
+        for( unsigned int i = 0; i < threads.size( ); i++ )
+        {
+            threads.at( i ).join( );
+        }
+
+        for( int i = 0; i < numberOfThreads; i++ )
+        {
+            BOOST_CHECK_EQUAL( static_cast< int >( concurrentStates[ i ].size( ) ), numberOfEvaluationsPerThread );
+            for( int j = 0; j < numberOfEvaluationsPerThread; j++ )
+            {
+                for( int k = 0; k < 6; k++ )
+                {
+                    BOOST_CHECK_EQUAL( serialStates[ i ][ j ]( k ), concurrentStates[ i ][ j ]( k ) );
+                }
+            }
+        }
+
+        // Check that handles are reused, instead of being opened for each new thread
+        BOOST_CHECK( calcephEphemeris.getNumberOfOpenHandles( ) >= 1 );
+        BOOST_CHECK( calcephEphemeris.getNumberOfOpenHandles( ) <= maximumNumberOfHandles );
+        if( calcephEphemeris.isHandleThreadSafe( ) )
+        {
+            BOOST_CHECK_EQUAL( calcephEphemeris.getNumberOfOpenHandles( ), 1 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+
+}  // namespace tudat
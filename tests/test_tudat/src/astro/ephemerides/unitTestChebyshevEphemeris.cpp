@@ -0,0 +1,128 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <limits>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_chebyshev_ephemeris )
+
+//! Test whether polynomial state is reproduced exactly by a single segment
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisPolynomial )
+{
+    // Define cubic position as function of time
+    std::function< Eigen::Vector6d( const double ) > stateFunction = []( const double time )
+    {
+        Eigen::Vector6d state;
+        state << 1.0 + 2.0 * time - 0.5 * time * time * time, -3.0 + time * time, 4.0 * time, 2.0 - 1.5 * time * time, 2.0 * time,
+                4.0;
+        return state;
+    };
+
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemeris =
+            ephemerides::createChebyshevEphemeris( stateFunction, -2.0, 3.0, 5, 1.0E-12 );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getNumberOfSegments( ), 1 );
+
+    for( double time = -2.0; time <= 3.0; time += 0.125 )
+    {
+        BOOST_CHECK_SMALL( ( stateFunction( time ) - chebyshevEphemeris->getCartesianState( time ) ).norm( ), 1.0E-12 );
+    }
+
+    // Check that times outside of range are rejected
+    BOOST_CHECK_THROW( chebyshevEphemeris->getCartesianState( -2.001 ), std::runtime_error );
+    BOOST_CHECK_THROW( chebyshevEphemeris->getCartesianState( 3.001 ), std::runtime_error );
+}
+
+//! Test fit to Kepler orbit, and writing/reading of coefficient file
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisKeplerOrbit )
+{
+    // Create Kepler ephemeris of low Earth orbit
+    Eigen::Vector6d keplerElements;
+    keplerElements << 7000.0E3, 0.01, 0.8, 0.3, 1.2, 0.5;
+    std::shared_ptr< ephemerides::KeplerEphemeris > keplerEphemeris =
+            std::make_shared< ephemerides::KeplerEphemeris >( keplerElements, 0.0, 398600.4418E9, "Earth", "J2000" );
+
+    // Fit Chebyshev polynomials to Kepler ephemeris
+    const double startTime = -3600.0;
+    const double endTime = 86400.0;
+    const double positionTolerance = 1.0E-3;
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemeris = ephemerides::createChebyshevEphemeris(
+            [ = ]( const double time ) { return keplerEphemeris->getCartesianState( time ); },
+            startTime,
+            endTime,
+            12,
+            positionTolerance,
+            "Earth",
+            "J2000" );
+
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris->getEndTime( ), endTime, 1.0E-14 );
+
+    // Check that memory use is smaller than that of table with 60 s time step
+    BOOST_CHECK( chebyshevEphemeris->getCoefficients( ).size( ) < 6 * ( endTime - startTime ) / 60.0 / 2 );
+
+    // Compare with Kepler ephemeris at points not used in fit
+    for( double time = startTime; time <= endTime; time += 97.3 )
+    {
+        Eigen::Vector6d stateDifference = keplerEphemeris->getCartesianState( time ) - chebyshevEphemeris->getCartesianState( time );
+        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 2.0 * positionTolerance );
+        BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-5 );
+    }
+
+    // Check that end time is included in last segment
+    BOOST_CHECK_SMALL(
+            ( keplerEphemeris->getCartesianState( endTime ) - chebyshevEphemeris->getCartesianState( endTime ) ).segment( 0, 3 ).norm( ),
+            2.0 * positionTolerance );
+
+    // Check that a larger tolerance requires fewer segments
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > coarseChebyshevEphemeris = ephemerides::createChebyshevEphemeris(
+            [ = ]( const double time ) { return keplerEphemeris->getCartesianState( time ); }, startTime, endTime, 12, 10.0 );
+    BOOST_CHECK( coarseChebyshevEphemeris->getNumberOfSegments( ) < chebyshevEphemeris->getNumberOfSegments( ) );
+
+    // Write coefficients to file, and check that ephemeris read from file is identical
+    const std::string fileName = "chebyshevEphemerisTest.bin";
+    ephemerides::writeChebyshevEphemerisFile( chebyshevEphemeris, fileName );
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > readEphemeris = ephemerides::readChebyshevEphemerisFile( fileName );
+    std::remove( fileName.c_str( ) );
+
+    BOOST_CHECK_EQUAL( readEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( readEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( readEphemeris->getNumberOfSegments( ), chebyshevEphemeris->getNumberOfSegments( ) );
+    BOOST_CHECK_EQUAL( readEphemeris->getPolynomialDegree( ), chebyshevEphemeris->getPolynomialDegree( ) );
+    for( double time = startTime; time <= endTime; time += 1013.7 )
+    {
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_EQUAL( readEphemeris->getCartesianState( time )( i ), chebyshevEphemeris->getCartesianState( time )( i ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+
+}  // namespace tudat
@@ -0,0 +1,211 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/gravitation/centralGravityModel.h"
+#include "tudat/astro/gravitation/mutualPointMassGravityModel.h"
+#include "tudat/simulation/simulation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::gravitation;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::basic_astrodynamics;
+
+BOOST_AUTO_TEST_SUITE( test_mutual_point_mass_gravity )
+
+//! Test whether the accelerations computed by the group model are identical to those from a direct sum over all bodies
+BOOST_AUTO_TEST_CASE( testMutualPointMassGravityKernel )
+{
+    // Define accelerated bodies (two of which have no gravitational parameter), and external bodies
+    std::vector< std::string > acceleratedBodies = { "Debris1", "Asteroid1", "Asteroid2", "Debris2", "Asteroid3" };
+    std::vector< std::string > externalBodies = { "Sun", "Jupiter" };
+    std::vector< double > gravitationalParameters = { 0.0, 6.26E10, 1.36E10, 0.0, 1.73E10, 1.32712440018E20, 1.26686534E17 };
+    std::vector< Eigen::Vector3d > positions = { Eigen::Vector3d( 4.1E11, 1.2E10, -3.0E9 ),
+                                                 Eigen::Vector3d( 3.9E11, -1.1E11, 2.0E10 ),
+                                                 Eigen::Vector3d( -2.5E11, 3.3E11, -1.0E10 ),
+                                                 Eigen::Vector3d( 4.1E11 + 1.0E6, 1.2E10 - 2.0E6, -3.0E9 + 5.0E5 ),
+                                                 Eigen::Vector3d( 1.0E11, -4.2E11, 4.0E10 ),
+                                                 Eigen::Vector3d( 1.0E8, -2.0E8, 3.0E7 ),
+                                                 Eigen::Vector3d( -6.1E11, 4.9E11, 1.2E10 ) };
+
+    std::vector< std::function< double( ) > > gravitationalParameterFunctions;
+    std::vector< std::function< Eigen::Vector3d( ) > > positionFunctions;
+    for( unsigned int i = 0; i < positions.size( ); i++ )
+    {
+        if( gravitationalParameters.at( i ) > 0.0 )
+        {
+            gravitationalParameterFunctions.push_back( [ = ]( ) { return gravitationalParameters.at( i ); } );
+        }
+        else
+        {
+            gravitationalParameterFunctions.push_back( nullptr );
+        }
+        positionFunctions.push_back( [ &positions, i ]( ) { return positions.at( i ); } );
+    }
+
+    std::shared_ptr< MutualPointMassGravity > mutualGravity = std::make_shared< MutualPointMassGravity >(
+            acceleratedBodies, externalBodies, gravitationalParameterFunctions, positionFunctions );
+    BOOST_CHECK_EQUAL( mutualGravity->getNumberOfAttractingAcceleratedBodies( ), 3 );
+    BOOST_CHECK_EQUAL( mutualGravity->getBodiesUndergoingAcceleration( ).size( ), acceleratedBodies.size( ) );
+    BOOST_CHECK_EQUAL( mutualGravity->getBodiesExertingAcceleration( ).size( ), acceleratedBodies.size( ) + externalBodies.size( ) );
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Move bodies for second test, and check whether accelerations are updated
+        if( test == 1 )
+        {
+            for( unsigned int i = 0; i < positions.size( ); i++ )
+            {
+                positions.at( i ) += Eigen::Vector3d( 1.0E9 * i, -2.0E9, 3.0E8 * i );
+            }
+        }
+
+        std::vector< std::shared_ptr< MutualPointMassGravityAcceleration > > accelerationModels;
+        for( unsigned int i = 0; i < acceleratedBodies.size( ); i++ )
+        {
+            accelerationModels.push_back(
+                    std::make_shared< MutualPointMassGravityAcceleration >( mutualGravity, acceleratedBodies.at( i ) ) );
+            accelerationModels.at( i )->resetCurrentTime( );
+            accelerationModels.at( i )->updateMembers( static_cast< double >( test ) );
+        }
+
+        // Compare accelerations of all bodies against direct evaluation
+        for( unsigned int i = 0; i < acceleratedBodies.size( ); i++ )
+        {
+            Eigen::Vector3d expectedAcceleration = Eigen::Vector3d::Zero( );
+            for( unsigned int j = 0; j < positions.size( ); j++ )
+            {
+                if( i != j && gravitationalParameters.at( j ) > 0.0 )
+                {
+                    expectedAcceleration +=
+                            computeGravitationalAcceleration( positions.at( i ), gravitationalParameters.at( j ), positions.at( j ) );
+                }
+            }
+
+            BOOST_CHECK_SMALL( ( accelerationModels.at( i )->getAcceleration( ) - expectedAcceleration ).norm( ) /
+                                       expectedAcceleration.norm( ),
+                               10.0 * std::numeric_limits< double >::epsilon( ) );
+            BOOST_CHECK_SMALL( ( mutualGravity->getAccelerationOfBody( acceleratedBodies.at( i ) ) - expectedAcceleration ).norm( ) /
+                                       expectedAcceleration.norm( ),
+                               10.0 * std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+
+    // Check that a body outside of the group is rejected
+    BOOST_CHECK_THROW( MutualPointMassGravityAcceleration( mutualGravity, "Sun" ), std::runtime_error );
+}
+
+//! Test whether propagation with mutual point-mass gravity is equal to propagation with separate point-mass accelerations
+BOOST_AUTO_TEST_CASE( testMutualPointMassGravityPropagation )
+{
+    const double sunGravitationalParameter = 1.32712440018E20;
+    std::vector< std::string > bodiesToPropagate = { "Asteroid1", "Asteroid2", "Asteroid3", "Debris1", "Debris2" };
+    std::vector< double > asteroidGravitationalParameters = { 6.26E10, 1.36E10, 1.73E10 };
+    std::vector< std::string > centralBodies( bodiesToPropagate.size( ), "SSB" );
+
+    std::vector< Eigen::VectorXd > finalStates;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Create bodies: Sun and Jupiter with constant state, asteroids with gravity field, and debris without gravity field
+        SystemOfBodies bodies( "SSB", "ECLIPJ2000" );
+        bodies.createEmptyBody( "Sun" );
+        bodies.createEmptyBody( "Jupiter" );
+        bodies.at( "Sun" )->setEphemeris(
+                std::make_shared< ephemerides::ConstantEphemeris >( []( ) { return Eigen::Vector6d::Zero( ); }, "SSB", "ECLIPJ2000" ) );
+        bodies.at( "Sun" )->setGravityFieldModel( std::make_shared< GravityFieldModel >( sunGravitationalParameter ) );
+        Eigen::Vector6d jupiterState = Eigen::Vector6d::Zero( );
+        jupiterState.segment( 0, 3 ) = Eigen::Vector3d( -6.1E11, 4.9E11, 1.2E10 );
+        bodies.at( "Jupiter" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                [ = ]( ) { return jupiterState; }, "SSB", "ECLIPJ2000" ) );
+        bodies.at( "Jupiter" )->setGravityFieldModel( std::make_shared< GravityFieldModel >( 1.26686534E17 ) );
+        for( unsigned int i = 0; i < bodiesToPropagate.size( ); i++ )
+        {
+            bodies.createEmptyBody( bodiesToPropagate.at( i ) );
+            if( i < asteroidGravitationalParameters.size( ) )
+            {
+                bodies.at( bodiesToPropagate.at( i ) )
+                        ->setGravityFieldModel( std::make_shared< GravityFieldModel >( asteroidGravitationalParameters.at( i ) ) );
+            }
+        }
+
+        // Define accelerations: each body is attracted by all other bodies that have a gravity field
+        AvailableAcceleration accelerationType = ( test == 0 ? point_mass_gravity : mutual_point_mass_gravity );
+        SelectedAccelerationMap accelerationMap;
+        for( unsigned int i = 0; i < bodiesToPropagate.size( ); i++ )
+        {
+            for( auto bodyIterator: bodies.getMap( ) )
+            {
+                if( bodyIterator.first != bodiesToPropagate.at( i ) && bodyIterator.second->getGravityFieldModel( ) != nullptr )
+                {
+                    accelerationMap[ bodiesToPropagate.at( i ) ][ bodyIterator.first ].push_back(
+                            std::make_shared< AccelerationSettings >( accelerationType ) );
+                }
+            }
+        }
+        AccelerationMap accelerationModelMap = createAccelerationModelsMap( bodies, accelerationMap, bodiesToPropagate, centralBodies );
+
+        // Define initial states on (nearly) circular orbits, with the debris objects close to the first asteroid
+        Eigen::VectorXd systemInitialState = Eigen::VectorXd::Zero( 6 * bodiesToPropagate.size( ) );
+        std::vector< double > orbitalRadii = { 4.1E11, 3.9E11, 4.3E11, 4.1E11 + 2.0E6, 4.1E11 - 5.0E6 };
+        std::vector< double > orbitalPhases = { 0.0, 2.1, 4.2, 1.0E-5, -2.0E-5 };
+        for( unsigned int i = 0; i < bodiesToPropagate.size( ); i++ )
+        {
+            double orbitalVelocity = std::sqrt( sunGravitationalParameter / orbitalRadii.at( i ) );
+            systemInitialState.segment( 6 * i, 6 ) << orbitalRadii.at( i ) * std::cos( orbitalPhases.at( i ) ),
+                    orbitalRadii.at( i ) * std::sin( orbitalPhases.at( i ) ), 1.0E8 * i,
+                    -orbitalVelocity * std::sin( orbitalPhases.at( i ) ), orbitalVelocity * std::cos( orbitalPhases.at( i ) ), 0.1 * i;
+        }
+
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        centralBodies,
+                        accelerationModelMap,
+                        bodiesToPropagate,
+                        systemInitialState,
+                        0.0,
+                        std::make_shared< RungeKuttaFixedStepSizeSettings<> >( 3600.0, CoefficientSets::rungeKutta4Classic ),
+                        std::make_shared< PropagationTimeTerminationSettings >( 30.0 * 86400.0 ),
+                        cowell );
+
+        SingleArcDynamicsSimulator<> dynamicsSimulator( bodies, propagatorSettings );
+        finalStates.push_back( dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).rbegin( )->second );
+    }
+
+    // Check that both propagations give the same result, up to rounding errors
+    for( unsigned int i = 0; i < bodiesToPropagate.size( ); i++ )
+    {
+        Eigen::Vector3d positionDifference = finalStates.at( 0 ).segment( 6 * i, 3 ) - finalStates.at( 1 ).segment( 6 * i, 3 );
+        Eigen::Vector3d velocityDifference = finalStates.at( 0 ).segment( 6 * i + 3, 3 ) - finalStates.at( 1 ).segment( 6 * i + 3, 3 );
+        BOOST_CHECK_SMALL( positionDifference.norm( ) / finalStates.at( 0 ).segment( 6 * i, 3 ).norm( ), 1.0E-13 );
+        BOOST_CHECK_SMALL( velocityDifference.norm( ) / finalStates.at( 0 ).segment( 6 * i + 3, 3 ).norm( ), 1.0E-13 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+
+}  // namespace tudat
@@ -21,6 +21,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "tudat/basics/testMacros.h"
+#include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
 
 namespace tudat
@@ -214,6 +215,116 @@ BOOST_AUTO_TEST_CASE( testGravityComputation )
     }
 }
 
+//! Test multi-threaded evaluation and far-field spherical harmonic expansion of polyhedron gravity field.
+BOOST_AUTO_TEST_CASE( testMultiThreadedAndFarFieldGravityComputation )
+{
+    // Define cuboid polyhedron dimensions
+    const double w = 10.0;  // width
+    const double h = 10.0;  // height
+    const double l = 20.0;  // length
+
+    // Define parameters
+    const double gravitationalConstant = 6.67259e-11;
+    const double density = 2670;
+    const double volume = w * h * l;
+    const double gravitationalParameter = gravitationalConstant * density * volume;
+
+    // Define cuboid
+    Eigen::MatrixXd verticesCoordinates( 8, 3 );
+    verticesCoordinates << 0.0, 0.0, 0.0, l, 0.0, 0.0, 0.0, w, 0.0, l, w, 0.0, 0.0, 0.0, h, l, 0.0, h, 0.0, w, h, l, w, h;
+    Eigen::MatrixXi verticesDefiningEachFacet( 12, 3 );
+    verticesDefiningEachFacet << 2, 1, 0, 1, 2, 3, 4, 2, 0, 2, 4, 6, 1, 4, 0, 4, 1, 5, 6, 5, 7, 5, 6, 4, 3, 6, 7, 6, 3, 2, 5, 3, 7, 3, 5, 1;
+
+    gravitation::PolyhedronGravityField gravityField =
+            gravitation::PolyhedronGravityField( gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+    gravitation::PolyhedronGravityField multiThreadedGravityField =
+            gravitation::PolyhedronGravityField( gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+    multiThreadedGravityField.setNumberOfThreads( 3 );
+
+    // Compare single- and multi-threaded results with direct evaluation of polyhedron expressions
+    std::vector< Eigen::Vector3d > testPositions = { Eigen::Vector3d( 0.0, 3.0, 2.0 ),
+                                                     Eigen::Vector3d( 12.0, 4.0, 3.0 ),
+                                                     Eigen::Vector3d( -5.0, 3.0, 7.0 ),
+                                                     Eigen::Vector3d( 35.0, -12.0, 48.0 ) };
+    for( unsigned int i = 0; i < testPositions.size( ); i++ )
+    {
+        Eigen::MatrixXd relativeVerticesCoordinates;
+        Eigen::VectorXd perFacetFactor, perEdgeFactor;
+        basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
+                relativeVerticesCoordinates, testPositions.at( i ), verticesCoordinates );
+        basic_mathematics::calculatePolyhedronPerFacetFactor( perFacetFactor, relativeVerticesCoordinates, verticesDefiningEachFacet );
+        basic_mathematics::calculatePolyhedronPerEdgeFactor(
+                perEdgeFactor, relativeVerticesCoordinates, gravityField.getVerticesDefiningEachEdge( ) );
+
+        double expectedPotential =
+                basic_mathematics::calculatePolyhedronGravitationalPotential( gravitationalParameter / volume,
+                                                                              relativeVerticesCoordinates,
+                                                                              verticesDefiningEachFacet,
+                                                                              gravityField.getVerticesDefiningEachEdge( ),
+                                                                              gravityField.getFacetDyads( ),
+                                                                              gravityField.getEdgeDyads( ),
+                                                                              perFacetFactor,
+                                                                              perEdgeFactor );
+        Eigen::Vector3d expectedGradient =
+                basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential( gravitationalParameter / volume,
+                                                                                        relativeVerticesCoordinates,
+                                                                                        verticesDefiningEachFacet,
+                                                                                        gravityField.getVerticesDefiningEachEdge( ),
+                                                                                        gravityField.getFacetDyads( ),
+                                                                                        gravityField.getEdgeDyads( ),
+                                                                                        perFacetFactor,
+                                                                                        perEdgeFactor );
+
+        BOOST_CHECK_CLOSE_FRACTION( expectedPotential, gravityField.getGravitationalPotential( testPositions.at( i ) ), 1.0E-13 );
+        BOOST_CHECK_CLOSE_FRACTION(
+                expectedPotential, multiThreadedGravityField.getGravitationalPotential( testPositions.at( i ) ), 1.0E-13 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedGradient, gravityField.getGradientOfPotential( testPositions.at( i ) ), 1.0E-13 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                expectedGradient, multiThreadedGravityField.getGradientOfPotential( testPositions.at( i ) ), 1.0E-13 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( gravityField.getHessianOfPotential( testPositions.at( i ) ),
+                                           multiThreadedGravityField.getHessianOfPotential( testPositions.at( i ) ),
+                                           1.0E-13 );
+    }
+
+    // Check Brillouin sphere and central term of spherical harmonic expansion
+    const double brillouinSphereRadius = basic_astrodynamics::computePolyhedronBrillouinSphereRadius( verticesCoordinates );
+    BOOST_CHECK_CLOSE_FRACTION( brillouinSphereRadius, std::sqrt( l * l + w * w + h * h ), 1.0E-15 );
+
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients = basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+            verticesCoordinates, verticesDefiningEachFacet, 2, brillouinSphereRadius );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 0, 0 ), 1.0, 1.0E-14 );
+
+    // Degree 1 coefficients are determined by the center of mass (l/2, w/2, h/2)
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 1, 0 ), 0.5 * h / ( std::sqrt( 3.0 ) * brillouinSphereRadius ), 1.0E-13 );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.first( 1, 1 ), 0.5 * l / ( std::sqrt( 3.0 ) * brillouinSphereRadius ), 1.0E-13 );
+    BOOST_CHECK_CLOSE_FRACTION( coefficients.second( 1, 1 ), 0.5 * w / ( std::sqrt( 3.0 ) * brillouinSphereRadius ), 1.0E-13 );
+
+    // Use far-field expansion beyond twice the Brillouin sphere radius
+    gravitation::PolyhedronGravityField farFieldGravityField =
+            gravitation::PolyhedronGravityField( gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+    farFieldGravityField.setFarFieldSphericalHarmonicExpansion( 12, 2.0 );
+    BOOST_CHECK_CLOSE_FRACTION( farFieldGravityField.getBrillouinSphereRadius( ), brillouinSphereRadius, 1.0E-15 );
+
+    // Check that exact polyhedron is used inside switch radius
+    Eigen::Vector3d nearPosition = Eigen::Vector3d( 30.0, -10.0, 20.0 );
+    BOOST_CHECK_EQUAL( farFieldGravityField.getGravitationalPotential( nearPosition ),
+                       gravityField.getGravitationalPotential( nearPosition ) );
+    BOOST_CHECK_EQUAL( farFieldGravityField.getGradientOfPotential( nearPosition ), gravityField.getGradientOfPotential( nearPosition ) );
+    BOOST_CHECK_EQUAL( farFieldGravityField.getPolyhedronGravityCache( )->isFarFieldExpansionUsed( ), false );
+
+    // Check that far-field expansion is used (and accurate) outside switch radius
+    Eigen::Vector3d farPosition = 3.0 * brillouinSphereRadius * Eigen::Vector3d( 0.6, -0.48, 0.64 );
+    BOOST_CHECK_CLOSE_FRACTION(
+            farFieldGravityField.getGravitationalPotential( farPosition ), gravityField.getGravitationalPotential( farPosition ), 1.0E-8 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+            farFieldGravityField.getGradientOfPotential( farPosition ), gravityField.getGradientOfPotential( farPosition ), 1.0E-7 );
+    BOOST_CHECK_EQUAL( farFieldGravityField.getPolyhedronGravityCache( )->isFarFieldExpansionUsed( ), true );
+
+    // Check that Hessian is always computed from polyhedron
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+            farFieldGravityField.getHessianOfPotential( farPosition ), gravityField.getHessianOfPotential( farPosition ), 1.0E-14 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
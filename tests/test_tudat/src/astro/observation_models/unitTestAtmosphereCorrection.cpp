@@ -844,6 +844,72 @@ BOOST_AUTO_TEST_CASE( testVmf3TroposphericCorrection )
     BOOST_CHECK_CLOSE_FRACTION( totalSlantDelay, 6.9705, 1.0e-1 );
 }
 
+// Check that station media correction cache reproduces uncached corrections, and reuses station- and epoch-dependent terms
+BOOST_AUTO_TEST_CASE( testStationMediaCorrectionCache )
+{
+    // Create Saastamoinen correction with simplified Chao mapping, counting the number of meteorological data evaluations
+    int numberOfPressureEvaluations = 0;
+    std::function< Eigen::Vector3d( double ) > groundStationGeodeticPositionFunction = [ = ]( double time ) {
+        return ( Eigen::Vector3d( ) << 100.0, 0.3, 0.2 ).finished( );
+    };
+    std::function< double( double ) > pressureFunction = [ & ]( double time ) {
+        numberOfPressureEvaluations++;
+        return 897.1e2 + 1.0E-3 * time;
+    };
+    std::function< double( double ) > temperatureFunction = [ = ]( double time ) { return 283.0 + 1.0E-5 * time; };
+    std::function< double( double ) > waterVaporPartialPressureFunction = [ = ]( double time ) { return 1.0E3; };
+    std::function< double( Eigen::Vector3d, double ) > elevationFunction = [ = ]( Eigen::Vector3d, double ) { return 0.4; };
+
+    SaastamoinenTroposphericCorrection troposphericCorrection(
+            groundStationGeodeticPositionFunction,
+            pressureFunction,
+            temperatureFunction,
+            waterVaporPartialPressureFunction,
+            std::make_shared< SimplifiedChaoTroposphericMapping >( elevationFunction, true ),
+            true );
+
+    std::vector< Eigen::Vector6d > linkEndStates( 2, Eigen::Vector6d::Zero( ) );
+    std::vector< double > testTimes = { 0.0, 10.0, 10.0, 10.4, 20.0, 10.0 };
+
+    // Compute corrections without cache
+    std::vector< double > uncachedCorrections;
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        uncachedCorrections.push_back( troposphericCorrection.calculateLightTimeCorrectionWithMultiLegLinkEndStates(
+                linkEndStates, { testTimes.at( i ), testTimes.at( i ) + 1.0 }, 0, nullptr ) );
+    }
+    BOOST_CHECK_EQUAL( numberOfPressureEvaluations, testTimes.size( ) );
+
+    // Compute corrections with cache, and check that results are identical, and that terms are reused for equal epochs
+    std::shared_ptr< StationMediaCorrectionCache > stationCache = std::make_shared< StationMediaCorrectionCache >( );
+    troposphericCorrection.setStationMediaCorrectionCache( stationCache, stationCache->getTermIndex( "saastamoinen_tropospheric" ) );
+    BOOST_CHECK_EQUAL( stationCache->getTermIndex( "saastamoinen_tropospheric" ), 0 );
+
+    numberOfPressureEvaluations = 0;
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( troposphericCorrection.calculateLightTimeCorrectionWithMultiLegLinkEndStates(
+                                   linkEndStates, { testTimes.at( i ), testTimes.at( i ) + 1.0 }, 0, nullptr ),
+                           uncachedCorrections.at( i ) );
+    }
+    BOOST_CHECK_EQUAL( numberOfPressureEvaluations, 4 );
+    BOOST_CHECK_EQUAL( stationCache->getNumberOfCacheMisses( ), 4 );
+    BOOST_CHECK_EQUAL( stationCache->getNumberOfCacheHits( ), 2 );
+
+    // Check that, with epoch quantization, terms are evaluated at the rounded epoch
+    stationCache->setEpochQuantization( 1.0 );
+    stationCache->resetStatistics( );
+    numberOfPressureEvaluations = 0;
+    BOOST_CHECK_EQUAL( troposphericCorrection.calculateLightTimeCorrectionWithMultiLegLinkEndStates(
+                               linkEndStates, { 10.4, 11.4 }, 0, nullptr ),
+                       uncachedCorrections.at( 1 ) );
+    BOOST_CHECK_EQUAL( troposphericCorrection.calculateLightTimeCorrectionWithMultiLegLinkEndStates(
+                               linkEndStates, { 9.6, 10.6 }, 0, nullptr ),
+                       uncachedCorrections.at( 1 ) );
+    BOOST_CHECK_EQUAL( numberOfPressureEvaluations, 1 );
+    BOOST_CHECK_EQUAL( stationCache->getNumberOfCacheHits( ), 1 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
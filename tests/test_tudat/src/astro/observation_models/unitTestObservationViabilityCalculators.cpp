@@ -11,6 +11,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
 #include <limits>
 #include <string>
 
@@ -1227,6 +1228,262 @@ BOOST_AUTO_TEST_CASE( testOrbiterOccultationObservationViabilityCalculators )
     }
 }
 
+BOOST_AUTO_TEST_CASE( testBatchObservationViabilityScreening )
+{
+    // Define simplified rotating central body, with station at given latitude/longitude
+    double rotationRate = 2.0 * mathematical_constants::PI / 86400.0;
+    double stationLatitude = 20.0 * mathematical_constants::PI / 180.0;
+    double stationLongitude = 50.0 * mathematical_constants::PI / 180.0;
+    double stationRadius = 6371.0E3;
+    Eigen::Vector3d bodyFixedStationPosition =
+            stationRadius * ( Eigen::Vector3d( ) << std::cos( stationLatitude ) * std::cos( stationLongitude ),
+                              std::cos( stationLatitude ) * std::sin( stationLongitude ),
+                              std::sin( stationLatitude ) )
+                                    .finished( );
+    std::function< Eigen::Quaterniond( const double ) > rotationToBodyFixedFrame = [ = ]( const double time ) {
+        return Eigen::Quaterniond( Eigen::AngleAxisd( -rotationRate * time, Eigen::Vector3d::UnitZ( ) ) );
+    };
+    Eigen::Quaterniond rotationToTopocentricFrame =
+            Eigen::Quaterniond( Eigen::AngleAxisd( -( mathematical_constants::PI / 2.0 - stationLatitude ), Eigen::Vector3d::UnitX( ) ) *
+                                Eigen::AngleAxisd( -( mathematical_constants::PI / 2.0 + stationLongitude ), Eigen::Vector3d::UnitZ( ) ) );
+    std::shared_ptr< PointingAnglesCalculator > pointingAngleCalculator = std::make_shared< PointingAnglesCalculator >(
+            rotationToBodyFixedFrame, [ = ]( const double ) { return rotationToTopocentricFrame; } );
+
+    // Define test body for occultation/avoidance tests
+    Eigen::Vector6d testBodyState = Eigen::Vector6d::Zero( );
+    testBodyState( 0 ) = 8000.0E3;
+    double testBodyRadius = 1000.0E3;
+    double testAngle = 20.0 * mathematical_constants::PI / 180.0;
+
+    // Create viability calculators for one-way downlink (station is receiver)
+    std::vector< std::pair< int, int > > linkEndIndices = { { 1, 0 } };
+    std::vector< std::shared_ptr< ObservationViabilityCalculator > > viabilityCalculators;
+    viabilityCalculators.push_back(
+            std::make_shared< MinimumElevationAngleCalculator >( linkEndIndices, testAngle, pointingAngleCalculator ) );
+    viabilityCalculators.push_back( std::make_shared< BodyAvoidanceAngleCalculator >(
+            linkEndIndices, testAngle, [ = ]( const double ) { return testBodyState; }, "TestBody" ) );
+    viabilityCalculators.push_back( std::make_shared< OccultationCalculator >(
+            linkEndIndices, [ = ]( const double ) { return testBodyState; }, testBodyRadius ) );
+
+    // Create link end states/times for grid of epochs, with target in inclined circular orbit (exaggerated light time)
+    int numberOfEpochs = 5000;
+    Eigen::VectorXd receptionTimes = Eigen::VectorXd::Zero( numberOfEpochs );
+    std::vector< LinkEndStateGrid > linkEndStateGrids( 2, LinkEndStateGrid::Zero( 6, numberOfEpochs ) );
+    std::vector< Eigen::VectorXd > linkEndTimeGrids( 2, Eigen::VectorXd::Zero( numberOfEpochs ) );
+    for( int j = 0; j < numberOfEpochs; j++ )
+    {
+        receptionTimes( j ) = 30.0 * static_cast< double >( j );
+        linkEndTimeGrids[ 1 ]( j ) = receptionTimes( j );
+        linkEndTimeGrids[ 0 ]( j ) = receptionTimes( j ) - 100.0;
+
+        double orbitAngle = 2.0 * mathematical_constants::PI * linkEndTimeGrids[ 0 ]( j ) / 7200.0;
+        linkEndStateGrids[ 0 ].block( 0, j, 3, 1 ) =
+                Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitX( ) ) *
+                ( 10000.0E3 * Eigen::Vector3d( std::cos( orbitAngle ), std::sin( orbitAngle ), 0.0 ) );
+        linkEndStateGrids[ 1 ].block( 0, j, 3, 1 ) =
+                rotationToBodyFixedFrame( linkEndTimeGrids[ 1 ]( j ) ).inverse( ) * bodyFixedStationPosition;
+    }
+
+    // Check margins of each calculator against single-observation checks
+    std::vector< Eigen::Vector6d > linkEndStates( 2 );
+    std::vector< double > linkEndTimes( 2 );
+    std::vector< int > numberOfViableObservations( viabilityCalculators.size( ), 0 );
+    for( unsigned int i = 0; i < viabilityCalculators.size( ); i++ )
+    {
+        Eigen::VectorXd viabilityMargins = viabilityCalculators.at( i )->computeViabilityMargins( linkEndStateGrids, linkEndTimeGrids );
+        BOOST_CHECK_EQUAL( viabilityMargins.rows( ), numberOfEpochs );
+        for( int j = 0; j < numberOfEpochs; j++ )
+        {
+            for( unsigned int k = 0; k < 2; k++ )
+            {
+                linkEndStates[ k ] = linkEndStateGrids[ k ].col( j );
+                linkEndTimes[ k ] = linkEndTimeGrids[ k ]( j );
+            }
+            bool isViable = viabilityCalculators.at( i )->isObservationViable( linkEndStates, linkEndTimes );
+            if( std::fabs( viabilityMargins( j ) ) > 1.0E-12 )
+            {
+                BOOST_CHECK_EQUAL( viabilityMargins( j ) > 0.0, isViable );
+            }
+            numberOfViableObservations[ i ] += isViable;
+        }
+
+        // Check that test case contains both viable and non-viable observations for each calculator
+        BOOST_CHECK( numberOfViableObservations[ i ] > 0 );
+        BOOST_CHECK( numberOfViableObservations[ i ] < numberOfEpochs );
+    }
+
+    // Check screening of combined calculators against single-observation checks
+    double screeningTolerance = 0.01;
+    Eigen::VectorXd combinedMargins = computeObservationViabilityMargins( linkEndStateGrids, linkEndTimeGrids, viabilityCalculators );
+    std::vector< ObservationViabilityScreeningResult > screeningResults =
+            screenObservationViability( linkEndStateGrids, linkEndTimeGrids, viabilityCalculators, screeningTolerance );
+    BOOST_CHECK_EQUAL( screeningResults.size( ), numberOfEpochs );
+
+    std::vector< std::pair< double, double > > viabilityWindows = getObservationViabilityWindows( receptionTimes, combinedMargins );
+    BOOST_CHECK( viabilityWindows.size( ) > 1 );
+
+    int numberOfUndeterminedObservations = 0;
+    unsigned int currentWindow = 0;
+    for( int j = 0; j < numberOfEpochs; j++ )
+    {
+        for( unsigned int k = 0; k < 2; k++ )
+        {
+            linkEndStates[ k ] = linkEndStateGrids[ k ].col( j );
+            linkEndTimes[ k ] = linkEndTimeGrids[ k ]( j );
+        }
+        bool isViable = isObservationViable( linkEndStates, linkEndTimes, viabilityCalculators );
+
+        if( screeningResults.at( j ) == screened_viable_observation )
+        {
+            BOOST_CHECK_EQUAL( isViable, true );
+        }
+        else if( screeningResults.at( j ) == screened_non_viable_observation )
+        {
+            BOOST_CHECK_EQUAL( isViable, false );
+        }
+        else
+        {
+            BOOST_CHECK( std::fabs( combinedMargins( j ) ) <= screeningTolerance );
+            numberOfUndeterminedObservations++;
+        }
+
+        // Check whether epoch is inside a viability window, if and only if observation is viable
+        while( currentWindow < viabilityWindows.size( ) && viabilityWindows.at( currentWindow ).second < receptionTimes( j ) )
+        {
+            currentWindow++;
+        }
+        bool isInWindow =
+                ( currentWindow < viabilityWindows.size( ) ) && ( viabilityWindows.at( currentWindow ).first <= receptionTimes( j ) );
+        BOOST_CHECK_EQUAL( isInWindow, isViable );
+    }
+
+    // Check that only a small part of the observations requires an exact check
+    BOOST_CHECK( numberOfUndeterminedObservations > 0 );
+    BOOST_CHECK( numberOfUndeterminedObservations < numberOfEpochs / 10 );
+
+    // Check that no screening is applied without viability calculators
+    std::vector< ObservationViabilityScreeningResult > unconstrainedResults = screenObservationViability(
+            linkEndStateGrids, linkEndTimeGrids, std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ), screeningTolerance );
+    BOOST_CHECK( std::count( unconstrainedResults.begin( ), unconstrainedResults.end( ), screened_viable_observation ) == numberOfEpochs );
+}
+
+BOOST_AUTO_TEST_CASE( testViabilityScreenedObservationSimulation )
+{
+    // Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create environment, with simplified rotation models for Earth/Mars
+    BodyListSettings bodySettings = getDefaultBodySettings( { "Earth", "Mars", "Sun" } );
+    bodySettings.at( "Earth" )->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+            "ECLIPJ2000",
+            "IAU_Earth",
+            spice_interface::computeRotationQuaternionBetweenFrames( "ECLIPJ2000", "IAU_Earth", 0.0 ),
+            0.0,
+            2.0 * mathematical_constants::PI / ( physical_constants::JULIAN_DAY ) );
+    bodySettings.at( "Mars" )->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+            "ECLIPJ2000",
+            "IAU_Mars",
+            spice_interface::computeRotationQuaternionBetweenFrames( "ECLIPJ2000", "IAU_Mars", 0.0 ),
+            0.0,
+            2.0 * mathematical_constants::PI / ( physical_constants::JULIAN_DAY + 40.0 * 60.0 ) );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    createGroundStation( bodies.at( "Mars" ),
+                         "MarsStation",
+                         ( Eigen::Vector3d( ) << 100.0, 0.2, 2.1 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+    createGroundStation( bodies.at( "Earth" ),
+                         "EarthStation",
+                         ( Eigen::Vector3d( ) << 800.0, 0.12, 5.3 ).finished( ),
+                         coordinate_conversions::geodetic_position );
+
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair< std::string, std::string >( "Mars", "MarsStation" );
+    linkEnds[ receiver ] = std::make_pair< std::string, std::string >( "Earth", "EarthStation" );
+
+    // Define elevation angle and Sun avoidance constraints
+    double earthTestAngle = 4.0 * mathematical_constants::PI / 180.0;
+    double marsTestAngle = 10.0 * mathematical_constants::PI / 180.0;
+    double earthSunAvoidanceAngle = 30.0 * mathematical_constants::PI / 180.0;
+    std::vector< std::shared_ptr< ObservationViabilitySettings > > observationViabilitySettings;
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+            minimum_elevation_angle, std::make_pair< std::string, std::string >( "Earth", "" ), "", earthTestAngle ) );
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+            minimum_elevation_angle, std::make_pair< std::string, std::string >( "Mars", "" ), "", marsTestAngle ) );
+    observationViabilitySettings.push_back( std::make_shared< ObservationViabilitySettings >(
+            body_avoidance_angle, std::make_pair< std::string, std::string >( "Earth", "" ), "Sun", earthSunAvoidanceAngle ) );
+
+    // Define observation times, sampling different rotational phases of Earth and Mars
+    std::vector< double > observationTimes;
+    for( double currentTime = 0.0; currentTime <= 100.0 * physical_constants::JULIAN_DAY; currentTime += 10000.0 )
+    {
+        observationTimes.push_back( currentTime );
+    }
+
+    // Tolerance exceeds change in elevation angles over the light time (at most ~25 minutes)
+    double screeningTolerance = 10.0 * mathematical_constants::PI / 180.0;
+
+    std::vector< std::shared_ptr< ObservationViabilityCalculator > > viabilityCalculators =
+            createObservationViabilityCalculators( bodies, linkEnds, one_way_range, observationViabilitySettings );
+    std::vector< double > screenedObservationTimes = getViabilityScreenedObservationTimes(
+            observationTimes, linkEnds, one_way_range, viabilityCalculators, bodies, screeningTolerance );
+    BOOST_CHECK( screenedObservationTimes.size( ) > 0 );
+    BOOST_CHECK( screenedObservationTimes.size( ) < observationTimes.size( ) );
+
+    // Check that no screening is applied without viability calculators
+    BOOST_CHECK_EQUAL( getViabilityScreenedObservationTimes( observationTimes,
+                                                             linkEnds,
+                                                             one_way_range,
+                                                             std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ),
+                                                             bodies,
+                                                             screeningTolerance )
+                               .size( ),
+                       observationTimes.size( ) );
+
+    // Simulate observations with per-observation viability check only, and with prior screening
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( one_way_range, linkEnds ) );
+    std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > > observationSimulators =
+            createObservationSimulators( observationSettingsList, bodies );
+
+    std::shared_ptr< TabulatedObservationSimulationSettings< double > > unscreenedSettings =
+            std::make_shared< TabulatedObservationSimulationSettings< double > >(
+                    one_way_range, linkEnds, observationTimes, transmitter, observationViabilitySettings );
+    std::shared_ptr< TabulatedObservationSimulationSettings< double > > screenedSettings =
+            std::make_shared< TabulatedObservationSimulationSettings< double > >(
+                    one_way_range, linkEnds, observationTimes, transmitter, observationViabilitySettings );
+    screenedSettings->viabilityScreeningTolerance_ = screeningTolerance;
+
+    std::shared_ptr< ObservationCollection<> > unscreenedObservations = simulateObservations(
+            std::vector< std::shared_ptr< ObservationSimulationSettings< double > > >( { unscreenedSettings } ),
+            observationSimulators,
+            bodies );
+    std::shared_ptr< ObservationCollection<> > screenedObservations = simulateObservations(
+            std::vector< std::shared_ptr< ObservationSimulationSettings< double > > >( { screenedSettings } ),
+            observationSimulators,
+            bodies );
+
+    // Check that screening removes only observations that fail the per-observation check, and yields identical observations
+    std::vector< double > unscreenedTimes = unscreenedObservations->getConcatenatedTimeVector( );
+    std::vector< double > screenedTimes = screenedObservations->getConcatenatedTimeVector( );
+    BOOST_CHECK( unscreenedTimes.size( ) > 0 );
+    BOOST_CHECK( unscreenedTimes.size( ) <= screenedObservationTimes.size( ) );
+    BOOST_CHECK_EQUAL( unscreenedTimes.size( ), screenedTimes.size( ) );
+    for( unsigned int i = 0; i < std::min( unscreenedTimes.size( ), screenedTimes.size( ) ); i++ )
+    {
+        BOOST_CHECK_EQUAL( unscreenedTimes.at( i ), screenedTimes.at( i ) );
+        BOOST_CHECK( std::find( screenedObservationTimes.begin( ), screenedObservationTimes.end( ), unscreenedTimes.at( i ) ) !=
+                     screenedObservationTimes.end( ) );
+    }
+    Eigen::VectorXd unscreenedObservationVector = unscreenedObservations->getObservationVector( );
+    Eigen::VectorXd screenedObservationVector = screenedObservations->getObservationVector( );
+    BOOST_CHECK_EQUAL( unscreenedObservationVector.rows( ), screenedObservationVector.rows( ) );
+    if( unscreenedObservationVector.rows( ) == screenedObservationVector.rows( ) )
+    {
+        BOOST_CHECK_EQUAL( ( unscreenedObservationVector - screenedObservationVector ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -981,6 +981,171 @@ BOOST_AUTO_TEST_CASE( test_ObservationsSplitting )
     BOOST_CHECK( ( splitObsSets.at( 1 )->getObservationTimes( ).at( 0 ) - splitObsSets.at( 0 )->getObservationTimes( ).back( ) ) > 1500.0 );
 }
 
+BOOST_AUTO_TEST_CASE( test_SingleObservationSetStorage )
+{
+    LinkDefinition linkEnds;
+    linkEnds[ receiver ] = LinkEndId( "Earth", "Station1" );
+    linkEnds[ transmitter ] = LinkEndId( "Spacecraft", "" );
+
+    // Create unsorted angular position observations, with one row per observation
+    const int numberOfObservations = 6;
+    std::vector< double > observationTimes = { 50.0, 10.0, 40.0, 20.0, 60.0, 30.0 };
+    std::vector< Eigen::VectorXd > observations, residuals;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        observations.push_back( ( Eigen::VectorXd( 2 ) << observationTimes.at( i ), -observationTimes.at( i ) ).finished( ) );
+    }
+    std::shared_ptr< SingleObservationSet< > > observationSet =
+            std::make_shared< SingleObservationSet< > >( angular_position, linkEnds, observations, observationTimes, receiver );
+
+    // Set residuals (provided in time order)
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        residuals.push_back( Eigen::VectorXd::Constant( 2, 10.0 * ( i + 1 ) * 1.0E-6 ) );
+    }
+    observationSet->setResiduals( residuals );
+
+    // Check that observations are sorted, and that matrix and vector views are consistent
+    BOOST_CHECK_EQUAL( observationSet->getObservationsMatrix( ).rows( ), numberOfObservations );
+    BOOST_CHECK_EQUAL( observationSet->getObservationsMatrix( ).cols( ), 2 );
+    Eigen::VectorXd observationsVector = observationSet->getObservationsVector( );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double expectedTime = 10.0 * ( i + 1 );
+        BOOST_CHECK_EQUAL( observationSet->getObservationTimesReference( ).at( i ), expectedTime );
+        BOOST_CHECK_EQUAL( observationSet->getObservationsMatrix( )( i, 0 ), expectedTime );
+        BOOST_CHECK_EQUAL( observationsVector( 2 * i + 1 ), -expectedTime );
+        BOOST_CHECK_EQUAL( observationSet->getObservation( i )( 1 ), -expectedTime );
+        BOOST_CHECK_EQUAL( observationSet->getResidual( i )( 0 ), expectedTime * 1.0E-6 );
+    }
+
+    // Check weights setting
+    Eigen::VectorXd tabulatedWeights = Eigen::VectorXd::LinSpaced( 2 * numberOfObservations, 1.0, 2.0 * numberOfObservations );
+    observationSet->setTabulatedWeights( tabulatedWeights );
+    BOOST_CHECK_EQUAL( ( observationSet->getWeightsVector( ) - tabulatedWeights ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( observationSet->getWeightsMatrix( )( 2, 1 ), 6.0 );
+
+    // Add observations, and check that sorting is applied to all data
+    std::vector< Eigen::VectorXd > newObservations = { Eigen::VectorXd::Constant( 2, 15.0 ) };
+    std::vector< Eigen::VectorXd > newWeights = { Eigen::VectorXd::Constant( 2, 100.0 ) };
+    observationSet->addObservations( newObservations, { 15.0 }, { }, newWeights );
+    BOOST_CHECK_EQUAL( observationSet->getNumberOfObservables( ), numberOfObservations + 1 );
+    BOOST_CHECK_EQUAL( observationSet->getObservationTime( 1 ), 15.0 );
+    BOOST_CHECK_EQUAL( observationSet->getWeight( 1 )( 0 ), 100.0 );
+    BOOST_CHECK_EQUAL( observationSet->getWeight( 2 )( 0 ), 3.0 );
+    BOOST_CHECK_EQUAL( observationSet->getResidual( 1 )( 0 ), 0.0 );
+
+    // Remove observations, and check that remaining data is consistent
+    observationSet->removeObservations( { 0, 1, 5 } );
+    BOOST_CHECK_EQUAL( observationSet->getNumberOfObservables( ), numberOfObservations - 2 );
+    std::vector< double > expectedTimes = { 20.0, 30.0, 40.0, 60.0 };
+    for( unsigned int i = 0; i < expectedTimes.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( observationSet->getObservationTime( i ), expectedTimes.at( i ) );
+        BOOST_CHECK_EQUAL( observationSet->getObservation( i )( 0 ), expectedTimes.at( i ) );
+        BOOST_CHECK_EQUAL( observationSet->getResidual( i )( 1 ), expectedTimes.at( i ) * 1.0E-6 );
+    }
+    BOOST_CHECK_EQUAL( observationSet->getTimeBounds( ).first, 20.0 );
+    BOOST_CHECK_EQUAL( observationSet->getTimeBounds( ).second, 60.0 );
+    BOOST_CHECK_THROW( observationSet->removeObservations( { 4 } ), std::runtime_error );
+
+    // Filter observations on time bounds, and move them back
+    observationSet->filterObservations( observationFilter( time_bounds_filtering, 25.0, 45.0 ) );
+    BOOST_CHECK_EQUAL( observationSet->getNumberOfObservables( ), 2 );
+    BOOST_CHECK_EQUAL( observationSet->getNumberOfFilteredObservations( ), 2 );
+    BOOST_CHECK_EQUAL( observationSet->getFilteredObservationSet( )->getObservation( 1 )( 0 ), 40.0 );
+    observationSet->filterObservations( observationFilter( time_bounds_filtering, 25.0, 45.0, false ) );
+    BOOST_CHECK_EQUAL( observationSet->getNumberOfObservables( ), 4 );
+    BOOST_CHECK_EQUAL( observationSet->getNumberOfFilteredObservations( ), 0 );
+    BOOST_CHECK_EQUAL( observationSet->getObservation( 1 )( 0 ), 30.0 );
+    BOOST_CHECK_EQUAL( observationSet->getResidual( 1 )( 0 ), 30.0 * 1.0E-6 );
+
+    // Split observation set, and check that weights are retrieved from the correct observations
+    std::vector< std::shared_ptr< SingleObservationSet< > > > splitSets =
+            splitObservationSet( observationSet, observationSetSplitter( nb_observations_splitter, 3 ), false );
+    BOOST_CHECK_EQUAL( splitSets.size( ), 2 );
+    BOOST_CHECK_EQUAL( splitSets.at( 1 )->getNumberOfObservables( ), 1 );
+    BOOST_CHECK_EQUAL( splitSets.at( 1 )->getObservationTime( 0 ), 60.0 );
+    BOOST_CHECK_EQUAL( ( splitSets.at( 1 )->getWeight( 0 ) - observationSet->getWeight( 3 ) ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( splitSets.at( 1 )->getResidual( 0 ) - observationSet->getResidual( 3 ) ).norm( ), 0.0 );
+}
+
+//! Function to create a single observation set with equispaced observation times, for testing observation collection parsers
+std::shared_ptr< SingleObservationSet< > > createParserTestObservationSet( const ObservableType observableType,
+                                                                          const LinkEnds& linkEnds,
+                                                                          const double startTime,
+                                                                          const int numberOfObservations )
+{
+    std::vector< double > observationTimes;
+    std::vector< Eigen::VectorXd > observations;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        observationTimes.push_back( startTime + 10.0 * i );
+        observations.push_back( Eigen::VectorXd::Constant( getObservableSize( observableType ), startTime + i ) );
+    }
+    return std::make_shared< SingleObservationSet< > >( observableType, linkEnds, observations, observationTimes, receiver );
+}
+
+BOOST_AUTO_TEST_CASE( test_ObservationCollectionParserCache )
+{
+    LinkEnds firstLinkEnds, secondLinkEnds;
+    firstLinkEnds[ receiver ] = LinkEndId( "Earth", "Station1" );
+    firstLinkEnds[ transmitter ] = LinkEndId( "Spacecraft", "" );
+    secondLinkEnds[ receiver ] = LinkEndId( "Earth", "Station2" );
+    secondLinkEnds[ transmitter ] = LinkEndId( "Spacecraft", "" );
+
+    std::vector< std::shared_ptr< SingleObservationSet< > > > observationSets = {
+        createParserTestObservationSet( one_way_range, firstLinkEnds, 0.0, 10 ),
+        createParserTestObservationSet( one_way_range, firstLinkEnds, 1000.0, 5 ),
+        createParserTestObservationSet( one_way_range, secondLinkEnds, 0.0, 8 ),
+        createParserTestObservationSet( angular_position, firstLinkEnds, 500.0, 4 )
+    };
+    std::shared_ptr< ObservationCollection< > > observationCollection =
+            std::make_shared< ObservationCollection< > >( observationSets );
+
+    // Check parser results, and that parsers with identical contents share cached results
+    unsigned int numberOfCachedResults = observationCollection->getNumberOfCachedObservationParserResults( );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Station1", true ) ).size( ), 3 );
+    BOOST_CHECK_EQUAL( observationCollection->getNumberOfCachedObservationParserResults( ), numberOfCachedResults + 1 );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Station1", true ) ).size( ), 3 );
+    BOOST_CHECK_EQUAL( observationCollection->getNumberOfCachedObservationParserResults( ), numberOfCachedResults + 1 );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Station1", true, true ) ).size( ), 1 );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Spacecraft" ) ).size( ), 4 );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Mars" ) ).size( ), 0 );
+    std::vector< std::string > stationNames = { "Station1", "Station2" };
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( stationNames, true ) ).size( ), 4 );
+
+    std::vector< std::shared_ptr< ObservationCollectionParser > > combinedParsers = { observationParser( one_way_range ),
+                                                                                      observationParser( "Station1", true ) };
+    std::vector< std::shared_ptr< SingleObservationSet< > > > combinedParserSets =
+            observationCollection->getSingleObservationSets( observationParser( combinedParsers, true ) );
+    BOOST_CHECK_EQUAL( combinedParserSets.size( ), 2 );
+    BOOST_CHECK( combinedParserSets.at( 0 ) == observationSets.at( 0 ) );
+    BOOST_CHECK( combinedParserSets.at( 1 ) == observationSets.at( 1 ) );
+
+    // Check that results of parsers depending on the contents of the observation sets are not cached
+    numberOfCachedResults = observationCollection->getNumberOfCachedObservationParserResults( );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( std::make_pair( -1.0, 200.0 ) ) ).size( ), 2 );
+    combinedParsers.push_back( observationParser( std::make_pair( -1.0, 200.0 ) ) );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( combinedParsers, true ) ).size( ), 1 );
+    BOOST_CHECK_EQUAL( observationCollection->getNumberOfCachedObservationParserResults( ), numberOfCachedResults );
+
+    // Remove observation sets, and check that cached results are reset
+    observationCollection->removeSingleObservationSets( observationParser( "Station2", true ) );
+    BOOST_CHECK_EQUAL( observationCollection->getNumberOfCachedObservationParserResults( ), 0 );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Spacecraft" ) ).size( ), 3 );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Station2", true ) ).size( ), 0 );
+
+    // Append observation sets, and check that parser results and concatenated observations are updated
+    std::shared_ptr< ObservationCollection< > > secondObservationCollection = std::make_shared< ObservationCollection< > >(
+            std::vector< std::shared_ptr< SingleObservationSet< > > >( { observationSets.at( 2 ) } ) );
+    observationCollection->appendObservationCollection( secondObservationCollection );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Station2", true ) ).size( ), 1 );
+    BOOST_CHECK_EQUAL( observationCollection->getSingleObservationSets( observationParser( "Spacecraft" ) ).size( ), 4 );
+    BOOST_CHECK_EQUAL( observationCollection->getTotalObservableSize( ), 10 + 5 + 8 + 2 * 4 );
+    BOOST_CHECK_EQUAL( observationCollection->getObservationVector( ).rows( ), 10 + 5 + 8 + 2 * 4 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -0,0 +1,96 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Benchmark of the flattened acceleration pipeline of the N-body state derivative model against a direct traversal of the
+ *    acceleration map, for typical LEO and interplanetary model sets. Built only if TUDAT_BUILD_BENCHMARKS is set, and not run
+ *    as part of the unit tests.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "tudat/astro/propagators/nBodyCowellStateDerivative.h"
+#include "tudat/astro/propagators/accelerationPipelineTestModels.h"
+
+using namespace tudat;
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::gravitation;
+using namespace tudat::propagators;
+using namespace tudat::unit_tests;
+
+int main( )
+{
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::vector< std::string > propagatedBodies;
+        Eigen::VectorXd propagatedStates;
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        AccelerationMap accelerationMap =
+                ( test == 0 ) ? getLeoAccelerationModelSet( propagatedBodies, propagatedStates, cosineCoefficients, sineCoefficients )
+                              : getInterplanetaryAccelerationModelSet( propagatedBodies, propagatedStates );
+
+        NBodyCowellStateDerivative< double, double > stateDerivativeModel( accelerationMap, nullptr, propagatedBodies );
+        int numberOfAccelerationModels = 0;
+        for( const auto& outerIterator: accelerationMap )
+        {
+            for( const auto& innerIterator: outerIterator.second )
+            {
+                numberOfAccelerationModels += static_cast< int >( innerIterator.second.size( ) );
+            }
+        }
+        Eigen::MatrixXd computedStateDerivative = Eigen::MatrixXd::Zero( propagatedStates.rows( ), 1 );
+        Eigen::VectorXd expectedStateDerivative;
+
+        // Time both stages with the models already updated, so that only the overhead of the pipeline is measured
+        const int numberOfEvaluations = 200000;
+        const double evaluationTime = 1800.0;
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        for( int i = 0; i < numberOfEvaluations; i++ )
+        {
+            updateAccelerationMapModels( accelerationMap, evaluationTime );
+        }
+        const double mapUpdateTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        startTime = std::chrono::steady_clock::now( );
+        for( int i = 0; i < numberOfEvaluations; i++ )
+        {
+            stateDerivativeModel.updateStateDerivativeModel( evaluationTime );
+        }
+        const double flattenedUpdateTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        // Accumulate one state derivative component, so that the summation loops are not optimized away
+        double checkSum = 0.0;
+        startTime = std::chrono::steady_clock::now( );
+        for( int i = 0; i < numberOfEvaluations; i++ )
+        {
+            sumAccelerationMapContributions( accelerationMap, propagatedBodies, propagatedStates, expectedStateDerivative );
+            checkSum += expectedStateDerivative( 3 );
+        }
+        const double mapSumTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        startTime = std::chrono::steady_clock::now( );
+        for( int i = 0; i < numberOfEvaluations; i++ )
+        {
+            stateDerivativeModel.calculateSystemStateDerivative(
+                    evaluationTime, propagatedStates, computedStateDerivative.block( 0, 0, propagatedStates.rows( ), 1 ) );
+            checkSum -= computedStateDerivative( 3, 0 );
+        }
+        const double flattenedSumTime = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        std::cout << ( test == 0 ? "LEO" : "Interplanetary" ) << " model set, " << numberOfAccelerationModels
+                  << " acceleration models, time per evaluation (ns): update map " << 1.0E9 * mapUpdateTime / numberOfEvaluations
+                  << ", flattened " << 1.0E9 * flattenedUpdateTime / numberOfEvaluations << "; sum map "
+                  << 1.0E9 * mapSumTime / numberOfEvaluations << ", flattened " << 1.0E9 * flattenedSumTime / numberOfEvaluations
+                  << " (residual " << checkSum << ")" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/propagators/nBodyCowellStateDerivative.h"
+#include "tudat/astro/propagators/accelerationPipelineTestModels.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::gravitation;
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_acceleration_pipeline )
+
+//! Test whether the flattened acceleration pipeline of the state derivative model gives the same result as a direct traversal of
+//! the acceleration map, for typical model sets
+BOOST_AUTO_TEST_CASE( testAccelerationPipeline )
+{
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::vector< std::string > propagatedBodies;
+        Eigen::VectorXd propagatedStates;
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        AccelerationMap accelerationMap =
+                ( test == 0 ) ? getLeoAccelerationModelSet( propagatedBodies, propagatedStates, cosineCoefficients, sineCoefficients )
+                              : getInterplanetaryAccelerationModelSet( propagatedBodies, propagatedStates );
+
+        NBodyCowellStateDerivative< double, double > stateDerivativeModel( accelerationMap, nullptr, propagatedBodies );
+        Eigen::MatrixXd computedStateDerivative = Eigen::MatrixXd::Zero( propagatedStates.rows( ), 1 );
+        Eigen::VectorXd expectedStateDerivative;
+
+        // Compare state derivatives at a number of epochs
+        for( int i = 0; i < 5; i++ )
+        {
+            double currentTime = 600.0 * i;
+            stateDerivativeModel.clearStateDerivativeModel( );
+            stateDerivativeModel.updateStateDerivativeModel( currentTime );
+            stateDerivativeModel.calculateSystemStateDerivative(
+                    currentTime, propagatedStates, computedStateDerivative.block( 0, 0, propagatedStates.rows( ), 1 ) );
+
+            updateAccelerationMapModels( accelerationMap, currentTime );
+            sumAccelerationMapContributions( accelerationMap, propagatedBodies, propagatedStates, expectedStateDerivative );
+
+            for( unsigned int j = 0; j < propagatedBodies.size( ); j++ )
+            {
+                Eigen::Vector3d velocityDifference =
+                        computedStateDerivative.block( 6 * j, 0, 3, 1 ) - expectedStateDerivative.segment( 6 * j, 3 );
+                Eigen::Vector3d accelerationDifference =
+                        computedStateDerivative.block( 6 * j + 3, 0, 3, 1 ) - expectedStateDerivative.segment( 6 * j + 3, 3 );
+                BOOST_CHECK_EQUAL( velocityDifference.norm( ), 0.0 );
+                BOOST_CHECK_SMALL( accelerationDifference.norm( ) / expectedStateDerivative.segment( 6 * j + 3, 3 ).norm( ),
+                                   10.0 * std::numeric_limits< double >::epsilon( ) );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+
+}  // namespace tudat
@@ -20,6 +20,8 @@
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
+#include "tudat/astro/ephemerides/customEphemeris.h"
+#include "tudat/astro/ephemerides/customRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
 #include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
@@ -627,6 +629,200 @@ BOOST_AUTO_TEST_CASE( test_NonConservativeForceEnvironmentUpdate )
     }
 }
 
+//! Test whether updates that depend only on time are skipped when repeated at the same time, and whether statistics are recorded
+BOOST_AUTO_TEST_CASE( test_IncrementalEnvironmentUpdate )
+{
+    // Create bodies with custom ephemerides that count the number of evaluations
+    SystemOfBodies bodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth", false );
+    bodies.createEmptyBody( "Vehicle", false );
+    bodies.createEmptyBody( "Probe", false );
+
+    std::map< std::string, int > numberOfEphemerisEvaluations;
+    std::map< std::string, std::string > ephemerisOrigins = { { "Earth", "SSB" }, { "Vehicle", "SSB" }, { "Probe", "Vehicle" } };
+    for( auto originIterator: ephemerisOrigins )
+    {
+        std::string bodyName = originIterator.first;
+        numberOfEphemerisEvaluations[ bodyName ] = 0;
+        bodies.at( bodyName )->setEphemeris( std::make_shared< ephemerides::CustomEphemeris<> >(
+                [ &numberOfEphemerisEvaluations, bodyName ]( const double time ) {
+                    numberOfEphemerisEvaluations[ bodyName ]++;
+                    return ( Eigen::Vector6d( ) << 1.0E11 + time, 2.0E10 * bodyName.size( ), -time, 1.0, -2.0, 3.0 ).finished( );
+                },
+                originIterator.second,
+                "ECLIPJ2000" ) );
+    }
+    bodies.processBodyFrameDefinitions( );
+
+    // Set rotation models that depend only on time (Earth), and that is (conservatively) assumed to depend on state (Probe)
+    bodies.at( "Earth" )->setRotationalEphemeris( std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+            Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) ), 7.3E-5, 0.0, "ECLIPJ2000", "Earth_Fixed" ) );
+    bodies.at( "Probe" )->setRotationalEphemeris( std::make_shared< ephemerides::CustomRotationalEphemeris >(
+            []( const double time ) { return Eigen::Quaterniond( Eigen::AngleAxisd( 1.0E-4 * time, Eigen::Vector3d::UnitX( ) ) ); },
+            "ECLIPJ2000",
+            "Probe_Fixed" ) );
+
+    // Define updates, with Vehicle propagated (so that Probe state depends on integrated state through its ephemeris origin)
+    std::map< EnvironmentModelsToUpdate, std::vector< std::string > > updateSettings;
+    updateSettings[ body_translational_state_update ] = { "Probe", "Earth", "Vehicle" };
+    updateSettings[ body_rotational_state_update ] = { "Probe", "Earth" };
+    std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > > integratedStates;
+    integratedStates[ translational_state ].push_back( std::make_tuple( "Vehicle", "", cowell ) );
+
+    std::unordered_map< IntegratedStateType, Eigen::VectorXd > integratedStateToSet;
+    integratedStateToSet[ translational_state ] =
+            ( Eigen::VectorXd( 6 ) << 7.0E6, 1.0E5, -2.0E5, 100.0, 7.5E3, 10.0 ).finished( );
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        bool useIncrementalUpdates = ( test == 1 );
+        std::shared_ptr< EnvironmentUpdater< double, double > > updater =
+                std::make_shared< EnvironmentUpdater< double, double > >( bodies, updateSettings, integratedStates );
+        updater->setUseIncrementalUpdates( useIncrementalUpdates );
+        numberOfEphemerisEvaluations[ "Earth" ] = 0;
+
+        // Check that Earth translational and rotational updates are identified as depending only on time, and are done first
+        BOOST_CHECK_EQUAL( updater->getNumberOfTimeOnlyUpdates( ), 2 );
+        std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, EnvironmentUpdateStatistics > > updateStatistics =
+                updater->getUpdateStatistics( );
+        BOOST_CHECK_EQUAL( updateStatistics.size( ), 4 );
+        BOOST_CHECK_EQUAL( updateStatistics.at( 0 ).get< 1 >( ), "Earth" );
+        BOOST_CHECK_EQUAL( updateStatistics.at( 1 ).get< 1 >( ), "Earth" );
+
+        // Update environment three times at same time, and once at a different time
+        std::vector< double > testTimes = { 3600.0, 3600.0, 3600.0, 7200.0 };
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            updater->updateEnvironment( testTimes.at( i ), integratedStateToSet );
+
+            // Check that environment is properly updated
+            BOOST_CHECK_EQUAL( ( bodies.at( "Earth" )->getState( ) -
+                                 bodies.at( "Earth" )->getEphemeris( )->getCartesianState( testTimes.at( i ) ) )
+                                       .norm( ),
+                               0.0 );
+            Eigen::Matrix3d expectedRotation =
+                    bodies.at( "Earth" )->getRotationalEphemeris( )->getRotationToBaseFrame( testTimes.at( i ) ).toRotationMatrix( );
+            BOOST_CHECK_SMALL( ( bodies.at( "Earth" )->getCurrentRotationToGlobalFrame( ).toRotationMatrix( ) - expectedRotation ).norm( ),
+                               10.0 * std::numeric_limits< double >::epsilon( ) );
+        }
+
+        // Remove ephemeris evaluations used in the checks above
+        numberOfEphemerisEvaluations[ "Earth" ] -= testTimes.size( );
+
+        // Check number of Earth ephemeris evaluations (skipped for repeated time if incremental updates are used)
+        BOOST_CHECK_EQUAL( numberOfEphemerisEvaluations.at( "Earth" ), ( useIncrementalUpdates ? 2 : 4 ) );
+
+        updateStatistics = updater->getUpdateStatistics( );
+        for( unsigned int i = 0; i < updateStatistics.size( ); i++ )
+        {
+            EnvironmentUpdateStatistics currentStatistics = updateStatistics.at( i ).get< 2 >( );
+            if( i < 2 && useIncrementalUpdates )
+            {
+                BOOST_CHECK_EQUAL( currentStatistics.numberOfEvaluations, 2 );
+                BOOST_CHECK_EQUAL( currentStatistics.numberOfSkippedEvaluations, 2 );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( currentStatistics.numberOfEvaluations, 4 );
+                BOOST_CHECK_EQUAL( currentStatistics.numberOfSkippedEvaluations, 0 );
+            }
+            BOOST_CHECK_EQUAL( currentStatistics.evaluationTime, 0.0 );
+        }
+
+        // Check that reset of incremental updates forces update of all models
+        updater->resetIncrementalUpdates( );
+        numberOfEphemerisEvaluations[ "Earth" ] = 0;
+        updater->updateEnvironment( 7200.0, integratedStateToSet );
+        BOOST_CHECK_EQUAL( numberOfEphemerisEvaluations.at( "Earth" ), 1 );
+
+        // Check that timing of updates is recorded when requested
+        updater->resetUpdateStatistics( );
+        updater->setUpdateTimingIsActive( true );
+        for( unsigned int i = 0; i < 10; i++ )
+        {
+            updater->updateEnvironment( 7200.0 + 60.0 * ( i + 1 ), integratedStateToSet );
+        }
+        updateStatistics = updater->getUpdateStatistics( );
+        double totalUpdateTime = 0.0;
+        for( unsigned int i = 0; i < updateStatistics.size( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( updateStatistics.at( i ).get< 2 >( ).numberOfEvaluations, 10 );
+            BOOST_CHECK( updateStatistics.at( i ).get< 2 >( ).evaluationTime >= 0.0 );
+            totalUpdateTime += updateStatistics.at( i ).get< 2 >( ).evaluationTime;
+        }
+        BOOST_CHECK( totalUpdateTime > 0.0 );
+    }
+}
+
+//! Test whether propagation with a state-dependent rotation model is unaffected by the body ephemeris caches
+BOOST_AUTO_TEST_CASE( test_EphemerisCacheWithStateDependentRotation )
+{
+    // Create Earth with time-dependent rotation, and vehicle with rotation defined by (constant) aerodynamic angles, which
+    // determines the direction of its body-fixed engine
+    BodyListSettings bodySettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings.at( "Earth" )->rotationModelSettings =
+            simpleRotationModelSettings( "ECLIPJ2000", "IAU_Earth", Eigen::Quaterniond::Identity( ), 0.0, 7.292115E-5 );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( 3.986004418E14 );
+    bodySettings.at( "Earth" )->atmosphereSettings = exponentialAtmosphereSettings( 7.2E3, 240.0, 1.225 );
+    bodySettings.at( "Earth" )->shapeModelSettings = sphericalBodyShapeSettings( 6378.137E3 );
+
+    bodySettings.addSettings( "Vehicle" );
+    bodySettings.at( "Vehicle" )->constantMass = 1000.0;
+    bodySettings.at( "Vehicle" )->aerodynamicCoefficientSettings = constantAerodynamicCoefficientSettings(
+            4.0, ( Eigen::Vector3d( ) << 1.2, 0.3, 0.8 ).finished( ), aerodynamics::negative_body_fixed_frame_coefficients );
+    bodySettings.at( "Vehicle" )->rotationModelSettings = aerodynamicAngleRotationSettings(
+            "Earth", "ECLIPJ2000", "VehicleFixed", []( const double ) { return Eigen::Vector3d( 0.4, 0.05, 0.7 ); } );
+
+    // Propagate low orbit with RK4, which evaluates the state derivative at the same time for different states
+    std::map< std::string, std::map< double, Eigen::VectorXd > > propagatedStates;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+        if( test == 1 )
+        {
+            bodies.setEphemerisCacheSize( 4 );
+        }
+        addEngineModel( "Vehicle", "MainEngine", std::make_shared< ConstantThrustMagnitudeSettings >( 10.0, 300.0 ), bodies );
+
+        SelectedAccelerationMap accelerationSettingsMap;
+        accelerationSettingsMap[ "Vehicle" ][ "Earth" ] = { pointMassGravityAcceleration( ), aerodynamicAcceleration( ) };
+        accelerationSettingsMap[ "Vehicle" ][ "Vehicle" ] = { thrustAccelerationFromSingleEngine( "MainEngine" ) };
+        AccelerationMap accelerationModelMap =
+                createAccelerationModelsMap( bodies, accelerationSettingsMap, { "Vehicle" }, { "Earth" } );
+
+        Eigen::VectorXd initialState = ( Eigen::VectorXd( 6 ) << 6578.0E3, 0.0, 0.0, 0.0, 6.5E3, 3.0E3 ).finished( );
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                translationalStatePropagatorSettings< double >( { "Earth" },
+                                                                accelerationModelMap,
+                                                                { "Vehicle" },
+                                                                initialState,
+                                                                0.0,
+                                                                numerical_integrators::rungeKutta4Settings< double >( 10.0 ),
+                                                                propagationTimeTerminationSettings( 3600.0 ) );
+
+        SingleArcDynamicsSimulator< double > dynamicsSimulator( bodies, propagatorSettings );
+        propagatedStates[ test == 0 ? "uncached" : "cached" ] = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+        // Check that cache is used for Earth, but not for vehicle rotation
+        if( test == 1 )
+        {
+            BOOST_CHECK( bodies.at( "Earth" )->getEphemerisCacheStatistics( ).rotationMisses > 0 );
+            BOOST_CHECK_EQUAL( bodies.at( "Vehicle" )->getEphemerisCacheStatistics( ).rotationHits +
+                                       bodies.at( "Vehicle" )->getEphemerisCacheStatistics( ).rotationMisses,
+                               0 );
+        }
+    }
+
+    // Check that propagation results are identical with and without cache
+    BOOST_CHECK_EQUAL( propagatedStates.at( "uncached" ).size( ), propagatedStates.at( "cached" ).size( ) );
+    for( auto stateIterator: propagatedStates.at( "uncached" ) )
+    {
+        BOOST_CHECK_EQUAL( ( stateIterator.second - propagatedStates.at( "cached" ).at( stateIterator.first ) ).norm( ), 0.0 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
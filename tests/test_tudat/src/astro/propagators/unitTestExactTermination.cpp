@@ -11,6 +11,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <iterator>
 #include <limits>
 #include <string>
 #include <thread>
@@ -19,6 +20,7 @@
 
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/math/basic/linearAlgebra.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/basic_astro/orbitalElementConversions.h"
 
@@ -40,7 +42,8 @@ namespace unit_tests
 BOOST_AUTO_TEST_SUITE( test_exact_termination )
 
 //! Test exact termination conditions, to see if the propagation stops exactly (within tolerance) when it's supposed to.
-//! The test is run for an RK4 and RK7(8) integrator, with otherwise identical settings.
+//! The test is run for an RK4 and RK4(5) integrator, with otherwise identical settings. The RK4(5) case is run both with the
+//! exact termination located by re-stepping the integrator, and with it located on the integrator's dense output.
 //! Five types of termination conditions are used:
 //! 0) Termination on exact time
 //! 1) Termination on exact altitude
@@ -53,7 +56,8 @@ BOOST_AUTO_TEST_SUITE( test_exact_termination )
 //! The tests are run for forward and backward propagation
 BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
 {
-    for( unsigned int integratorCase = 0; integratorCase < 2; integratorCase++ )
+    // Integrator cases: fixed step RK4, variable step RKF45, and variable step RKF45 with termination located on dense output
+    for( unsigned int integratorCase = 0; integratorCase < 3; integratorCase++ )
     {
         for( unsigned int direction = 0; direction < 2; direction++ )
         {
@@ -153,6 +157,7 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
                         relative_distance_dependent_variable, "Vehicle", "Earth" ) );
                 double finalTestTime;
                 double secondFinalTestTime;
+                bool locateTerminationOnDenseOutput = ( integratorCase == 2 );
 
                 if( direction == 0 )
                 {
@@ -176,7 +181,8 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
                             8.7E6,
                             false,
                             true,
-                            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 100 ) );
+                            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 100 ),
+                            locateTerminationOnDenseOutput );
                 }
                 else if( simulationCase == 2 )
                 {
@@ -187,7 +193,8 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
                             8.7E6,
                             false,
                             true,
-                            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 100 ) ) );
+                            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 100 ),
+                            locateTerminationOnDenseOutput ) );
                     terminationSettings = std::make_shared< PropagationHybridTerminationSettings >( terminationSettingsList, true );
                 }
                 else if( simulationCase == 3 )
@@ -199,7 +206,8 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
                             8.7E6,
                             false,
                             true,
-                            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 100 ) ) );
+                            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 100 ),
+                            locateTerminationOnDenseOutput ) );
 
                     terminationSettings = std::make_shared< PropagationHybridTerminationSettings >( terminationSettingsList, false );
                 }
@@ -213,7 +221,8 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
                             8.7E6,
                             false,
                             true,
-                            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 100 ) ) );
+                            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 100 ),
+                            locateTerminationOnDenseOutput ) );
                     terminationSettings = std::make_shared< PropagationHybridTerminationSettings >( terminationSettingsList, false );
                 }
 
@@ -341,6 +350,197 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
     }
 }
 
+//! Test termination of a propagation on a terminal integration event that is located inside an integration step. The event
+//! (descending node of a circular orbit) is located on the dense output of the last step, after which that step is redone to end
+//! exactly at the event. The step sequence and final epoch are compared with a propagation without events, and the final state
+//! with the analytical solution.
+BOOST_AUTO_TEST_CASE( testTerminationOnIntegrationEventInsideStep )
+{
+    using namespace tudat::numerical_integrators;
+    using namespace tudat::propagators;
+
+    // Define two-body problem with unit gravitational parameter, and circular orbit with unit radius (orbital period of 2 pi)
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            []( const double time, const Eigen::VectorXd& state ) {
+                Eigen::VectorXd stateDerivative( 6 );
+                stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+                stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+                return stateDerivative;
+            };
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState( 0 ) = 1.0;
+    initialState( 4 ) = 1.0;
+
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            rungeKuttaVariableStepSettingsScalarTolerances< double >( 0.05, rungeKuttaFehlberg78, 1.0E-6, 1.0, 1.0E-12, 1.0E-12 );
+
+    // Propagate with and without terminal event (y = 0 on descending node, at t = pi), with a final time after the event
+    std::vector< std::map< double, Eigen::VectorXd > > stateHistories;
+    std::shared_ptr< IntegrationEventLocator< double, Eigen::VectorXd, Eigen::VectorXd, double > > eventLocator;
+    for( unsigned int useEvent = 0; useEvent < 2; useEvent++ )
+    {
+        if( useEvent == 1 )
+        {
+            eventLocator = std::make_shared< IntegrationEventLocator< double, Eigen::VectorXd, Eigen::VectorXd, double > >(
+                    std::vector< std::shared_ptr< IntegrationEventSettings< double, Eigen::VectorXd > > >(
+                            { std::make_shared< IntegrationEventSettings< double, Eigen::VectorXd > >(
+                                    "descending_node",
+                                    []( const double time, const Eigen::VectorXd& state ) { return state( 1 ); },
+                                    decreasing_event_crossing,
+                                    true ) } ) );
+        }
+
+        std::shared_ptr< SingleArcSimulationResults< double, double > > simulationResults =
+                std::make_shared< SingleArcSimulationResults< double, double > >(
+                        std::map< IntegratedStateType, std::vector< std::tuple< std::string, std::string, PropagatorType > > >( ),
+                        std::make_shared< SingleArcPropagatorProcessingSettings >( ),
+                        []( std::map< double, Eigen::VectorXd >& processedSolution, const std::map< double, Eigen::VectorXd >& rawSolution ) {
+                            processedSolution = rawSolution;
+                        },
+                        nullptr );
+        integrateEquationsFromIntegrator< SingleArcSimulationResults< double, double >, Eigen::VectorXd, double, double >(
+                createIntegrator< double, Eigen::VectorXd >( stateDerivativeFunction, initialState, 0.0, integratorSettings ),
+                std::make_shared< FixedTimePropagationTerminationCondition >( 5.0, true ),
+                simulationResults,
+                std::function< Eigen::VectorXd( ) >( ),
+                std::function< void( Eigen::VectorXd& ) >( ),
+                std::make_shared< SingleArcPropagatorProcessingSettings >( ),
+                eventLocator );
+        simulationResults->finalizePropagation( std::map< double, unsigned int >( ) );
+
+        BOOST_CHECK_EQUAL( simulationResults->getPropagationTerminationReason( )->getPropagationTerminationReason( ),
+                           termination_condition_reached );
+        stateHistories.push_back( simulationResults->getEquationsOfMotionNumericalSolutionRaw( ) );
+    }
+
+    // Retrieve terminal event, located on dense output
+    BOOST_CHECK( eventLocator->getTerminalEventIsLocated( ) );
+    const LocatedIntegrationEvent< double, Eigen::VectorXd > terminalEvent = eventLocator->getTerminalEvent( );
+    const double eventTime = terminalEvent.independentVariable_;
+    BOOST_CHECK_EQUAL( terminalEvent.isIncreasing_, false );
+    // Event is located on the cubic Hermite interpolant of the step, so its time is less accurate than the integrated states
+    BOOST_CHECK_SMALL( eventTime - mathematical_constants::PI, 1.0E-8 );
+
+    // Check that the event falls strictly inside a step of the propagation without events
+    const std::map< double, Eigen::VectorXd >& referenceStateHistory = stateHistories.at( 0 );
+    std::map< double, Eigen::VectorXd >::const_iterator stepEndIterator = referenceStateHistory.upper_bound( eventTime );
+    BOOST_CHECK( stepEndIterator != referenceStateHistory.end( ) );
+    const double stepEndTime = stepEndIterator->first;
+    const double stepStartTime = std::prev( stepEndIterator )->first;
+    BOOST_CHECK( eventTime - stepStartTime > 1.0E-3 * ( stepEndTime - stepStartTime ) );
+    BOOST_CHECK( stepEndTime - eventTime > 1.0E-3 * ( stepEndTime - stepStartTime ) );
+
+    // Check that propagation with event takes the same steps up to the step containing the event, and ends at the event
+    const std::map< double, Eigen::VectorXd >& eventStateHistory = stateHistories.at( 1 );
+    BOOST_CHECK_EQUAL( static_cast< int >( eventStateHistory.size( ) ),
+                       static_cast< int >( std::distance( referenceStateHistory.begin( ), stepEndIterator ) ) + 1 );
+    std::map< double, Eigen::VectorXd >::const_iterator referenceIterator = referenceStateHistory.begin( );
+    for( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = eventStateHistory.begin( );
+         stateIterator != std::prev( eventStateHistory.end( ) );
+         stateIterator++ )
+    {
+        BOOST_CHECK_EQUAL( stateIterator->first, referenceIterator->first );
+        referenceIterator++;
+    }
+    BOOST_CHECK_EQUAL( std::prev( eventStateHistory.end( ) )->first, eventTime );
+
+    // Check final state (from redone step) against state of located event (from dense output), and against analytical solution
+    const Eigen::VectorXd finalState = std::prev( eventStateHistory.end( ) )->second;
+    Eigen::VectorXd analyticalFinalState = Eigen::VectorXd::Zero( 6 );
+    analyticalFinalState << std::cos( eventTime ), std::sin( eventTime ), 0.0, -std::sin( eventTime ), std::cos( eventTime ), 0.0;
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( finalState( i ) - terminalEvent.state_( i ), 1.0E-6 );
+        BOOST_CHECK_SMALL( finalState( i ) - analyticalFinalState( i ), 1.0E-10 );
+    }
+    BOOST_CHECK_SMALL( finalState( 1 ), 1.0E-8 );
+}
+
+//! Test whether integration events defined in the propagator settings are located by the dynamics simulator, and whether a terminal
+//! event terminates the propagation.
+BOOST_AUTO_TEST_CASE( testIntegrationEventsInDynamicsSimulator )
+{
+    using namespace tudat::simulation_setup;
+    using namespace tudat::numerical_integrators;
+    using namespace tudat::propagators;
+
+    // Create point-mass Earth
+    const double earthGravitationalParameter = 3.986004418E14;
+    BodyListSettings bodySettings( "Earth", "ECLIPJ2000" );
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ] = { pointMassGravityAcceleration( ) };
+    basic_astrodynamics::AccelerationMap accelerationModelMap =
+            createAccelerationModelsMap( bodies, accelerationSettingsMap, { "Vehicle" }, { "Earth" } );
+
+    // Define circular orbit with 45 degree inclination, starting just after the ascending node
+    const double orbitRadius = 7000.0E3;
+    const double inclination = mathematical_constants::PI / 4.0;
+    const double initialArgumentOfLatitude = 0.1;
+    const double meanMotion = std::sqrt( earthGravitationalParameter / std::pow( orbitRadius, 3.0 ) );
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState << orbitRadius * std::cos( initialArgumentOfLatitude ),
+            orbitRadius * std::sin( initialArgumentOfLatitude ) * std::cos( inclination ),
+            orbitRadius * std::sin( initialArgumentOfLatitude ) * std::sin( inclination ),
+            -orbitRadius * meanMotion * std::sin( initialArgumentOfLatitude ),
+            orbitRadius * meanMotion * std::cos( initialArgumentOfLatitude ) * std::cos( inclination ),
+            orbitRadius * meanMotion * std::cos( initialArgumentOfLatitude ) * std::sin( inclination );
+
+    // Locate node crossings, and terminate at southernmost point of orbit (before the final time)
+    const double orbitalPeriod = 2.0 * mathematical_constants::PI / meanMotion;
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                    { "Earth" },
+                    accelerationModelMap,
+                    { "Vehicle" },
+                    initialState,
+                    0.0,
+                    rungeKuttaVariableStepSettingsScalarTolerances< double >( 10.0, rungeKuttaFehlberg78, 1.0E-3, 1.0E4, 1.0E-12, 1.0E-12 ),
+                    propagationTimeTerminationSettings( 2.0 * orbitalPeriod ) );
+    propagatorSettings->setIntegrationEventSettings(
+            { std::make_shared< IntegrationEventSettings< double, Eigen::VectorXd > >(
+                      "node", []( const double, const Eigen::VectorXd& state ) { return state( 2 ); } ),
+              std::make_shared< IntegrationEventSettings< double, Eigen::VectorXd > >(
+                      "southernmost_point",
+                      []( const double, const Eigen::VectorXd& state ) { return state( 5 ); },
+                      increasing_event_crossing,
+                      true ) } );
+
+    SingleArcDynamicsSimulator< double > dynamicsSimulator( bodies, propagatorSettings );
+    std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+            dynamicsSimulator.getSingleArcPropagationResults( );
+
+    // Check that descending node and southernmost point are located, and that propagation is terminated at the latter
+    BOOST_CHECK( propagationResults->integrationCompletedSuccessfully( ) );
+    const std::vector< SingleArcSimulationResults< double, double >::LocatedEvent >& locatedEvents =
+            propagationResults->getLocatedIntegrationEvents( );
+    BOOST_CHECK_EQUAL( locatedEvents.size( ), 2 );
+    BOOST_CHECK_EQUAL( propagationResults->getLocatedIntegrationEvents( "node" ).size( ), 1 );
+
+    BOOST_CHECK_EQUAL( locatedEvents.at( 0 ).eventName_, "node" );
+    BOOST_CHECK_EQUAL( locatedEvents.at( 0 ).isIncreasing_, false );
+    BOOST_CHECK_EQUAL( locatedEvents.at( 0 ).isTerminal_, false );
+    BOOST_CHECK_SMALL( locatedEvents.at( 0 ).independentVariable_ -
+                               ( mathematical_constants::PI - initialArgumentOfLatitude ) / meanMotion,
+                       1.0E-3 );
+    BOOST_CHECK_SMALL( locatedEvents.at( 0 ).state_( 2 ), 1.0E-3 );
+
+    BOOST_CHECK_EQUAL( locatedEvents.at( 1 ).eventName_, "southernmost_point" );
+    BOOST_CHECK_EQUAL( locatedEvents.at( 1 ).isTerminal_, true );
+    const double terminalEventTime = locatedEvents.at( 1 ).independentVariable_;
+    BOOST_CHECK_SMALL( terminalEventTime - ( 1.5 * mathematical_constants::PI - initialArgumentOfLatitude ) / meanMotion, 1.0E-3 );
+
+    // Check that propagation ends at terminal event (with event time only as accurate as dense output, ~1.0E-6 s here)
+    std::map< double, Eigen::VectorXd > stateHistory = propagationResults->getEquationsOfMotionNumericalSolution( );
+    BOOST_CHECK_EQUAL( stateHistory.rbegin( )->first, terminalEventTime );
+    BOOST_CHECK_SMALL( stateHistory.rbegin( )->second( 5 ), 1.0E-4 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -0,0 +1,217 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
+#include "tudat/simulation/propagation_setup/fusedDependentVariables.h"
+#include "tudat/simulation/propagation_setup/propagationOutput.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace simulation_setup;
+using namespace propagators;
+
+//! Function to set states and rotation of the bodies used in the test at a given time
+void setFusedDependentVariableTestEnvironment( const SystemOfBodies& bodies, const double time )
+{
+    Eigen::Vector6d earthState;
+    earthState << 1.4E11 + 1.0E3 * time, -5.0E10, 2.0E7, 1.0E4, 2.9E4, -3.0;
+    bodies.at( "Earth" )->setState( earthState );
+
+    Eigen::Vector6d moonState = earthState;
+    moonState.segment( 0, 3 ) += Eigen::Vector3d( 3.8E8 * std::cos( 2.7E-6 * time ), 3.8E8 * std::sin( 2.7E-6 * time ), 3.0E7 );
+    moonState.segment( 3, 3 ) += Eigen::Vector3d( -1.0E3 * std::sin( 2.7E-6 * time ), 1.0E3 * std::cos( 2.7E-6 * time ), 10.0 );
+    bodies.at( "Moon" )->setState( moonState );
+
+    Eigen::Vector6d vehicleState = earthState;
+    vehicleState.segment( 0, 3 ) += Eigen::Vector3d( 7.0E6 * std::cos( 1.0E-3 * time ), 7.0E6 * std::sin( 1.0E-3 * time ), 1.0E5 );
+    vehicleState.segment( 3, 3 ) += Eigen::Vector3d( -7.0E3 * std::sin( 1.0E-3 * time ), 7.0E3 * std::cos( 1.0E-3 * time ), 2.0E3 );
+    bodies.at( "Vehicle" )->setState( vehicleState );
+
+    bodies.at( "Earth" )->setCurrentRotationToLocalFrameFromEphemeris( time );
+}
+
+//! Function to create the environment used in the test
+SystemOfBodies createFusedDependentVariableTestBodies( )
+{
+    SystemOfBodies bodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth" );
+    bodies.createEmptyBody( "Moon" );
+    bodies.createEmptyBody( "Vehicle" );
+
+    bodies.at( "Earth" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.at( "Moon" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 4.9048695E12 ) );
+    bodies.at( "Earth" )->setRotationalEphemeris(
+            std::make_shared< ephemerides::SimpleRotationalEphemeris >( 0.1, 1.2, 0.3, 7.292115E-5, 0.0, "ECLIPJ2000", "IAU_Earth" ) );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 500.0 );
+    return bodies;
+}
+
+//! Function to create list of dependent variables used in the test
+std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > getFusedDependentVariableTestSettings( )
+{
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( relativePositionDependentVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( relativeVelocityDependentVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( relativeDistanceDependentVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( relativeSpeedDependentVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( bodyMassVariable( "Vehicle" ) );
+    dependentVariables.push_back( keplerianStateDependentVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( modifiedEquinoctialStateDependentVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( keplerianStateDependentVariable( "Moon", "Earth" ) );
+    dependentVariables.push_back( tnwToInertialFrameRotationMatrixVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( rswToInertialFrameRotationMatrixVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( inertialToBodyFixedRotationMatrixVariable( "Earth" ) );
+    dependentVariables.push_back( eulerAnglesToBodyFixed313Variable( "Earth" ) );
+    dependentVariables.push_back( centralBodyFixedCartesianPositionVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( centralBodyFixedSphericalPositionVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( relativePositionDependentVariable( "Moon", "SSB" ) );
+    dependentVariables.push_back(
+            std::make_shared< SingleDependentVariableSaveSettings >( keplerian_state_dependent_variable, "Vehicle", "Earth", 1 ) );
+    dependentVariables.push_back(
+            std::make_shared< SingleDependentVariableSaveSettings >( relative_position_dependent_variable, "Moon", "Vehicle", 2 ) );
+    return dependentVariables;
+}
+
+//! Function to create the regular (non-fused) function returning a dependent variable, in vector form
+std::function< Eigen::VectorXd( ) > getSeparateDependentVariableFunction(
+        const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariable,
+        const SystemOfBodies& bodies )
+{
+    if( isScalarDependentVariable( dependentVariable, bodies ) )
+    {
+        return std::bind( &getVectorFromDoubleFunction, getDoubleDependentVariableFunction( dependentVariable, bodies ) );
+    }
+    else
+    {
+        return getVectorDependentVariableFunction( dependentVariable, bodies ).first;
+    }
+}
+
+//! Function to evaluate list of dependent variables one by one, using the regular dependent variable functions
+Eigen::VectorXd evaluateDependentVariablesSeparately(
+        const std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > >& dependentVariables,
+        const SystemOfBodies& bodies )
+{
+    std::vector< Eigen::VectorXd > dependentVariableValues;
+    int totalSize = 0;
+    for( unsigned int i = 0; i < dependentVariables.size( ); i++ )
+    {
+        dependentVariableValues.push_back( getSeparateDependentVariableFunction( dependentVariables.at( i ), bodies )( ) );
+        totalSize += dependentVariableValues.back( ).rows( );
+    }
+
+    Eigen::VectorXd concatenatedValues( totalSize );
+    int currentIndex = 0;
+    for( unsigned int i = 0; i < dependentVariableValues.size( ); i++ )
+    {
+        concatenatedValues.segment( currentIndex, dependentVariableValues.at( i ).rows( ) ) = dependentVariableValues.at( i );
+        currentIndex += dependentVariableValues.at( i ).rows( );
+    }
+    return concatenatedValues;
+}
+
+BOOST_AUTO_TEST_SUITE( test_fused_dependent_variables )
+
+//! Test whether fused evaluation of dependent variables is identical to separate evaluation
+BOOST_AUTO_TEST_CASE( testFusedDependentVariableEvaluation )
+{
+    SystemOfBodies bodies = createFusedDependentVariableTestBodies( );
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables =
+            getFusedDependentVariableTestSettings( );
+
+    // Create fused engine directly
+    FusedDependentVariableEngine dependentVariableEngine;
+    for( unsigned int i = 0; i < dependentVariables.size( ); i++ )
+    {
+        if( !dependentVariableEngine.addFusedDependentVariable( dependentVariables.at( i ), bodies ) )
+        {
+            dependentVariableEngine.addDependentVariableFunction(
+                    getSeparateDependentVariableFunction( dependentVariables.at( i ), bodies ),
+                    getDependentVariableSaveSize( dependentVariables.at( i ), bodies ) );
+        }
+    }
+
+    // Check that only the body mass is computed separately, and that relative states/rotations are shared
+    BOOST_CHECK_EQUAL( dependentVariableEngine.getNumberOfFusedDependentVariables( ), dependentVariables.size( ) - 1 );
+    BOOST_CHECK_EQUAL( dependentVariableEngine.getNumberOfSharedIntermediates( ), 5 );
+
+    // Create dependent variable function as used in propagation
+    std::map< std::pair< int, int >, std::shared_ptr< SingleDependentVariableSaveSettings > > orderedDependentVariables;
+    std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >, std::string > > dependentVariableFunction =
+            createDependentVariableListFunction< double, double >(
+                    dependentVariables,
+                    bodies,
+                    orderedDependentVariables,
+                    std::unordered_map< IntegratedStateType,
+                                        std::vector< std::shared_ptr< SingleStateTypeDerivative< double, double > > > >( ) );
+    BOOST_CHECK_EQUAL( dependentVariableFunction.second.size( ), dependentVariables.size( ) );
+
+    ColumnarDependentVariableHistory< double > dependentVariableHistory( dependentVariableEngine.getTotalSize( ), 2 );
+    std::vector< Eigen::VectorXd > expectedValues;
+    for( int i = 0; i < 10; i++ )
+    {
+        const double currentTime = 3600.0 * i;
+        setFusedDependentVariableTestEnvironment( bodies, currentTime );
+
+        Eigen::VectorXd separateValues = evaluateDependentVariablesSeparately( dependentVariables, bodies );
+        Eigen::VectorXd fusedValues = dependentVariableEngine.getDependentVariables( );
+        Eigen::VectorXd listFunctionValues = dependentVariableFunction.first( );
+
+        BOOST_CHECK_EQUAL( separateValues.rows( ), fusedValues.rows( ) );
+        BOOST_CHECK_EQUAL( separateValues.rows( ), listFunctionValues.rows( ) );
+        for( int j = 0; j < separateValues.rows( ); j++ )
+        {
+            BOOST_CHECK_SMALL( fusedValues( j ) - separateValues( j ), 1.0E-15 * std::max( 1.0, std::fabs( separateValues( j ) ) ) );
+            BOOST_CHECK_SMALL( listFunctionValues( j ) - separateValues( j ),
+                               1.0E-15 * std::max( 1.0, std::fabs( separateValues( j ) ) ) );
+        }
+
+        dependentVariableHistory.addEpoch( currentTime, dependentVariableEngine );
+        expectedValues.push_back( fusedValues );
+    }
+
+    // Check columnar history (which has been resized during filling)
+    BOOST_CHECK_EQUAL( dependentVariableHistory.getNumberOfEpochs( ), 10 );
+    std::map< double, Eigen::VectorXd > dependentVariableHistoryMap = dependentVariableHistory.getDependentVariableHistoryMap( );
+    for( int i = 0; i < 10; i++ )
+    {
+        BOOST_CHECK_EQUAL( dependentVariableHistory.getTimes( ).at( i ), 3600.0 * i );
+        for( int j = 0; j < dependentVariableEngine.getTotalSize( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( dependentVariableHistory.getVariableHistory( j )( i ), expectedValues.at( i )( j ) );
+            BOOST_CHECK_EQUAL( dependentVariableHistoryMap.at( 3600.0 * i )( j ), expectedValues.at( i )( j ) );
+        }
+    }
+
+    // Check wrong sizes are caught
+    Eigen::VectorXd wrongSizeVector = Eigen::VectorXd::Zero( dependentVariableEngine.getTotalSize( ) + 1 );
+    BOOST_CHECK_THROW( dependentVariableEngine.evaluateDependentVariables( wrongSizeVector ), std::runtime_error );
+    ColumnarDependentVariableHistory< double > wrongSizeHistory( dependentVariableEngine.getTotalSize( ) - 1 );
+    BOOST_CHECK_THROW( wrongSizeHistory.addEpoch( 0.0, dependentVariableEngine ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+
+}  // namespace tudat
@@ -145,6 +145,113 @@ BOOST_AUTO_TEST_CASE( testEihPropagation )
     }
 }
 
+//! Test the EIH interaction kernel, which computes the pairwise geometry only for the upper triangle of body pairs, and
+//! sums the expansion terms without storing them individually, against the quantities computed directly from the body
+//! states, and against the individual expansion terms (which are computed only on request).
+BOOST_AUTO_TEST_CASE( testEihInteractionKernel )
+{
+    using namespace tudat::relativity;
+
+    // Create a 20-body system with arbitrary states and gravitational parameters
+    const int numberOfBodies = 20;
+    std::vector< Eigen::Vector6d > bodyStates;
+    std::vector< double > gravitationalParameters;
+    std::vector< std::string > bodyNames;
+    std::vector< std::function< double( ) > > gravitationalParameterFunctions;
+    std::vector< std::function< Eigen::Matrix< double, 6, 1 >( ) > > bodyStateFunctions;
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        Eigen::Vector6d bodyState;
+        bodyState << 1.0E11 * std::sin( 1.3 * i ), 1.0E11 * std::cos( 2.1 * i + 0.5 ), 1.0E10 * std::sin( 0.7 * i + 0.2 ),
+                3.0E4 * std::cos( 1.1 * i ), 3.0E4 * std::sin( 0.9 * i + 0.3 ), 3.0E3 * std::cos( 1.7 * i );
+        bodyStates.push_back( bodyState );
+        gravitationalParameters.push_back( 1.0E17 * ( 1.5 + std::sin( 3.1 * i ) ) );
+        bodyNames.push_back( "Body" + std::to_string( i ) );
+    }
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        gravitationalParameterFunctions.push_back( [ = ]( ) { return gravitationalParameters.at( i ); } );
+        bodyStateFunctions.push_back( [ = ]( ) { return bodyStates.at( i ); } );
+    }
+
+    // Only the first bodies undergo an acceleration
+    const int numberOfAcceleratedBodies = 15;
+    std::vector< std::string > acceleratedBodyNames( bodyNames.begin( ), bodyNames.begin( ) + numberOfAcceleratedBodies );
+
+    std::function< double( ) > ppnParameterFunction = []( ) { return 1.0; };
+    EinsteinInfeldHoffmannEquations eihEquations( acceleratedBodyNames,
+                                                  bodyNames,
+                                                  gravitationalParameterFunctions,
+                                                  bodyStateFunctions,
+                                                  ppnParameterFunction,
+                                                  ppnParameterFunction );
+    eihEquations.update( 0.0 );
+
+    for( int i = 0; i < numberOfAcceleratedBodies; i++ )
+    {
+        Eigen::Vector3d accelerationFromExpansionTerms = Eigen::Vector3d::Zero( );
+        for( int j = 0; j < numberOfBodies; j++ )
+        {
+            if( i != j )
+            {
+                // Check pairwise geometry against direct computation, for both orderings of the body pair
+                Eigen::Vector3d relativePosition = bodyStates.at( j ).segment( 0, 3 ) - bodyStates.at( i ).segment( 0, 3 );
+                Eigen::Vector3d relativeVelocity = bodyStates.at( j ).segment( 3, 3 ) - bodyStates.at( i ).segment( 3, 3 );
+                for( int k = 0; k < 3; k++ )
+                {
+                    BOOST_CHECK_SMALL( eihEquations.getRelativePositions( i, j )( k ) - relativePosition( k ),
+                                       std::numeric_limits< double >::epsilon( ) * relativePosition.norm( ) );
+                    BOOST_CHECK_SMALL( eihEquations.getRelativePositions( j, i )( k ) + relativePosition( k ),
+                                       std::numeric_limits< double >::epsilon( ) * relativePosition.norm( ) );
+                    BOOST_CHECK_SMALL( eihEquations.getRelativeVelocity( i, j )( k ) - relativeVelocity( k ),
+                                       std::numeric_limits< double >::epsilon( ) * relativeVelocity.norm( ) );
+                    BOOST_CHECK_SMALL( eihEquations.getRelativeVelocity( j, i )( k ) + relativeVelocity( k ),
+                                       std::numeric_limits< double >::epsilon( ) * relativeVelocity.norm( ) );
+                }
+                BOOST_CHECK_CLOSE_FRACTION(
+                        eihEquations.getRelativeDistance( i, j ), relativePosition.norm( ), std::numeric_limits< double >::epsilon( ) );
+                BOOST_CHECK_CLOSE_FRACTION( eihEquations.getInverseSquareDistance( j, i ),
+                                            1.0 / relativePosition.squaredNorm( ),
+                                            std::numeric_limits< double >::epsilon( ) );
+                BOOST_CHECK_CLOSE_FRACTION( eihEquations.getSingleSourceLocalPotential( i, j ),
+                                            gravitationalParameters.at( j ) / relativePosition.norm( ),
+                                            4.0 * std::numeric_limits< double >::epsilon( ) );
+                BOOST_CHECK_CLOSE_FRACTION( eihEquations.getLineOfSighSpeed( i, j ),
+                                            relativePosition.dot( bodyStates.at( j ).segment( 3, 3 ) ),
+                                            1.0E-12 );
+
+                // Recompute acceleration from the individual expansion terms
+                double scalarTerm = 0.0;
+                for( int k = 0; k < 7; k++ )
+                {
+                    scalarTerm += eihEquations.getScalarEihCorrection( k, i, j );
+                }
+                Eigen::Vector3d vectorTerm = Eigen::Vector3d::Zero( );
+                for( int k = 0; k < 3; k++ )
+                {
+                    vectorTerm += eihEquations.getVectorEihCorrection( k, i, j );
+                }
+                BOOST_CHECK_CLOSE_FRACTION( eihEquations.getTotalScalarTermCorrection( i, j ), scalarTerm, 1.0E-13 );
+                for( int k = 0; k < 3; k++ )
+                {
+                    BOOST_CHECK_SMALL( eihEquations.getTotalVectorTermCorrection( i, j )( k ) - vectorTerm( k ),
+                                       1.0E-13 * vectorTerm.norm( ) );
+                }
+
+                accelerationFromExpansionTerms += eihEquations.getSinglePointMassAccelerations( i, j ) *
+                                ( 1.0 + scalarTerm * physical_constants::INVERSE_SQUARE_SPEED_OF_LIGHT ) +
+                        eihEquations.getSingleSourceLocalPotential( i, j ) * vectorTerm * physical_constants::INVERSE_SQUARE_SPEED_OF_LIGHT;
+            }
+        }
+
+        for( int k = 0; k < 3; k++ )
+        {
+            BOOST_CHECK_SMALL( eihEquations.getAccelerationOfBody( i )( k ) - accelerationFromExpansionTerms( k ),
+                               1.0E-14 * accelerationFromExpansionTerms.norm( ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
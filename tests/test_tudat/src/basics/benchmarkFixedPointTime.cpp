@@ -0,0 +1,132 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Benchmark of Time and FixedPointTime in propagation, light-time and conversion workloads. Built only if
+ *    TUDAT_BUILD_BENCHMARKS is set, and not run as part of the unit tests.
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/fixedPointTime.h"
+#include "tudat/math/integrators/rungeKutta4Integrator.h"
+
+using namespace tudat;
+
+//! Function to compute the state derivative of a Kepler orbit
+Eigen::Vector6d computeKeplerStateDerivative( const Eigen::Vector6d& state )
+{
+    Eigen::Vector6d stateDerivative;
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -3.986004418E14 * state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+    return stateDerivative;
+}
+
+//! Function to integrate a Kepler orbit with a fixed-step RK4 integrator, using a given time type
+template< typename TimeType >
+Eigen::Vector6d integrateKeplerOrbit( const TimeType initialTime, const int numberOfSteps, double& elapsedSeconds )
+{
+    Eigen::Vector6d initialState;
+    initialState << 7000.0E3, 0.0, 0.0, 0.0, 7.5E3, 1.0E3;
+
+    std::chrono::steady_clock::time_point startClock = std::chrono::steady_clock::now( );
+    numerical_integrators::RungeKutta4Integrator< TimeType, Eigen::Vector6d, Eigen::Vector6d, double > integrator(
+            [ = ]( const TimeType time, const Eigen::Vector6d& state ) { return computeKeplerStateDerivative( state ); },
+            initialTime,
+            initialState,
+            10.0 );
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        integrator.performIntegrationStep( 10.0 );
+    }
+    elapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startClock ).count( );
+
+    return integrator.getCurrentState( );
+}
+
+//! Function to solve one-way light-time equations for a list of reception times, using a given time type
+template< typename TimeType >
+std::vector< double > computeLightTimes( const std::vector< TimeType >& receptionTimes,
+                                        const TimeType& referenceTime,
+                                        double& elapsedSeconds )
+{
+    const double speedOfLight = 299792458.0;
+    const double orbitRadius = 1.5E11;
+    const double meanMotion = 2.0E-7;
+    const Eigen::Vector3d receiverPosition( 6378.0E3, 0.0, 0.0 );
+
+    std::chrono::steady_clock::time_point startClock = std::chrono::steady_clock::now( );
+    std::vector< double > lightTimes( receptionTimes.size( ) );
+    for( unsigned int i = 0; i < receptionTimes.size( ); i++ )
+    {
+        double lightTime = 0.0;
+        TimeType transmissionTime = receptionTimes.at( i );
+        for( int j = 0; j < 4; j++ )
+        {
+            const double secondsSinceReference = static_cast< double >( transmissionTime - referenceTime );
+            const Eigen::Vector3d transmitterPosition( orbitRadius * std::cos( meanMotion * secondsSinceReference ),
+                                                       orbitRadius * std::sin( meanMotion * secondsSinceReference ),
+                                                       0.0 );
+            lightTime = ( transmitterPosition - receiverPosition ).norm( ) / speedOfLight;
+            transmissionTime = receptionTimes.at( i ) - lightTime;
+        }
+        lightTimes[ i ] = lightTime;
+    }
+    elapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startClock ).count( );
+    return lightTimes;
+}
+
+int main( )
+{
+    // Propagate Kepler orbit with both time types
+    const int numberOfSteps = 100000;
+    double timeElapsedSeconds, fixedPointTimeElapsedSeconds;
+    Eigen::Vector6d finalStateTime = integrateKeplerOrbit< Time >( Time( 8.0E8L ), numberOfSteps, timeElapsedSeconds );
+    Eigen::Vector6d finalStateFixedPointTime =
+            integrateKeplerOrbit< FixedPointTime >( FixedPointTime( 8.0E8 ), numberOfSteps, fixedPointTimeElapsedSeconds );
+    std::cout << "RK4 propagation of " << numberOfSteps << " steps: Time " << timeElapsedSeconds << " s, FixedPointTime "
+              << fixedPointTimeElapsedSeconds << " s (final position difference "
+              << ( finalStateTime - finalStateFixedPointTime ).segment( 0, 3 ).norm( ) << " m)" << std::endl;
+
+    // Solve light-time equations with both time types
+    const int numberOfObservations = 200000;
+    std::vector< double > receptionSeconds( numberOfObservations );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        receptionSeconds[ i ] = 8.0E8 + 60.0 * i + 1.0E-7 * ( i % 7 );
+    }
+    std::vector< FixedPointTime > fixedPointReceptionTimes = convertSecondsToFixedPointTimes( receptionSeconds );
+    std::vector< Time > receptionTimes = convertFixedPointTimesToTimes( fixedPointReceptionTimes );
+
+    std::vector< double > lightTimesTime = computeLightTimes< Time >( receptionTimes, Time( 7.9E8L ), timeElapsedSeconds );
+    std::vector< double > lightTimesFixedPointTime =
+            computeLightTimes< FixedPointTime >( fixedPointReceptionTimes, FixedPointTime( 7.9E8 ), fixedPointTimeElapsedSeconds );
+    std::cout << "Light-time solution for " << numberOfObservations << " observations: Time " << timeElapsedSeconds
+              << " s, FixedPointTime " << fixedPointTimeElapsedSeconds << " s" << std::endl;
+
+    // Convert reception times to seconds since reference
+    std::chrono::steady_clock::time_point startClock = std::chrono::steady_clock::now( );
+    std::vector< double > secondsSinceReferenceTime( numberOfObservations );
+    const Time referenceTime( 7.9E8L );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        secondsSinceReferenceTime[ i ] = static_cast< double >( receptionTimes[ i ] - referenceTime );
+    }
+    timeElapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startClock ).count( );
+
+    startClock = std::chrono::steady_clock::now( );
+    std::vector< double > secondsSinceReferenceFixedPointTime =
+            computeSecondsSinceReferenceTime( fixedPointReceptionTimes, FixedPointTime( 7.9E8 ) );
+    fixedPointTimeElapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startClock ).count( );
+    std::cout << "Batch conversion of " << numberOfObservations << " times: Time " << timeElapsedSeconds << " s, FixedPointTime "
+              << fixedPointTimeElapsedSeconds << " s" << std::endl;
+
+    return 0;
+}
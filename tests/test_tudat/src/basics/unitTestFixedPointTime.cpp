@@ -0,0 +1,304 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/fixedPointTime.h"
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/integrators/rungeKutta4Integrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_fixed_point_time )
+
+using namespace mathematical_constants;
+
+//! Test construction, normalization and conversion of FixedPointTime objects
+BOOST_AUTO_TEST_CASE( testFixedPointTimeConstructionAndConversion )
+{
+    // Check normalization of positive and negative input
+    FixedPointTime testTime( 759, 2.0 * 3600.0 + PI );
+    BOOST_CHECK_EQUAL( testTime.getFullPeriods( ), 761 );
+    BOOST_CHECK_CLOSE_FRACTION( testTime.getSecondsIntoFullPeriod( ), ( 2.0 * 3600.0 + PI ) - 2.0 * 3600.0, 1.0E-15 );
+
+    testTime = FixedPointTime( 759, -2.0 * 3600.0 - PI );
+    BOOST_CHECK_EQUAL( testTime.getFullPeriods( ), 756 );
+    BOOST_CHECK_CLOSE_FRACTION( testTime.getSecondsIntoFullPeriod( ), 3600.0 - ( ( 2.0 * 3600.0 + PI ) - 2.0 * 3600.0 ), 1.0E-15 );
+
+    // Check that double input is represented to within 1 fs (or double precision of input)
+    const double secondsSinceEpoch = 8.5E8 + 0.123456789;
+    testTime = FixedPointTime( secondsSinceEpoch );
+    BOOST_CHECK_EQUAL( testTime.getSeconds< double >( ), secondsSinceEpoch );
+    BOOST_CHECK_EQUAL( static_cast< double >( testTime ), secondsSinceEpoch );
+    BOOST_CHECK_EQUAL( FixedPointTime( -secondsSinceEpoch ).getSeconds< double >( ), -secondsSinceEpoch );
+    const double tickDuration = 1.0 / static_cast< double >( FIXED_POINT_TIME_TICKS_PER_SECOND );
+    BOOST_CHECK_EQUAL( FixedPointTime( tickDuration ).getTicksIntoFullPeriod( ), 1 );
+    BOOST_CHECK_EQUAL( FixedPointTime( -tickDuration ).getTicksIntoFullPeriod( ), FIXED_POINT_TIME_TICKS_PER_PERIOD - 1 );
+    BOOST_CHECK_EQUAL( FixedPointTime( -tickDuration ).getFullPeriods( ), -1 );
+    BOOST_CHECK_EQUAL( static_cast< int >( FixedPointTime( 7201 ) ), 7201 );
+
+    // Check that long double input is retained beyond double precision
+    const long double longSecondsSinceEpoch = 8.5E8L + LONG_PI * 1.0E-3L;
+    FixedPointTime longTestTime( longSecondsSinceEpoch );
+    BOOST_CHECK_SMALL( static_cast< double >( longTestTime.getSeconds< long double >( ) - longSecondsSinceEpoch ), 2.0E-15 );
+    BOOST_CHECK_SMALL( static_cast< double >( ( longTestTime - FixedPointTime( 8.5E8 ) ).getSeconds< long double >( ) -
+                                              ( longSecondsSinceEpoch - 8.5E8L ) ),
+                       1.0E-15 );
+
+    // Check conversion to and from Time
+    Time time( 2, LONG_PI );
+    FixedPointTime convertedTime( time );
+    BOOST_CHECK_EQUAL( convertedTime.getFullPeriods( ), 2 );
+    BOOST_CHECK_EQUAL( convertedTime.getTicksIntoFullPeriod( ),
+                       std::llround( LONG_PI * static_cast< long double >( FIXED_POINT_TIME_TICKS_PER_SECOND ) ) );
+    Time reconvertedTime = convertedTime.getTime( );
+    BOOST_CHECK_EQUAL( reconvertedTime.getFullPeriods( ), 2 );
+    BOOST_CHECK_SMALL( static_cast< double >( reconvertedTime.getSecondsIntoFullPeriod( ) - LONG_PI ), 1.0E-15 );
+
+    // Check batch conversions (round trip to double exact for values resolved by the fixed-point ticks)
+    std::vector< double > secondsList = { -1.0E9, -PI, 0.0, 1.0 / 1024.0, 3600.0, 4.0E8 + 0.25, 3.0E10 + 1.0E-5 };
+    std::vector< FixedPointTime > fixedPointTimes = convertSecondsToFixedPointTimes( secondsList );
+    std::vector< double > reconvertedSecondsList = convertFixedPointTimesToSeconds( fixedPointTimes );
+    std::vector< double > secondsSinceReference = computeSecondsSinceReferenceTime( fixedPointTimes, FixedPointTime( 4.0E8 ) );
+    std::vector< Time > times = convertFixedPointTimesToTimes( fixedPointTimes );
+    std::vector< FixedPointTime > reconvertedFixedPointTimes = convertTimesToFixedPointTimes( times );
+    for( unsigned int i = 0; i < secondsList.size( ); i++ )
+    {
+        BOOST_CHECK( fixedPointTimes.at( i ) == FixedPointTime( secondsList.at( i ) ) );
+        BOOST_CHECK_EQUAL( reconvertedSecondsList.at( i ), secondsList.at( i ) );
+        BOOST_CHECK_CLOSE_FRACTION( secondsSinceReference.at( i ), secondsList.at( i ) - 4.0E8, 1.0E-15 );
+        BOOST_CHECK( reconvertedFixedPointTimes.at( i ) == fixedPointTimes.at( i ) );
+        BOOST_CHECK_EQUAL( times.at( i ).getFullPeriods( ), fixedPointTimes.at( i ).getFullPeriods( ) );
+    }
+}
+
+//! Test arithmetic and comparison operations of FixedPointTime objects, compared to Time objects
+BOOST_AUTO_TEST_CASE( testFixedPointTimeArithmetic )
+{
+    Time time1( 759, 2566.8309405984728595902L );
+    Time time2( 29709787, 1432.48492385475949349L );
+    FixedPointTime fixedPointTime1( time1 );
+    FixedPointTime fixedPointTime2( time2 );
+
+    // Check additions and subtractions (exact for FixedPointTime)
+    FixedPointTime sum = fixedPointTime1 + fixedPointTime2;
+    FixedPointTime difference = fixedPointTime1 - fixedPointTime2;
+    BOOST_CHECK_EQUAL( sum.getFullPeriods( ), ( time1 + time2 ).getFullPeriods( ) );
+    BOOST_CHECK_EQUAL( difference.getFullPeriods( ), ( time1 - time2 ).getFullPeriods( ) );
+    BOOST_CHECK( ( sum - fixedPointTime2 ) == fixedPointTime1 );
+    BOOST_CHECK( ( difference + fixedPointTime2 ) == fixedPointTime1 );
+    BOOST_CHECK( std::abs( FixedPointTime( time1 + time2 ).getTicksIntoFullPeriod( ) - sum.getTicksIntoFullPeriod( ) ) <= 1 );
+    BOOST_CHECK( std::abs( FixedPointTime( time1 - time2 ).getTicksIntoFullPeriod( ) - difference.getTicksIntoFullPeriod( ) ) <= 1 );
+
+    FixedPointTime accumulatedTime = fixedPointTime1;
+    accumulatedTime += fixedPointTime2;
+    BOOST_CHECK( accumulatedTime == sum );
+    accumulatedTime -= fixedPointTime2;
+    BOOST_CHECK( accumulatedTime == fixedPointTime1 );
+    accumulatedTime += 60.0;
+    accumulatedTime -= 60.0L;
+    BOOST_CHECK( accumulatedTime == fixedPointTime1 );
+
+    // Check that repeated addition of a step does not accumulate error
+    FixedPointTime steppedTime( 0.0 );
+    const FixedPointTime timeStep( 0.125 );
+    for( int i = 0; i < 100000; i++ )
+    {
+        steppedTime += timeStep;
+    }
+    BOOST_CHECK( steppedTime == FixedPointTime( 12500.0 ) );
+
+    // Check multiplications and divisions, compared to Time
+    std::vector< double > factors = { 0.5, -0.25, 1.0 / 3.0, 7.0, 20.0, -PI };
+    for( unsigned int i = 0; i < factors.size( ); i++ )
+    {
+        FixedPointTime product = factors.at( i ) * fixedPointTime2;
+        Time timeProduct = factors.at( i ) * time2;
+        BOOST_CHECK_SMALL( static_cast< double >( ( FixedPointTime( timeProduct ) - product ).getSeconds< long double >( ) ),
+                           1.0E-16 * std::fabs( timeProduct.getSeconds< double >( ) ) );
+        BOOST_CHECK( fixedPointTime2 * factors.at( i ) == product );
+
+        FixedPointTime quotient = fixedPointTime2 / factors.at( i );
+        Time timeQuotient = time2 / factors.at( i );
+        BOOST_CHECK_SMALL( static_cast< double >( ( FixedPointTime( timeQuotient ) - quotient ).getSeconds< long double >( ) ),
+                           1.0E-16 * std::fabs( timeQuotient.getSeconds< double >( ) ) );
+
+        FixedPointTime scaledTime = fixedPointTime2;
+        scaledTime *= factors.at( i );
+        BOOST_CHECK( scaledTime == product );
+        scaledTime = fixedPointTime2;
+        scaledTime /= factors.at( i );
+        BOOST_CHECK( scaledTime == quotient );
+    }
+    BOOST_CHECK( 2.0 * fixedPointTime1 == fixedPointTime1 + fixedPointTime1 );
+    BOOST_CHECK( ( fixedPointTime1 + fixedPointTime1 ) / 2.0 == fixedPointTime1 );
+
+    // Check comparison operators
+    BOOST_CHECK( fixedPointTime1 < fixedPointTime2 );
+    BOOST_CHECK( fixedPointTime1 <= fixedPointTime2 );
+    BOOST_CHECK( fixedPointTime2 > fixedPointTime1 );
+    BOOST_CHECK( fixedPointTime2 >= fixedPointTime1 );
+    BOOST_CHECK( fixedPointTime1 != fixedPointTime2 );
+    BOOST_CHECK( fixedPointTime1 <= fixedPointTime1 );
+    BOOST_CHECK( fixedPointTime1 >= fixedPointTime1 );
+    BOOST_CHECK( !( fixedPointTime1 < fixedPointTime1 ) );
+
+    const FixedPointTime offsetTime = fixedPointTime1 + FixedPointTime::fromTicks( 0, 1 );
+    BOOST_CHECK( fixedPointTime1 < offsetTime );
+    BOOST_CHECK( offsetTime > fixedPointTime1 );
+    BOOST_CHECK( fixedPointTime1 < 1.0E12 );
+    BOOST_CHECK( fixedPointTime1 > 0.0 );
+    BOOST_CHECK( 0.0 < fixedPointTime1 );
+    BOOST_CHECK( FixedPointTime( 3600.0 ) == 3600.0 );
+    BOOST_CHECK( FixedPointTime( 3600.0 ) == 3600 );
+}
+
+//! Function to compute the state derivative of a harmonic oscillator with a periodic forcing term, as a function of time
+template< typename TimeType >
+Eigen::Vector2d computeForcedOscillatorStateDerivative( const TimeType& time,
+                                                        const Eigen::Vector2d& state,
+                                                        const TimeType& referenceTime,
+                                                        const double naturalFrequency,
+                                                        const double forcingFrequency )
+{
+    const double secondsSinceReference = static_cast< double >( time - referenceTime );
+    return ( Eigen::Vector2d( ) << state( 1 ),
+             -naturalFrequency * naturalFrequency * state( 0 ) + std::cos( forcingFrequency * secondsSinceReference ) )
+            .finished( );
+}
+
+//! Function to integrate a forced harmonic oscillator with a fixed-step RK4 integrator, using a given time type
+template< typename TimeType >
+Eigen::Vector2d integrateForcedOscillator( const TimeType& initialTime,
+                                           const double timeStep,
+                                           const int numberOfSteps,
+                                           const double naturalFrequency,
+                                           const double forcingFrequency )
+{
+    numerical_integrators::RungeKutta4Integrator< TimeType, Eigen::Vector2d, Eigen::Vector2d, double > integrator(
+            [ = ]( const TimeType time, const Eigen::Vector2d& state ) {
+                return computeForcedOscillatorStateDerivative( time, state, initialTime, naturalFrequency, forcingFrequency );
+            },
+            initialTime,
+            Eigen::Vector2d::Zero( ),
+            timeStep );
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        integrator.performIntegrationStep( timeStep );
+    }
+    const double propagatedTime = static_cast< double >( integrator.getCurrentIndependentVariable( ) - initialTime );
+    BOOST_CHECK_SMALL( propagatedTime - timeStep * numberOfSteps, 1.0E-9 );
+    return integrator.getCurrentState( );
+}
+
+//! Test use of FixedPointTime as independent variable of an integrator, for a time-dependent state derivative
+BOOST_AUTO_TEST_CASE( testFixedPointTimeIntegration )
+{
+    // Forced oscillator, starting at large epoch (so that time arithmetic in double precision would be insufficient)
+    const double naturalFrequency = 1.0E-3;
+    const double forcingFrequency = 2.3E-3;
+    const double timeStep = 10.0;
+    const int numberOfSteps = 2000;
+    const long double initialSeconds = 8.0E8L + 0.3L;
+
+    Eigen::Vector2d finalStateTime = integrateForcedOscillator< Time >(
+            Time( initialSeconds ), timeStep, numberOfSteps, naturalFrequency, forcingFrequency );
+    Eigen::Vector2d finalStateFixedPointTime = integrateForcedOscillator< FixedPointTime >(
+            FixedPointTime( initialSeconds ), timeStep, numberOfSteps, naturalFrequency, forcingFrequency );
+
+    // Compare to analytical solution (x = ( cos( W t ) - cos( w t ) ) / ( w^2 - W^2 ) for zero initial state)
+    const double propagationTime = timeStep * numberOfSteps;
+    const double frequencySquareDifference = naturalFrequency * naturalFrequency - forcingFrequency * forcingFrequency;
+    Eigen::Vector2d analyticalFinalState;
+    analyticalFinalState << ( std::cos( forcingFrequency * propagationTime ) - std::cos( naturalFrequency * propagationTime ) ) /
+                    frequencySquareDifference,
+            ( -forcingFrequency * std::sin( forcingFrequency * propagationTime ) +
+              naturalFrequency * std::sin( naturalFrequency * propagationTime ) ) /
+                    frequencySquareDifference;
+    for( int i = 0; i < 2; i++ )
+    {
+        const double stateScale = ( i == 0 ? 1.0 : forcingFrequency ) / std::fabs( frequencySquareDifference );
+        BOOST_CHECK_SMALL( finalStateTime( i ) - analyticalFinalState( i ), 1.0E-5 * stateScale );
+        BOOST_CHECK_SMALL( finalStateFixedPointTime( i ) - finalStateTime( i ), 1.0E-12 * stateScale );
+    }
+}
+
+//! Function to solve one-way light-time equations for a list of reception times, using a given time type
+template< typename TimeType >
+std::vector< double > computeLightTimes( const std::vector< TimeType >& receptionTimes, const TimeType& referenceTime )
+{
+    const double speedOfLight = 299792458.0;
+    const double orbitRadius = 1.5E11;
+    const double meanMotion = 2.0E-7;
+    const Eigen::Vector3d receiverPosition( 6378.0E3, 0.0, 0.0 );
+
+    std::vector< double > lightTimes( receptionTimes.size( ) );
+    for( unsigned int i = 0; i < receptionTimes.size( ); i++ )
+    {
+        // Iterate light time, evaluating transmitter position w.r.t. reference time
+        double lightTime = 0.0;
+        TimeType transmissionTime = receptionTimes.at( i );
+        for( int j = 0; j < 4; j++ )
+        {
+            const double secondsSinceReference = static_cast< double >( transmissionTime - referenceTime );
+            const Eigen::Vector3d transmitterPosition( orbitRadius * std::cos( meanMotion * secondsSinceReference ),
+                                                       orbitRadius * std::sin( meanMotion * secondsSinceReference ),
+                                                       0.0 );
+            lightTime = ( transmitterPosition - receiverPosition ).norm( ) / speedOfLight;
+            transmissionTime = receptionTimes.at( i ) - lightTime;
+        }
+        lightTimes[ i ] = lightTime;
+    }
+    return lightTimes;
+}
+
+//! Test consistency of Time and FixedPointTime in light-time calculations and batch conversions
+BOOST_AUTO_TEST_CASE( testFixedPointTimeLightTimeConsistency )
+{
+    const int numberOfObservations = 2000;
+    std::vector< double > receptionSeconds( numberOfObservations );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        receptionSeconds[ i ] = 8.0E8 + 60.0 * i + 1.0E-7 * ( i % 7 );
+    }
+    std::vector< FixedPointTime > fixedPointReceptionTimes = convertSecondsToFixedPointTimes( receptionSeconds );
+    std::vector< Time > receptionTimes = convertFixedPointTimesToTimes( fixedPointReceptionTimes );
+
+    // Solve light-time equations with both time types
+    std::vector< double > lightTimesTime = computeLightTimes< Time >( receptionTimes, Time( 7.9E8L ) );
+    std::vector< double > lightTimesFixedPointTime =
+            computeLightTimes< FixedPointTime >( fixedPointReceptionTimes, FixedPointTime( 7.9E8 ) );
+
+    // Convert reception times to seconds since reference
+    std::vector< double > secondsSinceReferenceFixedPointTime =
+            computeSecondsSinceReferenceTime( fixedPointReceptionTimes, FixedPointTime( 7.9E8 ) );
+    const Time referenceTime( 7.9E8L );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        BOOST_CHECK_SMALL( lightTimesTime.at( i ) - lightTimesFixedPointTime.at( i ), 1.0E-12 );
+        const double secondsSinceReferenceTime = static_cast< double >( receptionTimes[ i ] - referenceTime );
+        BOOST_CHECK_SMALL( secondsSinceReferenceTime - secondsSinceReferenceFixedPointTime.at( i ), 1.0E-14 * 60.0 * i + 1.0E-15 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+}  // namespace tudat
@@ -29,6 +29,7 @@
 
 #include <functional>
 #include <memory>
+#include <thread>
 
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/basics/testMacros.h"
@@ -456,6 +457,92 @@ BOOST_AUTO_TEST_CASE( testSpiceWrappers_7 )
     BOOST_CHECK_EQUAL( spiceKernelsLoaded, 0 );
 }
 
+// Test 8: Concurrent evaluation of states, and precomputed segments of Spice ephemeris.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_8 )
+{
+    using namespace spice_interface;
+
+    // Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Compute states serially
+    const int numberOfThreads = 4;
+    const int numberOfEvaluationsPerThread = 200;
+    const double timeStep = 3600.0;
+    std::vector< std::vector< Eigen::Vector6d > > serialStates( numberOfThreads );
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        for( int j = 0; j < numberOfEvaluationsPerThread; j++ )
+        {
+            serialStates[ i ].push_back( getBodyCartesianStateAtEpoch(
+                    "Moon", "Earth", "J2000", "NONE", ( i * numberOfEvaluationsPerThread + j ) * timeStep ) );
+        }
+    }
+
+    // Compute same states concurrently, and check that results are identical
+    std::vector< std::vector< Eigen::Vector6d > > concurrentStates( numberOfThreads );
+    std::vector< std::thread > threads;
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        threads.push_back( std::thread( [ &concurrentStates, i, numberOfEvaluationsPerThread, timeStep ]( ) {
+            for( int j = 0; j < numberOfEvaluationsPerThread; j++ )
+            {
+                concurrentStates[ i ].push_back( getBodyCartesianStateAtEpoch(
+                        "Moon", "Earth", "J2000", "NONE", ( i * numberOfEvaluationsPerThread + j ) * timeStep ) );
+            }
+        } ) );
+    }
+    for( unsigned int i = 0; i < threads.size( ); i++ )
+    {
+        threads.at( i ).join( );
+    }
+
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        for( int j = 0; j < numberOfEvaluationsPerThread; j++ )
+        {
+            for( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_EQUAL( serialStates[ i ][ j ]( k ), concurrentStates[ i ][ j ]( k ) );
+            }
+        }
+    }
+
+    // Precompute segments of Spice ephemeris, and compare with direct Spice states
+    const double startTime = 0.0;
+    const double endTime = 30.0 * 86400.0;
+    const double positionTolerance = 1.0E-3;
+    std::shared_ptr< ephemerides::SpiceEphemeris > spiceEphemeris =
+            std::make_shared< ephemerides::SpiceEphemeris >( "Moon", "Earth", false, false, false, "J2000" );
+    spiceEphemeris->precomputeSegments( startTime, endTime, 12, positionTolerance );
+    BOOST_CHECK( spiceEphemeris->getPrecomputedSegments( ) != nullptr );
+
+    for( double time = startTime; time <= endTime; time += 4321.0 )
+    {
+        Eigen::Vector6d stateDifference =
+                spiceEphemeris->getCartesianState( time ) - getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", "NONE", time );
+        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 2.0 * positionTolerance );
+    }
+
+    // Check that states outside of precomputed interval, and after clearing the segments, are retrieved from Spice directly
+    const double timeOutsideInterval = endTime + 86400.0;
+    Eigen::Vector6d directState = getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", "NONE", timeOutsideInterval );
+    Eigen::Vector6d ephemerisState = spiceEphemeris->getCartesianState( timeOutsideInterval );
+    for( int k = 0; k < 6; k++ )
+    {
+        BOOST_CHECK_EQUAL( directState( k ), ephemerisState( k ) );
+    }
+
+    spiceEphemeris->clearPrecomputedSegments( );
+    BOOST_CHECK( spiceEphemeris->getPrecomputedSegments( ) == nullptr );
+    directState = getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", "NONE", 0.5 * endTime );
+    ephemerisState = spiceEphemeris->getCartesianState( 0.5 * endTime );
+    for( int k = 0; k < 6; k++ )
+    {
+        BOOST_CHECK_EQUAL( directState( k ), ephemerisState( k ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -0,0 +1,272 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstdio>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/io/columnarBinaryFile.h"
+#include "tudat/simulation/estimation_setup/observationCollection.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::input_output;
+
+BOOST_AUTO_TEST_SUITE( test_columnar_binary_file )
+
+// Create test table, with smooth columns (epoch, sine), an integer-valued column and a column of noisy values
+Eigen::MatrixXd getTestTable( const int numberOfRows )
+{
+    Eigen::MatrixXd table( numberOfRows, 4 );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        table( i, 0 ) = 1.0E8 + 60.0 * i;
+        table( i, 1 ) = 7.0E6 * std::sin( 1.0E-3 * i );
+        table( i, 2 ) = static_cast< double >( i / 10 );
+        table( i, 3 ) = std::sin( 1.0E4 * i ) * std::exp( std::cos( 17.0 * i ) );
+    }
+    return table;
+}
+
+ColumnarBinaryFileDescription getTestDescription( const ColumnarBinaryCompression compression, const int chunkSize )
+{
+    ColumnarBinaryFileDescription description;
+    description.columnNames = { "epoch", "smooth", "integer", "noise" };
+    description.metadata = "origin=Earth;orientation=J2000";
+    description.compression = compression;
+    description.chunkSize = chunkSize;
+    description.contentType = dependent_variable_history_columnar_content;
+    return description;
+}
+
+//! Check whether data written to file in chunks (with and without compression) is read back exactly
+BOOST_AUTO_TEST_CASE( testColumnarBinaryFileRoundTrip )
+{
+    const Eigen::MatrixXd table = getTestTable( 1000 );
+
+    std::map< ColumnarBinaryCompression, std::size_t > fileSizes;
+    for( ColumnarBinaryCompression compression: { no_columnar_compression, xor_delta_run_length_compression } )
+    {
+        std::string fileName = "testColumnarBinaryFile.bin";
+        {
+            ColumnarBinaryFileWriter writer( fileName, getTestDescription( compression, 64 ) );
+            writer.appendRows( table.topRows( 500 ) );
+            for( int i = 500; i < table.rows( ); i++ )
+            {
+                writer.appendRow( table( i, 0 ), table.block( i, 1, 1, 3 ).transpose( ) );
+            }
+            BOOST_CHECK_EQUAL( writer.getNumberOfRows( ), 1000 );
+        }
+        fileSizes[ compression ] = boost::filesystem::file_size( fileName );
+
+        ColumnarBinaryFileReader reader( fileName );
+        BOOST_CHECK_EQUAL( reader.getNumberOfRows( ), 1000 );
+        BOOST_CHECK_EQUAL( reader.getNumberOfChunks( ), 16 );
+        BOOST_CHECK_EQUAL( reader.getNumberOfRowsInChunk( 15 ), 1000 - 15 * 64 );
+        BOOST_CHECK_EQUAL( reader.getNumberOfColumns( ), 4 );
+        BOOST_CHECK_EQUAL( reader.getMetadata( ), "origin=Earth;orientation=J2000" );
+        BOOST_CHECK_EQUAL( reader.getColumnNames( ).at( 3 ), "noise" );
+        BOOST_CHECK_EQUAL( reader.getDescription( ).contentType, dependent_variable_history_columnar_content );
+        BOOST_CHECK_EQUAL( reader.getDescription( ).compression, compression );
+        BOOST_CHECK_EQUAL( reader.getValidFileSize( ), fileSizes[ compression ] );
+
+        // Data must be reproduced bit-for-bit
+        Eigen::MatrixXd readTable = reader.readAll( );
+        BOOST_CHECK( readTable == table );
+        BOOST_CHECK( reader.readColumn( "noise" ) == table.col( 3 ) );
+        BOOST_CHECK_THROW( reader.readColumn( "mass" ), std::runtime_error );
+
+        // Uncompressed columns are accessible directly in the mapped file
+        const double* chunkColumn = reader.getChunkColumnData( 1, 1 );
+        if( compression == no_columnar_compression )
+        {
+            BOOST_CHECK( chunkColumn != nullptr );
+            for( int i = 0; i < 64; i++ )
+            {
+                BOOST_CHECK_EQUAL( chunkColumn[ i ], table( 64 + i, 1 ) );
+            }
+        }
+        else
+        {
+            BOOST_CHECK( chunkColumn == nullptr );
+        }
+        std::remove( fileName.c_str( ) );
+    }
+
+    // Compression must reduce the file size for the smooth and integer columns
+    BOOST_CHECK( fileSizes.at( xor_delta_run_length_compression ) < fileSizes.at( no_columnar_compression ) );
+}
+
+//! Check streaming appends, reading while writing, and recovery from an incomplete trailing chunk
+BOOST_AUTO_TEST_CASE( testColumnarBinaryFileStreaming )
+{
+    const Eigen::MatrixXd table = getTestTable( 100 );
+    for( ColumnarBinaryCompression compression: { no_columnar_compression, xor_delta_run_length_compression } )
+    {
+        std::string fileName = "testColumnarBinaryFileStreaming.bin";
+        {
+            ColumnarBinaryFileWriter writer( fileName, getTestDescription( compression, 16 ) );
+            writer.appendRows( table.topRows( 40 ) );
+
+            // Only complete chunks are available before flushing
+            BOOST_CHECK_EQUAL( ColumnarBinaryFileReader( fileName ).getNumberOfRows( ), 32 );
+            writer.flush( );
+            BOOST_CHECK_EQUAL( ColumnarBinaryFileReader( fileName ).getNumberOfRows( ), 40 );
+        }
+
+        // Append to existing file (settings are taken from file)
+        {
+            ColumnarBinaryFileDescription description;
+            description.columnNames = getTestDescription( compression, 16 ).columnNames;
+            ColumnarBinaryFileWriter writer( fileName, description, true );
+            BOOST_CHECK_EQUAL( writer.getDescription( ).chunkSize, 16 );
+            BOOST_CHECK_EQUAL( writer.getNumberOfRows( ), 40 );
+            writer.appendRows( table.block( 40, 0, 30, 4 ) );
+
+            // Appending with different columns is not allowed
+            description.columnNames.pop_back( );
+            BOOST_CHECK_THROW( ColumnarBinaryFileWriter( fileName, description, true ), std::runtime_error );
+        }
+        BOOST_CHECK( ColumnarBinaryFileReader( fileName ).readAll( ) == table.topRows( 70 ) );
+
+        // Simulate interrupted write of final chunk, which should be ignored when reading, and overwritten when appending
+        const std::size_t completeFileSize = boost::filesystem::file_size( fileName );
+        {
+            ColumnarBinaryFileWriter writer( fileName, getTestDescription( compression, 16 ), true );
+            writer.appendRows( table.block( 70, 0, 10, 4 ) );
+        }
+        boost::filesystem::resize_file( fileName, boost::filesystem::file_size( fileName ) - 12 );
+        {
+            ColumnarBinaryFileReader reader( fileName );
+            BOOST_CHECK_EQUAL( reader.getNumberOfRows( ), 70 );
+            BOOST_CHECK_EQUAL( reader.getValidFileSize( ), completeFileSize );
+        }
+        {
+            ColumnarBinaryFileWriter writer( fileName, getTestDescription( compression, 16 ), true );
+            writer.appendRows( table.block( 70, 0, 30, 4 ) );
+        }
+        BOOST_CHECK( ColumnarBinaryFileReader( fileName ).readAll( ) == table );
+        std::remove( fileName.c_str( ) );
+    }
+
+    // Check that invalid files are rejected
+    {
+        std::ofstream invalidFile( "testColumnarBinaryFileInvalid.bin" );
+        invalidFile << "This is not a columnar binary file, but a text file of sufficient length to contain a header";
+    }
+    BOOST_CHECK_THROW( ColumnarBinaryFileReader( "testColumnarBinaryFileInvalid.bin" ), std::runtime_error );
+    std::remove( "testColumnarBinaryFileInvalid.bin" );
+}
+
+//! Check writing and reading of vector and matrix histories
+BOOST_AUTO_TEST_CASE( testColumnarBinaryFileHistories )
+{
+    std::map< double, Eigen::VectorXd > stateHistory;
+    std::map< double, Eigen::MatrixXd > covarianceHistory;
+    for( int i = 0; i < 250; i++ )
+    {
+        Eigen::VectorXd state = Eigen::VectorXd( 6 );
+        state << 7.0E6 * std::cos( 1.0E-3 * i ), 7.0E6 * std::sin( 1.0E-3 * i ), 1.0E3, -7.5E3 * std::sin( 1.0E-3 * i ),
+                7.5E3 * std::cos( 1.0E-3 * i ), 0.0;
+        stateHistory[ 10.0 * i ] = state;
+
+        Eigen::MatrixXd covariance = Eigen::MatrixXd( 3, 2 );
+        covariance << 1.0 + i, 2.0, 3.0 / ( i + 1 ), 4.0, 5.0 * i, -6.0;
+        covarianceHistory[ 10.0 * i ] = covariance;
+    }
+
+    writeDataMapToColumnarBinaryFile( stateHistory,
+                                      "testColumnarBinaryStateHistory.bin",
+                                      std::vector< std::string >( ),
+                                      state_history_columnar_content,
+                                      xor_delta_run_length_compression );
+    std::map< double, Eigen::VectorXd > readStateHistory =
+            readDataMapFromColumnarBinaryFile< double, double >( "testColumnarBinaryStateHistory.bin" );
+    BOOST_CHECK_EQUAL( readStateHistory.size( ), stateHistory.size( ) );
+    for( auto it: stateHistory )
+    {
+        BOOST_CHECK( readStateHistory.at( it.first ) == it.second );
+    }
+    BOOST_CHECK_EQUAL( ColumnarBinaryFileReader( "testColumnarBinaryStateHistory.bin" ).getColumnNames( ).at( 6 ), "column_6" );
+
+    writeMatrixHistoryToColumnarBinaryFile( covarianceHistory, "testColumnarBinaryCovarianceHistory.bin" );
+    std::map< double, Eigen::MatrixXd > readCovarianceHistory =
+            readMatrixHistoryFromColumnarBinaryFile< double, double >( "testColumnarBinaryCovarianceHistory.bin" );
+    BOOST_CHECK_EQUAL( readCovarianceHistory.size( ), covarianceHistory.size( ) );
+    for( auto it: covarianceHistory )
+    {
+        BOOST_CHECK( readCovarianceHistory.at( it.first ) == it.second );
+    }
+    {
+        ColumnarBinaryFileReader reader( "testColumnarBinaryCovarianceHistory.bin" );
+        BOOST_CHECK_EQUAL( reader.getDescription( ).entryRows, 3 );
+        BOOST_CHECK_EQUAL( reader.getDescription( ).entryColumns, 2 );
+        BOOST_CHECK_EQUAL( reader.getColumnNames( ).at( 2 ), "entry_0_1" );
+    }
+    BOOST_CHECK_THROW( readMatrixHistoryFromColumnarBinaryFile( "testColumnarBinaryStateHistory.bin" ), std::runtime_error );
+    std::remove( "testColumnarBinaryStateHistory.bin" );
+    std::remove( "testColumnarBinaryCovarianceHistory.bin" );
+}
+
+//! Check writing of observation collection residuals
+BOOST_AUTO_TEST_CASE( testColumnarBinaryObservationResiduals )
+{
+    using namespace observation_models;
+
+    LinkDefinition linkEnds;
+    linkEnds[ transmitter ] = std::make_pair< std::string, std::string >( "Earth", "Station" );
+    linkEnds[ receiver ] = std::make_pair< std::string, std::string >( "Spacecraft", "" );
+
+    std::vector< Eigen::VectorXd > observations;
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 20; i++ )
+    {
+        observations.push_back( Eigen::VectorXd::Constant( 1, 1.0E8 + 3.0 * i ) );
+        observationTimes.push_back( 1.0E6 + 60.0 * i );
+    }
+    std::shared_ptr< ObservationCollection< double, double > > observationCollection =
+            createManualObservationCollection( one_way_range, linkEnds, observations, observationTimes, receiver );
+    Eigen::VectorXd residuals = Eigen::VectorXd::LinSpaced( 20, -1.0, 1.0 );
+    observationCollection->setResiduals( residuals );
+    observationCollection->setConstantWeight( 0.25 );
+
+    writeObservationResidualsToColumnarBinaryFile(
+            observationCollection, "testColumnarBinaryResiduals.bin", xor_delta_run_length_compression );
+
+    ColumnarBinaryFileReader reader( "testColumnarBinaryResiduals.bin" );
+    BOOST_CHECK_EQUAL( reader.getDescription( ).contentType, observation_residual_columnar_content );
+    BOOST_CHECK_EQUAL( reader.getNumberOfRows( ), 20 );
+    for( int i = 0; i < 20; i++ )
+    {
+        BOOST_CHECK_EQUAL( reader.readColumn( "epoch" )( i ), observationTimes.at( i ) );
+        BOOST_CHECK_EQUAL( reader.readColumn( "observation" )( i ), observations.at( i )( 0 ) );
+    }
+    BOOST_CHECK( reader.readColumn( "residual" ) == residuals );
+    BOOST_CHECK( reader.readColumn( "weight" ) == Eigen::VectorXd::Constant( 20, 0.25 ) );
+    BOOST_CHECK( reader.readColumn( "observable_type" ) == Eigen::VectorXd::Constant( 20, static_cast< double >( one_way_range ) ) );
+    BOOST_CHECK( reader.readColumn( "link_end_id" ) ==
+                 Eigen::VectorXd::Constant( 20, observationCollection->getLinkEndIdentifierMap( ).at( linkEnds.linkEnds_ ) ) );
+    std::remove( "testColumnarBinaryResiduals.bin" );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+
+}  // namespace tudat
@@ -19,6 +19,8 @@
 #include "tudat/simulation/estimation_setup/createLightTimeCorrection.h"
 
 #include "tudat/io/readIonexFile.h"
+#include "tudat/io/readViennaMappingFunctionData.h"
+#include "tudat/io/timeIndexedGridFile.h"
 
 namespace tudat
 {
@@ -474,6 +476,139 @@ BOOST_AUTO_TEST_CASE( testReadIonexFile )
     BOOST_CHECK_CLOSE_FRACTION( tecAt10, 12.7, 1.0e-12 );
 }
 
+BOOST_AUTO_TEST_CASE( testTimeIndexedGridFiles )
+{
+    using namespace tudat::simulation_setup;
+    using namespace tudat::interpolators;
+    using namespace tudat::input_output;
+    using namespace tudat::environment;
+
+    // Check writing and interpolation of generic grid file, using data that is linear in time, latitude and longitude
+    {
+        TimeIndexedGridData gridData;
+        gridData.numberOfFields = 2;
+        gridData.name = "test_grid";
+        gridData.epochs = { 0.0, 100.0, 200.0, 400.0 };
+        gridData.latitudes = { -10.0, 0.0, 10.0 };
+        gridData.longitudes = { -20.0, 0.0, 20.0, 40.0 };
+        std::function< double( int, double, double, double ) > testFunction = [ = ]( int field, double t, double lat, double lon ) {
+            return static_cast< double >( field + 1 ) * ( 1.0 + 0.01 * t ) + 0.3 * lat - 0.2 * lon;
+        };
+        gridData.data.resize( 4 * 2 * 3 * 4 );
+        for( int t = 0; t < 4; t++ )
+        {
+            for( int k = 0; k < 2; k++ )
+            {
+                for( int i = 0; i < 3; i++ )
+                {
+                    for( int j = 0; j < 4; j++ )
+                    {
+                        gridData.data[ gridData.getDataIndex( t, k, i, j ) ] =
+                                testFunction( k, gridData.epochs[ t ], gridData.latitudes[ i ], gridData.longitudes[ j ] );
+                    }
+                }
+            }
+        }
+
+        std::string gridFileName = "testTimeIndexedGrid.bin";
+        writeTimeIndexedGridFile( gridData, gridFileName );
+
+        {
+            TimeIndexedGridFile gridFile( gridFileName );
+            BOOST_CHECK_EQUAL( gridFile.getName( ), "test_grid" );
+            BOOST_CHECK_EQUAL( gridFile.getNumberOfFields( ), 2 );
+            BOOST_CHECK_EQUAL( gridFile.getEpochs( ).size( ), 4 );
+            BOOST_CHECK_EQUAL( gridFile.getNumberOfAccessedEpochs( ), 0 );
+
+            // Check interpolation inside grid
+            BOOST_CHECK_CLOSE_FRACTION( gridFile.interpolateField( 1, 150.0, 3.0, -7.0 ), testFunction( 1, 150.0, 3.0, -7.0 ), 1.0E-14 );
+            BOOST_CHECK_CLOSE_FRACTION( gridFile.interpolateField( 0, 120.0, -4.0, 33.0 ), testFunction( 0, 120.0, -4.0, 33.0 ), 1.0E-14 );
+            BOOST_CHECK_EQUAL( gridFile.getNumberOfAccessedEpochs( ), 2 );
+
+            Eigen::VectorXd interpolatedFields = gridFile.interpolateFields( 300.0, 10.0, 0.0 );
+            BOOST_CHECK_CLOSE_FRACTION( interpolatedFields( 0 ), testFunction( 0, 300.0, 10.0, 0.0 ), 1.0E-14 );
+            BOOST_CHECK_CLOSE_FRACTION( interpolatedFields( 1 ), testFunction( 1, 300.0, 10.0, 0.0 ), 1.0E-14 );
+            BOOST_CHECK_EQUAL( gridFile.getNumberOfAccessedEpochs( ), 3 );
+
+            // Check that values outside grid are taken at boundary
+            BOOST_CHECK_CLOSE_FRACTION(
+                    gridFile.interpolateField( 0, 500.0, 20.0, -30.0 ), testFunction( 0, 400.0, 10.0, -20.0 ), 1.0E-14 );
+        }
+        std::remove( gridFileName.c_str( ) );
+    }
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Check grid file created from IONEX file against interpolated IONEX data
+    {
+        std::vector< std::string > filePaths = { tudat::paths::getTudatTestDataPath( ) + "/IGS0OPSRAP_20251220000_01D_02H_GIM.INX" };
+        std::string gridFileName = "testIonexGrid.bin";
+        convertIonexFilesToTimeIndexedGridFile( filePaths, gridFileName );
+
+        SystemOfBodies bodies;
+        bodies.createEmptyBody( "Earth" );
+        setIonosphereModelFromIonex( filePaths, bodies );
+        std::shared_ptr< IonosphereModel > ionexModel = bodies.at( "Earth" )->getIonosphereModel( );
+
+        setIonosphereModelFromTimeIndexedGridFile( gridFileName, bodies );
+        std::shared_ptr< IonosphereModel > gridModel = bodies.at( "Earth" )->getIonosphereModel( );
+        BOOST_CHECK( std::dynamic_pointer_cast< TimeIndexedGridIonosphereModel >( gridModel ) != nullptr );
+        BOOST_CHECK_EQUAL( gridModel->getReferenceIonosphereHeight( ), ionexModel->getReferenceIonosphereHeight( ) );
+
+        double startTime = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                tudat::basic_astrodynamics::convertCalendarDateToJulianDay( 2025, 5, 2, 0, 0, 0.0 ),
+                tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+        for( int i = 0; i < 20; i++ )
+        {
+            double time = startTime + 1000.0 + 4000.0 * i;
+            double latitude = -85.0 + 8.3 * i;
+            double longitude = -175.0 + 17.1 * i;
+            BOOST_CHECK_CLOSE_FRACTION( gridModel->getVerticalTotalElectronContent( latitude, longitude, time ),
+                                        ionexModel->getVerticalTotalElectronContent( latitude, longitude, time ),
+                                        1.0E-12 );
+        }
+        std::remove( gridFileName.c_str( ) );
+    }
+
+    // Check grid files created from VMF files against VMF data
+    {
+        std::vector< std::string > filePaths = { paths::getTudatTestDataPath( ) + "y2017.vmf3_r.txt" };
+        std::vector< std::string > gridFileNames = convertVMFFilesToTimeIndexedGridFiles( filePaths, true, false, "testVmfGrid_" );
+
+        BodyListSettings bodySettings = getDefaultBodySettings( { "Earth" } );
+        bodySettings.at( "Earth" )->groundStationSettings = getDsnStationSettings( );
+        SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+        SystemOfBodies gridBodies = createSystemOfBodies( bodySettings );
+
+        double startTime = 536500800.0;
+        double endTime = startTime + 10.0 * physical_constants::JULIAN_DAY;
+        observation_models::setVmfTroposphereCorrections( filePaths, true, false, bodies, true, true, linearInterpolation( ) );
+        observation_models::setVmfTroposphereCorrectionsFromTimeIndexedGridFiles(
+                gridFileNames, gridBodies, true, true, linearInterpolation( ), startTime, endTime );
+
+        for( std::string groundStation: { "DSS-13", "DSS-43", "DSS-63" } )
+        {
+            std::shared_ptr< ground_stations::GroundStation > station = bodies.getBody( "Earth" )->getGroundStation( groundStation );
+            std::shared_ptr< ground_stations::GroundStation > gridStation =
+                    gridBodies.getBody( "Earth" )->getGroundStation( groundStation );
+            for( double time = startTime; time < endTime; time += 5000.0 )
+            {
+                BOOST_CHECK_CLOSE_FRACTION(
+                        station->getTemperatureFunction( )( time ), gridStation->getTemperatureFunction( )( time ), 1.0E-14 );
+                BOOST_CHECK_CLOSE_FRACTION( station->getPressureFunction( )( time ), gridStation->getPressureFunction( )( time ), 1.0E-14 );
+                BOOST_CHECK_CLOSE_FRACTION( station->getTroposphereData( )->getZenithDelay( time )( 0 ),
+                                            gridStation->getTroposphereData( )->getZenithDelay( time )( 0 ),
+                                            1.0E-14 );
+            }
+        }
+
+        for( unsigned int i = 0; i < gridFileNames.size( ); i++ )
+        {
+            std::remove( gridFileNames.at( i ).c_str( ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -0,0 +1,91 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Benchmark of the number of state derivative evaluations, wall time and final error of the fixed-order and adaptive-order
+ *    Bulirsch-Stoer integrators, compared to the RKF7(8) integrator, for an eccentric two-body orbit. Built only if
+ *    TUDAT_BUILD_BENCHMARKS is set, and not run as part of the unit tests.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/integrators/bulirschStoerVariableStepsizeIntegrator.h"
+#include "tudat/math/integrators/numericalIntegratorTestFunctions.h"
+#include "tudat/math/integrators/rungeKuttaCoefficients.h"
+#include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+using namespace tudat;
+using namespace tudat::numerical_integrators;
+using tudat::unit_tests::numerical_integrator_test_functions::computeAnalyticalEccentricOrbitState;
+
+int main( )
+{
+    // Define two-body problem (unit gravitational parameter), counting number of state derivative evaluations
+    unsigned int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state ) {
+                numberOfEvaluations++;
+                Eigen::VectorXd stateDerivative( 6 );
+                double radius = state.segment( 0, 3 ).norm( );
+                stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+                stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / ( radius * radius * radius );
+                return stateDerivative;
+            };
+
+    // Integrate eccentric orbit over 10 orbital periods, at a range of tolerances
+    const double eccentricity = 0.5;
+    const double endTime = 20.0 * mathematical_constants::PI;
+    const Eigen::VectorXd initialState = computeAnalyticalEccentricOrbitState( 0.0, eccentricity );
+    const Eigen::VectorXd finalState = computeAnalyticalEccentricOrbitState( endTime, eccentricity );
+    const int numberOfRepetitions = 20;
+
+    const std::vector< std::string > integratorNames = { "BS (fixed order)", "BS (adaptive order)", "RKF7(8)" };
+    for( double tolerance: { 1.0E-10, 1.0E-12, 1.0E-14 } )
+    {
+        std::cout << "Tolerance " << tolerance << std::endl;
+        for( unsigned int i = 0; i < integratorNames.size( ); i++ )
+        {
+            Eigen::VectorXd integratedState;
+            std::chrono::steady_clock::time_point startClock = std::chrono::steady_clock::now( );
+            for( int j = 0; j < numberOfRepetitions; j++ )
+            {
+                std::shared_ptr< NumericalIntegrator< > > integrator;
+                if( i < 2 )
+                {
+                    integrator = std::make_shared< BulirschStoerVariableStepSizeIntegratorXd >(
+                            getBulirschStoerStepSequence( deufelhard_sequence, 8 ),
+                            stateDerivativeFunction, 0.0, initialState, 1.0E-12, 10.0, 0.01, tolerance, tolerance, 0.75, 4.0, 0.1,
+                            i == 1 );
+                }
+                else
+                {
+                    integrator = std::make_shared< RungeKuttaVariableStepSizeIntegratorXd >(
+                            RungeKuttaCoefficients::get( CoefficientSets::rungeKuttaFehlberg78 ),
+                            stateDerivativeFunction, 0.0, initialState, 1.0E-12, 10.0, 0.01, tolerance, tolerance );
+                }
+
+                numberOfEvaluations = 0;
+                integratedState = integrator->integrateTo( endTime, 0.01 );
+            }
+            const double elapsedSeconds =
+                    std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startClock ).count( ) / numberOfRepetitions;
+
+            std::cout << "  " << integratorNames.at( i ) << ": " << numberOfEvaluations << " evaluations, " << elapsedSeconds * 1.0E3
+                      << " ms, final error " << ( integratedState - finalState ).cwiseAbs( ).maxCoeff( ) << std::endl;
+        }
+    }
+
+    return 0;
+}
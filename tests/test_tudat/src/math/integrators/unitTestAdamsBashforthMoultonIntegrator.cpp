@@ -24,6 +24,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
 #include <limits>
 #include <cmath>
 
@@ -193,6 +194,72 @@ BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_Compare78_VanDerPol
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Circular two-body state derivative with unit gravitational parameter, used to test dense output.
+Eigen::VectorXd computeCircularOrbitStateDerivative( const double time, const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative( 6 );
+    double radius = state.segment( 0, 3 ).norm( );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / ( radius * radius * radius );
+    return stateDerivative;
+}
+
+//! Analytical solution of circular orbit with unit radius and gravitational parameter.
+Eigen::VectorXd computeAnalyticalCircularOrbitState( const double time )
+{
+    Eigen::VectorXd state( 6 );
+    state << std::cos( time ), std::sin( time ), 0.0, -std::sin( time ), std::cos( time ), 0.0;
+    return state;
+}
+
+//! Test dense output inside the steps taken by the integrator.
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_DenseOutput )
+{
+    Eigen::VectorXd initialState = computeAnalyticalCircularOrbitState( 0.0 );
+
+    AdamsBashforthMoultonIntegratorXd integrator_abam(
+            computeCircularOrbitStateDerivative, 0.0, initialState, 1.0E-10, 1.0, 0.01, 1.0E-12, 1.0E-12 );
+
+    double maximumDenseOutputError = 0.0;
+    double maximumStepError = 0.0;
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        integrator_abam.performIntegrationStep( integrator_abam.getNextStepSize( ) );
+        double currentTime = integrator_abam.getCurrentIndependentVariable( );
+        double previousTime = integrator_abam.getPreviousIndependentVariable( );
+
+        // Dense output at current time must reproduce current state
+        Eigen::VectorXd denseOutputDifference = integrator_abam.getDenseOutputState( currentTime ) - integrator_abam.getCurrentState( );
+        BOOST_CHECK_SMALL( denseOutputDifference.cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+
+        maximumStepError = std::max(
+                maximumStepError,
+                ( integrator_abam.getCurrentState( ) - computeAnalyticalCircularOrbitState( currentTime ) ).cwiseAbs( ).maxCoeff( ) );
+
+        // Check interpolated states, after startup phase
+        if( i > 50 )
+        {
+            for( double stepFraction: { 0.25, 0.5, 0.75 } )
+            {
+                double interpolationTime = previousTime + stepFraction * ( currentTime - previousTime );
+                maximumDenseOutputError = std::max( maximumDenseOutputError,
+                                                    ( integrator_abam.getDenseOutputState( interpolationTime ) -
+                                                      computeAnalyticalCircularOrbitState( interpolationTime ) )
+                                                            .cwiseAbs( )
+                                                            .maxCoeff( ) );
+            }
+        }
+    }
+
+    // Dense output should be as accurate as the integrated states themselves
+    BOOST_CHECK_SMALL( maximumDenseOutputError, 2.0 * maximumStepError + 1.0E-13 );
+    BOOST_CHECK_SMALL( maximumDenseOutputError, 1.0E-10 );
+
+    // Requesting dense output outside of stored history should fail
+    BOOST_CHECK_THROW( integrator_abam.getDenseOutputState( integrator_abam.getCurrentIndependentVariable( ) + 1.0 ),
+                       std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
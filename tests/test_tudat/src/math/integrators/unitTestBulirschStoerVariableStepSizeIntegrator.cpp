@@ -26,6 +26,10 @@
 
 #include <limits>
 #include <cmath>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include <Eigen/Core>
 
@@ -35,6 +39,7 @@
 #include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "tudat/math/integrators/rungeKuttaCoefficients.h"
 #include "tudat/math/integrators/numericalIntegratorTestFunctions.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 
 namespace tudat
 {
@@ -43,6 +48,7 @@ namespace unit_tests
 
 BOOST_AUTO_TEST_SUITE( test_bulirsch_stoer_integrator )
 
+using numerical_integrator_test_functions::computeAnalyticalEccentricOrbitState;
 using numerical_integrator_test_functions::computeAnalyticalStateFehlbergODE;
 using numerical_integrator_test_functions::computeFehlbergLogirithmicTestODEStateDerivative;
 using numerical_integrator_test_functions::computeNonAutonomousModelStateDerivative;
@@ -196,6 +202,156 @@ BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_Compare78_VanDerPol )
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Test adaptive order control, and compare number of function evaluations with fixed-order BS and RKF78 integrators
+BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_AdaptiveOrder )
+{
+    // Define two-body problem, counting number of state derivative evaluations
+    unsigned int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state ) {
+                numberOfEvaluations++;
+                Eigen::VectorXd stateDerivative( 6 );
+                double radius = state.segment( 0, 3 ).norm( );
+                stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+                stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / ( radius * radius * radius );
+                return stateDerivative;
+            };
+
+    // Integrate over 10 orbits, and retrieve number of evaluations and final error
+    double eccentricity = 0.5;
+    double endTime = 20.0 * mathematical_constants::PI;
+    double tolerance = 1.0E-14;
+    Eigen::VectorXd initialState = computeAnalyticalEccentricOrbitState( 0.0, eccentricity );
+    Eigen::VectorXd finalState = computeAnalyticalEccentricOrbitState( endTime, eccentricity );
+
+    std::vector< unsigned int > numberOfEvaluationsPerIntegrator;
+    std::vector< double > errorPerIntegrator;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        std::shared_ptr< NumericalIntegrator< > > integrator;
+        if( i < 2 )
+        {
+            integrator = std::make_shared< BulirschStoerVariableStepSizeIntegratorXd >(
+                    getBulirschStoerStepSequence( deufelhard_sequence, 8 ),
+                    stateDerivativeFunction, 0.0, initialState, 1.0E-12, 10.0, 0.01, tolerance, tolerance, 0.75, 4.0, 0.1, i == 1 );
+        }
+        else
+        {
+            integrator = std::make_shared< RungeKuttaVariableStepSizeIntegratorXd >(
+                    RungeKuttaCoefficients::get( CoefficientSets::rungeKuttaFehlberg78 ),
+                    stateDerivativeFunction, 0.0, initialState, 1.0E-12, 10.0, 0.01, tolerance, tolerance );
+        }
+
+        numberOfEvaluations = 0;
+        Eigen::VectorXd integratedState = integrator->integrateTo( endTime, 0.01 );
+        numberOfEvaluationsPerIntegrator.push_back( numberOfEvaluations );
+        errorPerIntegrator.push_back( ( integratedState - finalState ).cwiseAbs( ).maxCoeff( ) );
+    }
+
+    // Adaptive order BS should be more accurate than fixed-order BS and RKF78 with fewer evaluations
+    BOOST_CHECK_SMALL( errorPerIntegrator.at( 1 ), 1.0E-10 );
+    BOOST_CHECK( errorPerIntegrator.at( 1 ) < errorPerIntegrator.at( 0 ) );
+    BOOST_CHECK( errorPerIntegrator.at( 1 ) < errorPerIntegrator.at( 2 ) );
+    BOOST_CHECK( numberOfEvaluationsPerIntegrator.at( 1 ) < numberOfEvaluationsPerIntegrator.at( 0 ) );
+    BOOST_CHECK( numberOfEvaluationsPerIntegrator.at( 1 ) < numberOfEvaluationsPerIntegrator.at( 2 ) );
+
+    // Check that adaptive order requires at least three entries in sequence
+    BOOST_CHECK_THROW( BulirschStoerVariableStepSizeIntegratorXd( getBulirschStoerStepSequence( deufelhard_sequence, 2 ),
+                                                                  stateDerivativeFunction,
+                                                                  0.0,
+                                                                  initialState,
+                                                                  1.0E-12,
+                                                                  10.0,
+                                                                  0.01,
+                                                                  tolerance,
+                                                                  tolerance,
+                                                                  0.75,
+                                                                  4.0,
+                                                                  0.1,
+                                                                  true ),
+                       std::runtime_error );
+}
+
+//! Step size validator that records the number of state derivative evaluations, and acceptance, of each step attempt
+class StepAttemptRecordingValidator : public BasicIntegratorStepSizeValidator< double >
+{
+public:
+    StepAttemptRecordingValidator( const unsigned int& numberOfEvaluations ):
+        BasicIntegratorStepSizeValidator< double >( 1.0E-12, 1.0E3 ), numberOfEvaluations_( numberOfEvaluations ),
+        numberOfEvaluationsAtLastAttempt_( 0 )
+    { }
+
+    std::pair< double, bool > validateStep( const std::pair< double, bool > recommendedStep, const double currentStep )
+    {
+        std::pair< double, bool > validatedStep = BasicIntegratorStepSizeValidator< double >::validateStep( recommendedStep, currentStep );
+        stepAttempts_.push_back( std::make_pair( numberOfEvaluations_ - numberOfEvaluationsAtLastAttempt_, validatedStep.second ) );
+        numberOfEvaluationsAtLastAttempt_ = numberOfEvaluations_;
+        return validatedStep;
+    }
+
+    // Number of state derivative evaluations, and acceptance, per step attempt
+    std::vector< std::pair< unsigned int, bool > > stepAttempts_;
+
+private:
+    const unsigned int& numberOfEvaluations_;
+
+    unsigned int numberOfEvaluationsAtLastAttempt_;
+};
+
+//! Test early rejection of steps in adaptive order control (convergence monitor with ODEX thresholds)
+BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_AdaptiveOrderRejection )
+{
+    // Define exponential decay problem, counting number of state derivative evaluations
+    unsigned int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state ) {
+                numberOfEvaluations++;
+                return Eigen::VectorXd( -state );
+            };
+
+    // For the sequence 2, 4, ..., 16 the initial target row is 6, and the first row checked for convergence is 5. For these step
+    // sizes, the normalized error estimate of row 5 exceeds the ODEX threshold ( n_6 / n_0 )^2 ( n_7 / n_0 )^2 = 3136, so that the
+    // first attempt must be rejected without computing rows 6 and 7.
+    const double tolerance = 1.0E-12;
+    const std::vector< unsigned int > sequence = getBulirschStoerStepSequence( deufelhard_sequence, 8 );
+    const unsigned int numberOfEvaluationsUpToRow5 = 1 + 2 + 4 + 6 + 8 + 10 + 12;
+    for( double stepSize: { 1.5, 1.75, 2.0 } )
+    {
+        numberOfEvaluations = 0;
+        std::shared_ptr< StepAttemptRecordingValidator > stepSizeValidator =
+                std::make_shared< StepAttemptRecordingValidator >( numberOfEvaluations );
+        BulirschStoerVariableStepSizeIntegratorXd integrator(
+                sequence,
+                stateDerivativeFunction,
+                0.0,
+                Eigen::VectorXd::Ones( 1 ),
+                stepSize,
+                std::make_shared< PerElementIntegratorStepSizeController< double, Eigen::VectorXd > >(
+                        tolerance, tolerance, 0.75, 15, 0.1, 4.0 ),
+                stepSizeValidator,
+                true );
+        Eigen::VectorXd integratedState = integrator.performIntegrationStep( stepSize );
+
+        // Check that exactly one attempt is rejected, after computing rows up to and including row 5
+        unsigned int numberOfRejectedSteps = 0;
+        for( unsigned int i = 0; i < stepSizeValidator->stepAttempts_.size( ); i++ )
+        {
+            numberOfRejectedSteps += ( stepSizeValidator->stepAttempts_.at( i ).second ? 0 : 1 );
+        }
+        BOOST_CHECK_EQUAL( numberOfRejectedSteps, 1 );
+        BOOST_CHECK_EQUAL( stepSizeValidator->stepAttempts_.size( ), 2 );
+        BOOST_CHECK_EQUAL( stepSizeValidator->stepAttempts_.at( 0 ).second, false );
+        BOOST_CHECK_EQUAL( stepSizeValidator->stepAttempts_.at( 0 ).first, numberOfEvaluationsUpToRow5 );
+        BOOST_CHECK_EQUAL( stepSizeValidator->stepAttempts_.at( 1 ).second, true );
+
+        // Check result of the accepted (smaller) step
+        const double integratedTime = integrator.getCurrentIndependentVariable( );
+        BOOST_CHECK( integratedTime > 0.0 );
+        BOOST_CHECK( integratedTime < stepSize );
+        BOOST_CHECK_SMALL( integratedState( 0 ) - std::exp( -integratedTime ), 10.0 * tolerance );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -28,6 +28,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "tudat/math/integrators/integrationEventLocator.h"
 #include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "tudat/math/integrators/rungeKutta4Integrator.h"
 #include "tudat/math/integrators/rungeKuttaCoefficients.h"
@@ -318,6 +319,131 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Function to compute the state derivative of a Kepler orbit (unit gravitational parameter), counting the number of calls.
+Eigen::VectorXd computeCountedKeplerOrbitStateDerivative( const double time, const Eigen::VectorXd& state, int& numberOfEvaluations )
+{
+    numberOfEvaluations++;
+    Eigen::VectorXd stateDerivative( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+    return stateDerivative;
+}
+
+//! Test dense output, and location of events on dense output.
+BOOST_AUTO_TEST_CASE( testDenseOutputAndEventLocation )
+{
+    using namespace numerical_integrators;
+
+    // Define inclined, eccentric orbit (unit semi-major axis and gravitational parameter), starting at periapsis
+    const double eccentricity = 0.3;
+    const double inclination = 0.5;
+    const double argumentOfPeriapsis = 1.0;
+    const double orbitalPeriod = 2.0 * mathematical_constants::PI;
+    const Eigen::Vector3d periapsisDirection( std::cos( argumentOfPeriapsis ),
+                                              std::sin( argumentOfPeriapsis ) * std::cos( inclination ),
+                                              std::sin( argumentOfPeriapsis ) * std::sin( inclination ) );
+    const Eigen::Vector3d velocityDirection( -std::sin( argumentOfPeriapsis ),
+                                             std::cos( argumentOfPeriapsis ) * std::cos( inclination ),
+                                             std::cos( argumentOfPeriapsis ) * std::sin( inclination ) );
+    Eigen::VectorXd initialState( 6 );
+    initialState.segment( 0, 3 ) = ( 1.0 - eccentricity ) * periapsisDirection;
+    initialState.segment( 3, 3 ) = std::sqrt( ( 1.0 + eccentricity ) / ( 1.0 - eccentricity ) ) * velocityDirection;
+
+    // Compute time of first ascending node passage (true anomaly equal to 2 pi minus argument of periapsis)
+    const double ascendingNodeTrueAnomaly = 2.0 * mathematical_constants::PI - argumentOfPeriapsis;
+    double ascendingNodeEccentricAnomaly = 2.0 *
+            std::atan( std::sqrt( ( 1.0 - eccentricity ) / ( 1.0 + eccentricity ) ) * std::tan( ascendingNodeTrueAnomaly / 2.0 ) );
+    if( ascendingNodeEccentricAnomaly < 0.0 )
+    {
+        ascendingNodeEccentricAnomaly += 2.0 * mathematical_constants::PI;
+    }
+    const double ascendingNodeTime = ascendingNodeEccentricAnomaly - eccentricity * std::sin( ascendingNodeEccentricAnomaly );
+
+    // Define events: ascending node (terminal in second case) and periapsis passages
+    std::vector< std::shared_ptr< IntegrationEventSettings<> > > eventSettings;
+    eventSettings.push_back( std::make_shared< IntegrationEventSettings<> >(
+            "ascending_node", []( const double, const Eigen::VectorXd& state ) { return state( 2 ); }, increasing_event_crossing ) );
+    eventSettings.push_back( std::make_shared< IntegrationEventSettings<> >(
+            "periapsis",
+            []( const double, const Eigen::VectorXd& state ) { return state.segment( 0, 3 ).dot( state.segment( 3, 3 ) ); },
+            increasing_event_crossing ) );
+
+    // Integrate without (case 0) and with (case 1) event location, and with terminal event and dense output checks (case 2)
+    std::vector< int > numberOfEvaluations( 3, 0 );
+    std::vector< Eigen::VectorXd > finalStates( 3 );
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        std::shared_ptr< RungeKuttaVariableStepSizeIntegratorXd > integrator = std::make_shared< RungeKuttaVariableStepSizeIntegratorXd >(
+                RungeKuttaCoefficients::get( CoefficientSets::rungeKuttaFehlberg78 ),
+                std::bind( &computeCountedKeplerOrbitStateDerivative,
+                           std::placeholders::_1,
+                           std::placeholders::_2,
+                           std::ref( numberOfEvaluations.at( testCase ) ) ),
+                0.0,
+                initialState,
+                1.0E-6,
+                10.0,
+                0.01,
+                1.0E-12,
+                1.0E-12 );
+
+        if( testCase == 2 )
+        {
+            eventSettings.at( 0 )->isTerminal_ = true;
+        }
+        std::shared_ptr< IntegrationEventLocator<> > eventLocator = std::make_shared< IntegrationEventLocator<> >( eventSettings );
+        eventLocator->initialize( 0.0, initialState );
+
+        while( integrator->getCurrentIndependentVariable( ) < 3.2 * orbitalPeriod )
+        {
+            integrator->performIntegrationStep( integrator->getNextStepSize( ) );
+
+            // Check dense output at start and end of step
+            if( testCase == 2 )
+            {
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( integrator->getDenseOutputState( integrator->getPreviousIndependentVariable( ) ),
+                                                   integrator->getPreviousState( ),
+                                                   std::numeric_limits< double >::epsilon( ) );
+            }
+            if( testCase > 0 )
+            {
+                if( eventLocator->processStep( integrator ) )
+                {
+                    break;
+                }
+            }
+        }
+        finalStates[ testCase ] = integrator->getCurrentState( );
+
+        // Check located events against analytical solution
+        if( testCase > 0 )
+        {
+            std::vector< LocatedIntegrationEvent<> > nodePassages = eventLocator->getLocatedEvents( "ascending_node" );
+            std::vector< LocatedIntegrationEvent<> > periapsisPassages = eventLocator->getLocatedEvents( "periapsis" );
+            BOOST_CHECK_EQUAL( nodePassages.size( ), ( testCase == 1 ) ? 3 : 1 );
+            BOOST_CHECK_EQUAL( periapsisPassages.size( ), ( testCase == 1 ) ? 3 : 0 );
+            for( unsigned int i = 0; i < nodePassages.size( ); i++ )
+            {
+                BOOST_CHECK_SMALL( nodePassages.at( i ).independentVariable_ - ( ascendingNodeTime + i * orbitalPeriod ), 1.0E-6 );
+                BOOST_CHECK_SMALL( nodePassages.at( i ).state_( 2 ), 1.0E-6 );
+                BOOST_CHECK_EQUAL( nodePassages.at( i ).isIncreasing_, true );
+            }
+            for( unsigned int i = 0; i < periapsisPassages.size( ); i++ )
+            {
+                BOOST_CHECK_SMALL( periapsisPassages.at( i ).independentVariable_ - ( i + 1 ) * orbitalPeriod, 1.0E-6 );
+            }
+            BOOST_CHECK_EQUAL( eventLocator->getTerminalEventIsLocated( ), ( testCase == 2 ) );
+        }
+    }
+
+    // Check that event location requires no additional state derivative evaluations, and does not modify the solution
+    BOOST_CHECK_EQUAL( numberOfEvaluations.at( 0 ), numberOfEvaluations.at( 1 ) );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( finalStates.at( 0 )( i ), finalStates.at( 1 )( i ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
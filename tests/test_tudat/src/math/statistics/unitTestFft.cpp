@@ -1,6 +1,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <cstdio>
 #include <iostream>
 
 #include <boost/format.hpp>
@@ -40,6 +41,70 @@ BOOST_AUTO_TEST_CASE( testFft )
         BOOST_CHECK_SMALL( ( backTransformedTimeDomainData[ i ] - timeDomainData[ i ] ) / timeDomainData[ i ], 2.0E-10 );
     }
 }
+
+BOOST_AUTO_TEST_CASE( testBatchedAndCachedFft )
+{
+    clearFftPlanCache( );
+
+    // Create set of time series of equal length
+    int numberOfSeries = 5;
+    int numberOfDataPoints = 1000;
+    std::vector< std::vector< double > > timeDomainData( numberOfSeries );
+    for( int i = 0; i < numberOfSeries; i++ )
+    {
+        timeDomainData[ i ].resize( numberOfDataPoints );
+        for( int j = 0; j < numberOfDataPoints; j++ )
+        {
+            timeDomainData[ i ][ j ] = std::sin( static_cast< double >( i + 3 ) * 2.0 * mathematical_constants::PI *
+                                                 static_cast< double >( j ) / static_cast< double >( numberOfDataPoints ) ) +
+                    static_cast< double >( i * j ) / 100.0 + 1.0;
+        }
+    }
+
+    // Transform series in batch, and one by one (twice, to check reuse of cached plan)
+    std::vector< std::vector< std::complex< double > > > batchedFrequencyDomainData =
+            performFftOfMultipleRealDataSeries( timeDomainData );
+    std::vector< std::vector< double > > batchedBackTransformedData =
+            performInverseFftToMultipleRealDataSeries( batchedFrequencyDomainData );
+    for( int k = 0; k < 2; k++ )
+    {
+        for( int i = 0; i < numberOfSeries; i++ )
+        {
+            std::vector< std::complex< double > > frequencyDomainData = performFftOfRealData( timeDomainData[ i ] );
+            BOOST_CHECK_EQUAL( frequencyDomainData.size( ), batchedFrequencyDomainData[ i ].size( ) );
+            for( unsigned int j = 0; j < frequencyDomainData.size( ); j++ )
+            {
+                BOOST_CHECK_SMALL( std::abs( frequencyDomainData[ j ] - batchedFrequencyDomainData[ i ][ j ] ), 1.0E-10 );
+            }
+
+            std::vector< double > backTransformedTimeDomainData = performInverseFftToRealData( frequencyDomainData );
+            BOOST_CHECK_EQUAL( backTransformedTimeDomainData.size( ), numberOfDataPoints );
+            for( int j = 0; j < numberOfDataPoints; j++ )
+            {
+                BOOST_CHECK_SMALL( backTransformedTimeDomainData[ j ] - timeDomainData[ i ][ j ], 1.0E-12 );
+                BOOST_CHECK_SMALL( batchedBackTransformedData[ i ][ j ] - timeDomainData[ i ][ j ], 1.0E-12 );
+            }
+        }
+    }
+
+    // Check that one plan is cached per size, series count and direction
+    BOOST_CHECK_EQUAL( getNumberOfCachedFftPlans( ), 4 );
+
+    // Check that inconsistent series lengths are rejected
+    timeDomainData[ 2 ].pop_back( );
+    BOOST_CHECK_THROW( performFftOfMultipleRealDataSeries( timeDomainData ), std::runtime_error );
+
+    // Check wisdom round trip
+    std::string wisdomFile = "fftwWisdomTest.dat";
+    BOOST_CHECK( exportFftwWisdomToFile( wisdomFile ) );
+    BOOST_CHECK( importFftwWisdomFromFile( wisdomFile ) );
+    std::remove( wisdomFile.c_str( ) );
+    BOOST_CHECK( !importFftwWisdomFromFile( wisdomFile ) );
+
+    clearFftPlanCache( );
+    BOOST_CHECK_EQUAL( getNumberOfCachedFftPlans( ), 0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -31,6 +31,7 @@
 #include "tudat/astro/electromagnetism/radiationPressureTargetModel.h"
 #include "tudat/astro/electromagnetism/reflectionLaw.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
+#include "tudat/astro/ephemerides/customEphemeris.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
 #include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/itrsToGcrsRotationModel.h"
@@ -2025,6 +2026,104 @@ BOOST_AUTO_TEST_CASE( test_DefaultSettingsDifferentBody )
     BOOST_CHECK_EQUAL( bodies.at( "Mars" )->getRotationalEphemeris( )->getTargetFrameOrientation( ), "IAU_Mars" );
 }
 
+//! Test the epoch caches of states and rotations retrieved from body ephemerides
+BOOST_AUTO_TEST_CASE( test_ephemerisCacheSetup )
+{
+    // Create body with ephemeris that counts the number of evaluations
+    int numberOfEphemerisCalls = 0;
+    std::function< Eigen::Vector6d( const double ) > stateFunction = [ & ]( const double time )
+    {
+        numberOfEphemerisCalls++;
+        return ( Eigen::Vector6d( ) << 1.0E7 + time, 2.0E7, -time, 1.0, 0.0, -1.0 ).finished( );
+    };
+
+    SystemOfBodies bodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ephemerides::CustomEphemeris<> >( stateFunction, "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Vehicle" )->setRotationalEphemeris( std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+            0.2, 0.4, 1.3, 2.0E-5, 0.0, "ECLIPJ2000", "VehicleFixed" ) );
+    bodies.processBodyFrameDefinitions( );
+
+    // Alternate between two epochs (as in light-time iterations) without cache
+    std::shared_ptr< Body > vehicle = bodies.at( "Vehicle" );
+    const double transmissionTime = 1000.0;
+    const double receptionTime = 1010.0;
+    for( int i = 0; i < 5; i++ )
+    {
+        vehicle->getStateInBaseFrameFromEphemeris( transmissionTime );
+        vehicle->getStateInBaseFrameFromEphemeris( receptionTime );
+    }
+    BOOST_CHECK_EQUAL( numberOfEphemerisCalls, 10 );
+    BOOST_CHECK_EQUAL( bodies.getEphemerisCacheStatistics( ).stateMisses, 0 );
+
+    // Repeat with cache, and check that ephemeris is evaluated once per epoch
+    bodies.setEphemerisCacheSize( 4 );
+    numberOfEphemerisCalls = 0;
+    Eigen::Vector6d transmitterState, receiverState;
+    for( int i = 0; i < 5; i++ )
+    {
+        transmitterState = vehicle->getStateInBaseFrameFromEphemeris( transmissionTime );
+        receiverState = vehicle->getStateInBaseFrameFromEphemeris( receptionTime );
+    }
+    BOOST_CHECK_EQUAL( numberOfEphemerisCalls, 2 );
+    Eigen::Vector6d expectedState = stateFunction( transmissionTime );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( transmitterState, expectedState, 0.0 );
+    expectedState = stateFunction( receptionTime );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( receiverState, expectedState, 0.0 );
+    BOOST_CHECK_EQUAL( bodies.getEphemerisCacheStatistics( ).stateMisses, 2 );
+    BOOST_CHECK_EQUAL( bodies.getEphemerisCacheStatistics( ).stateHits, 8 );
+
+    // Check that oldest entry is overwritten when cache is full
+    for( int i = 0; i < 4; i++ )
+    {
+        vehicle->getStateInBaseFrameFromEphemeris( 2000.0 + i );
+    }
+    bodies.resetEphemerisCacheStatistics( );
+    vehicle->getStateInBaseFrameFromEphemeris( transmissionTime );
+    vehicle->getStateInBaseFrameFromEphemeris( 2003.0 );
+    BOOST_CHECK_EQUAL( bodies.getEphemerisCacheStatistics( ).stateMisses, 1 );
+    BOOST_CHECK_EQUAL( bodies.getEphemerisCacheStatistics( ).stateHits, 1 );
+
+    // Check that cache is cleared when ephemeris is reset
+    vehicle->setEphemeris( std::make_shared< ephemerides::CustomEphemeris<> >(
+            [ = ]( const double time ) { return 2.0 * stateFunction( time ); }, "SSB", "ECLIPJ2000" ) );
+    transmitterState = vehicle->getStateInBaseFrameFromEphemeris( transmissionTime );
+    expectedState = 2.0 * stateFunction( transmissionTime );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( transmitterState, expectedState, 0.0 );
+
+    // Check cached rotations, and transformation of body-fixed states
+    std::shared_ptr< ephemerides::RotationalEphemeris > rotationModel = vehicle->getRotationalEphemeris( );
+    Eigen::Vector6d bodyFixedState = ( Eigen::Vector6d( ) << 6.0E6, -2.0E6, 1.0E6, 10.0, 20.0, -5.0 ).finished( );
+    Eigen::Matrix3d expectedRotationMatrix = rotationModel->getRotationMatrixToTargetFrame( transmissionTime );
+    Eigen::Matrix3d expectedRotationMatrixDerivative = rotationModel->getDerivativeOfRotationToTargetFrame( receptionTime );
+    Eigen::Vector6d expectedInertialState =
+            ephemerides::transformStateToInertialOrientation( bodyFixedState, receptionTime, rotationModel );
+    for( int i = 0; i < 3; i++ )
+    {
+        vehicle->setCurrentRotationToLocalFrameFromEphemeris( transmissionTime );
+        Eigen::Matrix3d rotationMatrix = vehicle->getCurrentRotationToLocalFrame( ).toRotationMatrix( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( rotationMatrix, expectedRotationMatrix, std::numeric_limits< double >::epsilon( ) );
+
+        vehicle->setCurrentRotationalStateToLocalFrameFromEphemeris( receptionTime );
+        Eigen::Matrix3d rotationMatrixDerivative = vehicle->getCurrentRotationMatrixDerivativeToLocalFrame( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                rotationMatrixDerivative, expectedRotationMatrixDerivative, std::numeric_limits< double >::epsilon( ) );
+
+        Eigen::Vector6d inertialState = vehicle->transformStateToGlobalFrameFromEphemeris( bodyFixedState, receptionTime );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( inertialState, expectedInertialState, 1.0E-14 );
+    }
+    BOOST_CHECK_EQUAL( vehicle->getEphemerisCacheStatistics( ).rotationMisses, 2 );
+    BOOST_CHECK_EQUAL( vehicle->getEphemerisCacheStatistics( ).rotationHits, 7 );
+
+    // Check deactivation of cache
+    bodies.setEphemerisCacheSize( 0 );
+    bodies.resetEphemerisCacheStatistics( );
+    vehicle->setCurrentRotationToLocalFrameFromEphemeris( transmissionTime );
+    vehicle->getStateInBaseFrameFromEphemeris( receptionTime );
+    BOOST_CHECK_EQUAL( bodies.getEphemerisCacheStatistics( ).rotationHits + bodies.getEphemerisCacheStatistics( ).rotationMisses, 0 );
+    BOOST_CHECK_EQUAL( bodies.getEphemerisCacheStatistics( ).stateHits + bodies.getEphemerisCacheStatistics( ).stateMisses, 0 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }  // namespace unit_tests
@@ -0,0 +1,160 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_parallel_body_creation )
+
+//! Function to create settings for an environment with dependencies between models, that does not require Spice kernels
+BodyListSettings getParallelCreationTestBodySettings( )
+{
+    BodyListSettings bodySettings = BodyListSettings( "SSB", "ECLIPJ2000" );
+    const double sunGravitationalParameter = 1.32712440018E20;
+
+    bodySettings.addSettings( "Sun" );
+    bodySettings.at( "Sun" )->ephemerisSettings = constantEphemerisSettings( Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings.at( "Sun" )->gravityFieldSettings = centralGravitySettings( sunGravitationalParameter );
+
+    // Create planets with tabulated ephemerides, simple rotation models and spherical harmonic gravity fields, for which the
+    // frame is taken from the rotation model
+    for( int i = 0; i < 8; i++ )
+    {
+        std::string planetName = "Planet" + std::to_string( i );
+        Eigen::Vector6d keplerElements;
+        keplerElements << ( 0.5 + 0.3 * i ) * 1.496E11, 0.01 * i, 0.02 * i, 0.1 * i, 0.2 * i, 0.3 * i;
+
+        bodySettings.addSettings( planetName );
+        bodySettings.at( planetName )->ephemerisSettings = tabulatedEphemerisSettings(
+                keplerEphemerisSettings( keplerElements, 0.0, sunGravitationalParameter, "Sun", "ECLIPJ2000" ), 0.0, 1.0E7, 3600.0 );
+        bodySettings.at( planetName )->rotationModelSettings = simpleRotationModelSettings(
+                "ECLIPJ2000", "IAU_" + planetName, Eigen::Matrix3d::Identity( ), 0.0, 1.0E-5 * ( i + 1 ) );
+        Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+        Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+        cosineCoefficients( 0, 0 ) = 1.0;
+        cosineCoefficients( 2, 0 ) = -1.0E-3 * ( i + 1 );
+        sineCoefficients( 2, 2 ) = 1.0E-6 * ( i + 1 );
+        bodySettings.at( planetName )->gravityFieldSettings =
+                sphericalHarmonicsGravitySettings( 1.0E14 * ( i + 1 ), 6.0E6, cosineCoefficients, sineCoefficients, "" );
+        bodySettings.at( planetName )->shapeModelSettings = sphericalBodyShapeSettings( 6.0E6 );
+    }
+
+    // Create moon with rotation model that depends on its ephemeris
+    Eigen::Vector6d moonKeplerElements;
+    moonKeplerElements << 4.0E8, 0.05, 0.1, 0.2, 0.3, 0.4;
+    bodySettings.addSettings( "Moon" );
+    bodySettings.at( "Moon" )->ephemerisSettings =
+            keplerEphemerisSettings( moonKeplerElements, 0.0, 1.0E14, "Planet0", "ECLIPJ2000" );
+    bodySettings.at( "Moon" )->rotationModelSettings = synchronousRotationModelSettings( "Planet0", "ECLIPJ2000", "IAU_Moon" );
+    bodySettings.at( "Moon" )->gravityFieldSettings = centralGravitySettings( 4.9E12 );
+
+    return bodySettings;
+}
+
+//! Test whether environment created using multiple threads is identical to that created sequentially
+BOOST_AUTO_TEST_CASE( testParallelBodyCreation )
+{
+    BodyListSettings bodySettings = getParallelCreationTestBodySettings( );
+    BOOST_CHECK_EQUAL( bodySettings.getNumberOfCreationThreads( ), 1 );
+    SystemOfBodies sequentialBodies = createSystemOfBodies( bodySettings );
+
+    bodySettings.setNumberOfCreationThreads( 4 );
+    SystemOfBodies parallelBodies = createSystemOfBodies( bodySettings );
+
+    BOOST_CHECK_EQUAL( sequentialBodies.getMap( ).size( ), parallelBodies.getMap( ).size( ) );
+    for( auto bodyIterator: sequentialBodies.getMap( ) )
+    {
+        const std::string bodyName = bodyIterator.first;
+        std::shared_ptr< Body > sequentialBody = bodyIterator.second;
+        std::shared_ptr< Body > parallelBody = parallelBodies.at( bodyName );
+
+        BOOST_CHECK( sequentialBody->getEphemeris( ) != parallelBody->getEphemeris( ) );
+        BOOST_CHECK_EQUAL( sequentialBody->getGravityFieldModel( )->getGravitationalParameter( ),
+                           parallelBody->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+        if( bodyName != "Sun" )
+        {
+            BOOST_CHECK_EQUAL( sequentialBody->getRotationalEphemeris( )->getTargetFrameOrientation( ),
+                               parallelBody->getRotationalEphemeris( )->getTargetFrameOrientation( ) );
+        }
+        if( bodyName.substr( 0, 6 ) == "Planet" )
+        {
+            std::shared_ptr< gravitation::SphericalHarmonicsGravityField > sequentialGravityField =
+                    std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >( sequentialBody->getGravityFieldModel( ) );
+            std::shared_ptr< gravitation::SphericalHarmonicsGravityField > parallelGravityField =
+                    std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >( parallelBody->getGravityFieldModel( ) );
+            BOOST_CHECK( parallelGravityField != nullptr );
+            BOOST_CHECK_EQUAL( parallelGravityField->getFixedReferenceFrame( ), "IAU_" + bodyName );
+            Eigen::MatrixXd cosineCoefficientDifference =
+                    sequentialGravityField->getCosineCoefficients( ) - parallelGravityField->getCosineCoefficients( );
+            BOOST_CHECK_EQUAL( cosineCoefficientDifference.norm( ), 0.0 );
+        }
+
+        for( double testTime = 1.0E5; testTime < 9.0E6; testTime += 1.0E6 )
+        {
+            Eigen::Vector6d sequentialState = sequentialBody->getStateInBaseFrameFromEphemeris< double, double >( testTime );
+            Eigen::Vector6d parallelState = parallelBody->getStateInBaseFrameFromEphemeris< double, double >( testTime );
+            for( int i = 0; i < 6; i++ )
+            {
+                BOOST_CHECK_EQUAL( sequentialState( i ), parallelState( i ) );
+            }
+
+            if( bodyName != "Sun" )
+            {
+                sequentialBodies.at( bodyName )->setStateFromEphemeris< double, double >( testTime );
+                parallelBodies.at( bodyName )->setStateFromEphemeris< double, double >( testTime );
+                sequentialBodies.at( "Planet0" )->setStateFromEphemeris< double, double >( testTime );
+                parallelBodies.at( "Planet0" )->setStateFromEphemeris< double, double >( testTime );
+
+                Eigen::Matrix3d sequentialRotation = sequentialBody->getRotationalEphemeris( )->getRotationMatrixToTargetFrame( testTime );
+                Eigen::Matrix3d parallelRotation = parallelBody->getRotationalEphemeris( )->getRotationMatrixToTargetFrame( testTime );
+                for( int i = 0; i < 3; i++ )
+                {
+                    for( int j = 0; j < 3; j++ )
+                    {
+                        BOOST_CHECK_SMALL( sequentialRotation( i, j ) - parallelRotation( i, j ), 1.0E-15 );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//! Test whether errors in model creation are propagated when using multiple threads
+BOOST_AUTO_TEST_CASE( testParallelBodyCreationErrors )
+{
+    BodyListSettings bodySettings = getParallelCreationTestBodySettings( );
+    BOOST_CHECK_THROW( bodySettings.setNumberOfCreationThreads( 0 ), std::runtime_error );
+    bodySettings.setNumberOfCreationThreads( 4 );
+
+    // Remove rotation model of body with spherical harmonic gravity field without frame
+    bodySettings.at( "Planet3" )->rotationModelSettings = nullptr;
+    BOOST_CHECK_THROW( createSystemOfBodies( bodySettings ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+
+}  // namespace tudat
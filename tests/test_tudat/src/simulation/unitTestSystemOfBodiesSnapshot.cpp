@@ -0,0 +1,221 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/simulation/environment_setup/createBodies.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_system_of_bodies_snapshot )
+
+//! Function to create settings for a small environment that does not require Spice kernels
+BodyListSettings getSnapshotTestBodySettings( )
+{
+    BodyListSettings bodySettings = BodyListSettings( "SSB", "ECLIPJ2000" );
+
+    Eigen::Vector6d sunState = Eigen::Vector6d::Zero( );
+    bodySettings.addSettings( "Sun" );
+    bodySettings.at( "Sun" )->ephemerisSettings = constantEphemerisSettings( sunState, "SSB", "ECLIPJ2000" );
+    bodySettings.at( "Sun" )->gravityFieldSettings = centralGravitySettings( 1.32712440018E20 );
+
+    Eigen::Vector6d earthKeplerElements;
+    earthKeplerElements << 1.496E11, 0.0167, 0.1, 1.0, 2.0, 3.0;
+    bodySettings.addSettings( "Earth" );
+    bodySettings.at( "Earth" )->ephemerisSettings =
+            keplerEphemerisSettings( earthKeplerElements, 0.0, 1.32712440018E20, "Sun", "ECLIPJ2000" );
+    bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( 3.986004418E14 );
+    bodySettings.at( "Earth" )->rotationModelSettings = simpleRotationModelSettings(
+            "ECLIPJ2000", "IAU_Earth", Eigen::Matrix3d::Identity( ), 0.0, 2.0 * mathematical_constants::PI / 86164.0 );
+    bodySettings.at( "Earth" )->shapeModelSettings = sphericalBodyShapeSettings( 6378.0E3 );
+    bodySettings.at( "Earth" )->atmosphereSettings = exponentialAtmosphereSettings( 7.2E3, 1.225 );
+
+    // Moon with models that hold evaluation state (interpolator and spherical harmonics caches)
+    Eigen::Vector6d moonKeplerElements;
+    moonKeplerElements << 3.844E8, 0.0549, 0.09, 0.5, 1.5, 2.5;
+    bodySettings.addSettings( "Moon" );
+    bodySettings.at( "Moon" )->ephemerisSettings =
+            tabulatedEphemerisSettings( keplerEphemerisSettings( moonKeplerElements, 0.0, 3.986004418E14, "Earth", "ECLIPJ2000" ),
+                                        -1.0E6,
+                                        3.2E7,
+                                        1.0E4 );
+    bodySettings.at( "Moon" )->rotationModelSettings = simpleRotationModelSettings(
+            "ECLIPJ2000", "IAU_Moon", Eigen::Matrix3d::Identity( ), 0.0, 2.0 * mathematical_constants::PI / 2360591.5 );
+    Eigen::MatrixXd moonCosineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+    Eigen::MatrixXd moonSineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+    moonCosineCoefficients( 0, 0 ) = 1.0;
+    moonCosineCoefficients( 2, 0 ) = -9.09E-5;
+    moonCosineCoefficients( 2, 2 ) = 3.47E-5;
+    moonCosineCoefficients( 3, 1 ) = 2.93E-5;
+    moonSineCoefficients( 3, 1 ) = 4.0E-6;
+    moonCosineCoefficients( 4, 3 ) = -6.0E-6;
+    moonSineCoefficients( 4, 3 ) = 1.5E-6;
+    bodySettings.at( "Moon" )->gravityFieldSettings =
+            sphericalHarmonicsGravitySettings( 4.9028E12, 1738.0E3, moonCosineCoefficients, moonSineCoefficients, "IAU_Moon" );
+
+    bodySettings.addSettings( "Vehicle" );
+    bodySettings.at( "Vehicle" )->constantMass = 500.0;
+
+    return bodySettings;
+}
+
+//! Function to retrieve a body-fixed position near the Moon at which its gravity field is evaluated in the tests
+Eigen::Vector3d getSnapshotTestGravityEvaluationPosition( const int index )
+{
+    return 2.0E6 * ( Eigen::Vector3d( ) << std::cos( 0.01 * index ), std::sin( 0.01 * index ), 0.3 * std::sin( 0.003 * index ) )
+                           .finished( );
+}
+
+//! Test whether clones share the immutable models of the prototype, and recreate all other models and bodies
+BOOST_AUTO_TEST_CASE( testSnapshotModelSharing )
+{
+    SystemOfBodiesSnapshot< > snapshot( getSnapshotTestBodySettings( ) );
+    const SystemOfBodies& prototypeBodies = snapshot.getPrototypeBodies( );
+
+    SystemOfBodies clonedBodies = snapshot.clone( );
+    BOOST_CHECK_EQUAL( clonedBodies.getMap( ).size( ), prototypeBodies.getMap( ).size( ) );
+
+    for( auto bodyName: { "Sun", "Earth", "Moon", "Vehicle" } )
+    {
+        // Body objects must never be shared
+        BOOST_CHECK( clonedBodies.at( bodyName ) != prototypeBodies.at( bodyName ) );
+        BOOST_CHECK( clonedBodies.at( bodyName )->getMassProperties( ) != prototypeBodies.at( bodyName )->getMassProperties( ) );
+    }
+
+    // Check which models are shared
+    BOOST_CHECK( clonedBodies.at( "Sun" )->getEphemeris( ) == prototypeBodies.at( "Sun" )->getEphemeris( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getEphemeris( ) != prototypeBodies.at( "Earth" )->getEphemeris( ) );
+    BOOST_CHECK( clonedBodies.at( "Sun" )->getGravityFieldModel( ) == prototypeBodies.at( "Sun" )->getGravityFieldModel( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getGravityFieldModel( ) == prototypeBodies.at( "Earth" )->getGravityFieldModel( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getRotationalEphemeris( ) == prototypeBodies.at( "Earth" )->getRotationalEphemeris( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getShapeModel( ) == prototypeBodies.at( "Earth" )->getShapeModel( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getAtmosphereModel( ) == prototypeBodies.at( "Earth" )->getAtmosphereModel( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Vehicle" )->getBodyMass( ), 500.0 );
+
+    // Models that modify internal state on evaluation must not be shared
+    BOOST_CHECK( clonedBodies.at( "Moon" )->getEphemeris( ) != prototypeBodies.at( "Moon" )->getEphemeris( ) );
+    BOOST_CHECK( clonedBodies.at( "Moon" )->getGravityFieldModel( ) != prototypeBodies.at( "Moon" )->getGravityFieldModel( ) );
+
+    // Check that the per-run state of a clone is independent of that of the prototype
+    Eigen::Vector6d vehicleState = Eigen::Vector6d::Constant( 1.0 );
+    prototypeBodies.at( "Vehicle" )->setState( Eigen::Vector6d::Zero( ) );
+    clonedBodies.at( "Vehicle" )->setState( vehicleState );
+    BOOST_CHECK_EQUAL( ( prototypeBodies.at( "Vehicle" )->getState( ) - Eigen::Vector6d::Zero( ) ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( clonedBodies.at( "Vehicle" )->getState( ) - vehicleState ).norm( ), 0.0 );
+
+    // Check that global frame states of clones match those of the prototype
+    for( double testTime = 0.0; testTime < 1.0E8; testTime += 1.0E7 )
+    {
+        Eigen::Vector6d prototypeState = prototypeBodies.at( "Earth" )->getStateInBaseFrameFromEphemeris< double, double >( testTime );
+        Eigen::Vector6d clonedState = clonedBodies.at( "Earth" )->getStateInBaseFrameFromEphemeris< double, double >( testTime );
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_EQUAL( prototypeState( i ), clonedState( i ) );
+        }
+    }
+
+    // Check that models of a plain createSystemOfBodies call are not shared
+    SystemOfBodies newBodies = createSystemOfBodies( snapshot.getBodySettings( ) );
+    BOOST_CHECK( newBodies.at( "Sun" )->getEphemeris( ) != prototypeBodies.at( "Sun" )->getEphemeris( ) );
+    BOOST_CHECK( newBodies.at( "Earth" )->getGravityFieldModel( ) != prototypeBodies.at( "Earth" )->getGravityFieldModel( ) );
+}
+
+//! Test whether clones can be created and used in parallel, including models that hold evaluation state
+BOOST_AUTO_TEST_CASE( testSnapshotParallelClones )
+{
+    SystemOfBodiesSnapshot< > snapshot( getSnapshotTestBodySettings( ) );
+
+    const int numberOfThreads = 4;
+    const int numberOfEvaluations = 1000;
+    std::vector< double > testTimes;
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        testTimes.push_back( static_cast< double >( i ) * 3.0E4 );
+    }
+
+    // Compute reference values in prototype
+    std::shared_ptr< Body > prototypeEarth = snapshot.getPrototypeBodies( ).at( "Earth" );
+    std::shared_ptr< Body > prototypeMoon = snapshot.getPrototypeBodies( ).at( "Moon" );
+    std::vector< Eigen::Vector6d > referenceStates;
+    std::vector< Eigen::Matrix3d > referenceRotations;
+    std::vector< Eigen::Vector6d > referenceMoonStates;
+    std::vector< Eigen::Vector3d > referenceMoonGravity;
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        referenceStates.push_back( prototypeEarth->getStateInBaseFrameFromEphemeris< double, double >( testTimes.at( i ) ) );
+        referenceRotations.push_back( prototypeEarth->getRotationalEphemeris( )->getRotationMatrixToTargetFrame( testTimes.at( i ) ) );
+        referenceMoonStates.push_back( prototypeMoon->getEphemeris( )->getCartesianState( testTimes.at( i ) ) );
+        referenceMoonGravity.push_back( prototypeMoon->getGravityFieldModel( )->getGradientOfPotential(
+                getSnapshotTestGravityEvaluationPosition( i ) ) );
+    }
+
+    // Create clones and evaluate their states concurrently
+    std::vector< std::vector< Eigen::Vector6d > > threadStates( numberOfThreads );
+    std::vector< std::vector< Eigen::Matrix3d > > threadRotations( numberOfThreads );
+    std::vector< std::vector< Eigen::Vector6d > > threadMoonStates( numberOfThreads );
+    std::vector< std::vector< Eigen::Vector3d > > threadMoonGravity( numberOfThreads );
+    std::vector< std::thread > threads;
+    for( int j = 0; j < numberOfThreads; j++ )
+    {
+        threads.push_back( std::thread( [ &, j ]( ) {
+            SystemOfBodies clonedBodies = snapshot.clone( );
+            for( unsigned int i = 0; i < testTimes.size( ); i++ )
+            {
+                threadStates[ j ].push_back(
+                        clonedBodies.at( "Earth" )->getStateInBaseFrameFromEphemeris< double, double >( testTimes.at( i ) ) );
+                threadRotations[ j ].push_back(
+                        clonedBodies.at( "Earth" )->getRotationalEphemeris( )->getRotationMatrixToTargetFrame( testTimes.at( i ) ) );
+                threadMoonStates[ j ].push_back( clonedBodies.at( "Moon" )->getEphemeris( )->getCartesianState( testTimes.at( i ) ) );
+                threadMoonGravity[ j ].push_back( clonedBodies.at( "Moon" )->getGravityFieldModel( )->getGradientOfPotential(
+                        getSnapshotTestGravityEvaluationPosition( i ) ) );
+            }
+        } ) );
+    }
+    for( unsigned int j = 0; j < threads.size( ); j++ )
+    {
+        threads.at( j ).join( );
+    }
+
+    for( int j = 0; j < numberOfThreads; j++ )
+    {
+        BOOST_CHECK_EQUAL( threadStates[ j ].size( ), testTimes.size( ) );
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( threadStates[ j ].at( i ), referenceStates.at( i ), 1.0E-15 );
+            for( int k = 0; k < 3; k++ )
+            {
+                for( int l = 0; l < 3; l++ )
+                {
+                    BOOST_CHECK_SMALL( threadRotations[ j ].at( i )( k, l ) - referenceRotations.at( i )( k, l ), 1.0E-15 );
+                }
+            }
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( threadMoonStates[ j ].at( i ), referenceMoonStates.at( i ), 1.0E-15 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( threadMoonGravity[ j ].at( i ), referenceMoonGravity.at( i ), 1.0E-15 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}  // namespace unit_tests
+
+}  // namespace tudat